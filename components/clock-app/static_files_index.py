@@ -0,0 +1,404 @@
+#!/usr/bin/env python3
+"""Generate a perfect hash index for the embedded web assets.
+
+Reads the downloaded static_files.h, takes the asset paths in the order they
+appear in static_files::files[], and writes static_files_index.h: a
+hash-and-displace table that maps every path to its index with two hashes and
+one string compare, however many assets the web UI ships, plus a strong ETag
+for every asset computed from its contents.
+
+With --brotli, every gzip asset is also recompressed with brotli (needs the
+brotli Python module) and kept when it comes out smaller, so the firmware can
+pick the encoding from the request's Accept-Encoding.
+
+Lookup (see static_files_index::find):
+    bucket = hash(path, 0) % num_buckets
+    slot   = hash(path, displacements[bucket]) % num_slots
+    index  = slots[slot]            -1 if empty
+and the caller confirms files[index].path equals the path.
+
+With --synthetic N, static_files.h is first written with N made-up assets,
+for benchmarks.
+
+Usage:
+    static_files_index.py [--brotli] static_files.h static_files_index.h
+    static_files_index.py --synthetic N static_files.h static_files_index.h
+    static_files_index.py --bench 10 100 500
+"""
+
+import argparse
+import gzip
+import hashlib
+import os
+import re
+import subprocess
+import sys
+import tempfile
+
+FNV_OFFSET = 0x811C9DC5
+FNV_PRIME = 0x01000193
+MAX_DISPLACEMENT = 0xFFFF
+
+
+def fnv1a(data, seed):
+    h = (FNV_OFFSET ^ (seed * 0x9E3779B9)) & 0xFFFFFFFF
+    for byte in data:
+        h ^= byte
+        h = (h * FNV_PRIME) & 0xFFFFFFFF
+    # FNV only carries low bits upwards; fold the high bits back down so the
+    # low bits used as a table index depend on the whole seed
+    h ^= h >> 16
+    h = (h * 0x85EBCA6B) & 0xFFFFFFFF
+    h ^= h >> 13
+    return h
+
+
+def next_pow2(n):
+    size = 1
+    while size < n:
+        size <<= 1
+    return size
+
+
+def find_closing(text, start):
+    """Index of the brace closing the one at text[start], skipping literals."""
+    depth = 0
+    i = start
+    while i < len(text):
+        c = text[i]
+        if c in "\"'":
+            i += 1
+            while i < len(text) and text[i] != c:
+                i += 2 if text[i] == "\\" else 1
+        elif c == "{":
+            depth += 1
+        elif c == "}":
+            depth -= 1
+            if depth == 0:
+                return i
+        i += 1
+    raise ValueError("unbalanced braces in static_files.h")
+
+
+def parse_byte_arrays(header):
+    """Byte arrays by name, for initializers made of integer literals only."""
+    arrays = {}
+    for match in re.finditer(r"\b(\w+)\s*\[[^\]]*\]\s*=\s*\{([^{}]*)\}", header):
+        try:
+            arrays[match.group(1)] = bytes(int(tok.strip(), 16 if tok.strip().lower().startswith("0x") else 10)
+                for tok in match.group(2).split(",") if tok.strip())
+        except ValueError:
+            pass
+    return arrays
+
+
+def parse_files(header):
+    """(path, content) for each asset, in files[] order.
+
+    The path is the only string literal in an entry that starts with '/';
+    MIME types ("text/html") never do. The content is the byte array the
+    entry points to, or the entry's own text when the contents are inline,
+    which still changes whenever the asset does.
+    """
+    match = re.search(r"\bfiles\s*\[\s*\]\s*=\s*\{", header)
+    if not match:
+        return []
+
+    arrays = parse_byte_arrays(header)
+    body_start = match.end() - 1
+    body_end = find_closing(header, body_start)
+
+    files = []
+    i = body_start + 1
+    while i < body_end:
+        if header[i] != "{":
+            i += 1
+            continue
+        end = find_closing(header, i)
+        entry = header[i + 1:end]
+        i = end + 1
+
+        path = re.search(r'"(/(?:[^"\\]|\\.)*)"', entry)
+        if not path:
+            raise ValueError("files[] entry without a path: {%s}" % entry[:60])
+
+        content = entry.encode()
+        for name in re.findall(r"\b[A-Za-z_]\w*\b", entry):
+            if name in arrays:
+                content = arrays[name]
+                break
+        files.append((path.group(1), content))
+
+    count = re.search(r"\bnum_of_files\s*=\s*(\d+)", header)
+    if count and int(count.group(1)) != len(files):
+        raise ValueError("found %d files but num_of_files is %s" % (len(files), count.group(1)))
+    return files
+
+
+def etag(content):
+    """Strong entity tag, quoted as it goes on the wire."""
+    return '"%s"' % hashlib.sha256(content).hexdigest()[:16]
+
+
+def build(paths):
+    """Return (displacements, slots) for a hash-and-displace table."""
+    keys = [p.encode() for p in paths]
+    if len(set(keys)) != len(keys):
+        raise ValueError("duplicate asset path")
+
+    num_slots = next_pow2(max(1, len(keys)))
+    num_buckets = next_pow2(max(1, (len(keys) + 1) // 2))
+
+    buckets = [[] for _ in range(num_buckets)]
+    for index, key in enumerate(keys):
+        buckets[fnv1a(key, 0) % num_buckets].append(index)
+
+    displacements = [0] * num_buckets
+    slots = [-1] * num_slots
+
+    # Largest buckets first, while the table is still mostly empty
+    for bucket in sorted(range(num_buckets), key=lambda b: -len(buckets[b])):
+        members = buckets[bucket]
+        if not members:
+            continue
+
+        for d in range(1, MAX_DISPLACEMENT + 1):
+            placed = [fnv1a(keys[i], d) % num_slots for i in members]
+            if len(set(placed)) == len(placed) and all(slots[s] == -1 for s in placed):
+                for i, s in zip(members, placed):
+                    slots[s] = i
+                displacements[bucket] = d
+                break
+        else:
+            raise ValueError("no displacement found for bucket %d" % bucket)
+
+    return displacements, slots
+
+
+def format_array(values, per_line=16):
+    lines = []
+    for i in range(0, len(values), per_line):
+        lines.append("    " + ", ".join(str(v) for v in values[i:i + per_line]) + ",")
+    return "\n".join(lines)
+
+
+def recompress_brotli(files):
+    """Brotli bodies by file index, where one could be made and is smaller."""
+    try:
+        import brotli
+    except ImportError:
+        print("static_files_index: brotli module not available, serving gzip only", file=sys.stderr)
+        return {}
+
+    encoded = {}
+    for index, (path, content) in enumerate(files):
+        try:
+            plain = gzip.decompress(content)
+        except (OSError, EOFError):
+            continue    # Inline or not gzip; nothing to recompress
+        body = brotli.compress(plain, quality=11)
+        if len(body) < len(content):
+            encoded[index] = body
+    return encoded
+
+
+def format_bytes(data, per_line=16):
+    return "\n".join("    " + ", ".join("0x%02x" % b for b in data[i:i + per_line]) + ","
+        for i in range(0, len(data), per_line))
+
+
+def render_brotli(files, encoded):
+    arrays = "".join("constexpr uint8_t brotli_%d[] = {\n%s\n};\n\n" % (index, format_bytes(body))
+        for index, body in sorted(encoded.items()))
+
+    variants = []
+    for index in range(len(files)):
+        if index in encoded:
+            variants.append('    {{ brotli_{0}, sizeof(brotli_{0}), "{1}" }},'.format(
+                index, etag(encoded[index]).replace('"', '\\"')))
+        else:
+            variants.append("    { nullptr, 0, nullptr },")
+
+    return """// Brotli encoding of each file, or nullptr where it was not built
+{arrays}constexpr encoding brotli[{count}] = {{
+{variants}
+}};
+""".format(arrays=arrays, count=max(1, len(files)), variants="\n".join(variants) or "    { nullptr, 0, nullptr },")
+
+
+def render(files, encoded):
+    paths = [path for path, _ in files]
+    displacements, slots = build(paths)
+    return """#pragma once
+// Generated by static_files_index.py from static_files.h; do not edit
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace static_files_index {{
+
+constexpr uint32_t num_files = {num_files};
+constexpr uint32_t num_buckets = {num_buckets};
+constexpr uint32_t num_slots = {num_slots};
+
+constexpr uint16_t displacements[num_buckets] = {{
+{displacements}
+}};
+
+constexpr int16_t slots[num_slots] = {{
+{slots}
+}};
+
+// Strong ETag of each file's contents, in static_files::files order
+constexpr const char* etags[{etag_count}] = {{
+{etags}
+}};
+
+struct encoding {{
+    const uint8_t* contents;
+    size_t size;
+    const char* etag;
+}};
+
+{brotli}
+constexpr uint32_t hash(const char* path, size_t len, uint32_t seed) {{
+    uint32_t h = {offset:#010x}u ^ (seed * 0x9e3779b9u);
+    for (size_t i = 0; i < len; i++) {{
+        h ^= (uint8_t)path[i];
+        h *= {prime:#010x}u;
+    }}
+    h ^= h >> 16;
+    h *= 0x85ebca6bu;
+    h ^= h >> 13;
+    return h;
+}}
+
+// Candidate index into static_files::files for a path, or -1
+constexpr int find(const char* path, size_t len) {{
+    uint32_t bucket = hash(path, len, 0) & (num_buckets - 1);
+    uint32_t slot = hash(path, len, displacements[bucket]) & (num_slots - 1);
+    return slots[slot];
+}}
+
+}}  // namespace static_files_index
+""".format(
+        num_files=len(paths),
+        num_buckets=len(displacements),
+        num_slots=len(slots),
+        displacements=format_array(displacements),
+        slots=format_array(slots),
+        etag_count=max(1, len(files)),
+        etags="\n".join('    "%s",' % etag(content).replace('"', '\\"') for _, content in files) or "    nullptr,",
+        brotli=render_brotli(files, encoded),
+        offset=FNV_OFFSET,
+        prime=FNV_PRIME,
+    )
+
+
+def synthetic_header(count):
+    """A static_files.h of count assets with the path shapes of a Vite build."""
+    entries = "\n".join('        { "/assets/chunk-%04d.%08x.js", asset_body, sizeof(asset_body), '
+        '"application/javascript" },' % (i, i * 2654435761 & 0xFFFFFFFF) for i in range(count))
+    return """#pragma once
+// Generated by static_files_index.py --synthetic; %d made-up assets
+#include <stddef.h>
+
+namespace static_files {
+    struct file {
+        const char* path;
+        const unsigned char* contents;
+        size_t size;
+        const char* type;
+    };
+
+    inline unsigned char asset_body[64];
+
+    const file files[] = {
+%s
+    };
+    const int num_of_files = %d;
+}
+""" % (count, entries, count)
+
+
+def write_if_changed(path, content):
+    """Write content unless the file already holds it, so dependents don't rebuild."""
+    try:
+        with open(path, encoding="utf-8") as f:
+            if f.read() == content:
+                return False
+    except OSError:
+        pass
+
+    with open(path, "w", encoding="utf-8") as f:
+        f.write(content)
+    return True
+
+
+def bench(sizes):
+    """Time lookups at each size with the host benchmark.
+
+    The interpreter says nothing about the cost on the device, so every size
+    is indexed as a synthetic UI and timed by test/host/
+    bench_static_files_index.cpp, built with $CXX (default c++).
+    """
+    source = os.path.join(os.path.dirname(os.path.abspath(__file__)), "..", "..", "test", "host",
+        "bench_static_files_index.cpp")
+    if not os.path.exists(source):
+        print("static_files_index: %s not found" % source, file=sys.stderr)
+        return 1
+
+    compiler = os.environ.get("CXX", "c++")
+    for count in sizes:
+        with tempfile.TemporaryDirectory() as tmp:
+            header = synthetic_header(count)
+            write_if_changed(os.path.join(tmp, "static_files.h"), header)
+            write_if_changed(os.path.join(tmp, "static_files_index.h"), render(parse_files(header), {}))
+
+            program = os.path.join(tmp, "bench_static_files_index")
+            try:
+                subprocess.run([compiler, "-std=c++17", "-O2", "-I", tmp, source, "-o", program], check=True)
+                subprocess.run([program], check=True)
+            except (OSError, subprocess.CalledProcessError) as e:
+                print("static_files_index: benchmark of %d assets failed: %s" % (count, e), file=sys.stderr)
+                return 1
+    return 0
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("header", nargs="?", help="static_files.h to index")
+    parser.add_argument("output", nargs="?", help="static_files_index.h to write")
+    parser.add_argument("--brotli", action="store_true", help="add brotli encodings of the gzip assets")
+    parser.add_argument("--synthetic", type=int, metavar="N", help="write header with N synthetic assets first")
+    parser.add_argument("--bench", type=int, nargs="+", metavar="N", help="time lookups with N synthetic assets")
+    args = parser.parse_args()
+
+    if args.bench:
+        return bench(args.bench)
+
+    if not args.header or not args.output:
+        parser.error("header and output are required")
+
+    if args.synthetic is not None:
+        write_if_changed(args.header, synthetic_header(args.synthetic))
+
+    with open(args.header, encoding="utf-8", errors="replace") as f:
+        header = f.read()
+
+    try:
+        files = parse_files(header)
+        encoded = recompress_brotli(files) if args.brotli else {}
+        content = render(files, encoded)
+    except ValueError as e:
+        print("static_files_index: %s" % e, file=sys.stderr)
+        return 1
+
+    if not write_if_changed(args.output, content):
+        return 0
+    print("static_files_index: indexed %d assets, %d with brotli" % (len(files), len(encoded)))
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,141 @@
+#include "alloc_trace.h"
+
+#include "sdkconfig.h"
+
+static const char* const g_path_names[ALLOC_PATH_COUNT] = { "none", "ticker", "clock", "render" };
+
+const char* alloc_trace_path_name(alloc_path_t path) {
+    return path < ALLOC_PATH_COUNT ? g_path_names[path] : "?";
+}
+
+#ifdef CONFIG_ALLOC_TRACE
+
+#include "clock_events.h"
+
+#include <esp_attr.h>
+#include <esp_event.h>
+#include <esp_log.h>
+#include <atomic>
+#include <stdlib.h>
+
+static const char* TAG = "alloc_trace";
+
+namespace {
+
+typedef struct {
+    std::atomic<uint32_t> allocs;
+    std::atomic<uint32_t> frees;
+    std::atomic<uint32_t> violations;
+    std::atomic<size_t> last_size;
+    std::atomic<bool> reported;
+} path_counters_t;
+
+path_counters_t g_paths[ALLOC_PATH_COUNT] = {};
+std::atomic<bool> g_steady{ false };
+
+// Path of the calling task, and violations it made since its scope was entered.
+// Heap hooks may run with the scheduler suspended, so they only count; the
+// log happens when the scope ends.
+thread_local alloc_path_t t_path = ALLOC_PATH_NONE;
+thread_local uint32_t t_pending = 0;
+thread_local size_t t_pending_size = 0;
+
+void on_hour_tick(void* arg, esp_event_base_t base, int32_t id, void* data) {
+    alloc_trace_report();
+}
+
+} // namespace
+
+alloc_path_t alloc_trace_enter(alloc_path_t path) {
+    alloc_path_t previous = t_path;
+    t_path = path;
+    return previous;
+}
+
+void alloc_trace_exit(alloc_path_t path, alloc_path_t previous) {
+    t_path = previous;
+    if (t_pending == 0) {
+        return;
+    }
+
+    uint32_t count = t_pending;
+    size_t size = t_pending_size;
+    t_pending = 0;
+
+    // Every violation is counted; only the first per path is logged
+    if (g_paths[path].reported.exchange(true)) {
+        return;
+    }
+    ESP_LOGW(TAG, "%lu heap allocation(s) on the %s path in steady state, latest %u bytes",
+        (unsigned long)count, g_path_names[path], (unsigned)size);
+#ifdef CONFIG_ALLOC_TRACE_ASSERT
+    ESP_LOGE(TAG, "Aborting: the %s path must not allocate once steady", g_path_names[path]);
+    abort();
+#endif
+}
+
+void alloc_trace_set_steady(void) {
+    if (!g_steady.exchange(true)) {
+        ESP_LOGI(TAG, "Steady state; hot-path allocations are now violations");
+    }
+}
+
+void IRAM_ATTR alloc_trace_record_alloc(size_t size) {
+    alloc_path_t path = t_path;
+    g_paths[path].allocs.fetch_add(1, std::memory_order_relaxed);
+
+    if (path != ALLOC_PATH_NONE && g_steady.load(std::memory_order_relaxed)) {
+        g_paths[path].violations.fetch_add(1, std::memory_order_relaxed);
+        g_paths[path].last_size.store(size, std::memory_order_relaxed);
+        t_pending++;
+        t_pending_size = size;
+    }
+}
+
+void IRAM_ATTR alloc_trace_record_free(void) {
+    g_paths[t_path].frees.fetch_add(1, std::memory_order_relaxed);
+}
+
+void alloc_trace_get_stats(alloc_path_t path, alloc_trace_stats_t* stats) {
+    if (path >= ALLOC_PATH_COUNT || stats == nullptr) {
+        return;
+    }
+    stats->allocs = g_paths[path].allocs.load();
+    stats->frees = g_paths[path].frees.load();
+    stats->violations = g_paths[path].violations.load();
+    stats->last_size = g_paths[path].last_size.load();
+}
+
+void alloc_trace_report(void) {
+    for (int i = 0; i < ALLOC_PATH_COUNT; i++) {
+        alloc_trace_stats_t stats;
+        alloc_trace_get_stats((alloc_path_t)i, &stats);
+        if (stats.violations > 0) {
+            ESP_LOGW(TAG, "%s: %lu allocs, %lu frees, %lu in steady state", g_path_names[i],
+                (unsigned long)stats.allocs, (unsigned long)stats.frees, (unsigned long)stats.violations);
+        }
+        else {
+            ESP_LOGI(TAG, "%s: %lu allocs, %lu frees", g_path_names[i],
+                (unsigned long)stats.allocs, (unsigned long)stats.frees);
+        }
+    }
+}
+
+void alloc_trace_init(void) {
+    esp_event_handler_register(CLOCK_EVENTS, CLOCK_EVENT_HOUR_TICK, on_hour_tick, nullptr);
+}
+
+#ifdef CONFIG_HEAP_USE_HOOKS
+
+// Called by the heap for every allocation and free, from any task
+extern "C" void IRAM_ATTR esp_heap_trace_alloc_hook(void* ptr, size_t size, uint32_t caps) {
+    alloc_trace_record_alloc(size);
+}
+
+extern "C" void IRAM_ATTR esp_heap_trace_free_hook(void* ptr) {
+    alloc_trace_record_free();
+}
+
+#endif
+
+#endif
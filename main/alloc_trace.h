@@ -0,0 +1,119 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "sdkconfig.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * Hot-path allocation tracer
+ *
+ * Once the clock has booted and synced, ticking and drawing should not touch
+ * the heap: an allocation there runs every second for the life of the
+ * device, and is where fragmentation and a slow leak come from. Code on the
+ * tick and render paths runs inside an ALLOC_TRACE_SCOPE(); with
+ * CONFIG_ALLOC_TRACE every heap allocation and free is counted against the
+ * path the calling task is on, and an allocation on a hot path after
+ * alloc_trace_set_steady() is a violation. The first violation on each path
+ * is logged when its scope ends, and aborts with CONFIG_ALLOC_TRACE_ASSERT.
+ *
+ * On the device, allocations arrive through ESP-IDF's heap hooks. A host
+ * build has none; its malloc wrapper calls alloc_trace_record_alloc() and
+ * alloc_trace_record_free() instead.
+ */
+
+typedef enum {
+    ALLOC_PATH_NONE,        // Not on a hot path; counted, never a violation
+    ALLOC_PATH_TICKER,      // Time ticker timer callback
+    ALLOC_PATH_CLOCK,       // Clock event handlers and the nixie cleaning cycle
+    ALLOC_PATH_RENDER,      // Wordclock transition frames
+    ALLOC_PATH_COUNT
+} alloc_path_t;
+
+typedef struct {
+    uint32_t allocs;
+    uint32_t frees;
+    uint32_t violations;    // Allocations on the path once steady
+    size_t last_size;       // Size of the latest violation
+} alloc_trace_stats_t;
+
+#ifdef CONFIG_ALLOC_TRACE
+
+/**
+ * Enter a hot path on the calling task.
+ *
+ * @return The path the task was on, to be passed to alloc_trace_exit()
+ */
+alloc_path_t alloc_trace_enter(alloc_path_t path);
+
+/**
+ * Leave the path entered last, reporting any violation made on it.
+ */
+void alloc_trace_exit(alloc_path_t path, alloc_path_t previous);
+
+/**
+ * Start treating hot-path allocations as violations.
+ * Called by the time ticker once the clock has run a few seconds after sync,
+ * so first-use allocations (timezone parsing, lazy buffers) are not counted.
+ */
+void alloc_trace_set_steady(void);
+
+void alloc_trace_record_alloc(size_t size);
+void alloc_trace_record_free(void);
+
+void alloc_trace_get_stats(alloc_path_t path, alloc_trace_stats_t* stats);
+
+/**
+ * Log the counts of every path.
+ */
+void alloc_trace_report(void);
+
+/**
+ * Report on every hour tick.
+ * Should be called after the default event loop is created.
+ */
+void alloc_trace_init(void);
+
+#else
+
+static inline void alloc_trace_set_steady(void) {}
+static inline void alloc_trace_init(void) {}
+
+#endif
+
+const char* alloc_trace_path_name(alloc_path_t path);
+
+#ifdef __cplusplus
+}
+
+#ifdef CONFIG_ALLOC_TRACE
+
+/**
+ * Marks the rest of the enclosing block as being on a hot path.
+ */
+class AllocTraceScope {
+public:
+    explicit AllocTraceScope(alloc_path_t path) : path_(path), previous_(alloc_trace_enter(path)) {}
+    ~AllocTraceScope() { alloc_trace_exit(path_, previous_); }
+
+    AllocTraceScope(const AllocTraceScope&) = delete;
+    AllocTraceScope& operator=(const AllocTraceScope&) = delete;
+
+private:
+    alloc_path_t path_;
+    alloc_path_t previous_;
+};
+
+#define ALLOC_TRACE_SCOPE(path) AllocTraceScope alloc_trace_scope_(path)
+
+#else
+
+#define ALLOC_TRACE_SCOPE(path) do {} while (0)
+
+#endif
+
+#endif
@@ -1,23 +1,173 @@
 #include "api.h"
 
+#include "async_worker.h"
+#include "config_batch.h"
+#include "http_governor.h"
+#include "json_writer.h"
 #include "kd_common.h"
 #include "kd_pixdriver.h"
+#include "mem_policy.h"
+#include "settings_store.h"
 #include "static_files.h"
+#include "static_files_index.h"
+#include "state_ws.h"
+#include "webui_bundle.h"
 
 #include <esp_http_server.h>
+#include "esp_heap_caps.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include <stdlib.h>
 #include <string.h>
+#include <strings.h>
 
-// Static file handler function
-static esp_err_t static_file_handler(httpd_req_t* req) {
-    const static_files::file* f = reinterpret_cast<const static_files::file*>(req->user_ctx);
-    if (!f) {
-        httpd_resp_send_404(req);
-        return ESP_FAIL;
+static const char* TAG = "api";
+
+// Static assets go out in pieces of this size straight from flash
+#define STATIC_FILE_CHUNK_SIZE 4096
+
+// Set when the generated index agrees with static_files::files; otherwise
+// lookups fall back to a linear scan and no ETags are sent
+static bool static_index_valid = false;
+
+static bool check_static_index(void) {
+    if (static_files_index::num_files != (uint32_t)static_files::num_of_files) {
+        return false;
     }
+    for (int i = 0; i < static_files::num_of_files; i++) {
+        const char* path = static_files::files[i].path;
+        if (static_files_index::find(path, strlen(path)) != i) {
+            return false;
+        }
+    }
+    return true;
+}
+
+static void fill_embedded_file(int index, webui_bundle_file_t* file) {
+    const static_files::file& f = static_files::files[index];
+    *file = {};
+    file->path = f.path;
+    file->type = f.type;
+    file->contents[WEBUI_ENCODING_GZIP] = f.contents;
+    file->size[WEBUI_ENCODING_GZIP] = f.size;
+
+    if (static_index_valid) {
+        const static_files_index::encoding& brotli = static_files_index::brotli[index];
+        file->etag[WEBUI_ENCODING_GZIP] = static_files_index::etags[index];
+        file->contents[WEBUI_ENCODING_BROTLI] = brotli.contents;
+        file->size[WEBUI_ENCODING_BROTLI] = brotli.size;
+        file->etag[WEBUI_ENCODING_BROTLI] = brotli.etag;
+    }
+}
+
+// Resolve a request URI (query string ignored) to a web UI file. An uploaded
+// bundle replaces the built-in files entirely, so the two never mix.
+static bool find_static_file(const char* uri, webui_bundle_file_t* file) {
+    size_t len = strcspn(uri, "?#");
+    if (len == 1 && uri[0] == '/') {
+        uri = "/index.html";
+        len = strlen(uri);
+    }
+
+    if (webui_bundle_active()) {
+        return webui_bundle_find(uri, len, file);
+    }
+
+    if (static_index_valid) {
+        int i = static_files_index::find(uri, len);
+        if (i < 0) {
+            return false;
+        }
+        const char* path = static_files::files[i].path;
+        if (strncmp(path, uri, len) != 0 || path[len] != '\0') {
+            return false;
+        }
+        fill_embedded_file(i, file);
+        return true;
+    }
+
+    for (int i = 0; i < static_files::num_of_files; i++) {
+        const char* path = static_files::files[i].path;
+        if (strncmp(path, uri, len) == 0 && path[len] == '\0') {
+            fill_embedded_file(i, file);
+            return true;
+        }
+    }
+    return false;
+}
+
+// Weak comparison as If-None-Match requires, so a W/ prefix is ignored
+bool etag_matches(const char* if_none_match, const char* etag) {
+    size_t etag_len = strlen(etag);
+    const char* p = if_none_match;
+    while (true) {
+        p += strspn(p, " \t,");
+        if (*p == '\0') {
+            return false;
+        }
+        if (*p == '*') {
+            return true;
+        }
+        if (strncmp(p, "W/", 2) == 0) {
+            p += 2;
+        }
+
+        size_t len = strcspn(p, " \t,");
+        if (len == etag_len && strncmp(p, etag, len) == 0) {
+            return true;
+        }
+        p += len;
+    }
+}
+
+// True if an Accept-Encoding value allows the content coding; an entry with
+// q=0 refuses it
+static bool accepts_encoding(const char* accept_encoding, const char* coding) {
+    size_t coding_len = strlen(coding);
+    const char* p = accept_encoding;
+    while (true) {
+        p += strspn(p, " \t,");
+        if (*p == '\0') {
+            return false;
+        }
+
+        size_t len = strcspn(p, " \t,;");
+        bool match = len == coding_len && strncasecmp(p, coding, len) == 0;
+        p += len;
+
+        // Parameters run to the next comma; only the weight matters
+        size_t params = strcspn(p, ",");
+        if (match) {
+            const char* q = p;
+            while (q < p + params && strncmp(q, "q=", 2) != 0) {
+                q++;
+            }
+            return q >= p + params || strtof(q + 2, NULL) > 0.0f;
+        }
+        p += params;
+    }
+}
+
+static esp_err_t send_static_file(httpd_req_t* req, const webui_bundle_file_t* f) {
+    int64_t start_us = esp_timer_get_time();
+
+    // Every file has a gzip body and some also a brotli one; gzip is sent
+    // even to clients that don't ask for it
+    webui_encoding_t encoding = WEBUI_ENCODING_GZIP;
+    char accept_encoding[128];
+    if (f->contents[WEBUI_ENCODING_BROTLI] != NULL &&
+        httpd_req_get_hdr_value_str(req, "Accept-Encoding", accept_encoding, sizeof(accept_encoding)) == ESP_OK &&
+        accepts_encoding(accept_encoding, "br")) {
+        encoding = WEBUI_ENCODING_BROTLI;
+    }
+    const char* etag = f->etag[encoding];
 
     // Set appropriate headers
     httpd_resp_set_type(req, f->type);
-    httpd_resp_set_hdr(req, "Content-Encoding", "gzip");
+    httpd_resp_set_hdr(req, "Content-Encoding", encoding == WEBUI_ENCODING_BROTLI ? "br" : "gzip");
+    httpd_resp_set_hdr(req, "Vary", "Accept-Encoding");
 
     // Add caching headers for static assets (except HTML)
     if (strcmp(f->type, "text/html") != 0) {
@@ -30,50 +180,254 @@ static esp_err_t static_file_handler(httpd_req_t* req) {
         httpd_resp_set_hdr(req, "X-XSS-Protection", "1; mode=block");
     }
 
-    httpd_resp_send(req, reinterpret_cast<const char*>(f->contents), f->size);
+    // Let the browser revalidate with the build-time ETag instead of
+    // downloading the asset again; HTML does this on every visit
+    if (etag != NULL) {
+        httpd_resp_set_hdr(req, "ETag", etag);
+
+        char if_none_match[128];
+        if (httpd_req_get_hdr_value_str(req, "If-None-Match", if_none_match, sizeof(if_none_match)) == ESP_OK &&
+            etag_matches(if_none_match, etag)) {
+            httpd_resp_set_status(req, "304 Not Modified");
+            httpd_resp_send(req, NULL, 0);
+            return ESP_OK;
+        }
+    }
+
+    // Stream straight from flash in fixed-size chunks
+    const char* data = reinterpret_cast<const char*>(f->contents[encoding]);
+    size_t remaining = f->size[encoding];
+    while (remaining > 0) {
+        size_t len = remaining < STATIC_FILE_CHUNK_SIZE ? remaining : STATIC_FILE_CHUNK_SIZE;
+        if (httpd_resp_send_chunk(req, data, len) != ESP_OK) {
+            ESP_LOGW(TAG, "Client went away while sending %s", f->path);
+            return ESP_FAIL;
+        }
+        data += len;
+        remaining -= len;
+    }
+    httpd_resp_send_chunk(req, NULL, 0);
+
+    ESP_LOGD(TAG, "Sent %s (%s, %u bytes) in %lld us, httpd stack headroom %u bytes", f->path,
+        encoding == WEBUI_ENCODING_BROTLI ? "br" : "gzip", (unsigned int)f->size[encoding],
+        (long long)(esp_timer_get_time() - start_us), (unsigned int)uxTaskGetStackHighWaterMark(NULL));
     return ESP_OK;
 }
 
+// Root handler function
+static esp_err_t root_handler(httpd_req_t* req) {
+    webui_bundle_file_t f;
+    if (!find_static_file("/", &f)) {
+        httpd_resp_send_404(req);
+        return ESP_FAIL;
+    }
+    return send_static_file(req, &f);
+}
+
+static esp_err_t static_file_get(httpd_req_t* req) {
+    webui_bundle_file_t f;
+    if (!find_static_file(req->uri, &f)) {
+        httpd_resp_send_err(req, HTTPD_404_NOT_FOUND, NULL);
+        return ESP_FAIL;
+    }
+    return send_static_file(req, &f);
+}
+
+// Catch-all for URIs no handler claimed; serves web UI files by path so
+// the web UI costs no handler slots however many assets it ships
+static esp_err_t static_file_handler(httpd_req_t* req, httpd_err_code_t) {
+    if (req->method != HTTP_GET) {
+        httpd_resp_send_err(req, HTTPD_404_NOT_FOUND, NULL);
+        return ESP_FAIL;
+    }
+    return http_governor_run(req, HTTP_CLASS_STATIC, static_file_get);
+}
+
+// Helper function to write free memory per region and what each subsystem holds
+static esp_err_t memory_get_handler(httpd_req_t* req) {
+    char buf[256];
+    json_writer_t writer;
+    json_writer_init(&writer, buf, sizeof(buf), req);
+    httpd_resp_set_type(req, "application/json");
+
+    json_object_begin(&writer);
+    json_key(&writer, "internal");
+    json_object_begin(&writer);
+    json_kv_int(&writer, "free", heap_caps_get_free_size(MALLOC_CAP_INTERNAL));
+    json_kv_int(&writer, "min_free", heap_caps_get_minimum_free_size(MALLOC_CAP_INTERNAL));
+    json_kv_int(&writer, "largest_block", heap_caps_get_largest_free_block(MALLOC_CAP_INTERNAL));
+    json_object_end(&writer);
+    json_key(&writer, "psram");
+    json_object_begin(&writer);
+    json_kv_int(&writer, "free", heap_caps_get_free_size(MALLOC_CAP_SPIRAM));
+    json_object_end(&writer);
+
+    json_key(&writer, "subsystems");
+    json_array_begin(&writer);
+    for (int i = 0; i < MEM_SUBSYSTEM_COUNT; i++) {
+        mem_usage_t usage;
+        mem_get_usage((mem_subsystem_t)i, &usage);
+        json_object_begin(&writer);
+        json_kv_string(&writer, "name", mem_subsystem_name((mem_subsystem_t)i));
+        json_kv_int(&writer, "internal", usage.internal);
+        json_kv_int(&writer, "psram", usage.psram);
+        json_kv_int(&writer, "peak", usage.peak);
+        json_kv_int(&writer, "failures", usage.failures);
+        json_object_end(&writer);
+    }
+    json_array_end(&writer);
+    json_object_end(&writer);
+
+    return json_writer_finish(&writer);
+}
+
+static esp_err_t workers_get_handler(httpd_req_t* req) {
+    async_worker_stats_t stats;
+    async_worker_get_stats(&stats);
+
+    char buf[256];
+    json_writer_t writer;
+    json_writer_init(&writer, buf, sizeof(buf), req);
+    httpd_resp_set_type(req, "application/json");
+
+    json_object_begin(&writer);
+    json_kv_int(&writer, "workers", stats.workers);
+    json_kv_int(&writer, "busy", stats.busy);
+    json_kv_int(&writer, "queued", stats.queued);
+    json_kv_int(&writer, "max_queued", stats.max_queued);
+    json_kv_int(&writer, "queue_size", stats.queue_size);
+    json_kv_int(&writer, "completed", stats.completed);
+    json_kv_int(&writer, "rejected", stats.rejected);
+    json_kv_int(&writer, "wait_us_max", stats.wait_us_max);
+    json_kv_int(&writer, "service_us_avg", stats.service_us_avg);
+    json_kv_int(&writer, "service_us_max", stats.service_us_max);
+    json_object_end(&writer);
+
+    return json_writer_finish(&writer);
+}
+
+static esp_err_t governor_get_handler(httpd_req_t* req) {
+    http_governor_stats_t stats;
+    http_governor_get_stats(&stats);
+
+    char buf[256];
+    json_writer_t writer;
+    json_writer_init(&writer, buf, sizeof(buf), req);
+    httpd_resp_set_type(req, "application/json");
+
+    json_object_begin(&writer);
+    json_kv_int(&writer, "in_flight", stats.in_flight);
+    json_kv_int(&writer, "max_in_flight", stats.max_in_flight);
+    json_kv_int(&writer, "clients", stats.clients);
+    json_key(&writer, "classes");
+    json_array_begin(&writer);
+    for (int i = 0; i < HTTP_CLASS_COUNT; i++) {
+        json_object_begin(&writer);
+        json_kv_string(&writer, "name", http_class_name((http_class_t)i));
+        json_kv_int(&writer, "admitted", stats.admitted[i]);
+        json_kv_int(&writer, "limited", stats.limited[i]);
+        json_kv_int(&writer, "shed", stats.shed[i]);
+        json_object_end(&writer);
+    }
+    json_array_end(&writer);
+    json_object_end(&writer);
+
+    return json_writer_finish(&writer);
+}
+
+static esp_err_t settings_stats_get_handler(httpd_req_t* req) {
+    settings_domain_stats_t domains[SETTINGS_MAX_DOMAINS];
+    size_t count = settings_store_get_stats(domains, SETTINGS_MAX_DOMAINS);
+
+    char buf[256];
+    json_writer_t writer;
+    json_writer_init(&writer, buf, sizeof(buf), req);
+    httpd_resp_set_type(req, "application/json");
+
+    json_object_begin(&writer);
+    json_key(&writer, "domains");
+    json_array_begin(&writer);
+    for (size_t i = 0; i < count; i++) {
+        json_object_begin(&writer);
+        json_kv_string(&writer, "name", domains[i].name);
+        json_kv_int(&writer, "changes", domains[i].changes);
+        json_kv_int(&writer, "writes", domains[i].writes);
+        json_kv_int(&writer, "commits", domains[i].commits);
+        json_kv_int(&writer, "failures", domains[i].failures);
+        json_kv_bool(&writer, "pending", domains[i].dirty);
+        json_object_end(&writer);
+    }
+    json_array_end(&writer);
+    json_object_end(&writer);
+
+    return json_writer_finish(&writer);
+}
+
 static void register_clock_handlers(httpd_handle_t server) {
     // Register PixelDriver API endpoints
     PixelDriver::attach_api(server);
 
-    // Create an array of httpd_uri_t to keep them alive after the loop
-    static httpd_uri_t static_file_uris[static_files::num_of_files + 1]; // +1 for root '/' override
+    // Web UI bundle status and upload
+    register_webui_bundle_handlers(server);
 
-    // Register static files
-    for (int i = 0; i < static_files::num_of_files; i++) {
-        const static_files::file& f = static_files::files[i];
+    // Live state pushes over WebSocket
+    register_state_ws_handlers(server);
 
-        static_file_uris[i] = {
-            .uri = f.path,
-            .method = HTTP_GET,
-            .handler = static_file_handler,
-            .user_ctx = (void*)&static_files::files[i]
-        };
+    // All config sections in one request
+    register_config_batch_handlers(server);
 
-        httpd_register_uri_handler(server, &static_file_uris[i]);
-    }
+    // Memory placement and per-subsystem usage
+    static const httpd_uri_t memory_uri = {
+        .uri = "/api/memory",
+        .method = HTTP_GET,
+        .handler = memory_get_handler,
+        .user_ctx = NULL
+    };
+    http_governor_register_uri(server, &memory_uri);
 
-    // Find index.html file to serve at root '/'
-    const static_files::file* index_file = nullptr;
-    for (int i = 0; i < static_files::num_of_files; i++) {
-        if (strcmp(static_files::files[i].path, "/index.html") == 0) {
-            index_file = &static_files::files[i];
-            break;
-        }
-    }
+    // Settings changes and NVS writes per settings domain
+    static const httpd_uri_t settings_stats_uri = {
+        .uri = "/api/settings/stats",
+        .method = HTTP_GET,
+        .handler = settings_stats_get_handler,
+        .user_ctx = NULL
+    };
+    http_governor_register_uri(server, &settings_stats_uri);
 
-    if (index_file) {
-        // Override root URI handler '/' to serve index.html instead of welcome message
-        static_file_uris[static_files::num_of_files] = {
-            .uri = "/",
-            .method = HTTP_GET,
-            .handler = static_file_handler,
-            .user_ctx = (void*)index_file
-        };
-        httpd_register_uri_handler(server, &static_file_uris[static_files::num_of_files]);
+    // Worker pool load for slow requests
+    static const httpd_uri_t workers_uri = {
+        .uri = "/api/workers",
+        .method = HTTP_GET,
+        .handler = workers_get_handler,
+        .user_ctx = NULL
+    };
+    http_governor_register_uri(server, &workers_uri);
+
+    // Requests admitted and turned away per class
+    static const httpd_uri_t governor_uri = {
+        .uri = "/api/governor",
+        .method = HTTP_GET,
+        .handler = governor_get_handler,
+        .user_ctx = NULL
+    };
+    http_governor_register_uri(server, &governor_uri);
+
+    static_index_valid = check_static_index();
+    if (!static_index_valid) {
+        ESP_LOGW(TAG, "Static file index does not match static_files.h, using linear lookup");
     }
+
+    // Override root URI handler '/' to serve index.html instead of welcome message
+    static const httpd_uri_t root_uri = {
+        .uri = "/",
+        .method = HTTP_GET,
+        .handler = root_handler,
+        .user_ctx = NULL
+    };
+    http_governor_register_uri(server, &root_uri);
+
+    // Everything else is resolved through the static file index
+    httpd_register_err_handler(server, HTTPD_404_NOT_FOUND, static_file_handler);
 }
 
 //subtype
@@ -92,6 +446,12 @@ void clock_api_init() {
     // Note: subtype is clock-specific but mDNS is handled by kd_common
     kd_common_set_device_info(FIRMWARE_VARIANT, subtype);
 
+    // Prefer an uploaded web UI bundle over the one compiled in
+    webui_bundle_init();
+
+    // Slow handlers are queued to these once the server is up
+    async_worker_init();
+
     // Register handler callback - will be called when httpd starts (on WiFi connect)
     kd_common_api_register_handlers(register_clock_handlers);
 }
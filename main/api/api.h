@@ -1,3 +1,11 @@
 #pragma once
 
 void clock_api_init();
+
+/**
+ * @brief Whether an If-None-Match header value lists the entity tag
+ *
+ * @param if_none_match Header value
+ * @param etag Quoted entity tag
+ */
+bool etag_matches(const char* if_none_match, const char* etag);
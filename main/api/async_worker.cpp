@@ -0,0 +1,211 @@
+#include "async_worker.h"
+
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/queue.h"
+#include "freertos/task.h"
+#include "http_governor.h"
+#include "mem_policy.h"
+#include "sdkconfig.h"
+#include "task_stacks.h"
+
+static const char* TAG = "async_worker";
+
+// Same as the httpd task the handlers were written for; see task_stacks_report()
+#define ASYNC_WORKER_STACK_SIZE 4096
+
+typedef struct {
+    httpd_req_t* req;           // Copy from httpd_req_async_handler_begin()
+    esp_err_t (*handler)(httpd_req_t* req);
+    int64_t queued_at;
+    bool governed;              // Holds an in-flight slot of the HTTP governor
+} async_job_t;
+
+static QueueHandle_t job_queue = NULL;
+static StaticQueue_t job_queue_buf;
+static uint8_t job_queue_storage[CONFIG_HTTP_ASYNC_QUEUE_SIZE * sizeof(async_job_t)];
+
+static TaskHandle_t workers[CONFIG_HTTP_ASYNC_WORKERS];
+static StackType_t worker_stacks[CONFIG_HTTP_ASYNC_WORKERS][ASYNC_WORKER_STACK_SIZE];
+static StaticTask_t worker_tcbs[CONFIG_HTTP_ASYNC_WORKERS];
+
+static async_worker_stats_t stats = {};
+static uint64_t service_us_total = 0;
+static portMUX_TYPE stats_lock = portMUX_INITIALIZER_UNLOCKED;
+
+static void worker_task(void* arg) {
+    async_job_t job;
+    while (true) {
+        if (xQueueReceive(job_queue, &job, portMAX_DELAY) != pdTRUE) {
+            continue;
+        }
+
+        int64_t start = esp_timer_get_time();
+        uint32_t wait_us = (uint32_t)(start - job.queued_at);
+        portENTER_CRITICAL(&stats_lock);
+        stats.queued--;
+        stats.busy++;
+        if (wait_us > stats.wait_us_max) {
+            stats.wait_us_max = wait_us;
+        }
+        portEXIT_CRITICAL(&stats_lock);
+
+        // Errors were answered by the handler itself
+        job.handler(job.req);
+        httpd_req_async_handler_complete(job.req);
+        if (job.governed) {
+            http_governor_release();
+        }
+
+        uint32_t service_us = (uint32_t)(esp_timer_get_time() - start);
+        portENTER_CRITICAL(&stats_lock);
+        stats.busy--;
+        stats.completed++;
+        service_us_total += service_us;
+        if (service_us > stats.service_us_max) {
+            stats.service_us_max = service_us;
+        }
+        portEXIT_CRITICAL(&stats_lock);
+    }
+}
+
+void async_worker_init(void) {
+    if (job_queue != NULL) {
+        return;
+    }
+
+    job_queue = xQueueCreateStatic(CONFIG_HTTP_ASYNC_QUEUE_SIZE, sizeof(async_job_t), job_queue_storage,
+        &job_queue_buf);
+    stats.workers = CONFIG_HTTP_ASYNC_WORKERS;
+    stats.queue_size = CONFIG_HTTP_ASYNC_QUEUE_SIZE;
+
+    // Same priority as the httpd task, so neither starves the other
+    for (int i = 0; i < CONFIG_HTTP_ASYNC_WORKERS; i++) {
+        workers[i] = xTaskCreateStatic(worker_task, "httpd_worker", ASYNC_WORKER_STACK_SIZE, NULL, 5,
+            worker_stacks[i], &worker_tcbs[i]);
+        task_stacks_register(workers[i], ASYNC_WORKER_STACK_SIZE);
+    }
+}
+
+esp_err_t async_worker_submit(httpd_req_t* req, esp_err_t (*handler)(httpd_req_t* req)) {
+    if (job_queue == NULL) {
+        ESP_LOGE(TAG, "Workers not started");
+        httpd_resp_send_500(req);
+        return ESP_FAIL;
+    }
+
+    // Only the httpd task queues, so a free slot stays free until the send below
+    if (uxQueueSpacesAvailable(job_queue) == 0) {
+        portENTER_CRITICAL(&stats_lock);
+        stats.rejected++;
+        portEXIT_CRITICAL(&stats_lock);
+
+        ESP_LOGW(TAG, "%s: all workers busy", req->uri);
+        httpd_resp_set_status(req, "503 Service Unavailable");
+        httpd_resp_set_hdr(req, "Retry-After", "1");
+        httpd_resp_send(req, "Busy, retry shortly", HTTPD_RESP_USE_STRLEN);
+        return ESP_FAIL;
+    }
+
+    async_job_t job = { .req = NULL, .handler = handler, .queued_at = esp_timer_get_time(), .governed = false };
+    esp_err_t err = httpd_req_async_handler_begin(req, &job.req);
+    if (err != ESP_OK) {
+        ESP_LOGE(TAG, "%s: cannot hand off request: %s", req->uri, esp_err_to_name(err));
+        httpd_resp_send_500(req);
+        return ESP_FAIL;
+    }
+
+    portENTER_CRITICAL(&stats_lock);
+    stats.queued++;
+    if (stats.queued > stats.max_queued) {
+        stats.max_queued = stats.queued;
+    }
+    portEXIT_CRITICAL(&stats_lock);
+
+    // Still in flight until the worker is done with it
+    job.governed = http_governor_detach();
+    xQueueSend(job_queue, &job, 0);
+    return ESP_OK;
+}
+
+// Work handed to the httpd task; whoever of the two finishes last frees it
+typedef struct {
+    void (*work)(void* arg);
+    void (*release)(void* arg);
+    void* arg;
+    TaskHandle_t waiter;
+    bool done;                  // Work has run, the waiter frees this
+    bool abandoned;             // Waiter gave up, the work item frees this
+} httpd_work_t;
+
+static portMUX_TYPE httpd_work_lock = portMUX_INITIALIZER_UNLOCKED;
+
+static void httpd_work(void* arg) {
+    httpd_work_t* item = (httpd_work_t*)arg;
+    item->work(item->arg);
+
+    portENTER_CRITICAL(&httpd_work_lock);
+    bool abandoned = item->abandoned;
+    item->done = true;
+    portEXIT_CRITICAL(&httpd_work_lock);
+
+    if (!abandoned) {
+        xTaskNotifyGive(item->waiter);
+        return;
+    }
+    if (item->release != NULL) {
+        item->release(item->arg);
+    }
+    mem_free(MEM_HTTP, item);
+}
+
+esp_err_t async_worker_run_on_httpd(httpd_req_t* req, void (*work)(void* arg), void* arg, void (*release)(void* arg)) {
+    httpd_work_t* item = (httpd_work_t*)mem_alloc(MEM_HTTP, sizeof(httpd_work_t));
+    if (item == NULL) {
+        return ESP_ERR_NO_MEM;
+    }
+    *item = { .work = work, .release = release, .arg = arg, .waiter = xTaskGetCurrentTaskHandle(),
+        .done = false, .abandoned = false };
+
+    esp_err_t err = httpd_queue_work(req->handle, httpd_work, item);
+    if (err != ESP_OK) {
+        mem_free(MEM_HTTP, item);
+        return err;
+    }
+
+    if (ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(CONFIG_HTTP_ASYNC_HTTPD_WAIT_MS)) == 0) {
+        portENTER_CRITICAL(&httpd_work_lock);
+        bool done = item->done;
+        item->abandoned = !done;
+        portEXIT_CRITICAL(&httpd_work_lock);
+
+        if (!done) {
+            ESP_LOGW(TAG, "%s: httpd task did not run the work in %d ms, leaving it to the work item", req->uri,
+                CONFIG_HTTP_ASYNC_HTTPD_WAIT_MS);
+            return ESP_ERR_TIMEOUT;
+        }
+        // Finished just as the wait ran out; take its notification
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+    }
+
+    mem_free(MEM_HTTP, item);
+    return ESP_OK;
+}
+
+bool async_worker_current(void) {
+    TaskHandle_t task = xTaskGetCurrentTaskHandle();
+    for (int i = 0; i < CONFIG_HTTP_ASYNC_WORKERS; i++) {
+        if (workers[i] == task) {
+            return true;
+        }
+    }
+    return false;
+}
+
+void async_worker_get_stats(async_worker_stats_t* out) {
+    portENTER_CRITICAL(&stats_lock);
+    *out = stats;
+    out->service_us_avg = stats.completed > 0 ? (uint32_t)(service_us_total / stats.completed) : 0;
+    portEXIT_CRITICAL(&stats_lock);
+}
@@ -0,0 +1,81 @@
+#pragma once
+
+#include <stdint.h>
+
+#include "esp_err.h"
+#include "esp_http_server.h"
+
+/*
+ * Async request workers
+ *
+ * All handlers run on the single httpd task, so one that writes flash or
+ * commits NVS stalls every other client meanwhile, static assets included.
+ * Such a handler hands its request to a small pool of worker tasks with
+ * async_worker_submit(); ESP-IDF's async request API keeps the connection
+ * open while the httpd task goes back to serving. When the job queue is
+ * full the request is answered at once with a 503 and Retry-After.
+ *
+ * A handler run on a worker may use the request as usual, but anything it
+ * shares with handlers on the httpd task needs its own locking, or has to
+ * be changed on the httpd task with async_worker_run_on_httpd().
+ */
+
+/**
+ * @brief Queue and timing figures since boot
+ */
+typedef struct {
+    uint32_t workers;
+    uint32_t busy;              // Workers running a job now
+    uint32_t queued;            // Jobs waiting for a worker now
+    uint32_t max_queued;        // Most jobs ever waiting at once
+    uint32_t queue_size;
+    uint32_t completed;
+    uint32_t rejected;          // Answered with 503, queue full
+    uint32_t wait_us_max;       // Longest a job waited for a worker
+    uint32_t service_us_avg;    // Handler run time
+    uint32_t service_us_max;
+} async_worker_stats_t;
+
+/**
+ * @brief Start the worker tasks
+ *
+ * Should be called before the HTTP server starts.
+ */
+void async_worker_init(void);
+
+/**
+ * @brief Run a handler for the request on a worker task
+ *
+ * Called from the request's handler on the httpd task, which should return
+ * the result right away. On ESP_OK the worker owns the request and sends
+ * the response; otherwise an error response has already been sent.
+ *
+ * @param req HTTP request
+ * @param handler Handler to run on the worker
+ * @return ESP_OK if queued, ESP_FAIL after a 503 or 500 response
+ */
+esp_err_t async_worker_submit(httpd_req_t* req, esp_err_t (*handler)(httpd_req_t* req));
+
+/**
+ * @brief Run work on the httpd task and wait for it, from a worker
+ *
+ * The wait is bounded by CONFIG_HTTP_ASYNC_HTTPD_WAIT_MS: a server that is
+ * stopping never runs its queued work. On ESP_ERR_TIMEOUT arg belongs to
+ * the work item, which calls release(arg) right after work(arg) if it does
+ * run later; the caller must not touch arg again.
+ *
+ * @param req Request being handled, for its server
+ * @param work Function to run on the httpd task
+ * @param arg Argument to work and release
+ * @param release Frees arg once the wait was abandoned, or NULL
+ * @return ESP_OK once work has run, ESP_ERR_TIMEOUT if the wait was
+ *         abandoned, or the error queueing the work (arg still the caller's)
+ */
+esp_err_t async_worker_run_on_httpd(httpd_req_t* req, void (*work)(void* arg), void* arg, void (*release)(void* arg));
+
+/**
+ * @brief Whether the calling task is one of the workers
+ */
+bool async_worker_current(void);
+
+void async_worker_get_stats(async_worker_stats_t* stats);
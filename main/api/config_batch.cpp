@@ -0,0 +1,284 @@
+#include "config_batch.h"
+
+#include "async_worker.h"
+#include "clock_events.h"
+#include "http_governor.h"
+#include "mem_policy.h"
+#include "settings_store.h"
+
+#include "esp_event.h"
+#include "esp_log.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
+#include <stdio.h>
+#include <string.h>
+
+static const char* TAG = "config_batch";
+
+// Largest request body accepted
+#define CONFIG_BATCH_MAX_BODY JSON_READER_MAX_BODY
+
+// Room for the current config of every section in the response
+#define CONFIG_BATCH_MAX_RESPONSE 512
+
+static const config_section_t* sections[CONFIG_BATCH_MAX_SECTIONS];
+static size_t section_count = 0;
+
+// POSTs run on the workers; this keeps them one at a time
+static SemaphoreHandle_t batch_lock = NULL;
+static StaticSemaphore_t batch_lock_buf;
+
+void config_batch_register(const config_section_t* section) {
+    for (size_t i = 0; i < section_count; i++) {
+        if (sections[i] == section) {
+            return;
+        }
+    }
+    if (section_count == CONFIG_BATCH_MAX_SECTIONS) {
+        ESP_LOGE(TAG, "No room for config section %s", section->name);
+        return;
+    }
+    sections[section_count++] = section;
+}
+
+esp_err_t config_section_read_request(httpd_req_t* req, const config_section_t* section, pb_field_t* pb_fields,
+    size_t pb_field_count) {
+    section->begin();
+
+    // Syntax and type errors are answered by the readers
+    esp_err_t err;
+    if (pb_fields != NULL && pb_request_body_is_protobuf(req)) {
+        err = pb_read_request(req, pb_fields, pb_field_count);
+    }
+    else {
+        err = json_read_request(req, section->fields, section->field_count);
+    }
+    if (err != ESP_OK) {
+        return ESP_FAIL;
+    }
+
+    const char* error = "invalid value";
+    if (section->validate(&error) != ESP_OK) {
+        ESP_LOGW(TAG, "%s: %s", req->uri, error);
+        httpd_resp_send_err(req, HTTPD_400_BAD_REQUEST, error);
+        return ESP_FAIL;
+    }
+    return ESP_OK;
+}
+
+// Helper function to receive the whole body into buf, which holds CONFIG_BATCH_MAX_BODY bytes
+static bool receive_body(httpd_req_t* req, char* buf) {
+    size_t received = 0;
+    while (received < req->content_len) {
+        int ret = httpd_req_recv(req, buf + received, req->content_len - received);
+        if (ret <= 0) {
+            if (ret == HTTPD_SOCK_ERR_TIMEOUT) {
+                httpd_resp_send_408(req);
+            }
+            else {
+                httpd_resp_send_500(req);
+            }
+            return false;
+        }
+        received += ret;
+    }
+    return true;
+}
+
+// Helper function to read every member of the body into its section's
+// staged copy and validate it; nothing is applied
+static bool stage_sections(const char* body, size_t len, json_field_t* members, char* message, size_t message_size) {
+    for (size_t i = 0; i < section_count; i++) {
+        sections[i]->begin();
+        members[i] = {
+            .key = sections[i]->name,
+            .type = JSON_FIELD_OBJECT,
+            .value = sections[i]->fields,
+            .size = sections[i]->field_count,
+        };
+    }
+
+    json_reader_t reader;
+    json_reader_init(&reader, members, section_count);
+    reader.reject_unknown = true;
+    json_reader_feed(&reader, body, len);
+    if (json_reader_finish(&reader) != ESP_OK) {
+        snprintf(message, message_size, "%s", json_reader_error(&reader));
+        return false;
+    }
+
+    for (size_t i = 0; i < section_count; i++) {
+        const char* error = "invalid value";
+        if (members[i].found && sections[i]->validate(&error) != ESP_OK) {
+            snprintf(message, message_size, "%s: %s", sections[i]->name, error);
+            return false;
+        }
+    }
+    return true;
+}
+
+static esp_err_t config_batch_get_handler(httpd_req_t* req) {
+    char buf[256];
+    json_writer_t writer;
+    json_writer_init(&writer, buf, sizeof(buf), req);
+    httpd_resp_set_type(req, "application/json");
+
+    json_object_begin(&writer);
+    for (size_t i = 0; i < section_count; i++) {
+        json_key(&writer, sections[i]->name);
+        sections[i]->write(&writer);
+    }
+    json_object_end(&writer);
+
+    return json_writer_finish(&writer);
+}
+
+// One POST, handed from its worker to the httpd task and back. The body
+// is part of it, so every POST takes one block of the same size.
+typedef struct {
+    char body[CONFIG_BATCH_MAX_BODY];
+    size_t body_len;
+    bool valid;
+    size_t applied;
+    char message[96];       // Why the body was rejected
+    esp_err_t write_err;
+    char response[CONFIG_BATCH_MAX_RESPONSE];
+} config_batch_job_t;
+
+// Runs on the httpd task, where the single-section POSTs change the same
+// config structs, so staging and commit never overlap one of those
+static void config_batch_apply_work(void* arg) {
+    config_batch_job_t* job = (config_batch_job_t*)arg;
+
+    // Validate everything before touching anything
+    json_field_t members[CONFIG_BATCH_MAX_SECTIONS];
+    if (stage_sections(job->body, job->body_len, members, job->message, sizeof(job->message))) {
+        job->valid = true;
+
+        // Then apply the staged sections in one go
+        for (size_t i = 0; i < section_count; i++) {
+            if (members[i].found) {
+                sections[i]->commit();
+                job->applied++;
+            }
+        }
+    }
+
+    json_writer_t writer;
+    json_writer_init(&writer, job->response, sizeof(job->response), NULL);
+    json_object_begin(&writer);
+    for (size_t i = 0; i < section_count; i++) {
+        json_key(&writer, sections[i]->name);
+        sections[i]->write(&writer);
+    }
+    json_object_end(&writer);
+    job->write_err = json_writer_finish(&writer);
+}
+
+// The worker stopped waiting; the settings writer still saves what was
+// committed, this only announces it
+static void config_batch_apply_release(void* arg) {
+    config_batch_job_t* job = (config_batch_job_t*)arg;
+    if (job->applied > 0) {
+        esp_event_post(CLOCK_EVENTS, CLOCK_EVENT_CONFIG_CHANGED, nullptr, 0, 0);
+    }
+    mem_free(MEM_HTTP, job);
+}
+
+static esp_err_t config_batch_apply(httpd_req_t* req) {
+    if (req->content_len > CONFIG_BATCH_MAX_BODY) {
+        httpd_resp_set_status(req, "413 Content Too Large");
+        httpd_resp_send(req, "Request body too large", HTTPD_RESP_USE_STRLEN);
+        return ESP_FAIL;
+    }
+
+    config_batch_job_t* job = (config_batch_job_t*)mem_alloc(MEM_HTTP, sizeof(config_batch_job_t));
+    if (job == NULL) {
+        httpd_resp_send_500(req);
+        return ESP_FAIL;
+    }
+    memset(job, 0, sizeof(*job));
+
+    if (!receive_body(req, job->body)) {
+        mem_free(MEM_HTTP, job);
+        return ESP_FAIL;
+    }
+    job->body_len = req->content_len;
+    esp_err_t err = async_worker_run_on_httpd(req, config_batch_apply_work, job, config_batch_apply_release);
+    if (err == ESP_ERR_TIMEOUT) {
+        // The job is the work item's now
+        httpd_resp_set_status(req, "503 Service Unavailable");
+        httpd_resp_set_hdr(req, "Retry-After", "1");
+        httpd_resp_send(req, "Server busy, config may not be applied", HTTPD_RESP_USE_STRLEN);
+        return ESP_FAIL;
+    }
+    if (err != ESP_OK) {
+        ESP_LOGE(TAG, "Failed to queue config apply: %s", esp_err_to_name(err));
+        mem_free(MEM_HTTP, job);
+        httpd_resp_send_500(req);
+        return ESP_FAIL;
+    }
+
+    if (!job->valid) {
+        ESP_LOGW(TAG, "Rejected: %s", job->message);
+        httpd_resp_send_err(req, HTTPD_400_BAD_REQUEST, job->message);
+        err = ESP_FAIL;
+    }
+    else {
+        if (job->applied > 0) {
+            // One record write covers every section, then one redraw; the
+            // flush can wait on flash, so it stays on the worker
+            settings_store_flush();
+            esp_event_post(CLOCK_EVENTS, CLOCK_EVENT_CONFIG_CHANGED, nullptr, 0, 0);
+            ESP_LOGI(TAG, "Applied %u config section(s)", (unsigned int)job->applied);
+        }
+
+        // Return updated config
+        if (job->write_err != ESP_OK) {
+            httpd_resp_send_500(req);
+            err = ESP_FAIL;
+        }
+        else {
+            httpd_resp_set_type(req, "application/json");
+            err = httpd_resp_send(req, job->response, HTTPD_RESP_USE_STRLEN);
+        }
+    }
+
+    mem_free(MEM_HTTP, job);
+    return err;
+}
+
+static esp_err_t config_batch_worker(httpd_req_t* req) {
+    xSemaphoreTake(batch_lock, portMAX_DELAY);
+    esp_err_t err = config_batch_apply(req);
+    xSemaphoreGive(batch_lock);
+    return err;
+}
+
+// The settings commit can wait on flash, so it runs on a worker; the config
+// itself is only ever changed on the httpd task
+static esp_err_t config_batch_post_handler(httpd_req_t* req) {
+    return async_worker_submit(req, config_batch_worker);
+}
+
+void register_config_batch_handlers(httpd_handle_t server) {
+    if (batch_lock == NULL) {
+        batch_lock = xSemaphoreCreateMutexStatic(&batch_lock_buf);
+    }
+
+    httpd_uri_t config_get_uri = {
+        .uri = "/api/config",
+        .method = HTTP_GET,
+        .handler = config_batch_get_handler,
+        .user_ctx = NULL
+    };
+    http_governor_register_uri(server, &config_get_uri);
+
+    httpd_uri_t config_post_uri = {
+        .uri = "/api/config",
+        .method = HTTP_POST,
+        .handler = config_batch_post_handler,
+        .user_ctx = NULL
+    };
+    http_governor_register_uri(server, &config_post_uri);
+}
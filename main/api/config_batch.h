@@ -0,0 +1,94 @@
+#pragma once
+
+#include "esp_err.h"
+#include "esp_http_server.h"
+#include "json_reader.h"
+#include "json_writer.h"
+#include "pb_codec.h"
+#include <stdint.h>
+
+// Config sections that can be registered
+#define CONFIG_BATCH_MAX_SECTIONS 4
+
+/*
+ * Batch configuration at /api/config
+ *
+ * One POST carries any number of config sections, each under its own
+ * member, in the shape of that section's own endpoint:
+ *
+ *   {"nixie":{"brightness":80,"on":true}}
+ *
+ * The body is read with json_reader, each member through its section's
+ * field table, without building a tree. Every section is validated before
+ * anything changes; one bad member rejects the whole request with a 400
+ * naming it. The sections are then applied together, written to NVS as
+ * one settings record commit, and a single CLOCK_EVENT_CONFIG_CHANGED is
+ * posted. Both methods answer with the current config of every section.
+ *
+ * A section's own POST reads its body through the same table and
+ * validate function, with config_section_read_request(). The fields point
+ * at one staged copy per section, so all of this runs on the httpd task,
+ * where nothing else stages at the same time.
+ */
+
+/**
+ * @brief A config domain that can be set through /api/config
+ */
+typedef struct {
+    const char* name;       // Member of the /api/config body
+
+    // Members of the section, read into the staged copy
+    json_field_t* fields;
+    size_t field_count;
+
+    // Start the staged copy from the current config, before the fields are read
+    void (*begin)(void);
+
+    /**
+     * Check what the fields read and finish the staged copy. Nothing may
+     * be applied yet.
+     *
+     * @return ESP_OK, or ESP_ERR_INVALID_ARG with *error set
+     */
+    esp_err_t (*validate)(const char** error);
+
+    // Apply and save the staged copy, without posting CLOCK_EVENT_CONFIG_CHANGED
+    void (*commit)(void);
+
+    // Current config as one JSON value
+    void (*write)(json_writer_t* writer);
+} config_section_t;
+
+/**
+ * @brief Make a section settable through /api/config
+ *
+ * Called by the section's owner when its handlers are registered;
+ * registering the same section again has no effect.
+ *
+ * @param section Section, which must outlive the server
+ */
+void config_batch_register(const config_section_t* section);
+
+/**
+ * @brief Read a section's own POST body into its staged copy
+ *
+ * Starts the staged copy, reads the body through the section's fields, or
+ * through pb_fields when it is protobuf, and validates it; the caller then
+ * commits. Runs on the httpd task. On failure the error response has
+ * already been sent.
+ *
+ * @param req HTTP request
+ * @param section Section the body is for
+ * @param pb_fields Protobuf fields into the same staged copy, or NULL
+ * @param pb_field_count Number of protobuf fields
+ * @return ESP_OK, or ESP_FAIL after sending an error response
+ */
+esp_err_t config_section_read_request(httpd_req_t* req, const config_section_t* section, pb_field_t* pb_fields,
+    size_t pb_field_count);
+
+/**
+ * @brief Register the /api/config endpoints
+ *
+ * @param server HTTP server handle
+ */
+void register_config_batch_handlers(httpd_handle_t server);
@@ -0,0 +1,83 @@
+#include "config_cache.h"
+#include "api.h"
+
+#include <stdio.h>
+#include <string.h>
+
+#include "esp_log.h"
+#include "esp_random.h"
+#include "mem_policy.h"
+#include "freertos/FreeRTOS.h"
+
+static const char* TAG = "config_cache";
+
+static portMUX_TYPE generation_lock = portMUX_INITIALIZER_UNLOCKED;
+
+// Generations restart at every boot; this keeps an old ETag from matching
+static uint32_t boot_id = 0;
+
+void config_domain_changed(config_domain_t* domain) {
+    portENTER_CRITICAL(&generation_lock);
+    domain->generation++;
+    if (domain->generation == 0) {
+        // 0 marks a body that was never built
+        domain->generation = 1;
+    }
+    portEXIT_CRITICAL(&generation_lock);
+}
+
+static uint32_t current_generation(config_domain_t* domain) {
+    portENTER_CRITICAL(&generation_lock);
+    uint32_t generation = domain->generation;
+    portEXIT_CRITICAL(&generation_lock);
+    return generation;
+}
+
+esp_err_t config_body_send(httpd_req_t* req, config_body_t* body) {
+    if (boot_id == 0) {
+        boot_id = esp_random() | 1;
+    }
+
+    // Read once; a change during the build leaves the body stale for the next request
+    uint32_t generation = current_generation(body->domain);
+
+    // Headers keep a pointer, so the tag lives in the body
+    snprintf(body->etag, sizeof(body->etag), "\"%s-%08lx-%lu-%s\"", body->domain->name,
+        (unsigned long)boot_id, (unsigned long)generation, body->format);
+    httpd_resp_set_hdr(req, "ETag", body->etag);
+    httpd_resp_set_hdr(req, "Cache-Control", "no-cache");
+
+    if (req->method == HTTP_GET) {
+        char if_none_match[64];
+        if (httpd_req_get_hdr_value_str(req, "If-None-Match", if_none_match, sizeof(if_none_match)) == ESP_OK &&
+            etag_matches(if_none_match, body->etag)) {
+            httpd_resp_set_status(req, "304 Not Modified");
+            return httpd_resp_send(req, NULL, 0);
+        }
+    }
+
+    if (body->buf == NULL) {
+        body->buf = (uint8_t*)mem_alloc(MEM_HTTP, body->size);
+        if (body->buf == NULL) {
+            httpd_resp_send_500(req);
+            return ESP_FAIL;
+        }
+    }
+
+    if (body->generation != generation || body->len == 0) {
+        body->len = body->build(body->buf, body->size);
+        if (body->len == 0) {
+            body->generation = 0;
+            ESP_LOGE(TAG, "%s %s body does not fit in %u bytes", body->domain->name, body->format,
+                (unsigned int)body->size);
+            httpd_resp_send_500(req);
+            return ESP_FAIL;
+        }
+        body->generation = generation;
+        ESP_LOGD(TAG, "Rebuilt %s %s body, generation %lu", body->domain->name, body->format,
+            (unsigned long)generation);
+    }
+
+    httpd_resp_set_type(req, body->content_type);
+    return httpd_resp_send(req, (const char*)body->buf, body->len);
+}
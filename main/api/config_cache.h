@@ -0,0 +1,70 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "esp_err.h"
+#include "esp_http_server.h"
+
+/*
+ * Cached config responses
+ *
+ * Each config domain carries a generation counter that its owner bumps
+ * whenever the stored config changes. A serialized response is kept
+ * together with the generation it was built from and reused until the
+ * counter moves on, and its ETag is derived from the generation, so a
+ * conditional GET for an unchanged config is answered with a 304 without
+ * building anything.
+ */
+
+typedef struct {
+    const char* name;               // ETag prefix
+    uint32_t generation;            // Bumped by config_domain_changed()
+} config_domain_t;
+
+/**
+ * @brief Serializes the domain's config into buf
+ *
+ * @return Bytes written, or 0 if the body does not fit
+ */
+typedef size_t (*config_body_builder_t)(uint8_t* buf, size_t size);
+
+/**
+ * @brief One cached representation of a domain, e.g. its JSON body
+ */
+typedef struct {
+    config_domain_t* domain;
+    const char* format;             // ETag suffix telling representations apart
+    const char* content_type;
+    config_body_builder_t build;
+    uint8_t* buf;                   // Allocated on first use from MEM_HTTP
+    size_t size;
+    size_t len;
+    uint32_t generation;            // Generation the body was built from
+    char etag[48];
+} config_body_t;
+
+#define CONFIG_DOMAIN(domain_name) { .name = (domain_name), .generation = 1 }
+
+#define CONFIG_BODY(domain_ptr, body_format, type, builder, buffer_size) \
+    { .domain = (domain_ptr), .format = (body_format), .content_type = (type), .build = (builder), \
+      .buf = NULL, .size = (buffer_size), .len = 0, .generation = 0, .etag = "" }
+
+/**
+ * @brief Record that the domain's config changed
+ *
+ * Safe to call from any task; cached bodies are rebuilt on their next use.
+ */
+void config_domain_changed(config_domain_t* domain);
+
+/**
+ * @brief Send a cached body, rebuilding it if its domain changed
+ *
+ * Sets ETag and Cache-Control: no-cache. A GET whose If-None-Match holds
+ * the current ETag gets a 304 without the body being built.
+ *
+ * @param req HTTP request
+ * @param body Cached body
+ * @return ESP_OK, or the error after a 500 response
+ */
+esp_err_t config_body_send(httpd_req_t* req, config_body_t* body);
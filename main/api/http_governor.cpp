@@ -0,0 +1,281 @@
+#include "http_governor.h"
+
+#include "sdkconfig.h"
+
+#include <string.h>
+
+static const char* const class_names[HTTP_CLASS_COUNT] = { "control", "read", "static" };
+
+const char* http_class_name(http_class_t cls) {
+    return cls < HTTP_CLASS_COUNT ? class_names[cls] : "?";
+}
+
+#ifdef CONFIG_HTTP_GOVERNOR
+
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "freertos/FreeRTOS.h"
+#include "lwip/sockets.h"
+#include <stdio.h>
+
+static const char* TAG = "http_governor";
+
+// Handlers registered through the governor, across all modules
+#define GOVERNED_URIS_MAX 16
+
+// Client addresses with a bucket; the least recently seen gives way to a new one
+#define GOVERNOR_CLIENTS 8
+
+// Bucket levels are kept in thousandths of a request
+#define TOKEN 1000
+
+typedef struct {
+    uint8_t addr[16];           // IPv6, or IPv4 in the first four bytes
+    uint32_t tokens;
+    int64_t updated_at;
+    bool used;
+    bool warned;                // Rejection logged since the last admission
+} client_bucket_t;
+
+typedef struct {
+    const char* uri;
+    httpd_method_t method;
+    esp_err_t (*handler)(httpd_req_t* req);
+    void* user_ctx;
+    http_class_t cls;
+} governed_uri_t;
+
+static governed_uri_t governed_uris[GOVERNED_URIS_MAX];
+static size_t governed_uri_count = 0;
+
+// Only touched from the httpd task
+static client_bucket_t clients[GOVERNOR_CLIENTS];
+
+// Set while a governed handler runs, until it returns or detaches; httpd task only
+static bool current_held = false;
+
+static http_governor_stats_t stats = {};
+static portMUX_TYPE stats_lock = portMUX_INITIALIZER_UNLOCKED;
+
+static uint32_t bucket_size(void) {
+    return CONFIG_HTTP_GOVERNOR_CLIENT_BURST * TOKEN;
+}
+
+// Tokens left untouched by reads and static assets
+static uint32_t control_reserve(void) {
+    uint32_t reserve = CONFIG_HTTP_GOVERNOR_CONTROL_RESERVE * TOKEN;
+    return reserve < bucket_size() ? reserve : bucket_size() - TOKEN;
+}
+
+// Helper function to read the client address of the request's socket
+static void peer_address(httpd_req_t* req, uint8_t addr[16]) {
+    memset(addr, 0, 16);
+
+    struct sockaddr_storage peer;
+    socklen_t len = sizeof(peer);
+    if (getpeername(httpd_req_to_sockfd(req), (struct sockaddr*)&peer, &len) != 0) {
+        return; // Unknown peers share one bucket
+    }
+    if (peer.ss_family == AF_INET6) {
+        memcpy(addr, &((struct sockaddr_in6*)&peer)->sin6_addr, 16);
+    }
+    else if (peer.ss_family == AF_INET) {
+        memcpy(addr, &((struct sockaddr_in*)&peer)->sin_addr, 4);
+    }
+}
+
+// Helper function to find the client's bucket, taking a slot for a new client
+static client_bucket_t* find_bucket(const uint8_t addr[16], int64_t now) {
+    client_bucket_t* oldest = &clients[0];
+    for (int i = 0; i < GOVERNOR_CLIENTS; i++) {
+        client_bucket_t* bucket = &clients[i];
+        if (bucket->used && memcmp(bucket->addr, addr, 16) == 0) {
+            return bucket;
+        }
+        if (!bucket->used || (oldest->used && bucket->updated_at < oldest->updated_at)) {
+            oldest = bucket;
+        }
+    }
+
+    if (!oldest->used) {
+        portENTER_CRITICAL(&stats_lock);
+        stats.clients++;
+        portEXIT_CRITICAL(&stats_lock);
+    }
+
+    // New clients start with a full bucket, enough to load the web UI
+    memcpy(oldest->addr, addr, 16);
+    oldest->tokens = bucket_size();
+    oldest->updated_at = now;
+    oldest->used = true;
+    oldest->warned = false;
+    return oldest;
+}
+
+static void refill(client_bucket_t* bucket, int64_t now) {
+    uint64_t elapsed_us = now > bucket->updated_at ? now - bucket->updated_at : 0;
+    uint64_t tokens = bucket->tokens + elapsed_us * CONFIG_HTTP_GOVERNOR_CLIENT_RATE * TOKEN / 1000000;
+    bucket->tokens = tokens < bucket_size() ? (uint32_t)tokens : bucket_size();
+    bucket->updated_at = now;
+}
+
+// Helper function to answer a rejected request; the body is kept tiny on purpose
+static void send_rejection(httpd_req_t* req, const char* status, uint32_t retry_after_s, const char* body) {
+    char retry_after[12];
+    snprintf(retry_after, sizeof(retry_after), "%lu", (unsigned long)retry_after_s);
+    httpd_resp_set_status(req, status);
+    httpd_resp_set_hdr(req, "Retry-After", retry_after);
+    httpd_resp_send(req, body, HTTPD_RESP_USE_STRLEN);
+}
+
+static esp_err_t admit(httpd_req_t* req, http_class_t cls) {
+    int64_t now = esp_timer_get_time();
+    uint8_t addr[16];
+    peer_address(req, addr);
+
+    client_bucket_t* bucket = find_bucket(addr, now);
+    refill(bucket, now);
+
+    // Reads and static assets must leave the reserve for control requests
+    uint32_t needed = TOKEN + (cls == HTTP_CLASS_CONTROL ? 0 : control_reserve());
+    if (bucket->tokens < needed) {
+        uint32_t per_second = CONFIG_HTTP_GOVERNOR_CLIENT_RATE * TOKEN;
+        uint32_t retry_after = (needed - bucket->tokens + per_second - 1) / per_second;
+
+        portENTER_CRITICAL(&stats_lock);
+        stats.limited[cls]++;
+        portEXIT_CRITICAL(&stats_lock);
+
+        if (!bucket->warned) {
+            bucket->warned = true;
+            ESP_LOGW(TAG, "%s: client over %d requests/s, limiting", req->uri, CONFIG_HTTP_GOVERNOR_CLIENT_RATE);
+        }
+        send_rejection(req, "429 Too Many Requests", retry_after > 0 ? retry_after : 1, "Too many requests");
+        return ESP_FAIL;
+    }
+
+    // Control requests may fill the cap; everything else leaves them a slot
+    uint32_t cap = CONFIG_HTTP_GOVERNOR_MAX_IN_FLIGHT - (cls == HTTP_CLASS_CONTROL ? 0 : 1);
+    portENTER_CRITICAL(&stats_lock);
+    bool admitted = stats.in_flight < cap;
+    if (admitted) {
+        stats.admitted[cls]++;
+        stats.in_flight++;
+        if (stats.in_flight > stats.max_in_flight) {
+            stats.max_in_flight = stats.in_flight;
+        }
+    }
+    else {
+        stats.shed[cls]++;
+    }
+    portEXIT_CRITICAL(&stats_lock);
+
+    if (!admitted) {
+        send_rejection(req, "503 Service Unavailable", 1, "Busy, retry shortly");
+        return ESP_FAIL;
+    }
+
+    // A rejected request does not cost a token, so retrying after Retry-After works
+    bucket->tokens -= TOKEN;
+    bucket->warned = false;
+    return ESP_OK;
+}
+
+esp_err_t http_governor_run(httpd_req_t* req, http_class_t cls, esp_err_t (*handler)(httpd_req_t* req)) {
+    if (admit(req, cls) != ESP_OK) {
+        return ESP_FAIL;
+    }
+
+    current_held = true;
+    esp_err_t err = handler(req);
+    if (current_held) {
+        current_held = false;
+        http_governor_release();
+    }
+    return err;
+}
+
+bool http_governor_detach(void) {
+    bool held = current_held;
+    current_held = false;
+    return held;
+}
+
+void http_governor_release(void) {
+    portENTER_CRITICAL(&stats_lock);
+    if (stats.in_flight > 0) {
+        stats.in_flight--;
+    }
+    portEXIT_CRITICAL(&stats_lock);
+}
+
+void http_governor_get_stats(http_governor_stats_t* out) {
+    portENTER_CRITICAL(&stats_lock);
+    *out = stats;
+    portEXIT_CRITICAL(&stats_lock);
+}
+
+static esp_err_t governed_handler(httpd_req_t* req) {
+    const governed_uri_t* governed = (const governed_uri_t*)req->user_ctx;
+
+    // The handler sees the user_ctx it was registered with
+    req->user_ctx = governed->user_ctx;
+    return http_governor_run(req, governed->cls, governed->handler);
+}
+
+esp_err_t http_governor_register_uri(httpd_handle_t server, const httpd_uri_t* uri) {
+    // The server restarts on reconnect and registers everything again
+    governed_uri_t* governed = NULL;
+    for (size_t i = 0; i < governed_uri_count; i++) {
+        if (governed_uris[i].method == uri->method && strcmp(governed_uris[i].uri, uri->uri) == 0) {
+            governed = &governed_uris[i];
+            break;
+        }
+    }
+    if (governed == NULL) {
+        if (governed_uri_count == GOVERNED_URIS_MAX) {
+            ESP_LOGE(TAG, "No room to govern %s, registering it ungoverned", uri->uri);
+            return httpd_register_uri_handler(server, uri);
+        }
+        governed = &governed_uris[governed_uri_count++];
+    }
+
+    governed->uri = uri->uri;
+    governed->method = uri->method;
+    governed->handler = uri->handler;
+    governed->user_ctx = uri->user_ctx;
+    if (uri->method != HTTP_GET) {
+        governed->cls = HTTP_CLASS_CONTROL;
+    }
+    else {
+        governed->cls = strncmp(uri->uri, "/api/", 5) == 0 ? HTTP_CLASS_READ : HTTP_CLASS_STATIC;
+    }
+
+    httpd_uri_t wrapped = *uri;
+    wrapped.handler = governed_handler;
+    wrapped.user_ctx = governed;
+    return httpd_register_uri_handler(server, &wrapped);
+}
+
+#else
+
+esp_err_t http_governor_run(httpd_req_t* req, http_class_t cls, esp_err_t (*handler)(httpd_req_t* req)) {
+    return handler(req);
+}
+
+bool http_governor_detach(void) {
+    return false;
+}
+
+void http_governor_release(void) {
+}
+
+esp_err_t http_governor_register_uri(httpd_handle_t server, const httpd_uri_t* uri) {
+    return httpd_register_uri_handler(server, uri);
+}
+
+void http_governor_get_stats(http_governor_stats_t* stats) {
+    memset(stats, 0, sizeof(*stats));
+}
+
+#endif
@@ -0,0 +1,96 @@
+#pragma once
+
+#include <stdint.h>
+
+#include "esp_err.h"
+#include "esp_http_server.h"
+
+/*
+ * HTTP resource governor
+ *
+ * A client polling the API in a tight loop keeps lwIP, the httpd task and
+ * the event loop busy with work the clock does not need: every control
+ * request posts a redraw and queues a settings write. Each request is
+ * admitted here before its handler runs:
+ *
+ * - Every client address has a token bucket refilled at
+ *   CONFIG_HTTP_GOVERNOR_CLIENT_RATE requests per second. An empty bucket
+ *   is answered at once with 429 and a Retry-After of when a token will be
+ *   back. The last CONFIG_HTTP_GOVERNOR_CONTROL_RESERVE tokens are kept
+ *   for control requests, so a client loading the web UI can still change
+ *   settings.
+ * - Requests being handled, on the httpd task or waiting for or running on
+ *   a worker, are capped at CONFIG_HTTP_GOVERNOR_MAX_IN_FLIGHT. Control
+ *   requests may use the whole cap, API reads and static assets all but
+ *   one; beyond that the answer is 503 with Retry-After.
+ *
+ * WebSocket frames and endpoints registered by kd_common and PixelDriver
+ * are not governed.
+ */
+
+typedef enum {
+    HTTP_CLASS_CONTROL,         // Changes device state: POST, PUT, DELETE
+    HTTP_CLASS_READ,            // API GET
+    HTTP_CLASS_STATIC,          // Web UI files
+    HTTP_CLASS_COUNT
+} http_class_t;
+
+/**
+ * @brief Admission counts since boot
+ */
+typedef struct {
+    uint32_t admitted[HTTP_CLASS_COUNT];
+    uint32_t limited[HTTP_CLASS_COUNT];     // Answered with 429, client over its rate
+    uint32_t shed[HTTP_CLASS_COUNT];        // Answered with 503, too many in flight
+    uint32_t in_flight;
+    uint32_t max_in_flight;                 // Most requests in flight at once
+    uint32_t clients;                       // Client addresses being tracked
+} http_governor_stats_t;
+
+/**
+ * @brief Admit a request, then run its handler
+ *
+ * Called on the httpd task. A rejected request is answered at once with
+ * 429 or 503 and the handler is not run. An admitted one counts as in
+ * flight until the handler returns, unless the handler detaches it.
+ *
+ * @param req HTTP request
+ * @param cls Request class
+ * @param handler Handler to run if admitted
+ * @return The handler's result, or ESP_FAIL once a rejection is sent
+ */
+esp_err_t http_governor_run(httpd_req_t* req, http_class_t cls, esp_err_t (*handler)(httpd_req_t* req));
+
+/**
+ * @brief Take over the in-flight period of the request being handled
+ *
+ * Called by a governed handler passing its request to another task, which
+ * calls http_governor_release() once the response is sent.
+ *
+ * @return true if the caller now owns a release, false if the request was
+ *         not admitted through the governor
+ */
+bool http_governor_detach(void);
+
+/**
+ * @brief End the in-flight period of a detached request
+ *
+ * May be called from any task.
+ */
+void http_governor_release(void);
+
+/**
+ * @brief Register a URI handler that is admitted first
+ *
+ * Drop-in for httpd_register_uri_handler(). Other methods than GET are
+ * control requests; GETs are API reads under /api/ and static assets
+ * elsewhere.
+ *
+ * @param server HTTP server handle
+ * @param uri URI handler; copied, as by httpd_register_uri_handler()
+ */
+esp_err_t http_governor_register_uri(httpd_handle_t server, const httpd_uri_t* uri);
+
+void http_governor_get_stats(http_governor_stats_t* stats);
+
+const char* http_class_name(http_class_t cls);
@@ -0,0 +1,566 @@
+#include "json_reader.h"
+
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "esp_log.h"
+
+static const char* TAG = "json_reader";
+
+// Request bodies are received in pieces of this size
+#define JSON_READER_RECV_SIZE 128
+
+typedef enum : uint8_t {
+    STATE_VALUE,            // Expecting a value
+    STATE_OBJECT_FIRST,     // After '{': key or '}'
+    STATE_OBJECT_KEY,       // After ',' in an object: key
+    STATE_COLON,            // After a key
+    STATE_ARRAY_FIRST,      // After '[': value or ']'
+    STATE_AFTER_VALUE,      // ',' or the closing bracket
+    STATE_STRING,
+    STATE_ESCAPE,           // After '\' in a string
+    STATE_UNICODE,          // Reading \u hex digits
+    STATE_NUMBER,
+    STATE_LITERAL,          // true, false or null
+    STATE_DONE,             // Only whitespace may follow
+} reader_state_t;
+
+void json_reader_init(json_reader_t* reader, json_field_t* fields, size_t field_count) {
+    memset(reader, 0, sizeof(*reader));
+    reader->fields = fields;
+    reader->field_count = field_count;
+    reader->state = STATE_VALUE;
+    for (size_t i = 0; i < field_count; i++) {
+        fields[i].found = false;
+        fields[i].is_null = false;
+        if (fields[i].type == JSON_FIELD_OBJECT) {
+            json_field_t* members = (json_field_t*)fields[i].value;
+            for (size_t j = 0; j < fields[i].size; j++) {
+                members[j].found = false;
+                members[j].is_null = false;
+            }
+        }
+    }
+}
+
+static esp_err_t fail(json_reader_t* reader, esp_err_t err, const char* format, ...) {
+    if (reader->err != ESP_OK) {
+        return reader->err;
+    }
+
+    va_list args;
+    va_start(args, format);
+    int len = vsnprintf(reader->error, sizeof(reader->error), format, args);
+    va_end(args);
+    if (len >= 0 && (size_t)len < sizeof(reader->error)) {
+        snprintf(reader->error + len, sizeof(reader->error) - len, " at byte %u", (unsigned int)reader->offset);
+    }
+
+    reader->err = err;
+    return err;
+}
+
+static esp_err_t type_error(json_reader_t* reader, json_field_t* field) {
+    static const char* const expected[] = { "a number", "a boolean", "a string", "a number", "an object" };
+    if (reader->object_field != NULL) {
+        return fail(reader, ESP_ERR_INVALID_ARG, "%s: %s: expected %s%s", reader->object_field->key, field->key,
+            expected[field->type], field->nullable ? " or null" : "");
+    }
+    return fail(reader, ESP_ERR_INVALID_ARG, "%s: expected %s%s", field->key, expected[field->type],
+        field->nullable ? " or null" : "");
+}
+
+static inline bool is_space(char c) {
+    return c == ' ' || c == '\t' || c == '\n' || c == '\r';
+}
+
+static inline bool is_digit(char c) {
+    return c >= '0' && c <= '9';
+}
+
+// Helper function to find the field of the key just read, in the table of the object it is in
+static json_field_t* find_field(json_reader_t* reader) {
+    json_field_t* fields = NULL;
+    size_t field_count = 0;
+    if (reader->depth == 1) {
+        fields = reader->fields;
+        field_count = reader->field_count;
+    }
+    else if (reader->depth == 2 && reader->object_field != NULL) {
+        fields = (json_field_t*)reader->object_field->value;
+        field_count = reader->object_field->size;
+    }
+    if (reader->token_overflow) {
+        return NULL;
+    }
+
+    for (size_t i = 0; i < field_count; i++) {
+        const char* key = fields[i].key;
+        if (strlen(key) == reader->token_len && memcmp(key, reader->token, reader->token_len) == 0) {
+            return &fields[i];
+        }
+    }
+    return NULL;
+}
+
+static void token_append(json_reader_t* reader, char c) {
+    if (reader->token_len < sizeof(reader->token)) {
+        reader->token[reader->token_len++] = c;
+    }
+    else {
+        reader->token_overflow = true;
+    }
+}
+
+// A decoded string byte: part of a key, a string field, or discarded
+static esp_err_t string_append(json_reader_t* reader, char c) {
+    if (reader->return_state == STATE_COLON) {
+        token_append(reader, c);
+        return ESP_OK;
+    }
+
+    json_field_t* field = reader->target;
+    if (field == NULL) {
+        return ESP_OK;
+    }
+    if (reader->string_len + 1 >= field->size) {
+        return fail(reader, ESP_ERR_INVALID_SIZE, "%s: longer than %u bytes", field->key, (unsigned int)(field->size - 1));
+    }
+    ((char*)field->value)[reader->string_len++] = c;
+    return ESP_OK;
+}
+
+static esp_err_t append_code_point(json_reader_t* reader, uint32_t cp) {
+    char utf8[4];
+    size_t len;
+    if (cp < 0x80) {
+        utf8[0] = cp;
+        len = 1;
+    }
+    else if (cp < 0x800) {
+        utf8[0] = 0xC0 | (cp >> 6);
+        utf8[1] = 0x80 | (cp & 0x3F);
+        len = 2;
+    }
+    else if (cp < 0x10000) {
+        utf8[0] = 0xE0 | (cp >> 12);
+        utf8[1] = 0x80 | ((cp >> 6) & 0x3F);
+        utf8[2] = 0x80 | (cp & 0x3F);
+        len = 3;
+    }
+    else {
+        utf8[0] = 0xF0 | (cp >> 18);
+        utf8[1] = 0x80 | ((cp >> 12) & 0x3F);
+        utf8[2] = 0x80 | ((cp >> 6) & 0x3F);
+        utf8[3] = 0x80 | (cp & 0x3F);
+        len = 4;
+    }
+
+    for (size_t i = 0; i < len && reader->err == ESP_OK; i++) {
+        string_append(reader, utf8[i]);
+    }
+    return reader->err;
+}
+
+static esp_err_t end_unicode_escape(json_reader_t* reader) {
+    uint32_t cp = reader->code_point;
+
+    if (reader->high_surrogate != 0) {
+        if (cp < 0xDC00 || cp > 0xDFFF) {
+            return fail(reader, ESP_ERR_INVALID_ARG, "Unpaired surrogate");
+        }
+        cp = 0x10000 + ((reader->high_surrogate - 0xD800) << 10) + (cp - 0xDC00);
+        reader->high_surrogate = 0;
+    }
+    else if (cp >= 0xD800 && cp <= 0xDBFF) {
+        reader->high_surrogate = cp;
+        return ESP_OK;
+    }
+    else if (cp >= 0xDC00 && cp <= 0xDFFF) {
+        return fail(reader, ESP_ERR_INVALID_ARG, "Unpaired surrogate");
+    }
+
+    return append_code_point(reader, cp);
+}
+
+static void begin_string(json_reader_t* reader, uint8_t return_state) {
+    reader->state = STATE_STRING;
+    reader->return_state = return_state;
+    reader->token_len = 0;
+    reader->token_overflow = false;
+    reader->string_len = 0;
+    reader->high_surrogate = 0;
+}
+
+static esp_err_t end_string(json_reader_t* reader) {
+    if (reader->high_surrogate != 0) {
+        return fail(reader, ESP_ERR_INVALID_ARG, "Unpaired surrogate");
+    }
+
+    if (reader->return_state == STATE_COLON) {
+        reader->key_field = find_field(reader);
+        if (reader->key_field == NULL && reader->depth == 1 && reader->reject_unknown) {
+            return fail(reader, ESP_ERR_INVALID_ARG, "%.*s: unknown member", (int)reader->token_len, reader->token);
+        }
+    }
+    else if (reader->target != NULL) {
+        ((char*)reader->target->value)[reader->string_len] = '\0';
+        reader->target->found = true;
+        reader->target = NULL;
+    }
+
+    reader->state = reader->return_state;
+    return ESP_OK;
+}
+
+static esp_err_t end_number(json_reader_t* reader) {
+    if (reader->token_overflow) {
+        return fail(reader, ESP_ERR_INVALID_SIZE, "Number too long");
+    }
+
+    // -?(0|[1-9][0-9]*)(.[0-9]+)?([eE][+-]?[0-9]+)?
+    const char* p = reader->token;
+    const char* end = reader->token + reader->token_len;
+    if (p < end && *p == '-') p++;
+    if (p < end && *p == '0') {
+        p++;
+    }
+    else if (p < end && is_digit(*p)) {
+        while (p < end && is_digit(*p)) p++;
+    }
+    else {
+        return fail(reader, ESP_ERR_INVALID_ARG, "Invalid number");
+    }
+    if (p < end && *p == '.') {
+        p++;
+        if (p == end || !is_digit(*p)) {
+            return fail(reader, ESP_ERR_INVALID_ARG, "Invalid number");
+        }
+        while (p < end && is_digit(*p)) p++;
+    }
+    if (p < end && (*p == 'e' || *p == 'E')) {
+        p++;
+        if (p < end && (*p == '+' || *p == '-')) p++;
+        if (p == end || !is_digit(*p)) {
+            return fail(reader, ESP_ERR_INVALID_ARG, "Invalid number");
+        }
+        while (p < end && is_digit(*p)) p++;
+    }
+    if (p != end) {
+        return fail(reader, ESP_ERR_INVALID_ARG, "Invalid number");
+    }
+
+    json_field_t* field = reader->target;
+    if (field != NULL) {
+        char text[JSON_READER_MAX_TOKEN + 1];
+        memcpy(text, reader->token, reader->token_len);
+        text[reader->token_len] = '\0';
+        double value = strtod(text, NULL);
+        if (field->type == JSON_FIELD_FLOAT) {
+            *(float*)field->value = (float)value;
+        }
+        else {
+            *(int32_t*)field->value = value >= INT32_MAX ? INT32_MAX : value <= INT32_MIN ? INT32_MIN : (int32_t)value;
+        }
+        field->found = true;
+        reader->target = NULL;
+    }
+
+    reader->state = STATE_AFTER_VALUE;
+    return ESP_OK;
+}
+
+static esp_err_t end_literal(json_reader_t* reader) {
+    bool is_true = reader->token_len == 4 && memcmp(reader->token, "true", 4) == 0;
+    bool is_false = reader->token_len == 5 && memcmp(reader->token, "false", 5) == 0;
+    bool is_null = reader->token_len == 4 && memcmp(reader->token, "null", 4) == 0;
+    if (reader->token_overflow || !(is_true || is_false || is_null)) {
+        return fail(reader, ESP_ERR_INVALID_ARG, "Invalid literal");
+    }
+
+    json_field_t* field = reader->target;
+    if (field != NULL) {
+        bool allowed = is_null ? field->nullable : field->type == JSON_FIELD_BOOL;
+        if (!allowed) {
+            return type_error(reader, field);
+        }
+        if (is_null) {
+            field->is_null = true;
+        }
+        else {
+            *(bool*)field->value = is_true;
+        }
+        field->found = true;
+        reader->target = NULL;
+    }
+
+    reader->state = STATE_AFTER_VALUE;
+    return ESP_OK;
+}
+
+static esp_err_t open_container(json_reader_t* reader, bool array) {
+    if (reader->depth == JSON_READER_MAX_DEPTH) {
+        return fail(reader, ESP_ERR_INVALID_SIZE, "Nested deeper than %d", JSON_READER_MAX_DEPTH);
+    }
+
+    reader->depth++;
+    uint8_t bit = 1u << (reader->depth - 1);
+    reader->arrays = array ? reader->arrays | bit : reader->arrays & ~bit;
+    reader->state = array ? STATE_ARRAY_FIRST : STATE_OBJECT_FIRST;
+    return ESP_OK;
+}
+
+static esp_err_t close_container(json_reader_t* reader) {
+    if (reader->depth == 2) {
+        reader->object_field = NULL;
+    }
+    reader->depth--;
+    reader->state = reader->depth == 0 ? STATE_DONE : STATE_AFTER_VALUE;
+    return ESP_OK;
+}
+
+static inline bool in_array(const json_reader_t* reader) {
+    return reader->arrays & (1u << (reader->depth - 1));
+}
+
+static esp_err_t begin_value(json_reader_t* reader, char c) {
+    // The value of a known top-level key goes to its field
+    json_field_t* field = reader->key_field;
+    reader->key_field = NULL;
+    reader->target = field;
+
+    if (reader->depth == 0 && c != '{') {
+        return fail(reader, ESP_ERR_INVALID_ARG, "Body must be a JSON object");
+    }
+
+    if (c == '{' || c == '[') {
+        if (field != NULL && (c == '[' || field->type != JSON_FIELD_OBJECT)) {
+            return type_error(reader, field);
+        }
+        if (field != NULL) {
+            field->found = true;
+            reader->object_field = field;
+            reader->target = NULL;
+        }
+        return open_container(reader, c == '[');
+    }
+    if (c == '"') {
+        if (field != NULL && field->type != JSON_FIELD_STRING) {
+            return type_error(reader, field);
+        }
+        begin_string(reader, STATE_AFTER_VALUE);
+        return ESP_OK;
+    }
+    if (c == '-' || is_digit(c)) {
+        if (field != NULL && field->type != JSON_FIELD_INT && field->type != JSON_FIELD_FLOAT) {
+            return type_error(reader, field);
+        }
+        reader->state = STATE_NUMBER;
+    }
+    else if (c >= 'a' && c <= 'z') {
+        // Only null can suit a nullable field; anything else fails on the literal
+        if (field != NULL && field->type != JSON_FIELD_BOOL && !field->nullable) {
+            return type_error(reader, field);
+        }
+        reader->state = STATE_LITERAL;
+    }
+    else {
+        return fail(reader, ESP_ERR_INVALID_ARG, "Unexpected '%c'", c);
+    }
+
+    reader->token_len = 0;
+    reader->token_overflow = false;
+    token_append(reader, c);
+    return ESP_OK;
+}
+
+static esp_err_t feed_char(json_reader_t* reader, char c) {
+    switch (reader->state) {
+    case STATE_STRING:
+        if (c == '"') {
+            return end_string(reader);
+        }
+        if (c == '\\') {
+            reader->state = STATE_ESCAPE;
+            return ESP_OK;
+        }
+        if ((unsigned char)c < 0x20) {
+            return fail(reader, ESP_ERR_INVALID_ARG, "Control character in string");
+        }
+        if (reader->high_surrogate != 0) {
+            return fail(reader, ESP_ERR_INVALID_ARG, "Unpaired surrogate");
+        }
+        return string_append(reader, c);
+
+    case STATE_ESCAPE: {
+        reader->state = STATE_STRING;
+        if (c == 'u') {
+            reader->state = STATE_UNICODE;
+            reader->code_point = 0;
+            reader->hex_digits = 4;
+            return ESP_OK;
+        }
+        if (reader->high_surrogate != 0) {
+            return fail(reader, ESP_ERR_INVALID_ARG, "Unpaired surrogate");
+        }
+
+        static const char escapes[] = "\"\"\\\\//b\bf\fn\nr\rt\t";
+        for (size_t i = 0; i < sizeof(escapes) - 1; i += 2) {
+            if (escapes[i] == c) {
+                return string_append(reader, escapes[i + 1]);
+            }
+        }
+        return fail(reader, ESP_ERR_INVALID_ARG, "Invalid escape '\\%c'", c);
+    }
+
+    case STATE_UNICODE: {
+        uint32_t digit;
+        if (is_digit(c)) digit = c - '0';
+        else if (c >= 'a' && c <= 'f') digit = c - 'a' + 10;
+        else if (c >= 'A' && c <= 'F') digit = c - 'A' + 10;
+        else return fail(reader, ESP_ERR_INVALID_ARG, "Invalid \\u escape");
+
+        reader->code_point = (reader->code_point << 4) | digit;
+        if (--reader->hex_digits == 0) {
+            reader->state = STATE_STRING;
+            return end_unicode_escape(reader);
+        }
+        return ESP_OK;
+    }
+
+    case STATE_NUMBER:
+        if (is_digit(c) || c == '-' || c == '+' || c == '.' || c == 'e' || c == 'E') {
+            token_append(reader, c);
+            return ESP_OK;
+        }
+        if (end_number(reader) != ESP_OK) {
+            return reader->err;
+        }
+        return feed_char(reader, c);
+
+    case STATE_LITERAL:
+        if (c >= 'a' && c <= 'z') {
+            token_append(reader, c);
+            return ESP_OK;
+        }
+        if (end_literal(reader) != ESP_OK) {
+            return reader->err;
+        }
+        return feed_char(reader, c);
+
+    default:
+        break;
+    }
+
+    if (is_space(c)) {
+        return ESP_OK;
+    }
+
+    switch (reader->state) {
+    case STATE_VALUE:
+        return begin_value(reader, c);
+
+    case STATE_ARRAY_FIRST:
+        if (c == ']') {
+            return close_container(reader);
+        }
+        return begin_value(reader, c);
+
+    case STATE_OBJECT_FIRST:
+        if (c == '}') {
+            return close_container(reader);
+        }
+        [[fallthrough]];
+    case STATE_OBJECT_KEY:
+        if (c != '"') {
+            return fail(reader, ESP_ERR_INVALID_ARG, "Expected a key");
+        }
+        begin_string(reader, STATE_COLON);
+        return ESP_OK;
+
+    case STATE_COLON:
+        if (c != ':') {
+            return fail(reader, ESP_ERR_INVALID_ARG, "Expected ':'");
+        }
+        reader->state = STATE_VALUE;
+        return ESP_OK;
+
+    case STATE_AFTER_VALUE:
+        if (c == ',') {
+            reader->state = in_array(reader) ? STATE_VALUE : STATE_OBJECT_KEY;
+            return ESP_OK;
+        }
+        if (c == (in_array(reader) ? ']' : '}')) {
+            return close_container(reader);
+        }
+        return fail(reader, ESP_ERR_INVALID_ARG, in_array(reader) ? "Expected ',' or ']'" : "Expected ',' or '}'");
+
+    case STATE_DONE:
+    default:
+        return fail(reader, ESP_ERR_INVALID_ARG, "Unexpected data after the object");
+    }
+}
+
+esp_err_t json_reader_feed(json_reader_t* reader, const char* data, size_t len) {
+    for (size_t i = 0; i < len && reader->err == ESP_OK; i++) {
+        if (reader->offset == JSON_READER_MAX_BODY) {
+            return fail(reader, ESP_ERR_INVALID_SIZE, "Body larger than %d bytes", JSON_READER_MAX_BODY);
+        }
+        feed_char(reader, data[i]);
+        reader->offset++;
+    }
+    return reader->err;
+}
+
+esp_err_t json_reader_finish(json_reader_t* reader) {
+    if (reader->err != ESP_OK) {
+        return reader->err;
+    }
+    if (reader->state != STATE_DONE) {
+        return fail(reader, ESP_ERR_INVALID_ARG, "Unexpected end of body");
+    }
+    return ESP_OK;
+}
+
+const char* json_reader_error(const json_reader_t* reader) {
+    return reader->err != ESP_OK ? reader->error : "";
+}
+
+esp_err_t json_read_request(httpd_req_t* req, json_field_t* fields, size_t field_count) {
+    if (req->content_len > JSON_READER_MAX_BODY) {
+        httpd_resp_set_status(req, "413 Content Too Large");
+        httpd_resp_send(req, "Request body too large", HTTPD_RESP_USE_STRLEN);
+        return ESP_FAIL;
+    }
+
+    json_reader_t reader;
+    json_reader_init(&reader, fields, field_count);
+
+    char buf[JSON_READER_RECV_SIZE];
+    size_t remaining = req->content_len;
+    while (remaining > 0 && reader.err == ESP_OK) {
+        int ret = httpd_req_recv(req, buf, remaining < sizeof(buf) ? remaining : sizeof(buf));
+        if (ret <= 0) {
+            if (ret == HTTPD_SOCK_ERR_TIMEOUT) {
+                httpd_resp_send_408(req);
+            }
+            else {
+                httpd_resp_send_500(req);
+            }
+            return ESP_FAIL;
+        }
+
+        json_reader_feed(&reader, buf, ret);
+        remaining -= ret;
+    }
+
+    if (json_reader_finish(&reader) != ESP_OK) {
+        ESP_LOGW(TAG, "%s: %s", req->uri, json_reader_error(&reader));
+        httpd_resp_send_err(req, HTTPD_400_BAD_REQUEST, json_reader_error(&reader));
+        return ESP_FAIL;
+    }
+
+    return ESP_OK;
+}
@@ -0,0 +1,118 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "esp_err.h"
+#include "esp_http_server.h"
+
+// Largest request body accepted
+#define JSON_READER_MAX_BODY 1024
+
+// Deepest object/array nesting accepted
+#define JSON_READER_MAX_DEPTH 8
+
+// Longest key, number or literal; longer keys never match a field
+#define JSON_READER_MAX_TOKEN 32
+
+typedef enum : uint8_t {
+    JSON_FIELD_INT,         // value: int32_t*, clamped and truncated toward zero
+    JSON_FIELD_BOOL,        // value: bool*
+    JSON_FIELD_STRING,      // value: char[size], NUL-terminated
+    JSON_FIELD_FLOAT,       // value: float*
+    JSON_FIELD_OBJECT,      // value: json_field_t[size], members of the nested object; top level only
+} json_field_type_t;
+
+/**
+ * @brief A member of the body's top-level object to extract
+ *
+ * The value is only written when the key is present; found records that.
+ * A nullable field also accepts null, which sets found and is_null and
+ * leaves the value alone.
+ */
+typedef struct {
+    const char* key;
+    json_field_type_t type;
+    void* value;
+    size_t size;            // Buffer size for JSON_FIELD_STRING, field count for JSON_FIELD_OBJECT
+    bool nullable;
+    bool found;
+    bool is_null;
+} json_field_t;
+
+/*
+ * Incremental JSON reader
+ *
+ * Tokenizes a body fed in pieces of any size, without building a tree:
+ * values of the listed top-level keys are decoded into their fields and
+ * everything else is checked for syntax and skipped. A JSON_FIELD_OBJECT
+ * field routes the members of its object to fields of its own, so one
+ * body can carry several field tables. State is fixed-size, so a request
+ * costs the same memory whatever the body holds.
+ *
+ * Errors are sticky and carry the byte offset they were found at.
+ */
+typedef struct {
+    json_field_t* fields;
+    size_t field_count;
+    json_field_t* key_field;    // Field named by the last top-level key
+    json_field_t* target;       // Field the value being read belongs to
+    json_field_t* object_field; // JSON_FIELD_OBJECT whose members are being read
+    size_t offset;              // Bytes consumed
+    size_t string_len;          // Bytes written to a JSON_FIELD_STRING value
+    uint32_t code_point;        // \u escape being decoded
+    uint16_t high_surrogate;    // First half of a surrogate pair, or 0
+    uint8_t state;
+    uint8_t return_state;       // State after the current string
+    uint8_t hex_digits;         // \u digits still to read
+    uint8_t depth;
+    uint8_t arrays;             // Bit per depth: the container is an array
+    bool token_overflow;
+    bool reject_unknown;        // Top-level keys without a field are an error; set after init
+    char token[JSON_READER_MAX_TOKEN];
+    uint8_t token_len;
+    esp_err_t err;
+    char error[64];
+} json_reader_t;
+
+/**
+ * @brief Start reading a body
+ *
+ * @param reader Reader state
+ * @param fields Top-level members to extract
+ * @param field_count Number of fields
+ */
+void json_reader_init(json_reader_t* reader, json_field_t* fields, size_t field_count);
+
+/**
+ * @brief Consume the next piece of the body
+ *
+ * @return ESP_OK, ESP_ERR_INVALID_ARG for malformed or mistyped input, or
+ *         ESP_ERR_INVALID_SIZE when a limit is exceeded
+ */
+esp_err_t json_reader_feed(json_reader_t* reader, const char* data, size_t len);
+
+/**
+ * @brief Check that the body ended with a complete object
+ *
+ * @return ESP_OK or the error, as for json_reader_feed()
+ */
+esp_err_t json_reader_finish(json_reader_t* reader);
+
+/**
+ * @brief Describe the first error, e.g. "brightness: expected a number at byte 15"
+ */
+const char* json_reader_error(const json_reader_t* reader);
+
+/**
+ * @brief Read a request body into fields
+ *
+ * Receives the body in small pieces until Content-Length is reached. On
+ * failure the error response (400, 408, 413 or 500) has already been sent.
+ *
+ * @param req HTTP request
+ * @param fields Top-level members to extract
+ * @param field_count Number of fields
+ * @return ESP_OK, or ESP_FAIL after sending an error response
+ */
+esp_err_t json_read_request(httpd_req_t* req, json_field_t* fields, size_t field_count);
@@ -0,0 +1,221 @@
+#include "json_writer.h"
+
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+
+void json_writer_init(json_writer_t* writer, char* buf, size_t size, httpd_req_t* req) {
+    *writer = {};
+    writer->req = req;
+    writer->buf = buf;
+    writer->size = size;
+    writer->err = size > 1 ? ESP_OK : ESP_ERR_INVALID_SIZE;
+}
+
+static void flush(json_writer_t* writer) {
+    if (writer->req == NULL) {
+        writer->err = ESP_ERR_NO_MEM;
+        return;
+    }
+
+    esp_err_t err = httpd_resp_send_chunk(writer->req, writer->buf, writer->len);
+    if (err != ESP_OK) {
+        writer->err = err;
+        return;
+    }
+    writer->flushed = true;
+    writer->len = 0;
+}
+
+static void put(json_writer_t* writer, const char* data, size_t len) {
+    // Without a request the last byte is kept for the terminator
+    size_t capacity = writer->req != NULL ? writer->size : writer->size - 1;
+
+    while (len > 0 && writer->err == ESP_OK) {
+        if (writer->len == capacity) {
+            flush(writer);
+            continue;
+        }
+
+        size_t n = capacity - writer->len < len ? capacity - writer->len : len;
+        memcpy(writer->buf + writer->len, data, n);
+        writer->len += n;
+        data += n;
+        len -= n;
+    }
+}
+
+static inline void put_char(json_writer_t* writer, char c) {
+    put(writer, &c, 1);
+}
+
+// Comma before every value but the first at its level, none after a key
+static void begin_value(json_writer_t* writer) {
+    if (writer->after_key) {
+        writer->after_key = false;
+        return;
+    }
+
+    uint16_t bit = 1u << writer->depth;
+    if (writer->has_items & bit) {
+        put_char(writer, ',');
+    }
+    writer->has_items |= bit;
+}
+
+static void open_container(json_writer_t* writer, char c) {
+    begin_value(writer);
+    if (writer->depth == JSON_WRITER_MAX_DEPTH) {
+        writer->err = ESP_ERR_INVALID_STATE;
+        return;
+    }
+    put_char(writer, c);
+    writer->depth++;
+    writer->has_items &= ~(1u << writer->depth);
+}
+
+static void close_container(json_writer_t* writer, char c) {
+    if (writer->depth == 0) {
+        writer->err = ESP_ERR_INVALID_STATE;
+        return;
+    }
+    put_char(writer, c);
+    writer->depth--;
+}
+
+static void put_escaped(json_writer_t* writer, const char* value) {
+    static const char hex[] = "0123456789abcdef";
+
+    put_char(writer, '"');
+    const char* run = value;
+    for (const char* p = value; ; p++) {
+        unsigned char c = (unsigned char)*p;
+        if (c != '\0' && c >= 0x20 && c != '"' && c != '\\') {
+            continue;
+        }
+
+        put(writer, run, p - run);
+        if (c == '\0') {
+            break;
+        }
+        if (c == '"' || c == '\\') {
+            char escaped[2] = { '\\', (char)c };
+            put(writer, escaped, sizeof(escaped));
+        }
+        else {
+            char escaped[6] = { '\\', 'u', '0', '0', hex[c >> 4], hex[c & 0xF] };
+            put(writer, escaped, sizeof(escaped));
+        }
+        run = p + 1;
+    }
+    put_char(writer, '"');
+}
+
+esp_err_t json_writer_finish(json_writer_t* writer) {
+    if (writer->err == ESP_OK && writer->depth != 0) {
+        writer->err = ESP_ERR_INVALID_STATE;
+    }
+    if (writer->err != ESP_OK) {
+        return writer->err;
+    }
+
+    if (writer->req == NULL) {
+        writer->buf[writer->len] = '\0';
+        return ESP_OK;
+    }
+
+    // Small bodies go out in one send, with a Content-Length
+    if (!writer->flushed) {
+        return httpd_resp_send(writer->req, writer->buf, writer->len);
+    }
+
+    esp_err_t err = writer->len > 0 ? httpd_resp_send_chunk(writer->req, writer->buf, writer->len) : ESP_OK;
+    if (err == ESP_OK) {
+        err = httpd_resp_send_chunk(writer->req, NULL, 0);
+    }
+    return err;
+}
+
+void json_object_begin(json_writer_t* writer) {
+    open_container(writer, '{');
+}
+
+void json_object_end(json_writer_t* writer) {
+    close_container(writer, '}');
+}
+
+void json_array_begin(json_writer_t* writer) {
+    open_container(writer, '[');
+}
+
+void json_array_end(json_writer_t* writer) {
+    close_container(writer, ']');
+}
+
+void json_key(json_writer_t* writer, const char* key) {
+    begin_value(writer);
+    put_escaped(writer, key);
+    put_char(writer, ':');
+    writer->after_key = true;
+}
+
+void json_int(json_writer_t* writer, int32_t value) {
+    char digits[12];
+    char* p = digits + sizeof(digits);
+    uint32_t magnitude = value < 0 ? 0u - (uint32_t)value : (uint32_t)value;
+    do {
+        *--p = '0' + magnitude % 10;
+        magnitude /= 10;
+    } while (magnitude != 0);
+    if (value < 0) {
+        *--p = '-';
+    }
+
+    begin_value(writer);
+    put(writer, p, digits + sizeof(digits) - p);
+}
+
+void json_float(json_writer_t* writer, float value) {
+    if (!isfinite(value)) {
+        json_null(writer);
+        return;
+    }
+
+    char text[16];
+    int len = snprintf(text, sizeof(text), "%g", (double)value);
+    begin_value(writer);
+    put(writer, text, len);
+}
+
+void json_bool(json_writer_t* writer, bool value) {
+    begin_value(writer);
+    if (value) {
+        put(writer, "true", 4);
+    }
+    else {
+        put(writer, "false", 5);
+    }
+}
+
+void json_null(json_writer_t* writer) {
+    begin_value(writer);
+    put(writer, "null", 4);
+}
+
+void json_string(json_writer_t* writer, const char* value) {
+    begin_value(writer);
+    put_escaped(writer, value != NULL ? value : "");
+}
+
+void json_color(json_writer_t* writer, uint32_t color) {
+    static const char hex[] = "0123456789ABCDEF";
+
+    char text[9] = { '"', '#' };
+    for (int i = 0; i < 6; i++) {
+        text[2 + i] = hex[(color >> (20 - 4 * i)) & 0xF];
+    }
+    text[8] = '"';
+
+    begin_value(writer);
+    put(writer, text, sizeof(text));
+}
@@ -0,0 +1,91 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "esp_err.h"
+#include "esp_http_server.h"
+
+// Deepest object/array nesting the writer tracks
+#define JSON_WRITER_MAX_DEPTH 8
+
+/*
+ * Streaming JSON writer
+ *
+ * Serializes straight into a caller-provided buffer with no heap use. With
+ * an httpd request attached, a full buffer is flushed as a response chunk,
+ * so output of any size fits a small stack buffer; output that fits the
+ * buffer goes out in one send with a Content-Length instead.
+ *
+ * Errors are sticky: once the buffer overflows (without a request) or a send
+ * fails, further calls do nothing and json_writer_finish() reports it.
+ */
+typedef struct {
+    httpd_req_t* req;       // Flush target, or NULL to write into buf only
+    char* buf;
+    size_t size;
+    size_t len;
+    bool flushed;           // Part of the body already went out as a chunk
+    bool after_key;         // Next value follows a key, no comma
+    uint8_t depth;
+    uint16_t has_items;     // Bit per depth: a value was written at that level
+    esp_err_t err;
+} json_writer_t;
+
+/**
+ * @brief Start writing
+ *
+ * @param writer Writer state
+ * @param buf Output buffer
+ * @param size Size of buf
+ * @param req Request to stream the body to, or NULL to only fill buf
+ */
+void json_writer_init(json_writer_t* writer, char* buf, size_t size, httpd_req_t* req);
+
+/**
+ * @brief Finish writing
+ *
+ * Sends what is left to the request, or NUL-terminates buf when there is no
+ * request (so buf needs one spare byte).
+ *
+ * @return ESP_OK, ESP_ERR_NO_MEM if buf was too small, or the send error
+ */
+esp_err_t json_writer_finish(json_writer_t* writer);
+
+void json_object_begin(json_writer_t* writer);
+void json_object_end(json_writer_t* writer);
+void json_array_begin(json_writer_t* writer);
+void json_array_end(json_writer_t* writer);
+
+// Member name; the next value belongs to it
+void json_key(json_writer_t* writer, const char* key);
+
+void json_int(json_writer_t* writer, int32_t value);
+void json_float(json_writer_t* writer, float value);
+void json_bool(json_writer_t* writer, bool value);
+void json_null(json_writer_t* writer);
+void json_string(json_writer_t* writer, const char* value);
+
+// 0xRRGGBB as a "#RRGGBB" string
+void json_color(json_writer_t* writer, uint32_t color);
+
+// Object members
+static inline void json_kv_int(json_writer_t* writer, const char* key, int32_t value) {
+    json_key(writer, key);
+    json_int(writer, value);
+}
+
+static inline void json_kv_bool(json_writer_t* writer, const char* key, bool value) {
+    json_key(writer, key);
+    json_bool(writer, value);
+}
+
+static inline void json_kv_string(json_writer_t* writer, const char* key, const char* value) {
+    json_key(writer, key);
+    json_string(writer, value);
+}
+
+static inline void json_kv_color(json_writer_t* writer, const char* key, uint32_t color) {
+    json_key(writer, key);
+    json_color(writer, color);
+}
@@ -0,0 +1,276 @@
+#include "pb_codec.h"
+
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+
+#include "esp_log.h"
+
+static const char* TAG = "pb_codec";
+
+typedef enum : uint8_t {
+    WIRE_VARINT = 0,
+    WIRE_FIXED64 = 1,
+    WIRE_LEN = 2,
+    WIRE_FIXED32 = 5,
+} wire_type_t;
+
+void pb_writer_init(pb_writer_t* writer, uint8_t* buf, size_t size) {
+    *writer = {};
+    writer->buf = buf;
+    writer->size = size;
+}
+
+static void put(pb_writer_t* writer, const void* data, size_t len) {
+    if (writer->err != ESP_OK) {
+        return;
+    }
+    if (len > writer->size - writer->len) {
+        writer->err = ESP_ERR_NO_MEM;
+        return;
+    }
+    memcpy(writer->buf + writer->len, data, len);
+    writer->len += len;
+}
+
+static size_t encode_varint(uint8_t* out, uint64_t value) {
+    size_t n = 0;
+    do {
+        out[n] = (value & 0x7F) | (value > 0x7F ? 0x80 : 0);
+        value >>= 7;
+        n++;
+    } while (value != 0);
+    return n;
+}
+
+static void put_varint(pb_writer_t* writer, uint64_t value) {
+    uint8_t out[10];
+    put(writer, out, encode_varint(out, value));
+}
+
+static inline void put_tag(pb_writer_t* writer, uint32_t number, wire_type_t type) {
+    put_varint(writer, ((uint64_t)number << 3) | type);
+}
+
+void pb_write_uint(pb_writer_t* writer, uint32_t number, uint32_t value) {
+    put_tag(writer, number, WIRE_VARINT);
+    put_varint(writer, value);
+}
+
+void pb_write_bool(pb_writer_t* writer, uint32_t number, bool value) {
+    put_tag(writer, number, WIRE_VARINT);
+    put_varint(writer, value ? 1 : 0);
+}
+
+void pb_write_string(pb_writer_t* writer, uint32_t number, const char* value) {
+    size_t len = strlen(value);
+    put_tag(writer, number, WIRE_LEN);
+    put_varint(writer, len);
+    put(writer, value, len);
+}
+
+// One length byte is reserved; the body moves up if it needs more
+size_t pb_message_begin(pb_writer_t* writer, uint32_t number) {
+    put_tag(writer, number, WIRE_LEN);
+    size_t mark = writer->len;
+    put(writer, "", 1);
+    return mark;
+}
+
+void pb_message_end(pb_writer_t* writer, size_t mark) {
+    if (writer->err != ESP_OK) {
+        return;
+    }
+
+    size_t body_len = writer->len - mark - 1;
+    uint8_t prefix[10];
+    size_t prefix_len = encode_varint(prefix, body_len);
+    if (prefix_len > 1) {
+        if (prefix_len - 1 > writer->size - writer->len) {
+            writer->err = ESP_ERR_NO_MEM;
+            return;
+        }
+        memmove(writer->buf + mark + prefix_len, writer->buf + mark + 1, body_len);
+        writer->len += prefix_len - 1;
+    }
+    memcpy(writer->buf + mark, prefix, prefix_len);
+}
+
+// Helper function to read a varint; false if truncated or longer than 10 bytes
+static bool read_varint(const uint8_t** p, const uint8_t* end, uint64_t* value) {
+    uint64_t result = 0;
+    for (int shift = 0; shift < 70 && *p < end; shift += 7) {
+        uint8_t byte = *(*p)++;
+        result |= (uint64_t)(byte & 0x7F) << shift;
+        if ((byte & 0x80) == 0) {
+            *value = result;
+            return true;
+        }
+    }
+    return false;
+}
+
+static pb_field_t* find_field(pb_field_t* fields, size_t field_count, uint64_t number) {
+    for (size_t i = 0; i < field_count; i++) {
+        if (fields[i].number == number) {
+            return &fields[i];
+        }
+    }
+    return NULL;
+}
+
+esp_err_t pb_decode(const uint8_t* data, size_t len, pb_field_t* fields, size_t field_count) {
+    for (size_t i = 0; i < field_count; i++) {
+        fields[i].found = false;
+    }
+
+    const uint8_t* p = data;
+    const uint8_t* end = data + len;
+    while (p < end) {
+        uint64_t tag, value = 0;
+        if (!read_varint(&p, end, &tag) || (tag >> 3) == 0) {
+            return ESP_ERR_INVALID_ARG;
+        }
+
+        // Read or skip the payload
+        const uint8_t* bytes = NULL;
+        switch (tag & 0x07) {
+        case WIRE_VARINT:
+            if (!read_varint(&p, end, &value)) {
+                return ESP_ERR_INVALID_ARG;
+            }
+            break;
+        case WIRE_FIXED64:
+        case WIRE_FIXED32: {
+            size_t size = (tag & 0x07) == WIRE_FIXED64 ? 8 : 4;
+            if ((size_t)(end - p) < size) {
+                return ESP_ERR_INVALID_ARG;
+            }
+            p += size;
+            break;
+        }
+        case WIRE_LEN:
+            if (!read_varint(&p, end, &value) || value > (uint64_t)(end - p)) {
+                return ESP_ERR_INVALID_ARG;
+            }
+            bytes = p;
+            p += value;
+            break;
+        default:
+            // Groups are not used by proto3
+            return ESP_ERR_INVALID_ARG;
+        }
+
+        // Last occurrence wins, as in any protobuf decoder
+        pb_field_t* field = find_field(fields, field_count, tag >> 3);
+        if (field == NULL) {
+            continue;
+        }
+
+        switch (field->type) {
+        case PB_FIELD_INT:
+            if ((tag & 0x07) != WIRE_VARINT) {
+                return ESP_ERR_INVALID_ARG;
+            }
+            *(int32_t*)field->value = (int32_t)(uint32_t)value;
+            break;
+        case PB_FIELD_BOOL:
+            if ((tag & 0x07) != WIRE_VARINT) {
+                return ESP_ERR_INVALID_ARG;
+            }
+            *(bool*)field->value = value != 0;
+            break;
+        case PB_FIELD_STRING: {
+            if ((tag & 0x07) != WIRE_LEN || value >= field->size) {
+                return ESP_ERR_INVALID_ARG;
+            }
+            char* out = (char*)field->value;
+            memcpy(out, bytes, value);
+            out[value] = '\0';
+            break;
+        }
+        }
+        field->found = true;
+    }
+
+    return ESP_OK;
+}
+
+// Helper function to compare a media type, up to its parameters
+static bool media_type_is(const char* p, size_t len, const char* type) {
+    while (len > 0 && (p[len - 1] == ' ' || p[len - 1] == '\t')) {
+        len--;
+    }
+    return len == strlen(type) && strncasecmp(p, type, len) == 0;
+}
+
+bool pb_request_accepted(httpd_req_t* req) {
+    // Only an explicit entry counts; */* keeps JSON
+    char accept[128];
+    if (httpd_req_get_hdr_value_str(req, "Accept", accept, sizeof(accept)) != ESP_OK) {
+        return false;
+    }
+
+    const char* p = accept;
+    while (true) {
+        p += strspn(p, " \t,");
+        if (*p == '\0') {
+            return false;
+        }
+
+        size_t len = strcspn(p, ",;");
+        bool match = media_type_is(p, len, PB_CONTENT_TYPE);
+        p += len;
+
+        // Parameters run to the next comma; only the weight matters
+        size_t params = strcspn(p, ",");
+        if (match) {
+            const char* q = p;
+            while (q < p + params && strncmp(q, "q=", 2) != 0) {
+                q++;
+            }
+            return q >= p + params || strtof(q + 2, NULL) > 0.0f;
+        }
+        p += params;
+    }
+}
+
+bool pb_request_body_is_protobuf(httpd_req_t* req) {
+    char content_type[64];
+    if (httpd_req_get_hdr_value_str(req, "Content-Type", content_type, sizeof(content_type)) != ESP_OK) {
+        return false;
+    }
+    return media_type_is(content_type, strcspn(content_type, ";"), PB_CONTENT_TYPE);
+}
+
+esp_err_t pb_read_request(httpd_req_t* req, pb_field_t* fields, size_t field_count) {
+    if (req->content_len > PB_READER_MAX_BODY) {
+        httpd_resp_set_status(req, "413 Content Too Large");
+        httpd_resp_send(req, "Request body too large", HTTPD_RESP_USE_STRLEN);
+        return ESP_FAIL;
+    }
+
+    uint8_t buf[PB_READER_MAX_BODY];
+    size_t received = 0;
+    while (received < req->content_len) {
+        int ret = httpd_req_recv(req, (char*)buf + received, req->content_len - received);
+        if (ret <= 0) {
+            if (ret == HTTPD_SOCK_ERR_TIMEOUT) {
+                httpd_resp_send_408(req);
+            }
+            else {
+                httpd_resp_send_500(req);
+            }
+            return ESP_FAIL;
+        }
+        received += ret;
+    }
+
+    if (pb_decode(buf, received, fields, field_count) != ESP_OK) {
+        ESP_LOGW(TAG, "%s: malformed protobuf body (%u bytes)", req->uri, (unsigned int)received);
+        httpd_resp_send_err(req, HTTPD_400_BAD_REQUEST, "Malformed protobuf message");
+        return ESP_FAIL;
+    }
+
+    return ESP_OK;
+}
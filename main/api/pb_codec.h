@@ -0,0 +1,106 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "esp_err.h"
+#include "esp_http_server.h"
+
+/*
+ * Protocol Buffers wire format for the config endpoints
+ *
+ * Messages are written into and decoded from caller-owned buffers; there
+ * is no generated code and no heap. The schema the endpoints follow is
+ * docs/clock-config.proto.
+ */
+#define PB_CONTENT_TYPE "application/x-protobuf"
+
+// Largest request body accepted; the whole body is decoded at once
+#define PB_READER_MAX_BODY 256
+
+typedef enum : uint8_t {
+    PB_FIELD_INT,           // value: int32_t*, int32/uint32 varint truncated to 32 bits
+    PB_FIELD_BOOL,          // value: bool*
+    PB_FIELD_STRING,        // value: char[size], NUL-terminated
+} pb_field_type_t;
+
+/**
+ * @brief A top-level field of the message to extract
+ *
+ * The value is only written when the field is present; found records that.
+ * Unlisted fields are skipped.
+ */
+typedef struct {
+    uint32_t number;
+    pb_field_type_t type;
+    void* value;
+    size_t size;            // Buffer size for PB_FIELD_STRING
+    bool found;
+} pb_field_t;
+
+typedef struct {
+    uint8_t* buf;
+    size_t size;
+    size_t len;
+    esp_err_t err;          // ESP_ERR_NO_MEM once the buffer overflows
+} pb_writer_t;
+
+/**
+ * @brief Start writing a message into buf
+ */
+void pb_writer_init(pb_writer_t* writer, uint8_t* buf, size_t size);
+
+/**
+ * @brief Write a varint field (int32 values must not be negative)
+ */
+void pb_write_uint(pb_writer_t* writer, uint32_t number, uint32_t value);
+
+/**
+ * @brief Write a bool field
+ */
+void pb_write_bool(pb_writer_t* writer, uint32_t number, bool value);
+
+/**
+ * @brief Write a string field
+ */
+void pb_write_string(pb_writer_t* writer, uint32_t number, const char* value);
+
+/**
+ * @brief Open an embedded message field
+ *
+ * @return Mark to pass to pb_message_end()
+ */
+size_t pb_message_begin(pb_writer_t* writer, uint32_t number);
+
+/**
+ * @brief Close the embedded message opened at mark and fill in its length
+ */
+void pb_message_end(pb_writer_t* writer, size_t mark);
+
+/**
+ * @brief Decode a message into fields
+ *
+ * @return ESP_OK, or ESP_ERR_INVALID_ARG for a truncated or malformed
+ *         message or a field with the wrong wire type
+ */
+esp_err_t pb_decode(const uint8_t* data, size_t len, pb_field_t* fields, size_t field_count);
+
+/**
+ * @brief Whether the request's Accept header asks for protobuf
+ */
+bool pb_request_accepted(httpd_req_t* req);
+
+/**
+ * @brief Whether the request body is protobuf, by its Content-Type
+ */
+bool pb_request_body_is_protobuf(httpd_req_t* req);
+
+/**
+ * @brief Read a protobuf request body into fields
+ *
+ * On failure the error response (400, 408, 413 or 500) has already been
+ * sent.
+ *
+ * @return ESP_OK, or ESP_FAIL after sending an error response
+ */
+esp_err_t pb_read_request(httpd_req_t* req, pb_field_t* fields, size_t field_count);
@@ -0,0 +1,232 @@
+#include "pixel_stream.h"
+
+#include "clock_events.h"
+#include "json_writer.h"
+#include "kd_pixdriver.h"
+#include "mem_policy.h"
+
+#include "esp_log.h"
+#include "esp_timer.h"
+#include <string.h>
+#include <sys/select.h>
+
+static const char* TAG = "pixel_stream";
+
+// Largest frame: an RGBW pixel for every LED of the wordclock grid
+#define PIXEL_STREAM_MAX_PIXELS 256
+#define PIXEL_STREAM_MAX_FRAME (PIXEL_STREAM_HEADER_SIZE + PIXEL_STREAM_MAX_PIXELS * 4)
+
+#define STATS_INTERVAL_US 1000000
+
+// Frames are received here and converted straight into the pixel buffer
+static uint8_t* frame_buf = NULL;
+
+static httpd_handle_t stream_server = NULL;
+static int owner_fd = -1;
+static volatile bool streaming = false;
+static esp_timer_handle_t idle_timer = NULL;
+
+// Applied and dropped frames: in total, and since the last stats report
+static uint32_t frames_total = 0;
+static uint32_t dropped_total = 0;
+static uint32_t frames_window = 0;
+static int64_t window_start = 0;
+static int64_t last_applied = 0;
+
+bool pixel_stream_active(void) {
+    return streaming;
+}
+
+// Runs in the esp_timer task once frames stop
+static void idle_callback(void* arg) {
+    streaming = false;
+    ESP_LOGI(TAG, "Stream ended after %lu frames, %lu dropped",
+        (unsigned long)frames_total, (unsigned long)dropped_total);
+    esp_event_post(CLOCK_EVENTS, CLOCK_EVENT_DISPLAY_RELEASED, nullptr, 0, 0);
+}
+
+static void touch_idle_timer(void) {
+    esp_timer_stop(idle_timer);
+    esp_timer_start_once(idle_timer, PIXEL_STREAM_IDLE_TIMEOUT_MS * 1000);
+}
+
+// True if more data is already waiting behind the frame just read
+static bool newer_frame_waiting(int fd) {
+    fd_set readfds;
+    FD_ZERO(&readfds);
+    FD_SET(fd, &readfds);
+    struct timeval timeout = { 0, 0 };
+    return select(fd + 1, &readfds, NULL, NULL, &timeout) > 0;
+}
+
+static inline uint8_t add_white(uint8_t c, uint8_t w) {
+    return c + w > 255 ? 255 : c + w;
+}
+
+static bool apply_frame(const uint8_t* frame, size_t len) {
+    if (len < PIXEL_STREAM_HEADER_SIZE) {
+        return false;
+    }
+
+    uint8_t bytes_per_pixel = frame[0];
+    size_t first = frame[2] | (frame[3] << 8);
+    const uint8_t* data = frame + PIXEL_STREAM_HEADER_SIZE;
+    size_t data_len = len - PIXEL_STREAM_HEADER_SIZE;
+    if ((bytes_per_pixel != 3 && bytes_per_pixel != 4) || data_len % bytes_per_pixel != 0) {
+        return false;
+    }
+
+    std::vector<PixelColor>& pixels = PixelDriver::getMainChannel()->getPixelBuffer();
+    size_t count = data_len / bytes_per_pixel;
+    if (first >= pixels.size()) {
+        return true;
+    }
+    if (count > pixels.size() - first) {
+        count = pixels.size() - first;
+    }
+
+    if (!streaming) {
+        // A clock's effect mask would otherwise hide the pixels it leaves out
+        PixelDriver::getMainChannel()->setEffectByID("raw");
+        PixelDriver::getMainChannel()->setMask(std::vector<uint8_t>(pixels.size(), 1));
+        streaming = true;
+        ESP_LOGI(TAG, "Stream started");
+    }
+
+    // The driver takes RGB; white is folded into all three
+    PixelColor* out = pixels.data() + first;
+    if (bytes_per_pixel == 3) {
+        for (size_t i = 0; i < count; i++, data += 3) {
+            out[i] = PixelColor(data[0], data[1], data[2]);
+        }
+    }
+    else {
+        for (size_t i = 0; i < count; i++, data += 4) {
+            out[i] = PixelColor(add_white(data[0], data[3]), add_white(data[1], data[3]), add_white(data[2], data[3]));
+        }
+    }
+    return true;
+}
+
+static void send_stats(httpd_req_t* req, int64_t now) {
+    float fps = frames_window * 1000000.0f / (now - window_start);
+    ESP_LOGD(TAG, "%.1f fps, %lu frames, %lu dropped", fps, (unsigned long)frames_total, (unsigned long)dropped_total);
+
+    char buf[64];
+    json_writer_t writer;
+    json_writer_init(&writer, buf, sizeof(buf), NULL);
+    json_object_begin(&writer);
+    json_key(&writer, "fps");
+    json_float(&writer, fps);
+    json_kv_int(&writer, "frames", frames_total);
+    json_kv_int(&writer, "dropped", dropped_total);
+    json_object_end(&writer);
+    if (json_writer_finish(&writer) != ESP_OK) {
+        return;
+    }
+
+    httpd_ws_frame_t frame = {};
+    frame.type = HTTPD_WS_TYPE_TEXT;
+    frame.payload = (uint8_t*)buf;
+    frame.len = writer.len;
+    httpd_ws_send_frame(req, &frame);
+}
+
+// One client streams at a time; a new one is refused while it is connected
+static esp_err_t accept_client(httpd_req_t* req) {
+    int fd = httpd_req_to_sockfd(req);
+    if (owner_fd >= 0 && owner_fd != fd &&
+        httpd_ws_get_fd_info(stream_server, owner_fd) == HTTPD_WS_CLIENT_WEBSOCKET) {
+        ESP_LOGW(TAG, "Refusing client %d: client %d is streaming", fd, owner_fd);
+        return ESP_FAIL;
+    }
+
+    owner_fd = fd;
+    frames_total = 0;
+    dropped_total = 0;
+    frames_window = 0;
+    window_start = esp_timer_get_time();
+    return ESP_OK;
+}
+
+static esp_err_t pixel_stream_handler(httpd_req_t* req) {
+    if (req->method == HTTP_GET) {
+        return accept_client(req);
+    }
+
+    httpd_ws_frame_t frame = {};
+    esp_err_t err = httpd_ws_recv_frame(req, &frame, 0);
+    if (err != ESP_OK) {
+        return err;
+    }
+    if (frame.len > PIXEL_STREAM_MAX_FRAME) {
+        ESP_LOGW(TAG, "Frame of %u bytes, limit is %d", (unsigned int)frame.len, PIXEL_STREAM_MAX_FRAME);
+        return ESP_FAIL;
+    }
+
+    frame.payload = frame_buf;
+    err = httpd_ws_recv_frame(req, &frame, frame.len);
+    if (err != ESP_OK || frame.type != HTTPD_WS_TYPE_BINARY) {
+        return err;
+    }
+
+    int fd = httpd_req_to_sockfd(req);
+    if (fd != owner_fd) {
+        return ESP_OK;
+    }
+
+    // Behind the client: skip to the newest frame, but still show one per refresh
+    int64_t now = esp_timer_get_time();
+    if (newer_frame_waiting(fd) && now - last_applied < 1000000 / PIXEL_STREAM_FRAME_RATE) {
+        dropped_total++;
+    }
+    else if (apply_frame(frame_buf, frame.len)) {
+        last_applied = now;
+        frames_total++;
+        frames_window++;
+        touch_idle_timer();
+    }
+    else {
+        ESP_LOGW(TAG, "Malformed frame of %u bytes", (unsigned int)frame.len);
+        return ESP_FAIL;
+    }
+
+    if (now - window_start >= STATS_INTERVAL_US) {
+        send_stats(req, now);
+        frames_window = 0;
+        window_start = now;
+    }
+    return ESP_OK;
+}
+
+void register_pixel_stream_handlers(httpd_handle_t server) {
+    stream_server = server;
+    owner_fd = -1;
+
+    if (frame_buf == NULL) {
+        frame_buf = (uint8_t*)mem_alloc(MEM_STREAM, PIXEL_STREAM_MAX_FRAME);
+        if (frame_buf == NULL) {
+            return;
+        }
+    }
+
+    if (idle_timer == NULL) {
+        esp_timer_create_args_t timer_args = {
+            .callback = idle_callback,
+            .arg = nullptr,
+            .dispatch_method = ESP_TIMER_TASK,
+            .name = "pixel_stream",
+            .skip_unhandled_events = true
+        };
+        ESP_ERROR_CHECK(esp_timer_create(&timer_args, &idle_timer));
+    }
+
+    httpd_uri_t pixel_stream_uri = {
+        .uri = "/api/ws/pixels",
+        .method = HTTP_GET,
+        .handler = pixel_stream_handler,
+        .user_ctx = NULL,
+        .is_websocket = true
+    };
+    httpd_register_uri_handler(server, &pixel_stream_uri);
+}
@@ -0,0 +1,49 @@
+#pragma once
+
+#include <stdint.h>
+
+#include "esp_http_server.h"
+
+/*
+ * Raw pixel frames over WebSocket at /api/ws/pixels
+ *
+ * Each binary message is one frame, written straight into the main
+ * channel's pixel buffer:
+ *
+ *   uint8_t  bytes per pixel: 3 (R, G, B) or 4 (R, G, B, W)
+ *   uint8_t  reserved, 0
+ *   uint16_t index of the first pixel, little-endian
+ *   pixel data, bytes per pixel each
+ *
+ * The clock stops drawing while frames arrive and redraws itself
+ * PIXEL_STREAM_IDLE_TIMEOUT_MS after the last one. A frame that already
+ * has a newer one queued behind it is dropped, so a client sending faster
+ * than the display runs sees the newest frame rather than a growing lag.
+ *
+ * Once a second the client gets {"fps":..,"frames":..,"dropped":..} as a
+ * text frame.
+ */
+#define PIXEL_STREAM_HEADER_SIZE 4
+
+// Frames older than a display refresh may be dropped; matches PixelDriver::initialize()
+#define PIXEL_STREAM_FRAME_RATE 60
+
+// The clock takes the display back after this long without a frame
+#define PIXEL_STREAM_IDLE_TIMEOUT_MS 2000
+
+/**
+ * @brief Whether an external stream currently owns the pixel buffer
+ *
+ * Clock renderers skip drawing while this is true. When the stream ends,
+ * CLOCK_EVENT_DISPLAY_RELEASED is posted so they redraw.
+ */
+bool pixel_stream_active(void);
+
+/**
+ * @brief Register the /api/ws/pixels endpoint
+ *
+ * Only for clocks whose main channel runs in the driver's raw mode.
+ *
+ * @param server HTTP server handle
+ */
+void register_pixel_stream_handlers(httpd_handle_t server);
@@ -0,0 +1,401 @@
+#include "state_ws.h"
+
+#include "clock_events.h"
+#include "json_reader.h"
+#include "kd_common.h"
+
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "freertos/FreeRTOS.h"
+#include "sdkconfig.h"
+#include <string.h>
+#include <sys/select.h>
+#include <time.h>
+
+static const char* TAG = "state_ws";
+
+// Largest state message; the config section is the bulk of it
+#define STATE_WS_MESSAGE_SIZE 256
+
+// Largest frame accepted from a client
+#define STATE_WS_RECV_SIZE 64
+
+// Time push resolution a client subscribed to
+typedef enum : uint8_t {
+    TICK_NONE,
+    TICK_SECOND,
+    TICK_MINUTE,
+    TICK_HOUR,
+    TICK_COUNT,
+} tick_t;
+
+// Indexed by tick_t
+static const char* const tick_names[TICK_COUNT] = { "none", "second", "minute", "hour" };
+
+// Sections of a state message
+#define SECTION_TIME    (1 << 0)
+#define SECTION_SYNCED  (1 << 1)
+#define SECTION_CONFIG  (1 << 2)
+#define SECTION_ALL     (SECTION_TIME | SECTION_SYNCED | SECTION_CONFIG)
+
+typedef struct {
+    int fd;                     // -1 if the slot is free
+    uint8_t tick;               // tick_t
+    bool resync;                // Missed a push, gets the full state next
+    int64_t stalled_since;      // When the socket first refused data, or 0
+} ws_client_t;
+
+// Only touched from the httpd task
+static httpd_handle_t ws_server = NULL;
+static ws_client_t clients[CONFIG_STATE_WS_MAX_CLIENTS];
+
+// Read by the event handler to skip work nobody is waiting for
+static volatile int client_count = 0;
+static volatile uint8_t subscribed_ticks = 0;  // Bit per tick_t
+
+static state_ws_config_writer_t config_writer = NULL;
+
+// Changes collected from the event loop until the httpd task pushes them
+static portMUX_TYPE pending_lock = portMUX_INITIALIZER_UNLOCKED;
+static uint8_t pending_sections = 0;
+static uint8_t pending_ticks = 0;
+static bool push_queued = false;
+
+void state_ws_set_config_writer(state_ws_config_writer_t writer) {
+    config_writer = writer;
+}
+
+static void write_time(json_writer_t* writer) {
+    if (!kd_common_ntp_is_synced()) {
+        json_null(writer);
+        return;
+    }
+
+    time_t now;
+    time(&now);
+    struct tm timeinfo;
+    localtime_r(&now, &timeinfo);
+
+    char text[9];
+    strftime(text, sizeof(text), "%H:%M:%S", &timeinfo);
+    json_string(writer, text);
+}
+
+// Render the given sections into buf; returns the length, or 0 if they do not fit
+static size_t build_state(uint8_t sections, char* buf, size_t size) {
+    json_writer_t writer;
+    json_writer_init(&writer, buf, size, NULL);
+
+    json_object_begin(&writer);
+    if (sections & SECTION_TIME) {
+        json_key(&writer, "time");
+        write_time(&writer);
+    }
+    if (sections & SECTION_SYNCED) {
+        json_kv_bool(&writer, "synced", kd_common_ntp_is_synced());
+    }
+    if ((sections & SECTION_CONFIG) && config_writer != NULL) {
+        json_key(&writer, "config");
+        config_writer(&writer);
+    }
+    json_object_end(&writer);
+
+    if (json_writer_finish(&writer) != ESP_OK) {
+        ESP_LOGE(TAG, "State message larger than %d bytes", STATE_WS_MESSAGE_SIZE);
+        return 0;
+    }
+    return writer.len;
+}
+
+static void update_subscriptions(void) {
+    int count = 0;
+    uint8_t ticks = 0;
+    for (int i = 0; i < CONFIG_STATE_WS_MAX_CLIENTS; i++) {
+        if (clients[i].fd >= 0) {
+            count++;
+            ticks |= 1 << clients[i].tick;
+        }
+    }
+    client_count = count;
+    subscribed_ticks = ticks;
+}
+
+static void remove_client(ws_client_t* client) {
+    client->fd = -1;
+    update_subscriptions();
+}
+
+static void drop_client(ws_client_t* client, const char* reason) {
+    ESP_LOGW(TAG, "Dropping client %d: %s", client->fd, reason);
+    httpd_sess_trigger_close(ws_server, client->fd);
+    remove_client(client);
+}
+
+// Sessions close without telling this module; forget the ones that are gone
+static void prune_clients(void) {
+    for (int i = 0; i < CONFIG_STATE_WS_MAX_CLIENTS; i++) {
+        if (clients[i].fd >= 0 && httpd_ws_get_fd_info(ws_server, clients[i].fd) != HTTPD_WS_CLIENT_WEBSOCKET) {
+            remove_client(&clients[i]);
+        }
+    }
+}
+
+static ws_client_t* find_client(int fd) {
+    for (int i = 0; i < CONFIG_STATE_WS_MAX_CLIENTS; i++) {
+        if (clients[i].fd == fd) {
+            return &clients[i];
+        }
+    }
+    return NULL;
+}
+
+// True if the socket can take a small frame without blocking the httpd task
+static bool socket_writable(int fd) {
+    fd_set writefds;
+    FD_ZERO(&writefds);
+    FD_SET(fd, &writefds);
+    struct timeval timeout = { 0, 0 };
+    return select(fd + 1, NULL, &writefds, NULL, &timeout) > 0;
+}
+
+static void push_to_client(ws_client_t* client, const char* message, size_t len, int64_t now) {
+    if (!socket_writable(client->fd)) {
+        client->resync = true;
+        if (client->stalled_since == 0) {
+            client->stalled_since = now;
+        }
+        else if (now - client->stalled_since > CONFIG_STATE_WS_STALL_TIMEOUT_MS * 1000LL) {
+            drop_client(client, "not reading");
+        }
+        return;
+    }
+
+    httpd_ws_frame_t frame = {};
+    frame.type = HTTPD_WS_TYPE_TEXT;
+    frame.payload = (uint8_t*)message;
+    frame.len = len;
+    if (httpd_ws_send_frame_async(ws_server, client->fd, &frame) != ESP_OK) {
+        drop_client(client, "send failed");
+        return;
+    }
+
+    client->resync = false;
+    client->stalled_since = 0;
+}
+
+// Runs in the httpd task, queued by the event handlers
+static void push_work(void* arg) {
+    portENTER_CRITICAL(&pending_lock);
+    uint8_t sections = pending_sections;
+    uint8_t ticks = pending_ticks;
+    pending_sections = 0;
+    pending_ticks = 0;
+    push_queued = false;
+    portEXIT_CRITICAL(&pending_lock);
+
+    prune_clients();
+
+    // Clients mostly want the same sections, so reuse the last rendering
+    static char message[STATE_WS_MESSAGE_SIZE];
+    int message_sections = -1;
+    size_t message_len = 0;
+
+    int64_t now = esp_timer_get_time();
+    for (int i = 0; i < CONFIG_STATE_WS_MAX_CLIENTS; i++) {
+        ws_client_t* client = &clients[i];
+        if (client->fd < 0) {
+            continue;
+        }
+
+        uint8_t client_sections = sections;
+        if (ticks & (1 << client->tick)) {
+            client_sections |= SECTION_TIME;
+        }
+        if (client->resync) {
+            client_sections = SECTION_ALL;
+        }
+        if (client_sections == 0) {
+            continue;
+        }
+
+        if (client_sections != message_sections) {
+            message_len = build_state(client_sections, message, sizeof(message));
+            message_sections = client_sections;
+        }
+        if (message_len > 0) {
+            push_to_client(client, message, message_len, now);
+        }
+    }
+}
+
+// Called from the event loop task; the push itself happens in the httpd task
+static void queue_push(uint8_t sections, uint8_t ticks) {
+    if (ws_server == NULL || client_count == 0) {
+        return;
+    }
+    if (sections == 0 && (ticks & subscribed_ticks) == 0) {
+        return;
+    }
+
+    portENTER_CRITICAL(&pending_lock);
+    pending_sections |= sections;
+    pending_ticks |= ticks;
+    bool queue = !push_queued;
+    push_queued = true;
+    portEXIT_CRITICAL(&pending_lock);
+
+    // One queued push carries everything that changed until it runs
+    if (queue && httpd_queue_work(ws_server, push_work, NULL) != ESP_OK) {
+        portENTER_CRITICAL(&pending_lock);
+        push_queued = false;
+        portEXIT_CRITICAL(&pending_lock);
+        ESP_LOGW(TAG, "Failed to queue state push");
+    }
+}
+
+static void on_clock_event(void* arg, esp_event_base_t base, int32_t id, void* data) {
+    switch (id) {
+    case CLOCK_EVENT_SECOND_TICK:
+        queue_push(0, 1 << TICK_SECOND);
+        break;
+    case CLOCK_EVENT_MINUTE_TICK:
+        queue_push(0, 1 << TICK_MINUTE);
+        break;
+    case CLOCK_EVENT_HOUR_TICK:
+        queue_push(0, 1 << TICK_HOUR);
+        break;
+    case CLOCK_EVENT_CONFIG_CHANGED:
+        queue_push(SECTION_CONFIG, 0);
+        break;
+    default:
+        break;
+    }
+}
+
+static void on_ntp_event(void* arg, esp_event_base_t base, int32_t id, void* data) {
+    // KD_NTP_EVENT_SYNC_COMPLETE or KD_NTP_EVENT_SYNC_LOST; the clock may have jumped
+    queue_push(SECTION_SYNCED | SECTION_TIME, 0);
+}
+
+static esp_err_t send_text(httpd_req_t* req, const char* text, size_t len) {
+    httpd_ws_frame_t frame = {};
+    frame.type = HTTPD_WS_TYPE_TEXT;
+    frame.payload = (uint8_t*)text;
+    frame.len = len;
+    return httpd_ws_send_frame(req, &frame);
+}
+
+static esp_err_t send_error(httpd_req_t* req, const char* message) {
+    char buf[96];
+    json_writer_t writer;
+    json_writer_init(&writer, buf, sizeof(buf), NULL);
+    json_object_begin(&writer);
+    json_kv_string(&writer, "error", message);
+    json_object_end(&writer);
+    if (json_writer_finish(&writer) != ESP_OK) {
+        return ESP_FAIL;
+    }
+    return send_text(req, buf, writer.len);
+}
+
+// Handshake done: take the client on and send it the full state
+static esp_err_t add_client(httpd_req_t* req) {
+    prune_clients();
+
+    int fd = httpd_req_to_sockfd(req);
+    ws_client_t* client = find_client(fd);
+    if (client == NULL) {
+        client = find_client(-1);
+        if (client == NULL) {
+            ESP_LOGW(TAG, "Refusing client %d: %d clients connected", fd, CONFIG_STATE_WS_MAX_CLIENTS);
+            return ESP_FAIL;
+        }
+    }
+
+    *client = {};
+    client->fd = fd;
+    client->tick = TICK_MINUTE;
+    update_subscriptions();
+
+    char message[STATE_WS_MESSAGE_SIZE];
+    size_t len = build_state(SECTION_ALL, message, sizeof(message));
+    return len > 0 ? send_text(req, message, len) : ESP_OK;
+}
+
+// A client message: {"tick":"second"|"minute"|"hour"|"none"}
+static esp_err_t receive_message(httpd_req_t* req) {
+    uint8_t buf[STATE_WS_RECV_SIZE];
+    httpd_ws_frame_t frame = {};
+    esp_err_t err = httpd_ws_recv_frame(req, &frame, 0);
+    if (err != ESP_OK) {
+        return err;
+    }
+    if (frame.len > sizeof(buf)) {
+        ESP_LOGW(TAG, "Client %d sent a %u byte frame", httpd_req_to_sockfd(req), (unsigned int)frame.len);
+        return ESP_FAIL;
+    }
+
+    frame.payload = buf;
+    err = httpd_ws_recv_frame(req, &frame, frame.len);
+    if (err != ESP_OK || frame.type != HTTPD_WS_TYPE_TEXT) {
+        return err;
+    }
+
+    char tick[8] = "";
+    json_field_t fields[] = {
+        { .key = "tick", .type = JSON_FIELD_STRING, .value = tick, .size = sizeof(tick) },
+    };
+    json_reader_t reader;
+    json_reader_init(&reader, fields, sizeof(fields) / sizeof(fields[0]));
+    json_reader_feed(&reader, (const char*)buf, frame.len);
+    if (json_reader_finish(&reader) != ESP_OK) {
+        return send_error(req, json_reader_error(&reader));
+    }
+
+    ws_client_t* client = find_client(httpd_req_to_sockfd(req));
+    if (client == NULL || !fields[0].found) {
+        return ESP_OK;
+    }
+
+    for (uint8_t i = 0; i < TICK_COUNT; i++) {
+        if (strcmp(tick, tick_names[i]) == 0) {
+            client->tick = i;
+            update_subscriptions();
+            return ESP_OK;
+        }
+    }
+    return send_error(req, "tick: expected none, second, minute or hour");
+}
+
+static esp_err_t state_ws_handler(httpd_req_t* req) {
+    if (req->method == HTTP_GET) {
+        return add_client(req);
+    }
+    return receive_message(req);
+}
+
+void register_state_ws_handlers(httpd_handle_t server) {
+    // A restarted server starts without clients
+    for (int i = 0; i < CONFIG_STATE_WS_MAX_CLIENTS; i++) {
+        clients[i].fd = -1;
+    }
+    client_count = 0;
+    subscribed_ticks = 0;
+    ws_server = server;
+
+    httpd_uri_t state_ws_uri = {
+        .uri = "/api/ws",
+        .method = HTTP_GET,
+        .handler = state_ws_handler,
+        .user_ctx = NULL,
+        .is_websocket = true
+    };
+    httpd_register_uri_handler(server, &state_ws_uri);
+
+    static bool events_registered = false;
+    if (!events_registered) {
+        esp_event_handler_register(CLOCK_EVENTS, ESP_EVENT_ANY_ID, on_clock_event, NULL);
+        esp_event_handler_register(KD_NTP_EVENTS, ESP_EVENT_ANY_ID, on_ntp_event, NULL);
+        events_registered = true;
+    }
+}
@@ -0,0 +1,44 @@
+#pragma once
+
+#include "esp_http_server.h"
+#include "json_writer.h"
+
+/*
+ * Live state over WebSocket at /api/ws
+ *
+ * On connect a client gets the full state, then only the sections that
+ * changed, as compact JSON text frames:
+ *
+ *   {"time":"12:34:56","synced":true,"config":{...}}   full state
+ *   {"time":"12:35:00"}                                tick
+ *   {"config":{...}}                                   config changed
+ *   {"synced":false}                                   NTP sync lost
+ *
+ * Time is pushed once a minute by default; a client picks the resolution
+ * by sending {"tick":"second"}, "minute", "hour" or "none".
+ *
+ * Pushes never wait on a client. A client whose socket cannot take more
+ * data is skipped and gets the full state once it drains; one that stays
+ * blocked for CONFIG_STATE_WS_STALL_TIMEOUT_MS is disconnected.
+ */
+
+/**
+ * @brief Writes the clock's configuration as one JSON value
+ */
+typedef void (*state_ws_config_writer_t)(json_writer_t* writer);
+
+/**
+ * @brief Set the source of the "config" section
+ *
+ * Called by the clock variant; without a writer the section is left out.
+ *
+ * @param writer Config writer
+ */
+void state_ws_set_config_writer(state_ws_config_writer_t writer);
+
+/**
+ * @brief Register the /api/ws endpoint and start following clock events
+ *
+ * @param server HTTP server handle
+ */
+void register_state_ws_handlers(httpd_handle_t server);
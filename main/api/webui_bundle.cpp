@@ -0,0 +1,432 @@
+#include "webui_bundle.h"
+#include "static_files_index.h"
+
+#include "async_worker.h"
+#include "http_governor.h"
+#include "esp_log.h"
+#include "esp_partition.h"
+#include "esp_rom_crc.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "json_writer.h"
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "sdkconfig.h"
+
+static const char* TAG = "webui_bundle";
+
+// Upload body is moved to flash in pieces of this size
+#define WEBUI_UPLOAD_CHUNK_SIZE 1024
+
+// Only one upload runs at a time, so one buffer serves them all
+static char upload_buf[WEBUI_UPLOAD_CHUNK_SIZE];
+
+// Set on the httpd task when an upload is handed to a worker, cleared when it ends
+static volatile bool upload_in_progress = false;
+
+static const esp_partition_t* bundle_partition = NULL;
+
+// Active bundle. Only the httpd task serves from it or switches it, so a
+// switch can never pull the mapping from under a request being served;
+// an upload on a worker queues its switch to the httpd task.
+static const uint8_t* active_image = NULL;
+static esp_partition_mmap_handle_t active_mmap_handle;
+
+// Sequence of the last bundle installed, kept while an upload replaces it
+static uint32_t last_sequence = 0;
+
+static size_t bundle_capacity(void) {
+    return bundle_partition->size - bundle_partition->size % bundle_partition->erase_size;
+}
+
+static uint32_t header_crc(const webui_bundle_header_t* header) {
+    return esp_rom_crc32_le(0, (const uint8_t*)header, offsetof(webui_bundle_header_t, header_crc32));
+}
+
+static bool is_pow2(uint32_t value) {
+    return value != 0 && (value & (value - 1)) == 0;
+}
+
+static bool bundle_header_valid(const webui_bundle_header_t* header) {
+    if (header->magic != WEBUI_BUNDLE_MAGIC) {
+        return false;
+    }
+    if (header_crc(header) != header->header_crc32) {
+        ESP_LOGW(TAG, "Bundle header CRC mismatch");
+        return false;
+    }
+    if (header->version != WEBUI_BUNDLE_VERSION) {
+        ESP_LOGW(TAG, "Unsupported bundle version %d", header->version);
+        return false;
+    }
+    if (header->file_count == 0 || !is_pow2(header->num_buckets) || !is_pow2(header->num_slots)) {
+        ESP_LOGW(TAG, "Bundle has no usable index");
+        return false;
+    }
+
+    size_t index_size = header->file_count * sizeof(webui_bundle_entry_t) +
+        header->num_buckets * sizeof(uint16_t) + header->num_slots * sizeof(int16_t);
+    if (header->size > bundle_capacity() - sizeof(*header) || index_size > header->size) {
+        ESP_LOGW(TAG, "Bundle size %lu does not fit the partition", (unsigned long)header->size);
+        return false;
+    }
+    return true;
+}
+
+static bool string_valid(const uint8_t* image, size_t image_size, uint32_t offset) {
+    return offset < image_size && memchr(image + offset, '\0', image_size - offset) != NULL;
+}
+
+// Check everything the lookup path trusts, so serving never range-checks
+static bool bundle_image_valid(const webui_bundle_header_t* header, const uint8_t* image) {
+    size_t image_size = sizeof(*header) + header->size;
+    uint32_t crc = esp_rom_crc32_le(0, image + sizeof(*header), header->size);
+    if (crc != header->crc32) {
+        ESP_LOGW(TAG, "Bundle CRC mismatch (0x%08lx != 0x%08lx)", (unsigned long)crc, (unsigned long)header->crc32);
+        return false;
+    }
+
+    const webui_bundle_entry_t* entries = (const webui_bundle_entry_t*)(image + sizeof(*header));
+    for (size_t i = 0; i < header->file_count; i++) {
+        const webui_bundle_entry_t& entry = entries[i];
+        if (!string_valid(image, image_size, entry.path) || !string_valid(image, image_size, entry.type)) {
+            return false;
+        }
+        for (size_t e = 0; e < WEBUI_ENCODING_COUNT; e++) {
+            const webui_bundle_body_t& body = entry.bodies[e];
+            if (body.size > 0 && (body.offset > image_size || body.size > image_size - body.offset ||
+                memchr(body.etag, '\0', sizeof(body.etag)) == NULL)) {
+                return false;
+            }
+        }
+        if (entry.bodies[WEBUI_ENCODING_GZIP].size == 0) {
+            return false;
+        }
+    }
+
+    const uint16_t* displacements = (const uint16_t*)(entries + header->file_count);
+    const int16_t* slots = (const int16_t*)(displacements + header->num_buckets);
+    for (size_t i = 0; i < header->num_slots; i++) {
+        if (slots[i] >= (int)header->file_count) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Map the bundle and check its image; on success the caller owns the mapping
+static bool bundle_map(const webui_bundle_header_t* header, const uint8_t** image,
+    esp_partition_mmap_handle_t* handle) {
+    const void* mapped = NULL;
+    esp_err_t err = esp_partition_mmap(bundle_partition, 0, sizeof(*header) + header->size,
+        ESP_PARTITION_MMAP_DATA, &mapped, handle);
+    if (err != ESP_OK) {
+        ESP_LOGE(TAG, "Failed to map bundle: %s", esp_err_to_name(err));
+        return false;
+    }
+
+    if (!bundle_image_valid(header, (const uint8_t*)mapped)) {
+        ESP_LOGW(TAG, "Bundle is corrupt");
+        esp_partition_munmap(*handle);
+        return false;
+    }
+
+    *image = (const uint8_t*)mapped;
+    return true;
+}
+
+// Serve a mapped bundle, or the built-in web UI with image NULL
+static void bundle_activate(const uint8_t* image, esp_partition_mmap_handle_t handle) {
+    bool had_bundle = active_image != NULL;
+    esp_partition_mmap_handle_t old_handle = active_mmap_handle;
+
+    active_image = image;
+    active_mmap_handle = handle;
+
+    if (had_bundle) {
+        esp_partition_munmap(old_handle);
+    }
+
+    if (image == NULL) {
+        ESP_LOGI(TAG, "Serving built-in web UI");
+        return;
+    }
+
+    const webui_bundle_header_t* header = (const webui_bundle_header_t*)image;
+    last_sequence = header->sequence;
+    ESP_LOGI(TAG, "Serving web UI bundle '%.*s' (%d files, %lu bytes)", (int)sizeof(header->label),
+        header->label, header->file_count, (unsigned long)header->size);
+}
+
+void webui_bundle_init(void) {
+    bundle_partition = esp_partition_find_first(ESP_PARTITION_TYPE_DATA, ESP_PARTITION_SUBTYPE_ANY,
+        CONFIG_WEBUI_BUNDLE_PARTITION);
+    if (bundle_partition == NULL) {
+        ESP_LOGI(TAG, "Bundle partition '%s' not found, serving built-in web UI", CONFIG_WEBUI_BUNDLE_PARTITION);
+        return;
+    }
+
+    webui_bundle_header_t header;
+    const uint8_t* image;
+    esp_partition_mmap_handle_t handle;
+    if (esp_partition_read(bundle_partition, 0, &header, sizeof(header)) == ESP_OK && bundle_header_valid(&header) &&
+        bundle_map(&header, &image, &handle)) {
+        bundle_activate(image, handle);
+        return;
+    }
+
+    ESP_LOGI(TAG, "No web UI bundle in partition '%s', serving built-in web UI", bundle_partition->label);
+}
+
+bool webui_bundle_active(void) {
+    return active_image != NULL;
+}
+
+bool webui_bundle_find(const char* path, size_t len, webui_bundle_file_t* file) {
+    if (active_image == NULL) {
+        return false;
+    }
+
+    const webui_bundle_header_t* header = (const webui_bundle_header_t*)active_image;
+    const webui_bundle_entry_t* entries = (const webui_bundle_entry_t*)(active_image + sizeof(*header));
+    const uint16_t* displacements = (const uint16_t*)(entries + header->file_count);
+    const int16_t* slots = (const int16_t*)(displacements + header->num_buckets);
+
+    // Same hash-and-displace scheme as the built-in index
+    uint32_t bucket = static_files_index::hash(path, len, 0) & (header->num_buckets - 1);
+    int index = slots[static_files_index::hash(path, len, displacements[bucket]) & (header->num_slots - 1)];
+    if (index < 0) {
+        return false;
+    }
+
+    const webui_bundle_entry_t& entry = entries[index];
+    const char* entry_path = (const char*)active_image + entry.path;
+    if (strncmp(entry_path, path, len) != 0 || entry_path[len] != '\0') {
+        return false;
+    }
+
+    file->path = entry_path;
+    file->type = (const char*)active_image + entry.type;
+    for (size_t e = 0; e < WEBUI_ENCODING_COUNT; e++) {
+        const webui_bundle_body_t& body = entry.bodies[e];
+        file->contents[e] = body.size > 0 ? active_image + body.offset : NULL;
+        file->size[e] = body.size;
+        file->etag[e] = body.size > 0 ? body.etag : NULL;
+    }
+    return true;
+}
+
+static esp_err_t webui_get_handler(httpd_req_t* req) {
+    char buf[160];
+    json_writer_t writer;
+    json_writer_init(&writer, buf, sizeof(buf), req);
+    httpd_resp_set_type(req, "application/json");
+
+    json_object_begin(&writer);
+    json_kv_bool(&writer, "active", active_image != NULL);
+    json_kv_int(&writer, "capacity", bundle_partition != NULL ? bundle_capacity() : 0);
+
+    if (active_image != NULL) {
+        const webui_bundle_header_t* header = (const webui_bundle_header_t*)active_image;
+        char label[sizeof(header->label) + 1];
+        memcpy(label, header->label, sizeof(header->label));
+        label[sizeof(header->label)] = '\0';
+
+        json_kv_string(&writer, "label", label);
+        json_kv_int(&writer, "sequence", header->sequence);
+        json_kv_int(&writer, "files", header->file_count);
+        json_kv_int(&writer, "size", sizeof(*header) + header->size);
+    }
+    json_object_end(&writer);
+
+    return json_writer_finish(&writer);
+}
+
+typedef struct {
+    const uint8_t* image;
+    esp_partition_mmap_handle_t handle;
+} bundle_switch_t;
+
+static void bundle_switch_work(void* arg) {
+    bundle_switch_t* sw = (bundle_switch_t*)arg;
+    bundle_activate(sw->image, sw->handle);
+}
+
+static void bundle_switch_release(void* arg) {
+    free(arg);
+}
+
+// Helper function to switch bundles on the httpd task, waiting for it from a
+// worker. On ESP_ERR_TIMEOUT the switch still happens if the server gets to
+// it, so the mapping is no longer the caller's.
+static esp_err_t bundle_switch(httpd_req_t* req, const uint8_t* image, esp_partition_mmap_handle_t handle) {
+    if (!async_worker_current()) {
+        bundle_activate(image, handle);
+        return ESP_OK;
+    }
+
+    bundle_switch_t* sw = (bundle_switch_t*)malloc(sizeof(bundle_switch_t));
+    if (sw == NULL) {
+        return ESP_ERR_NO_MEM;
+    }
+    sw->image = image;
+    sw->handle = handle;
+
+    esp_err_t err = async_worker_run_on_httpd(req, bundle_switch_work, sw, bundle_switch_release);
+    if (err == ESP_ERR_TIMEOUT) {
+        return err;
+    }
+    free(sw);
+    if (err != ESP_OK) {
+        ESP_LOGE(TAG, "Failed to queue bundle switch: %s", esp_err_to_name(err));
+    }
+    return err;
+}
+
+// Receive a bundle over the one being served, header last, then switch to
+// it. The built-in web UI is served while the partition is rewritten, and
+// stays if the upload fails.
+static esp_err_t webui_upload(httpd_req_t* req) {
+    if (bundle_partition == NULL) {
+        httpd_resp_send_err(req, HTTPD_404_NOT_FOUND, "No web UI partition");
+        return ESP_FAIL;
+    }
+
+    if (req->content_len <= sizeof(webui_bundle_header_t) || req->content_len > bundle_capacity()) {
+        httpd_resp_send_err(req, HTTPD_400_BAD_REQUEST, "Bundle does not fit the partition");
+        return ESP_FAIL;
+    }
+
+    // Nothing may be served from the partition while it is rewritten
+    esp_partition_mmap_handle_t no_handle = {};
+    if (active_image != NULL) {
+        esp_err_t err = bundle_switch(req, NULL, no_handle);
+        if (err == ESP_ERR_TIMEOUT) {
+            httpd_resp_set_status(req, "503 Service Unavailable");
+            httpd_resp_set_hdr(req, "Retry-After", "1");
+            httpd_resp_send(req, "Server busy, retry shortly", HTTPD_RESP_USE_STRLEN);
+            return ESP_FAIL;
+        }
+        if (err != ESP_OK) {
+            httpd_resp_send_500(req);
+            return ESP_FAIL;
+        }
+    }
+
+    size_t base = 0;
+    size_t erase_size = (req->content_len + bundle_partition->erase_size - 1) / bundle_partition->erase_size *
+        bundle_partition->erase_size;
+    esp_err_t err = esp_partition_erase_range(bundle_partition, base, erase_size);
+    if (err != ESP_OK) {
+        ESP_LOGE(TAG, "Failed to erase bundle: %s", esp_err_to_name(err));
+        httpd_resp_send_500(req);
+        return ESP_FAIL;
+    }
+
+    // The header stays in RAM until the body is in flash and verified
+    webui_bundle_header_t header;
+    char* buf = upload_buf;
+    size_t received = 0;
+    while (received < req->content_len) {
+        size_t want = req->content_len - received;
+        int ret = httpd_req_recv(req, buf, want < sizeof(upload_buf) ? want : sizeof(upload_buf));
+        if (ret == HTTPD_SOCK_ERR_TIMEOUT) {
+            continue;
+        }
+        if (ret <= 0) {
+            ESP_LOGW(TAG, "Bundle upload aborted after %u bytes", (unsigned int)received);
+            return ESP_FAIL;
+        }
+
+        size_t used = 0;
+        if (received < sizeof(header)) {
+            used = sizeof(header) - received < (size_t)ret ? sizeof(header) - received : (size_t)ret;
+            memcpy((uint8_t*)&header + received, buf, used);
+        }
+        if (used < (size_t)ret) {
+            err = esp_partition_write(bundle_partition, base + received + used, buf + used, ret - used);
+            if (err != ESP_OK) {
+                ESP_LOGE(TAG, "Failed to write bundle: %s", esp_err_to_name(err));
+                httpd_resp_send_500(req);
+                return ESP_FAIL;
+            }
+        }
+        received += ret;
+    }
+
+    if (!bundle_header_valid(&header) || header.size != req->content_len - sizeof(header)) {
+        httpd_resp_send_err(req, HTTPD_400_BAD_REQUEST, "Invalid bundle header");
+        return ESP_FAIL;
+    }
+
+    // Verify what actually landed in flash before committing the header
+    const uint8_t* image;
+    esp_partition_mmap_handle_t handle;
+    if (!bundle_map(&header, &image, &handle)) {
+        httpd_resp_send_err(req, HTTPD_400_BAD_REQUEST, "Bundle failed verification");
+        return ESP_FAIL;
+    }
+
+    header.sequence = last_sequence + 1;
+    header.header_crc32 = header_crc(&header);
+
+    err = esp_partition_write(bundle_partition, base, &header, sizeof(header));
+    if (err != ESP_OK) {
+        ESP_LOGE(TAG, "Failed to commit bundle header: %s", esp_err_to_name(err));
+        esp_partition_munmap(handle);
+        httpd_resp_send_500(req);
+        return ESP_FAIL;
+    }
+
+    err = bundle_switch(req, image, handle);
+    if (err == ESP_ERR_TIMEOUT) {
+        ESP_LOGW(TAG, "Bundle installed, served once the server gets to it or from next boot");
+    }
+    else if (err != ESP_OK) {
+        ESP_LOGE(TAG, "Bundle installed, serving it from next boot");
+        esp_partition_munmap(handle);
+    }
+    return webui_get_handler(req);
+}
+
+static esp_err_t webui_upload_worker(httpd_req_t* req) {
+    esp_err_t err = webui_upload(req);
+    upload_in_progress = false;
+    return err;
+}
+
+// Flash erase and write take seconds, so the upload runs on a worker
+static esp_err_t webui_post_handler(httpd_req_t* req) {
+    if (upload_in_progress) {
+        httpd_resp_set_status(req, "409 Conflict");
+        httpd_resp_send(req, "Another upload is in progress", HTTPD_RESP_USE_STRLEN);
+        return ESP_FAIL;
+    }
+
+    upload_in_progress = true;
+    esp_err_t err = async_worker_submit(req, webui_upload_worker);
+    if (err != ESP_OK) {
+        upload_in_progress = false;
+    }
+    return err;
+}
+
+void register_webui_bundle_handlers(httpd_handle_t server) {
+    httpd_uri_t webui_get_uri = {
+        .uri = "/api/webui",
+        .method = HTTP_GET,
+        .handler = webui_get_handler,
+        .user_ctx = NULL
+    };
+    http_governor_register_uri(server, &webui_get_uri);
+
+    httpd_uri_t webui_post_uri = {
+        .uri = "/api/webui",
+        .method = HTTP_POST,
+        .handler = webui_post_handler,
+        .user_ctx = NULL
+    };
+    http_governor_register_uri(server, &webui_post_uri);
+}
@@ -0,0 +1,107 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "esp_http_server.h"
+
+/*
+ * Web UI bundle binary format (version 1, little-endian)
+ *
+ *   webui_bundle_header_t
+ *   webui_bundle_entry_t[file_count]
+ *   uint16_t displacements[num_buckets]   Path index, see static_files_index.h
+ *   int16_t slots[num_slots]
+ *   NUL-terminated paths and MIME types
+ *   file bodies, each 4-byte aligned
+ *
+ * All offsets are from the start of the header. The bundle partition holds
+ * one image at its start, served in place through a flash mmap. An upload
+ * drops back to the web UI compiled into the firmware, rewrites the
+ * partition and writes the header last, so an interrupted upload leaves the
+ * built-in UI served rather than a broken bundle. One slot instead of two
+ * lets a bundle use the whole partition, which a clock-app build needs.
+ *
+ * Bundles are built by tools/webui_bundle.py.
+ */
+#define WEBUI_BUNDLE_MAGIC 0x42495557  // "WUIB"
+#define WEBUI_BUNDLE_VERSION 1
+
+typedef enum : uint8_t {
+    WEBUI_ENCODING_GZIP,
+    WEBUI_ENCODING_BROTLI,
+    WEBUI_ENCODING_COUNT,
+} webui_encoding_t;
+
+typedef struct {
+    uint32_t magic;
+    uint16_t version;
+    uint16_t file_count;
+    uint16_t num_buckets;       // Power of two
+    uint16_t num_slots;         // Power of two
+    uint32_t sequence;          // Set by the device when the bundle is committed
+    uint32_t size;              // Bytes after the header
+    uint32_t crc32;             // CRC-32 (little-endian) over those bytes
+    char label[16];             // Bundle version, e.g. the clock-app release
+    uint32_t reserved;
+    uint32_t header_crc32;      // CRC-32 over the header up to this field
+} webui_bundle_header_t;
+
+typedef struct {
+    uint32_t offset;
+    uint32_t size;              // 0 if the file has no body in this encoding
+    char etag[20];              // Quoted strong ETag, NUL-terminated
+} webui_bundle_body_t;
+
+typedef struct {
+    uint32_t path;              // Offset of the path string
+    uint32_t type;              // Offset of the MIME type string
+    webui_bundle_body_t bodies[WEBUI_ENCODING_COUNT];
+} webui_bundle_entry_t;
+
+static_assert(sizeof(webui_bundle_header_t) == 48, "Bundle header layout is part of the flash format");
+static_assert(sizeof(webui_bundle_entry_t) == 64, "Bundle entry layout is part of the flash format");
+
+/**
+ * @brief A file in the active bundle, pointing into mapped flash
+ */
+typedef struct {
+    const char* path;
+    const char* type;
+    const uint8_t* contents[WEBUI_ENCODING_COUNT];     // NULL if not in that encoding
+    size_t size[WEBUI_ENCODING_COUNT];
+    const char* etag[WEBUI_ENCODING_COUNT];
+} webui_bundle_file_t;
+
+/**
+ * @brief Map the newest valid bundle from the bundle partition
+ *
+ * Leaves no bundle active if the partition is missing or holds no valid
+ * image; the web UI compiled into the firmware is served instead.
+ */
+void webui_bundle_init(void);
+
+/**
+ * @brief Whether a bundle is being served
+ */
+bool webui_bundle_active(void);
+
+/**
+ * @brief Look up a file in the active bundle
+ *
+ * @param path Request path, not necessarily terminated
+ * @param len Length of the path
+ * @param file Filled with the file's location in flash
+ * @return true if the active bundle has the file
+ */
+bool webui_bundle_find(const char* path, size_t len, webui_bundle_file_t* file);
+
+/**
+ * @brief Register the bundle status and upload endpoints
+ *
+ * GET /api/webui reports the active bundle; POST /api/webui takes a bundle
+ * image as the request body and switches to it once it is verified.
+ *
+ * @param server HTTP server handle
+ */
+void register_webui_bundle_handlers(httpd_handle_t server);
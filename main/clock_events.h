@@ -8,20 +8,16 @@ extern "C" {
 
 ESP_EVENT_DECLARE_BASE(CLOCK_EVENTS);
 
+// Events carry no data; handlers read the time themselves
 typedef enum {
     CLOCK_EVENT_SECOND_TICK,        // Posted every second change
     CLOCK_EVENT_MINUTE_TICK,        // Posted every minute change
     CLOCK_EVENT_HOUR_TICK,          // Posted every hour change
     CLOCK_EVENT_CONFIG_CHANGED,     // Posted when clock config changes
     CLOCK_EVENT_FORCE_REFRESH,      // Force immediate display refresh
+    CLOCK_EVENT_DISPLAY_RELEASED,   // Posted when an external pixel stream ends
 } clock_event_id_t;
 
-typedef struct {
-    int hour;
-    int minute;
-    int second;
-} clock_time_event_data_t;
-
 #ifdef __cplusplus
 }
 #endif
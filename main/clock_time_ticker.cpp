@@ -1,5 +1,6 @@
 #include "clock_time_ticker.h"
 #include "clock_events.h"
+#include "alloc_trace.h"
 #include "kd_common.h"
 
 #include <esp_timer.h>
@@ -17,7 +18,13 @@ int g_last_second = -1;
 int g_last_minute = -1;
 int g_last_hour = -1;
 
+// Seconds ticked before hot-path allocations count as violations
+#define STEADY_AFTER_SECONDS 5
+int g_seconds_ticked = 0;
+
 void ticker_callback(void* arg) {
+    ALLOC_TRACE_SCOPE(ALLOC_PATH_TICKER);
+
     if (!kd_common_ntp_is_synced()) {
         return;
     }
@@ -27,27 +34,23 @@ void ticker_callback(void* arg) {
     struct tm timeinfo;
     localtime_r(&now, &timeinfo);
 
-    clock_time_event_data_t event_data = {
-        .hour = timeinfo.tm_hour,
-        .minute = timeinfo.tm_min,
-        .second = timeinfo.tm_sec
-    };
-
     // Check for second change
     if (timeinfo.tm_sec != g_last_second) {
         g_last_second = timeinfo.tm_sec;
 
-        // Post second tick event
-        esp_event_post(CLOCK_EVENTS, CLOCK_EVENT_SECOND_TICK,
-                       &event_data, sizeof(event_data), 0);
+        if (g_seconds_ticked < STEADY_AFTER_SECONDS && ++g_seconds_ticked == STEADY_AFTER_SECONDS) {
+            alloc_trace_set_steady();
+        }
+
+        // Post second tick event; ticks carry no data, as esp_event_post() copies it to the heap
+        esp_event_post(CLOCK_EVENTS, CLOCK_EVENT_SECOND_TICK, nullptr, 0, 0);
 
         // Check for minute change
         if (timeinfo.tm_min != g_last_minute) {
             g_last_minute = timeinfo.tm_min;
 
             // Post minute tick event
-            esp_event_post(CLOCK_EVENTS, CLOCK_EVENT_MINUTE_TICK,
-                           &event_data, sizeof(event_data), 0);
+            esp_event_post(CLOCK_EVENTS, CLOCK_EVENT_MINUTE_TICK, nullptr, 0, 0);
 
             ESP_LOGD(TAG, "Minute tick: %02d:%02d", timeinfo.tm_hour, timeinfo.tm_min);
 
@@ -56,8 +59,7 @@ void ticker_callback(void* arg) {
                 g_last_hour = timeinfo.tm_hour;
 
                 // Post hour tick event
-                esp_event_post(CLOCK_EVENTS, CLOCK_EVENT_HOUR_TICK,
-                               &event_data, sizeof(event_data), 0);
+                esp_event_post(CLOCK_EVENTS, CLOCK_EVENT_HOUR_TICK, nullptr, 0, 0);
 
                 ESP_LOGI(TAG, "Hour tick: %02d:00", timeinfo.tm_hour);
             }
@@ -76,17 +78,10 @@ void on_ntp_sync(void* arg, esp_event_base_t base, int32_t id, void* data) {
         struct tm timeinfo;
         localtime_r(&now, &timeinfo);
 
-        clock_time_event_data_t event_data = {
-            .hour = timeinfo.tm_hour,
-            .minute = timeinfo.tm_min,
-            .second = timeinfo.tm_sec
-        };
-
         g_last_minute = timeinfo.tm_min;
         g_last_hour = timeinfo.tm_hour;
 
-        esp_event_post(CLOCK_EVENTS, CLOCK_EVENT_MINUTE_TICK,
-                       &event_data, sizeof(event_data), 0);
+        esp_event_post(CLOCK_EVENTS, CLOCK_EVENT_MINUTE_TICK, nullptr, 0, 0);
     }
     else if (id == 1) {  // KD_NTP_EVENT_SYNC_LOST
         ESP_LOGW(TAG, "NTP sync lost, stopping time ticker");
@@ -126,17 +121,10 @@ void clock_time_ticker_init() {
         struct tm timeinfo;
         localtime_r(&now, &timeinfo);
 
-        clock_time_event_data_t event_data = {
-            .hour = timeinfo.tm_hour,
-            .minute = timeinfo.tm_min,
-            .second = timeinfo.tm_sec
-        };
-
         g_last_minute = timeinfo.tm_min;
         g_last_hour = timeinfo.tm_hour;
 
-        esp_event_post(CLOCK_EVENTS, CLOCK_EVENT_MINUTE_TICK,
-                       &event_data, sizeof(event_data), 0);
+        esp_event_post(CLOCK_EVENTS, CLOCK_EVENT_MINUTE_TICK, nullptr, 0, 0);
     }
 
     ESP_LOGI(TAG, "Time ticker initialized");
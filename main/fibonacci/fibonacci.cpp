@@ -15,6 +15,8 @@
 
 #include "kd_common.h"
 #include "clock_events.h"
+#include "pixel_stream.h"
+#include "alloc_trace.h"
 
 #include "sdkconfig.h"
 
@@ -23,9 +25,8 @@
 static const char* TAG = "fibonacci";
 
 std::vector<PixelColor>* pixel_buffer = nullptr;
-uint8_t bits[9] = { 0 };
 
-static fibonacci_config_t fib_config = {
+fibonacci_config_t fib_config = {
     .brightness = 255,  // Default full brightness
     .theme_id = 0,      // Default to RGB theme
     .on = true          // Default on
@@ -33,8 +34,8 @@ static fibonacci_config_t fib_config = {
 
 #define FIBONACCI_THEMES_COUNT (sizeof(colors) / sizeof(colors[0]))
 
-// Define the colors array (declared as extern in themes.h)
-fibonacci_colorTheme colors[] = {
+// Colors represented in RGB. Off color is always white. Const, so the table stays in flash
+static const fibonacci_colorTheme colors[] = {
     { 0, "RGB",     0xFF0A0A, 0x0AFF0A, 0x0A0AFF },
     { 1, "Mondrian",0xFF0A0A, 0xF8DE00, 0x0A0AFF },
     { 2, "Basbrun", 0x502800, 0x14C814, 0xFF640A },
@@ -91,7 +92,7 @@ void setPixel(uint8_t pixel, uint32_t color)
     };
 }
 
-void setBits(uint8_t value, uint8_t offset)
+static void setBits(uint8_t bits[9], uint8_t value, uint8_t offset)
 {
     switch (value)
     {
@@ -296,11 +297,11 @@ void setTime(uint8_t hours, uint8_t minutes)
     // Clear all pixels first
     std::fill(pixel_buffer->begin(), pixel_buffer->end(), PixelColor(0, 0, 0));
 
-    for (int i = 0; i < 9; i++)
-        bits[i] = 0;
+    // Per square: 0x01 hour, 0x02 minute
+    uint8_t bits[9] = { 0 };
 
-    setBits(hours, 0x01);
-    setBits(minutes / 5, 0x02);
+    setBits(bits, hours, 0x01);
+    setBits(bits, minutes / 5, 0x02);
 
     for (int i = 0; i < 9; i++)
     {
@@ -323,6 +324,12 @@ void setTime(uint8_t hours, uint8_t minutes)
 
 // Update the display with current time
 static void update_display(void) {
+    // The buffer belongs to the stream until it is released
+    if (pixel_stream_active()) return;
+
+    // The sync animation owns the buffer until NTP sync
+    if (!kd_common_ntp_is_synced()) return;
+
     time_t now;
     struct tm timeinfo;
     time(&now);
@@ -334,6 +341,8 @@ static void update_display(void) {
 
 // Event handler for clock events
 static void clock_event_handler(void* arg, esp_event_base_t base, int32_t id, void* data) {
+    ALLOC_TRACE_SCOPE(ALLOC_PATH_CLOCK);
+
     if (base == CLOCK_EVENTS) {
         switch (id) {
             case CLOCK_EVENT_MINUTE_TICK:
@@ -341,6 +350,16 @@ static void clock_event_handler(void* arg, esp_event_base_t base, int32_t id, vo
             case CLOCK_EVENT_FORCE_REFRESH:
                 update_display();
                 break;
+            case CLOCK_EVENT_DISPLAY_RELEASED:
+                // Back to the clock, or to the sync animation if NTP is still pending
+                if (kd_common_ntp_is_synced()) {
+                    PixelDriver::getMainChannel()->setEffectByID("raw");
+                    update_display();
+                }
+                else {
+                    PixelDriver::getMainChannel()->setEffectByID("CYCLIC");
+                }
+                break;
             default:
                 break;
         }
@@ -356,30 +375,6 @@ static void ntp_event_handler(void* arg, esp_event_base_t base, int32_t id, void
     }
 }
 
-void fibonacci_clock_task(void* pvParameters) {
-    ESP_LOGI(TAG, "Fibonacci clock task started");
-
-    // Show syncing animation
-    PixelDriver::getMainChannel()->setColor(PixelColor(255, 255, 0)); // Yellow during sync
-    PixelDriver::getMainChannel()->setEffectByID("CYCLIC");
-    PixelDriver::getMainChannel()->setBrightness(fib_config.brightness);
-
-    // Register for clock events
-    esp_event_handler_register(CLOCK_EVENTS, ESP_EVENT_ANY_ID, clock_event_handler, nullptr);
-    esp_event_handler_register(KD_NTP_EVENTS, KD_NTP_EVENT_SYNC_COMPLETE, ntp_event_handler, nullptr);
-
-    // If already synced, switch to display mode immediately
-    if (kd_common_ntp_is_synced()) {
-        PixelDriver::getMainChannel()->setEffectByID("raw");
-        update_display();
-    }
-
-    // Task sleeps indefinitely - all updates come from events
-    while (true) {
-        vTaskDelay(portMAX_DELAY);
-    }
-}
-
 // Post config changed event to trigger display update
 static void post_config_changed(void) {
     esp_event_post(CLOCK_EVENTS, CLOCK_EVENT_CONFIG_CHANGED, nullptr, 0, 0);
@@ -407,12 +402,28 @@ void fibonacci_set_on_state(bool on) {
     post_config_changed();
 }
 
+// Apply and save a whole config at once; the caller posts CLOCK_EVENT_CONFIG_CHANGED
+void fibonacci_update_config(const fibonacci_config_t* config) {
+    if (config == NULL) return;
+
+    fib_config = *config;
+    if (fib_config.theme_id >= FIBONACCI_THEMES_COUNT) {
+        fib_config.theme_id = 0;
+    }
+    PixelDriver::getMainChannel()->setBrightness(fib_config.brightness);
+    fibonacci_save_to_nvs(&fib_config);
+}
+
+// Apply a config loaded from NVS; unlike the setters this saves nothing
 void fibonacci_apply_config(fibonacci_config_t* config) {
     if (config == NULL) return;
 
-    fibonacci_set_brightness(config->brightness);
-    fibonacci_set_theme(config->theme_id);
-    fibonacci_set_on_state(config->on);
+    fib_config = *config;
+    if (fib_config.theme_id >= FIBONACCI_THEMES_COUNT) {
+        fib_config.theme_id = 0;
+    }
+    PixelDriver::getMainChannel()->setBrightness(fib_config.brightness);
+    post_config_changed();
 }
 
 uint8_t fibonacci_get_themes_count(void) {
@@ -449,6 +460,10 @@ void fibonacci_clock_init() {
     // Apply loaded configuration
     fibonacci_apply_config(&fib_config);
 
+    // All updates come from events; the display switches to raw mode on NTP sync
+    esp_event_handler_register(CLOCK_EVENTS, ESP_EVENT_ANY_ID, clock_event_handler, nullptr);
+    esp_event_handler_register(KD_NTP_EVENTS, KD_NTP_EVENT_SYNC_COMPLETE, ntp_event_handler, nullptr);
+
     PixelDriver::getMainChannel()->setColor(PixelColor(0, 255, 255));
     PixelDriver::getMainChannel()->setEffectByID("BREATHE");
 }
@@ -13,9 +13,9 @@ typedef struct {
 void fibonacci_set_brightness(uint8_t brightness);
 void fibonacci_set_theme(uint8_t theme_id);
 void fibonacci_set_on_state(bool on);
+void fibonacci_update_config(const fibonacci_config_t* config);  // All fields, one save, no event
 
 void fibonacci_clock_init();
-void fibonacci_clock_task(void* pvParameters);
 
 // Theme functions (these remain as they're utility functions)
 uint8_t fibonacci_get_themes_count(void);
@@ -1,210 +1,245 @@
 #include "fibonacci_handlers.h"
 #include "fibonacci.h"
-#include "cJSON.h"
+#include "clock_events.h"
+#include "config_batch.h"
+#include "http_governor.h"
+#include "config_cache.h"
+#include "json_reader.h"
+#include "json_writer.h"
+#include "pb_codec.h"
+#include "settings_store.h"
+#include "state_ws.h"
+#include "pixel_stream.h"
 #include "esp_log.h"
 #include <string.h>
 #include "api.h"  // For set_cors_headers function
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
-#include "nvs_flash.h"
-#include "nvs.h"
 
 static const char* TAG = "fibonacci_handlers";
 
-// NVS namespace for Fibonacci configuration
+// Pre-record NVS namespace, migrated into the settings record
 #define FIBONACCI_NVS_NAMESPACE "fib_cfg"
 
-// Helper function to create Fibonacci state JSON
-static cJSON* create_fibonacci_state_json(void) {
-    fibonacci_config_t config;
-    fibonacci_load_from_nvs(&config);
+// External fib_config from fibonacci.cpp
+extern fibonacci_config_t fib_config;
+
+// Settings record field IDs; never reuse a retired ID
+static const settings_field_t fibonacci_settings_fields[] = {
+    SETTINGS_FIELD(1, fibonacci_config_t, brightness),
+    SETTINGS_FIELD(2, fibonacci_config_t, theme_id),
+    SETTINGS_FIELD(3, fibonacci_config_t, on),
+};
+
+static settings_domain_t fibonacci_settings =
+    SETTINGS_DOMAIN(SETTINGS_ID_FIBONACCI, "fibonacci", fib_config, fibonacci_settings_fields, FIBONACCI_NVS_NAMESPACE);
+
+// FibonacciConfig and FibonacciTheme field numbers, see docs/clock-config.proto
+enum {
+    FIBONACCI_PB_BRIGHTNESS = 1,
+    FIBONACCI_PB_THEME_ID = 2,
+    FIBONACCI_PB_ON = 3,
+    FIBONACCI_PB_THEMES = 4,
+};
+
+enum {
+    THEME_PB_ID = 1,
+    THEME_PB_NAME = 2,
+    THEME_PB_HOUR_COLOR = 3,
+    THEME_PB_MINUTE_COLOR = 4,
+    THEME_PB_BOTH_COLOR = 5,
+};
+
+// The ten built-in themes take 263 bytes
+#define FIBONACCI_PB_BUFFER_SIZE 384
+
+// Helper function to write the Fibonacci configuration members
+static void write_fibonacci_config_members(json_writer_t* writer, const fibonacci_config_t* config) {
+    json_kv_int(writer, "brightness", config->brightness);
+    json_kv_int(writer, "theme_id", config->theme_id);
+    json_kv_bool(writer, "on", config->on);
+}
 
-    cJSON* json = cJSON_CreateObject();
-    if (json == NULL) {
-        return NULL;
-    }
+// Helper function to write Fibonacci configuration JSON, without the theme list
+static void write_fibonacci_config_json(json_writer_t* writer) {
+    fibonacci_config_t config = fib_config;
+
+    json_object_begin(writer);
+    write_fibonacci_config_members(writer, &config);
+    json_object_end(writer);
+}
 
-    cJSON* brightness_json = cJSON_CreateNumber(config.brightness);
-    cJSON* theme_id_json = cJSON_CreateNumber(config.theme_id);
-    cJSON* on_json = cJSON_CreateBool(config.on);
+// Helper function to write Fibonacci state JSON
+static void write_fibonacci_state_json(json_writer_t* writer) {
+    fibonacci_config_t config = fib_config;
+
+    json_object_begin(writer);
+    write_fibonacci_config_members(writer, &config);
 
     // Add theme information
-    cJSON* themes_array = cJSON_CreateArray();
+    json_key(writer, "themes");
+    json_array_begin(writer);
     uint8_t themes_count = fibonacci_get_themes_count();
     for (uint8_t i = 0; i < themes_count; i++) {
         const fibonacci_colorTheme* theme = fibonacci_get_theme_info(i);
         if (theme) {
-            cJSON* theme_obj = cJSON_CreateObject();
-            cJSON_AddItemToObject(theme_obj, "id", cJSON_CreateNumber(theme->id));
-            cJSON_AddItemToObject(theme_obj, "name", cJSON_CreateString(theme->name));
-
-            // Convert colors to hex strings
-            char hour_color_str[8], minute_color_str[8], both_color_str[8];
-            snprintf(hour_color_str, sizeof(hour_color_str), "#%06X", (unsigned int)theme->hour_color);
-            snprintf(minute_color_str, sizeof(minute_color_str), "#%06X", (unsigned int)theme->minute_color);
-            snprintf(both_color_str, sizeof(both_color_str), "#%06X", (unsigned int)theme->both_color);
-
-            cJSON_AddItemToObject(theme_obj, "hour_color", cJSON_CreateString(hour_color_str));
-            cJSON_AddItemToObject(theme_obj, "minute_color", cJSON_CreateString(minute_color_str));
-            cJSON_AddItemToObject(theme_obj, "both_color", cJSON_CreateString(both_color_str));
-
-            cJSON_AddItemToArray(themes_array, theme_obj);
+            json_object_begin(writer);
+            json_kv_int(writer, "id", theme->id);
+            json_kv_string(writer, "name", theme->name);
+            json_kv_color(writer, "hour_color", theme->hour_color);
+            json_kv_color(writer, "minute_color", theme->minute_color);
+            json_kv_color(writer, "both_color", theme->both_color);
+            json_object_end(writer);
         }
     }
+    json_array_end(writer);
 
-    cJSON_AddItemToObject(json, "brightness", brightness_json);
-    cJSON_AddItemToObject(json, "theme_id", theme_id_json);
-    cJSON_AddItemToObject(json, "on", on_json);
-    cJSON_AddItemToObject(json, "themes", themes_array);
-
-    return json;
+    json_object_end(writer);
 }
 
-// Helper function to apply Fibonacci configuration from JSON
-static esp_err_t apply_fibonacci_config_from_json(cJSON* json) {
-    if (!json) return ESP_FAIL;
-
-    // Get current config
-    fibonacci_config_t config;
-    fibonacci_load_from_nvs(&config);
-
-    // Get fields
-    cJSON* brightness_json = cJSON_GetObjectItem(json, "brightness");
-    cJSON* theme_id_json = cJSON_GetObjectItem(json, "theme_id");
-    cJSON* on_json = cJSON_GetObjectItem(json, "on");
-
-    // Validate brightness if present
-    if (cJSON_IsNumber(brightness_json)) {
-        int val = cJSON_GetNumberValue(brightness_json);
-        uint8_t brightness = (val < 0) ? 0 : (val > 255) ? 255 : val;
-        config.brightness = brightness;
-        fibonacci_set_brightness(brightness);
-    }
+// Helper function to write Fibonacci state as a FibonacciConfig message
+static void write_fibonacci_state_pb(pb_writer_t* writer) {
+    fibonacci_config_t config = fib_config;
 
-    // Validate theme_id if present
-    if (cJSON_IsNumber(theme_id_json)) {
-        int val = cJSON_GetNumberValue(theme_id_json);
-        uint8_t theme_id = (val < 0) ? 0 : (val >= fibonacci_get_themes_count()) ? 0 : val;
-        config.theme_id = theme_id;
-        fibonacci_set_theme(theme_id);
-    }
+    pb_write_uint(writer, FIBONACCI_PB_BRIGHTNESS, config.brightness);
+    pb_write_uint(writer, FIBONACCI_PB_THEME_ID, config.theme_id);
+    pb_write_bool(writer, FIBONACCI_PB_ON, config.on);
 
-    // Validate on state if present
-    if (cJSON_IsBool(on_json)) {
-        bool on = cJSON_IsTrue(on_json);
-        config.on = on;
-        fibonacci_set_on_state(on);
+    uint8_t themes_count = fibonacci_get_themes_count();
+    for (uint8_t i = 0; i < themes_count; i++) {
+        const fibonacci_colorTheme* theme = fibonacci_get_theme_info(i);
+        if (theme) {
+            size_t mark = pb_message_begin(writer, FIBONACCI_PB_THEMES);
+            pb_write_uint(writer, THEME_PB_ID, theme->id);
+            pb_write_string(writer, THEME_PB_NAME, theme->name);
+            pb_write_uint(writer, THEME_PB_HOUR_COLOR, theme->hour_color);
+            pb_write_uint(writer, THEME_PB_MINUTE_COLOR, theme->minute_color);
+            pb_write_uint(writer, THEME_PB_BOTH_COLOR, theme->both_color);
+            pb_message_end(writer, mark);
+        }
     }
-
-    // Save to NVS
-    fibonacci_save_to_nvs(&config);
-    return ESP_OK;
 }
 
-// Legacy HTTP handlers for backward compatibility
-esp_err_t fibonacci_config_get_handler(httpd_req_t* req) {
-    cJSON* json = create_fibonacci_state_json();
-    if (json == NULL) {
-        httpd_resp_send_500(req);
-        return ESP_FAIL;
-    }
+// Config staged by a POST to /api/fibonacci or /api/config until it
+// validated; both read into it on the httpd task
+static fibonacci_config_t fibonacci_staged_config;
+static int32_t fibonacci_staged_brightness;
+static int32_t fibonacci_staged_theme_id;
+
+static json_field_t fibonacci_json_fields[] = {
+    { .key = "brightness", .type = JSON_FIELD_INT, .value = &fibonacci_staged_brightness },
+    { .key = "theme_id", .type = JSON_FIELD_INT, .value = &fibonacci_staged_theme_id },
+    { .key = "on", .type = JSON_FIELD_BOOL, .value = &fibonacci_staged_config.on },
+};
+
+static pb_field_t fibonacci_pb_fields[] = {
+    { .number = FIBONACCI_PB_BRIGHTNESS, .type = PB_FIELD_INT, .value = &fibonacci_staged_brightness },
+    { .number = FIBONACCI_PB_THEME_ID, .type = PB_FIELD_INT, .value = &fibonacci_staged_theme_id },
+    { .number = FIBONACCI_PB_ON, .type = PB_FIELD_BOOL, .value = &fibonacci_staged_config.on },
+};
+
+static void begin_fibonacci_config(void) {
+    fibonacci_staged_config = fib_config;
+    fibonacci_staged_brightness = fib_config.brightness;
+    fibonacci_staged_theme_id = fib_config.theme_id;
+}
 
-    char* json_string = cJSON_Print(json);
-    if (json_string == NULL) {
-        cJSON_Delete(json);
-        httpd_resp_send_500(req);
-        return ESP_FAIL;
-    }
+// Helper function to finish the staged config from the fields read
+static esp_err_t validate_fibonacci_config(const char** error) {
+    int32_t brightness = fibonacci_staged_brightness;
+    int32_t theme_id = fibonacci_staged_theme_id;
 
-    httpd_resp_set_type(req, "application/json");
-    httpd_resp_send(req, json_string, strlen(json_string));
+    fibonacci_staged_config.brightness = (brightness < 0) ? 0 : (brightness > 255) ? 255 : brightness;
+    fibonacci_staged_config.theme_id = (theme_id < 0) ? 0 : (theme_id >= fibonacci_get_themes_count()) ? 0 : theme_id;
+    return ESP_OK;
+}
 
-    free(json_string);
-    cJSON_Delete(json);
+static void commit_fibonacci_config(void) {
+    fibonacci_update_config(&fibonacci_staged_config);
+}
 
-    return ESP_OK;
+static const config_section_t fibonacci_config_section = {
+    .name = "fibonacci",
+    .fields = fibonacci_json_fields,
+    .field_count = sizeof(fibonacci_json_fields) / sizeof(fibonacci_json_fields[0]),
+    .begin = begin_fibonacci_config,
+    .validate = validate_fibonacci_config,
+    .commit = commit_fibonacci_config,
+    .write = write_fibonacci_config_json,
+};
+
+// Helper function to build the cached JSON body
+static size_t build_fibonacci_json(uint8_t* buf, size_t size) {
+    json_writer_t writer;
+    json_writer_init(&writer, (char*)buf, size, NULL);
+    write_fibonacci_state_json(&writer);
+    return json_writer_finish(&writer) == ESP_OK ? writer.len : 0;
 }
 
-esp_err_t fibonacci_config_post_handler(httpd_req_t* req) {
-    char content[512];
-    int ret = httpd_req_recv(req, content, sizeof(content) - 1);
-    if (ret <= 0) {
-        if (ret == HTTPD_SOCK_ERR_TIMEOUT) {
-            httpd_resp_send_408(req);
-        }
-        else {
-            httpd_resp_send_500(req);
-        }
-        return ESP_FAIL;
-    }
-    content[ret] = '\0';
+// Helper function to build the cached protobuf body
+static size_t build_fibonacci_pb(uint8_t* buf, size_t size) {
+    pb_writer_t writer;
+    pb_writer_init(&writer, buf, size);
+    write_fibonacci_state_pb(&writer);
+    return writer.err == ESP_OK ? writer.len : 0;
+}
 
-    // Parse JSON
-    cJSON* json = cJSON_Parse(content);
-    if (json == NULL) {
-        httpd_resp_send_err(req, HTTPD_400_BAD_REQUEST, "Invalid JSON format");
-        return ESP_FAIL;
-    }
+// GET responses, rebuilt only after fibonacci_save_to_nvs(); JSON with
+// the ten built-in themes is 1003 bytes
+static config_domain_t fibonacci_domain = CONFIG_DOMAIN("fibonacci");
+static config_body_t fibonacci_json_body = CONFIG_BODY(&fibonacci_domain, "json", "application/json", build_fibonacci_json, 1152);
+static config_body_t fibonacci_pb_body = CONFIG_BODY(&fibonacci_domain, "pb", PB_CONTENT_TYPE, build_fibonacci_pb, FIBONACCI_PB_BUFFER_SIZE);
 
-    // Apply configuration using shared function
-    esp_err_t result = apply_fibonacci_config_from_json(json);
-    cJSON_Delete(json);
+// Legacy HTTP handlers for backward compatibility
+esp_err_t fibonacci_config_get_handler(httpd_req_t* req) {
+    httpd_resp_set_hdr(req, "Vary", "Accept");
+    return config_body_send(req, pb_request_accepted(req) ? &fibonacci_pb_body : &fibonacci_json_body);
+}
 
-    if (result != ESP_OK) {
-        httpd_resp_send_err(req, HTTPD_400_BAD_REQUEST, "Invalid configuration");
+esp_err_t fibonacci_config_post_handler(httpd_req_t* req) {
+    // Error responses are sent by the reader
+    if (config_section_read_request(req, &fibonacci_config_section, fibonacci_pb_fields,
+            sizeof(fibonacci_pb_fields) / sizeof(fibonacci_pb_fields[0])) != ESP_OK) {
         return ESP_FAIL;
     }
 
+    // Apply and save all fields at once, then redraw once
+    fibonacci_update_config(&fibonacci_staged_config);
+    esp_event_post(CLOCK_EVENTS, CLOCK_EVENT_CONFIG_CHANGED, nullptr, 0, 0);
     return fibonacci_config_get_handler(req); // Return updated config
 }
 
 // NVS functions
 void fibonacci_load_from_nvs(fibonacci_config_t* config) {
-    nvs_handle_t nvs_handle;
-    esp_err_t err = nvs_open(FIBONACCI_NVS_NAMESPACE, NVS_READONLY, &nvs_handle);
-    if (err != ESP_OK) {
-        ESP_LOGI(TAG, "Fibonacci NVS namespace not found, using defaults");
-        config->brightness = 255;
-        config->theme_id = 0;
-        config->on = true;
-        return;
-    }
-
-    size_t required_size = sizeof(fibonacci_config_t);
-    err = nvs_get_blob(nvs_handle, "config", config, &required_size);
-    if (err != ESP_OK) {
-        ESP_LOGI(TAG, "Fibonacci config not found in NVS, using defaults");
-        config->brightness = 255;
-        config->theme_id = 0;
-        config->on = true;
+    // Defaults for fields the record does not hold
+    fib_config.brightness = 255;
+    fib_config.theme_id = 0;
+    fib_config.on = true;
+
+    // Read once at boot; fib_config stays the authoritative copy
+    if (!settings_load(&fibonacci_settings)) {
+        ESP_LOGI(TAG, "Fibonacci config not stored yet, using defaults");
     }
 
-    nvs_close(nvs_handle);
+    *config = fib_config;
 }
 
 void fibonacci_save_to_nvs(fibonacci_config_t* config) {
-    nvs_handle_t nvs_handle;
-    esp_err_t err = nvs_open(FIBONACCI_NVS_NAMESPACE, NVS_READWRITE, &nvs_handle);
-    if (err != ESP_OK) {
-        ESP_LOGE(TAG, "Failed to open Fibonacci NVS for writing: %s", esp_err_to_name(err));
-        return;
-    }
-
-    err = nvs_set_blob(nvs_handle, "config", config, sizeof(fibonacci_config_t));
-    if (err != ESP_OK) {
-        ESP_LOGE(TAG, "Failed to save Fibonacci config to NVS: %s", esp_err_to_name(err));
-    }
-    else {
-        err = nvs_commit(nvs_handle);
-        if (err != ESP_OK) {
-            ESP_LOGE(TAG, "Failed to commit Fibonacci NVS: %s", esp_err_to_name(err));
-        }
-    }
+    // Written by the settings store once changes settle
+    fib_config = *config;
+    settings_mark_dirty(&fibonacci_settings);
 
-    nvs_close(nvs_handle);
+    // Cached GET bodies are rebuilt on their next use
+    config_domain_changed(&fibonacci_domain);
 }
 
 void register_fibonacci_handlers(httpd_handle_t server) {
+    // Config section of the /api/ws pushes; the theme list never changes
+    state_ws_set_config_writer(write_fibonacci_config_json);
+
+    // Settable together with other sections through /api/config
+    config_batch_register(&fibonacci_config_section);
+
     // Register legacy HTTP handlers for backward compatibility
     httpd_uri_t fibonacci_config_get_uri = {
         .uri = "/api/fibonacci",
@@ -212,7 +247,7 @@ void register_fibonacci_handlers(httpd_handle_t server) {
         .handler = fibonacci_config_get_handler,
         .user_ctx = NULL
     };
-    httpd_register_uri_handler(server, &fibonacci_config_get_uri);
+    http_governor_register_uri(server, &fibonacci_config_get_uri);
 
     httpd_uri_t fibonacci_config_post_uri = {
         .uri = "/api/fibonacci",
@@ -220,5 +255,8 @@ void register_fibonacci_handlers(httpd_handle_t server) {
         .handler = fibonacci_config_post_handler,
         .user_ctx = NULL
     };
-    httpd_register_uri_handler(server, &fibonacci_config_post_uri);
+    http_governor_register_uri(server, &fibonacci_config_post_uri);
+
+    // Raw frames for the 9 panels at /api/ws/pixels
+    register_pixel_stream_handlers(server);
 }
@@ -33,6 +33,9 @@ esp_err_t fibonacci_config_post_handler(httpd_req_t* req);
 /**
  * @brief Load Fibonacci configuration from NVS
  *
+ * Fills the live configuration from the settings record read at boot,
+ * with defaults for fields the record does not hold. Call once at init.
+ *
  * @param config Pointer to configuration structure to fill
  */
 void fibonacci_load_from_nvs(fibonacci_config_t* config);
@@ -40,6 +43,9 @@ void fibonacci_load_from_nvs(fibonacci_config_t* config);
 /**
  * @brief Save Fibonacci configuration to NVS
  *
+ * Becomes the live configuration at once; the settings store writes it
+ * to NVS once changes settle.
+ *
  * @param config Pointer to configuration structure to save
  */
 void fibonacci_save_to_nvs(fibonacci_config_t* config);
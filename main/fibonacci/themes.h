@@ -13,8 +13,5 @@ typedef struct fibonacci_colorTheme {
     uint32_t both_color;
 } fibonacci_colorTheme;
 
-//Colors represented in RGB. Off color is always white.
-extern fibonacci_colorTheme colors[];
-
 #endif
 
@@ -14,8 +14,9 @@
 #include "api.h"
 #include "kd_pixdriver.h"
 #include "clock_time_ticker.h"
-
-static TaskHandle_t s_clock_task_handle = NULL;
+#include "settings_store.h"
+#include "task_stacks.h"
+#include "alloc_trace.h"
 
 #ifdef CONFIG_BASE_CLOCK_TYPE_NIXIE
 #include "nixie/nixie.h"
@@ -49,19 +50,6 @@ void wifi_connected(void* arg, esp_event_base_t event_base, int32_t event_id, vo
     ESP_LOGI("Clock", "WiFi connected - starting time sync");
     PixelDriver::getMainChannel()->setColor(PixelColor(255, 255, 0));
     PixelDriver::getMainChannel()->setEffectByID("CYCLIC");
-
-    // Only create clock task once (prevent duplicates on WiFi reconnect)
-    if (s_clock_task_handle == NULL) {
-#ifdef CONFIG_BASE_CLOCK_TYPE_NIXIE
-        xTaskCreate(nixie_clock_task, "clock_task", 2560, NULL, 5, &s_clock_task_handle);
-#elif CONFIG_BASE_CLOCK_TYPE_FIBONACCI
-        xTaskCreate(fibonacci_clock_task, "clock_task", 2560, NULL, 5, &s_clock_task_handle);
-#elif CONFIG_BASE_CLOCK_TYPE_WORDCLOCK
-        xTaskCreate(wordclock_clock_task, "clock_task", 2560, NULL, 5, &s_clock_task_handle);
-#else
-#error "No base clock type selected"
-#endif
-    }
 }
 
 extern "C" void app_main(void)
@@ -71,9 +59,18 @@ extern "C" void app_main(void)
 
     kd_common_init();
 
+    // Writes settings changes to NVS in the background
+    settings_store_init();
+
     // Initialize time ticker (posts CLOCK_EVENT_MINUTE_TICK and CLOCK_EVENT_HOUR_TICK)
     clock_time_ticker_init();
 
+    // Logs firmware task stack high-water marks every hour
+    task_stacks_init();
+
+    // Logs hot-path heap allocations every hour (CONFIG_ALLOC_TRACE)
+    alloc_trace_init();
+
     clock_api_init();
 
 #ifdef CONFIG_BASE_CLOCK_TYPE_NIXIE
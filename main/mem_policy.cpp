@@ -0,0 +1,102 @@
+#include "mem_policy.h"
+
+#include <esp_heap_caps.h>
+#include <esp_log.h>
+#include <esp_memory_utils.h>
+
+#include "freertos/FreeRTOS.h"
+#include "sdkconfig.h"
+
+static const char* TAG = "mem_policy";
+
+#ifndef CONFIG_SPIRAM
+#define CONFIG_MEM_PSRAM_MIN_SIZE 0
+#endif
+
+namespace {
+
+typedef struct {
+    const char* name;
+    bool psram;                 // Large buffers go to PSRAM first
+    uint32_t internal_caps;
+} mem_policy_t;
+
+// Indexed by mem_subsystem_t
+const mem_policy_t g_policies[MEM_SUBSYSTEM_COUNT] = {
+#if defined(CONFIG_SPIRAM) && defined(CONFIG_MEM_PSRAM_HTTP)
+    { "http", true, MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT },
+#else
+    { "http", false, MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT },
+#endif
+#if defined(CONFIG_SPIRAM) && defined(CONFIG_MEM_PSRAM_STREAM)
+    { "stream", true, MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT },
+#else
+    { "stream", false, MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT },
+#endif
+    { "dma", false, MALLOC_CAP_INTERNAL | MALLOC_CAP_DMA },
+};
+
+mem_usage_t g_usage[MEM_SUBSYSTEM_COUNT] = {};
+portMUX_TYPE g_lock = portMUX_INITIALIZER_UNLOCKED;
+
+void account(mem_subsystem_t subsystem, void* ptr, bool allocated) {
+    size_t size = heap_caps_get_allocated_size(ptr);
+    bool psram = esp_ptr_external_ram(ptr);
+
+    portENTER_CRITICAL(&g_lock);
+    mem_usage_t* usage = &g_usage[subsystem];
+    size_t* region = psram ? &usage->psram : &usage->internal;
+    if (allocated) {
+        *region += size;
+        if (usage->internal + usage->psram > usage->peak) {
+            usage->peak = usage->internal + usage->psram;
+        }
+    }
+    else {
+        *region -= size;
+    }
+    portEXIT_CRITICAL(&g_lock);
+}
+
+} // namespace
+
+void* mem_alloc(mem_subsystem_t subsystem, size_t size) {
+    const mem_policy_t* policy = &g_policies[subsystem];
+
+    void* ptr = nullptr;
+    if (policy->psram && size >= CONFIG_MEM_PSRAM_MIN_SIZE) {
+        ptr = heap_caps_malloc(size, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+    }
+    if (ptr == nullptr) {
+        ptr = heap_caps_malloc(size, policy->internal_caps);
+    }
+
+    if (ptr == nullptr) {
+        portENTER_CRITICAL(&g_lock);
+        g_usage[subsystem].failures++;
+        portEXIT_CRITICAL(&g_lock);
+        ESP_LOGE(TAG, "No memory for %u %s bytes", (unsigned int)size, policy->name);
+        return nullptr;
+    }
+
+    account(subsystem, ptr, true);
+    return ptr;
+}
+
+void mem_free(mem_subsystem_t subsystem, void* ptr) {
+    if (ptr == nullptr) {
+        return;
+    }
+    account(subsystem, ptr, false);
+    heap_caps_free(ptr);
+}
+
+void mem_get_usage(mem_subsystem_t subsystem, mem_usage_t* usage) {
+    portENTER_CRITICAL(&g_lock);
+    *usage = g_usage[subsystem];
+    portEXIT_CRITICAL(&g_lock);
+}
+
+const char* mem_subsystem_name(mem_subsystem_t subsystem) {
+    return g_policies[subsystem].name;
+}
@@ -0,0 +1,56 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * Memory placement policy
+ *
+ * Firmware buffers are allocated per subsystem, and the subsystem decides
+ * where they live. With CONFIG_SPIRAM, a subsystem enabled under
+ * "Memory placement" puts buffers of CONFIG_MEM_PSRAM_MIN_SIZE bytes or
+ * more in PSRAM, falling back to internal RAM when PSRAM is full. Small
+ * buffers, DMA buffers and anything touched with the flash cache disabled
+ * stay internal, leaving internal RAM to Wi-Fi and TLS.
+ */
+
+typedef enum {
+    MEM_HTTP,           // Response bodies and request jobs
+    MEM_STREAM,         // Pixel stream frames
+    MEM_DMA,            // Peripheral transfer buffers, always internal and DMA-capable
+    MEM_SUBSYSTEM_COUNT
+} mem_subsystem_t;
+
+/**
+ * Bytes a subsystem currently holds, by region.
+ */
+typedef struct {
+    size_t internal;
+    size_t psram;
+    size_t peak;                // Most bytes held at once
+    uint32_t failures;          // Allocations that found no memory
+} mem_usage_t;
+
+/**
+ * Allocate a buffer where the subsystem's policy places it.
+ *
+ * @return The buffer, or NULL if no region has room
+ */
+void* mem_alloc(mem_subsystem_t subsystem, size_t size);
+
+/**
+ * Free a buffer from mem_alloc() with the same subsystem.
+ */
+void mem_free(mem_subsystem_t subsystem, void* ptr);
+
+void mem_get_usage(mem_subsystem_t subsystem, mem_usage_t* usage);
+
+const char* mem_subsystem_name(mem_subsystem_t subsystem);
+
+#ifdef __cplusplus
+}
+#endif
@@ -15,6 +15,8 @@
 #include <string.h>
 #include "kd_common.h"
 #include "clock_events.h"
+#include "task_stacks.h"
+#include "alloc_trace.h"
 
 #include <esp_event.h>
 
@@ -66,6 +68,12 @@ void nixie_show_time(int h, int m, int s) {
 }
 
 
+// 200 ms polling loop plus an SPI transfer; see task_stacks_report()
+#define NIXIE_CLOCK_TASK_STACK_SIZE 2560
+
+static StackType_t nixie_clock_task_stack[NIXIE_CLOCK_TASK_STACK_SIZE];
+static StaticTask_t nixie_clock_task_tcb;
+
 // Shared state for the nixie clock task
 static volatile bool g_ntp_synced = false;
 static volatile bool g_cleaning = false;
@@ -95,6 +103,8 @@ static void update_display(void) {
 
 // Event handler for clock events
 static void clock_event_handler(void* arg, esp_event_base_t base, int32_t id, void* data) {
+    ALLOC_TRACE_SCOPE(ALLOC_PATH_CLOCK);
+
     if (base == CLOCK_EVENTS) {
         switch (id) {
         case CLOCK_EVENT_SECOND_TICK:
@@ -105,8 +115,11 @@ static void clock_event_handler(void* arg, esp_event_base_t base, int32_t id, vo
             break;
         case CLOCK_EVENT_HOUR_TICK: {
             // Check for cleaning trigger at 4:00 AM
-            clock_time_event_data_t* time_data = (clock_time_event_data_t*)data;
-            if (time_data && time_data->hour == 4 && time_data->minute == 0) {
+            time_t now;
+            struct tm timeinfo;
+            time(&now);
+            localtime_r(&now, &timeinfo);
+            if (timeinfo.tm_hour == 4 && timeinfo.tm_min == 0) {
                 ESP_LOGI(TAG, "Starting cathode cleaning cycle");
                 g_cleaning = true;
                 g_cleaning_digit = 0;
@@ -140,28 +153,13 @@ static void ntp_event_handler(void* arg, esp_event_base_t base, int32_t id, void
     }
 }
 
-void nixie_clock_task(void* pvParameters) {
-    ESP_LOGI(TAG, "Nixie clock task started");
-
-    // Show syncing animation
-    PixelDriver::getMainChannel()->setColor(PixelColor(255, 255, 0)); // Yellow during sync
-    PixelDriver::getMainChannel()->setEffectByID("CYCLIC");
-    PixelDriver::getMainChannel()->setBrightness(255);
-
-    // Register for events
-    esp_event_handler_register(CLOCK_EVENTS, ESP_EVENT_ANY_ID, clock_event_handler, nullptr);
-    esp_event_handler_register(KD_NTP_EVENTS, ESP_EVENT_ANY_ID, ntp_event_handler, nullptr);
-
-    // If already synced, switch to display mode immediately
-    if (kd_common_ntp_is_synced()) {
-        g_ntp_synced = true;
-        PixelDriver::getMainChannel()->loadFromNVS();
-    }
-
+static void nixie_clock_task(void* pvParameters) {
     // Polling loop only needed for cleaning cycle animation
     // Normal time updates are handled by CLOCK_EVENT_SECOND_TICK
     while (true) {
         if (g_ntp_synced && g_cleaning) {
+            ALLOC_TRACE_SCOPE(ALLOC_PATH_CLOCK);
+
             // Cleaning mode - cycle through all digits
             nixie_show_time(g_cleaning_digit * 11, g_cleaning_digit * 11, g_cleaning_digit * 11);
             g_cleaning_digit = (g_cleaning_digit + 1) % 10;
@@ -194,8 +192,10 @@ void nixie_clock_init() {
     PixelDriver::setCurrentLimit(600); // 600mA limit for Nixie LEDs
     PixelDriver::start();
 
+    // Full brightness until NTP sync loads the stored backlight settings
     PixelDriver::getMainChannel()->setColor(PixelColor(0, 255, 255));
     PixelDriver::getMainChannel()->setEffectByID("BREATHE");
+    PixelDriver::getMainChannel()->setBrightness(255);
 
     // Load nixie configuration from NVS
     nixie_load_from_nvs(&nixie_config);
@@ -207,6 +207,14 @@ void nixie_clock_init() {
     nixie_apply_config(&nixie_config);
 
     nixie_show_time(12, 12, 12);
+
+    // Time updates start on NTP sync
+    esp_event_handler_register(CLOCK_EVENTS, ESP_EVENT_ANY_ID, clock_event_handler, nullptr);
+    esp_event_handler_register(KD_NTP_EVENTS, ESP_EVENT_ANY_ID, ntp_event_handler, nullptr);
+
+    TaskHandle_t task = xTaskCreateStatic(nixie_clock_task, "clock_task", NIXIE_CLOCK_TASK_STACK_SIZE, nullptr, 5,
+        nixie_clock_task_stack, &nixie_clock_task_tcb);
+    task_stacks_register(task, NIXIE_CLOCK_TASK_STACK_SIZE);
 }
 
 void nixie_apply_config(nixie_config_t* config) {
@@ -11,5 +11,4 @@ typedef struct {
 
 //Public
 void nixie_clock_init();
-void nixie_clock_task(void* pvParameters);
 void nixie_apply_config(nixie_config_t* config);
\ No newline at end of file
@@ -2,10 +2,15 @@
 #include "nixie.h"
 #include "nixie_oe.h"
 #include "clock_events.h"
-#include "cJSON.h"
+#include "config_batch.h"
+#include "http_governor.h"
+#include "config_cache.h"
+#include "json_reader.h"
+#include "json_writer.h"
+#include "pb_codec.h"
+#include "settings_store.h"
+#include "state_ws.h"
 #include "esp_log.h"
-#include "nvs_flash.h"
-#include "nvs.h"
 #include <string.h>
 #include "api.h"  // For set_cors_headers function
 #include "freertos/FreeRTOS.h"
@@ -13,118 +18,137 @@
 
 static const char* TAG = "nixie_handlers";
 
+// Pre-record NVS namespace, migrated into the settings record
 #define NIXIE_NVS_NAMESPACE "nixie_cfg"
 
+// NixieConfig field numbers, see docs/clock-config.proto
+enum {
+    NIXIE_PB_BRIGHTNESS = 1,
+    NIXIE_PB_MILITARY_TIME = 2,
+    NIXIE_PB_BLINKING_DOTS = 3,
+    NIXIE_PB_ON = 4,
+};
+
 // External nixie_config from nixie.cpp
 extern nixie_config_t nixie_config;
 
-// Helper function to create nixie state JSON
-static cJSON* create_nixie_state_json(void) {
-    cJSON* json = cJSON_CreateObject();
-    if (json == NULL) {
-        return NULL;
-    }
-
-    cJSON* brightness_json = cJSON_CreateNumber(nixie_config.brightness);
-    cJSON* military_time_json = cJSON_CreateBool(nixie_config.military_time);
-    cJSON* blinking_dots_json = cJSON_CreateBool(nixie_config.blinking_dots);
-    cJSON* on_json = cJSON_CreateBool(nixie_config.on);
-
-    cJSON_AddItemToObject(json, "brightness", brightness_json);
-    cJSON_AddItemToObject(json, "military_time", military_time_json);
-    cJSON_AddItemToObject(json, "blinking_dots", blinking_dots_json);
-    cJSON_AddItemToObject(json, "on", on_json);
-
-    return json;
+// Settings record field IDs; never reuse a retired ID
+static const settings_field_t nixie_settings_fields[] = {
+    SETTINGS_FIELD(1, nixie_config_t, brightness),
+    SETTINGS_FIELD(2, nixie_config_t, military_time),
+    SETTINGS_FIELD(3, nixie_config_t, blinking_dots),
+    SETTINGS_FIELD(4, nixie_config_t, on),
+};
+
+static settings_domain_t nixie_settings =
+    SETTINGS_DOMAIN(SETTINGS_ID_NIXIE, "nixie", nixie_config, nixie_settings_fields, NIXIE_NVS_NAMESPACE);
+
+// Helper function to write nixie state JSON
+static void write_nixie_state_json(json_writer_t* writer) {
+    json_object_begin(writer);
+    json_kv_int(writer, "brightness", nixie_config.brightness);
+    json_kv_bool(writer, "military_time", nixie_config.military_time);
+    json_kv_bool(writer, "blinking_dots", nixie_config.blinking_dots);
+    json_kv_bool(writer, "on", nixie_config.on);
+    json_object_end(writer);
 }
 
-// Helper function to apply nixie configuration from JSON
-static esp_err_t apply_nixie_config_from_json(cJSON* json) {
-    if (!json) return ESP_FAIL;
-
-    // Get fields
-    cJSON* brightness_json = cJSON_GetObjectItem(json, "brightness");
-    cJSON* military_time_json = cJSON_GetObjectItem(json, "military_time");
-    cJSON* blinking_dots_json = cJSON_GetObjectItem(json, "blinking_dots");
-    cJSON* on_json = cJSON_GetObjectItem(json, "on");
-
-    nixie_config_t new_config = nixie_config;  // Start with current config
+// Helper function to write nixie state as a NixieConfig message
+static void write_nixie_state_pb(pb_writer_t* writer) {
+    pb_write_uint(writer, NIXIE_PB_BRIGHTNESS, nixie_config.brightness);
+    pb_write_bool(writer, NIXIE_PB_MILITARY_TIME, nixie_config.military_time);
+    pb_write_bool(writer, NIXIE_PB_BLINKING_DOTS, nixie_config.blinking_dots);
+    pb_write_bool(writer, NIXIE_PB_ON, nixie_config.on);
+}
 
-    // Validate brightness if present
-    if (cJSON_IsNumber(brightness_json)) {
-        int val = cJSON_GetNumberValue(brightness_json);
-        new_config.brightness = (val < 0) ? 0 : (val > 100) ? 100 : val;
-    }
+// Config staged by a POST to /api/nixie or /api/config until it validated;
+// both read into it on the httpd task
+static nixie_config_t nixie_staged_config;
+static int32_t nixie_staged_brightness;
+
+static json_field_t nixie_json_fields[] = {
+    { .key = "brightness", .type = JSON_FIELD_INT, .value = &nixie_staged_brightness },
+    { .key = "military_time", .type = JSON_FIELD_BOOL, .value = &nixie_staged_config.military_time },
+    { .key = "blinking_dots", .type = JSON_FIELD_BOOL, .value = &nixie_staged_config.blinking_dots },
+    { .key = "on", .type = JSON_FIELD_BOOL, .value = &nixie_staged_config.on },
+};
+
+static pb_field_t nixie_pb_fields[] = {
+    { .number = NIXIE_PB_BRIGHTNESS, .type = PB_FIELD_INT, .value = &nixie_staged_brightness },
+    { .number = NIXIE_PB_MILITARY_TIME, .type = PB_FIELD_BOOL, .value = &nixie_staged_config.military_time },
+    { .number = NIXIE_PB_BLINKING_DOTS, .type = PB_FIELD_BOOL, .value = &nixie_staged_config.blinking_dots },
+    { .number = NIXIE_PB_ON, .type = PB_FIELD_BOOL, .value = &nixie_staged_config.on },
+};
+
+static void begin_nixie_config(void) {
+    nixie_staged_config = nixie_config;
+    nixie_staged_brightness = nixie_config.brightness;
+}
 
-    // Validate military_time if present
-    if (cJSON_IsBool(military_time_json)) {
-        new_config.military_time = cJSON_IsTrue(military_time_json);
-    }
+// Helper function to finish the staged config from the fields read
+static esp_err_t validate_nixie_config(const char** error) {
+    int32_t brightness = nixie_staged_brightness;
+    nixie_staged_config.brightness = (brightness < 0) ? 0 : (brightness > 100) ? 100 : brightness;
+    return ESP_OK;
+}
 
-    // Validate blinking_dots if present
-    if (cJSON_IsBool(blinking_dots_json)) {
-        new_config.blinking_dots = cJSON_IsTrue(blinking_dots_json);
-    }
+static void commit_nixie_config(void) {
+    nixie_update_config(&nixie_staged_config);
+}
 
-    // Validate on state if present
-    if (cJSON_IsBool(on_json)) {
-        new_config.on = cJSON_IsTrue(on_json);
-    }
+static const config_section_t nixie_config_section = {
+    .name = "nixie",
+    .fields = nixie_json_fields,
+    .field_count = sizeof(nixie_json_fields) / sizeof(nixie_json_fields[0]),
+    .begin = begin_nixie_config,
+    .validate = validate_nixie_config,
+    .commit = commit_nixie_config,
+    .write = write_nixie_state_json,
+};
+
+// Helper function to build the cached JSON body
+static size_t build_nixie_json(uint8_t* buf, size_t size) {
+    json_writer_t writer;
+    json_writer_init(&writer, (char*)buf, size, NULL);
+    write_nixie_state_json(&writer);
+    return json_writer_finish(&writer) == ESP_OK ? writer.len : 0;
+}
 
-    // Apply the configuration
-    nixie_set_config(&new_config);
-    return ESP_OK;
+// Helper function to build the cached protobuf body
+static size_t build_nixie_pb(uint8_t* buf, size_t size) {
+    pb_writer_t writer;
+    pb_writer_init(&writer, buf, size);
+    write_nixie_state_pb(&writer);
+    return writer.err == ESP_OK ? writer.len : 0;
 }
 
+// GET responses, rebuilt only after nixie_set_config()
+static config_domain_t nixie_domain = CONFIG_DOMAIN("nixie");
+static config_body_t nixie_json_body = CONFIG_BODY(&nixie_domain, "json", "application/json", build_nixie_json, 96);
+static config_body_t nixie_pb_body = CONFIG_BODY(&nixie_domain, "pb", PB_CONTENT_TYPE, build_nixie_pb, 16);
+
 // NVS functions
 void nixie_load_from_nvs(nixie_config_t* config) {
     if (!config) return;
 
-    nvs_handle_t nvs_handle;
-    esp_err_t err = nvs_open(NIXIE_NVS_NAMESPACE, NVS_READONLY, &nvs_handle);
-    if (err != ESP_OK) {
-        ESP_LOGI(TAG, "NVS namespace not found, using defaults");
-        return;
-    }
-
-    size_t required_size = sizeof(nixie_config_t);
-    err = nvs_get_blob(nvs_handle, "config", config, &required_size);
-    if (err != ESP_OK) {
-        ESP_LOGI(TAG, "Config not found in NVS, using defaults");
+    // Read once at boot; nixie_config stays the authoritative copy
+    if (!settings_load(&nixie_settings)) {
+        ESP_LOGI(TAG, "Nixie config not stored yet, using defaults");
     }
     else {
-        ESP_LOGI(TAG, "Loaded nixie config from NVS: brightness=%d, military=%d, dots=%d, on=%d",
-            config->brightness, config->military_time, config->blinking_dots, config->on);
+        ESP_LOGI(TAG, "Loaded nixie config: brightness=%d, military=%d, dots=%d, on=%d",
+            nixie_config.brightness, nixie_config.military_time, nixie_config.blinking_dots, nixie_config.on);
     }
 
-    nvs_close(nvs_handle);
+    *config = nixie_config;
 }
 
 void nixie_save_to_nvs(const nixie_config_t* config) {
     if (!config) return;
 
-    nvs_handle_t nvs_handle;
-    esp_err_t err = nvs_open(NIXIE_NVS_NAMESPACE, NVS_READWRITE, &nvs_handle);
-    if (err != ESP_OK) {
-        ESP_LOGE(TAG, "Failed to open NVS for writing: %s", esp_err_to_name(err));
-        return;
-    }
-
-    err = nvs_set_blob(nvs_handle, "config", config, sizeof(nixie_config_t));
-    if (err != ESP_OK) {
-        ESP_LOGE(TAG, "Failed to save config to NVS: %s", esp_err_to_name(err));
-    }
-    else {
-        err = nvs_commit(nvs_handle);
-        if (err != ESP_OK) {
-            ESP_LOGE(TAG, "Failed to commit NVS: %s", esp_err_to_name(err));
-        }
-        else {
-            ESP_LOGI(TAG, "Nixie config saved to NVS");
-        }
-    }
-
-    nvs_close(nvs_handle);
+    // Written by the settings store once changes settle
+    nixie_config = *config;
+    settings_mark_dirty(&nixie_settings);
 }
 
 // Configuration getters/setters
@@ -135,14 +159,21 @@ nixie_config_t nixie_get_config(void) {
 void nixie_set_config(const nixie_config_t* config) {
     if (!config) return;
 
-    nixie_config = *config;
-    nixie_apply_config(config);
-    nixie_save_to_nvs(config);
+    nixie_update_config(config);
 
     // Post config changed event to trigger display update
     esp_event_post(CLOCK_EVENTS, CLOCK_EVENT_CONFIG_CHANGED, nullptr, 0, 0);
 }
 
+void nixie_update_config(const nixie_config_t* config) {
+    if (!config) return;
+
+    nixie_config = *config;
+    nixie_apply_config(config);
+    nixie_save_to_nvs(config);
+    config_domain_changed(&nixie_domain);
+}
+
 void nixie_apply_config(const nixie_config_t* config) {
     if (!config) return;
 
@@ -155,62 +186,28 @@ void nixie_apply_config(const nixie_config_t* config) {
 
 // Legacy HTTP handlers for backward compatibility
 esp_err_t nixie_config_get_handler(httpd_req_t* req) {
-    cJSON* json = create_nixie_state_json();
-    if (json == NULL) {
-        httpd_resp_send_500(req);
-        return ESP_FAIL;
-    }
-
-    char* json_string = cJSON_Print(json);
-    if (json_string == NULL) {
-        cJSON_Delete(json);
-        httpd_resp_send_500(req);
-        return ESP_FAIL;
-    }
-
-    httpd_resp_set_type(req, "application/json");
-    httpd_resp_send(req, json_string, strlen(json_string));
-
-    free(json_string);
-    cJSON_Delete(json);
-
-    return ESP_OK;
+    httpd_resp_set_hdr(req, "Vary", "Accept");
+    return config_body_send(req, pb_request_accepted(req) ? &nixie_pb_body : &nixie_json_body);
 }
 
 esp_err_t nixie_config_post_handler(httpd_req_t* req) {
-    char content[512];
-    int ret = httpd_req_recv(req, content, sizeof(content) - 1);
-    if (ret <= 0) {
-        if (ret == HTTPD_SOCK_ERR_TIMEOUT) {
-            httpd_resp_send_408(req);
-        }
-        else {
-            httpd_resp_send_500(req);
-        }
-        return ESP_FAIL;
-    }
-    content[ret] = '\0';
-
-    // Parse JSON
-    cJSON* json = cJSON_Parse(content);
-    if (json == NULL) {
-        httpd_resp_send_err(req, HTTPD_400_BAD_REQUEST, "Invalid JSON format");
-        return ESP_FAIL;
-    }
-
-    // Apply configuration using shared function
-    esp_err_t result = apply_nixie_config_from_json(json);
-    cJSON_Delete(json);
-
-    if (result != ESP_OK) {
-        httpd_resp_send_err(req, HTTPD_400_BAD_REQUEST, "Invalid configuration");
+    // Error responses are sent by the reader
+    if (config_section_read_request(req, &nixie_config_section, nixie_pb_fields,
+            sizeof(nixie_pb_fields) / sizeof(nixie_pb_fields[0])) != ESP_OK) {
         return ESP_FAIL;
     }
 
+    nixie_set_config(&nixie_staged_config);
     return nixie_config_get_handler(req); // Return updated config
 }
 
 void register_nixie_handlers(httpd_handle_t server) {
+    // Config section of the /api/ws pushes
+    state_ws_set_config_writer(write_nixie_state_json);
+
+    // Settable together with other sections through /api/config
+    config_batch_register(&nixie_config_section);
+
     // Register legacy HTTP handlers for backward compatibility
     httpd_uri_t nixie_config_get_uri = {
         .uri = "/api/nixie",
@@ -218,7 +215,7 @@ void register_nixie_handlers(httpd_handle_t server) {
         .handler = nixie_config_get_handler,
         .user_ctx = NULL
     };
-    httpd_register_uri_handler(server, &nixie_config_get_uri);
+    http_governor_register_uri(server, &nixie_config_get_uri);
 
     httpd_uri_t nixie_config_post_uri = {
         .uri = "/api/nixie",
@@ -226,5 +223,5 @@ void register_nixie_handlers(httpd_handle_t server) {
         .handler = nixie_config_post_handler,
         .user_ctx = NULL
     };
-    httpd_register_uri_handler(server, &nixie_config_post_uri);
+    http_governor_register_uri(server, &nixie_config_post_uri);
 }
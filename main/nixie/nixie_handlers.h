@@ -13,10 +13,11 @@ esp_err_t nixie_config_get_handler(httpd_req_t* req);
 esp_err_t nixie_config_post_handler(httpd_req_t* req);
 
 // NVS functions
-void nixie_load_from_nvs(nixie_config_t* config);
+void nixie_load_from_nvs(nixie_config_t* config);   // Once at boot, from the settings record
 void nixie_save_to_nvs(const nixie_config_t* config);
 
 // Configuration getters/setters
 nixie_config_t nixie_get_config(void);
 void nixie_set_config(const nixie_config_t* config);
+void nixie_update_config(const nixie_config_t* config);    // As nixie_set_config(), without posting CLOCK_EVENT_CONFIG_CHANGED
 void nixie_apply_config(const nixie_config_t* config);
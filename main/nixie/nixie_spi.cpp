@@ -12,6 +12,9 @@ static const char* TAG = "nixie_spi";
 static spi_device_handle_t spi_hv = NULL;
 static gpio_num_t lat_pin = (gpio_num_t)CONFIG_SHIFTREG_LATCH_PIN;
 
+// Shift register chain length in bytes
+#define NIXIE_SPI_MAX_BYTES 8
+
 void nixie_spi_init(void) {
     ESP_LOGI(TAG, "Initializing SPI for Nixie shift register control");
 
@@ -97,12 +100,14 @@ void nixie_spi_transmit_bitstream(const uint8_t* bitstream, size_t length_bits)
 
     // Apply data inversion if configured
     size_t length_bytes = (length_bits + 7) / 8;
-    uint8_t* tx_buffer = (uint8_t*)malloc(length_bytes);
-    if (tx_buffer == NULL) {
-        ESP_LOGE(TAG, "Failed to allocate TX buffer");
+    if (length_bytes > NIXIE_SPI_MAX_BYTES) {
+        ESP_LOGE(TAG, "Bitstream longer than the shift register chain");
         return;
     }
 
+    // The bus runs without DMA, so the buffer can live on the stack
+    uint8_t tx_buffer[NIXIE_SPI_MAX_BYTES];
+
     memcpy(tx_buffer, bitstream, length_bytes);
 
 #if defined(CONFIG_SHIFTREG_DATA_INVERSION) && CONFIG_SHIFTREG_DATA_INVERSION
@@ -122,8 +127,6 @@ void nixie_spi_transmit_bitstream(const uint8_t* bitstream, size_t length_bits)
         ESP_LOGE(TAG, "SPI transmission failed: %s", esp_err_to_name(err));
     }
 
-    free(tx_buffer);
-
     nixie_spi_latch(); // Pulse latch to apply data
 }
 
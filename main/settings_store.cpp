@@ -0,0 +1,435 @@
+#include "settings_store.h"
+
+#include <esp_log.h>
+#include <esp_rom_crc.h>
+#include <esp_system.h>
+#include <nvs.h>
+#include <string.h>
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
+#include "freertos/task.h"
+#include "sdkconfig.h"
+#include "task_stacks.h"
+
+static const char* TAG = "settings_store";
+
+#define SETTINGS_NVS_NAMESPACE "settings"
+#define SETTINGS_NVS_KEY "record"
+
+// NVS writes need about 2 KB; see task_stacks_report()
+#define SETTINGS_TASK_STACK_SIZE 3072
+
+// "KSET", little-endian
+#define SETTINGS_RECORD_MAGIC 0x5445534B
+
+namespace {
+
+typedef struct {
+    uint32_t magic;
+    uint16_t version;
+    uint16_t length;            // Payload bytes after the header
+    uint32_t crc32;             // CRC32 of the payload
+} record_header_t;
+
+typedef struct {
+    uint8_t domain;
+    uint8_t field;
+    uint8_t len;
+    const uint8_t* value;
+} record_entry_t;
+
+TaskHandle_t g_writer_task = nullptr;
+SemaphoreHandle_t g_flush_mutex = nullptr;
+StackType_t g_writer_stack[SETTINGS_TASK_STACK_SIZE];
+StaticTask_t g_writer_tcb;
+StaticSemaphore_t g_flush_mutex_buf;
+portMUX_TYPE g_lock = portMUX_INITIALIZER_UNLOCKED;
+
+settings_domain_t* g_domains[SETTINGS_MAX_DOMAINS] = {};
+size_t g_domain_count = 0;
+
+// Record read at boot; entries no registered domain knows are copied from it on every write
+uint8_t g_record[SETTINGS_RECORD_MAX_SIZE];
+size_t g_record_len = 0;
+
+uint8_t g_write_buf[SETTINGS_RECORD_MAX_SIZE];
+
+// Helper function to step through record entries; false at the end or on a truncated entry
+bool next_entry(const uint8_t* payload, size_t len, size_t* pos, record_entry_t* entry) {
+    if (*pos + 3 > len) {
+        return false;
+    }
+    entry->domain = payload[*pos];
+    entry->field = payload[*pos + 1];
+    entry->len = payload[*pos + 2];
+    if (*pos + 3 + entry->len > len) {
+        return false;
+    }
+    entry->value = payload + *pos + 3;
+    *pos += 3 + entry->len;
+    return true;
+}
+
+const settings_field_t* find_field(const settings_domain_t* domain, uint8_t id) {
+    for (size_t i = 0; i < domain->field_count; i++) {
+        if (domain->fields[i].id == id) {
+            return &domain->fields[i];
+        }
+    }
+    return nullptr;
+}
+
+// Called under the lock
+bool is_known_entry(const record_entry_t* entry) {
+    for (size_t i = 0; i < g_domain_count; i++) {
+        if (g_domains[i]->id == entry->domain) {
+            return find_field(g_domains[i], entry->field) != nullptr;
+        }
+    }
+    return false;
+}
+
+bool put_entry(uint8_t* buf, size_t* len, uint8_t domain, uint8_t field, const void* value, size_t size) {
+    if (*len + 3 + size > SETTINGS_RECORD_MAX_SIZE) {
+        return false;
+    }
+    buf[(*len)++] = domain;
+    buf[(*len)++] = field;
+    buf[(*len)++] = (uint8_t)size;
+    memcpy(buf + *len, value, size);
+    *len += size;
+    return true;
+}
+
+// Called under the lock; encodes every registered domain plus the unknown entries of the boot record
+bool encode_record(size_t* out_len) {
+    size_t len = sizeof(record_header_t);
+
+    for (size_t i = 0; i < g_domain_count; i++) {
+        const settings_domain_t* domain = g_domains[i];
+        for (size_t f = 0; f < domain->field_count; f++) {
+            const settings_field_t* field = &domain->fields[f];
+            if (!put_entry(g_write_buf, &len, domain->id, field->id,
+                (const uint8_t*)domain->data + field->offset, field->size)) {
+                return false;
+            }
+        }
+    }
+
+    const uint8_t* payload = g_record + sizeof(record_header_t);
+    size_t pos = 0;
+    record_entry_t entry;
+    while (next_entry(payload, g_record_len, &pos, &entry)) {
+        if (!is_known_entry(&entry) &&
+            !put_entry(g_write_buf, &len, entry.domain, entry.field, entry.value, entry.len)) {
+            return false;
+        }
+    }
+
+    *out_len = len;
+    return true;
+}
+
+// Helper function to read the record once at boot
+void read_record(void) {
+    nvs_handle_t nvs_handle;
+    esp_err_t err = nvs_open(SETTINGS_NVS_NAMESPACE, NVS_READONLY, &nvs_handle);
+    if (err != ESP_OK) {
+        ESP_LOGI(TAG, "No settings record, using defaults");
+        return;
+    }
+
+    size_t size = sizeof(g_record);
+    err = nvs_get_blob(nvs_handle, SETTINGS_NVS_KEY, g_record, &size);
+    nvs_close(nvs_handle);
+    if (err != ESP_OK) {
+        ESP_LOGW(TAG, "Cannot read settings record: %s", esp_err_to_name(err));
+        return;
+    }
+
+    record_header_t header;
+    memcpy(&header, g_record, sizeof(header));
+    if (size < sizeof(header) || header.magic != SETTINGS_RECORD_MAGIC ||
+        header.length != size - sizeof(header)) {
+        ESP_LOGW(TAG, "Malformed settings record, using defaults");
+        return;
+    }
+    if (header.version != SETTINGS_RECORD_VERSION) {
+        ESP_LOGW(TAG, "Unsupported settings record version %u, using defaults", header.version);
+        return;
+    }
+    if (esp_rom_crc32_le(0, g_record + sizeof(header), header.length) != header.crc32) {
+        ESP_LOGW(TAG, "Settings record CRC mismatch, using defaults");
+        return;
+    }
+
+    g_record_len = header.length;
+    ESP_LOGI(TAG, "Loaded settings record, %u bytes", (unsigned int)size);
+}
+
+// Helper function to drop a legacy blob once its domain is in the record
+void erase_legacy(settings_domain_t* domain) {
+    nvs_handle_t nvs_handle;
+    if (nvs_open(domain->legacy_namespace, NVS_READWRITE, &nvs_handle) != ESP_OK) {
+        return;
+    }
+    if (nvs_erase_all(nvs_handle) == ESP_OK && nvs_commit(nvs_handle) == ESP_OK) {
+        domain->migrated = false;
+        ESP_LOGI(TAG, "Erased legacy %s settings", domain->legacy_namespace);
+    }
+    nvs_close(nvs_handle);
+}
+
+// Helper function to copy a pre-record blob into the live copy; only a blob
+// of the current struct size can be trusted
+bool migrate_legacy(settings_domain_t* domain) {
+    nvs_handle_t nvs_handle;
+    if (domain->legacy_namespace == nullptr ||
+        nvs_open(domain->legacy_namespace, NVS_READONLY, &nvs_handle) != ESP_OK) {
+        return false;
+    }
+
+    uint8_t blob[SETTINGS_MAX_SIZE];
+    size_t size = sizeof(blob);
+    esp_err_t err = nvs_get_blob(nvs_handle, "config", blob, &size);
+    nvs_close(nvs_handle);
+    if (err != ESP_OK) {
+        return false;
+    }
+
+    if (size != domain->size) {
+        ESP_LOGW(TAG, "Legacy %s settings are %u bytes, expected %u; using defaults",
+            domain->name, (unsigned int)size, (unsigned int)domain->size);
+        domain->migrated = true;
+        return false;
+    }
+
+    memcpy(domain->data, blob, size);
+    domain->migrated = true;
+    ESP_LOGI(TAG, "Migrated %s settings from %s", domain->name, domain->legacy_namespace);
+    return true;
+}
+
+// Write the record from a snapshot taken under the lock; a change made
+// during the write marks its domain dirty again
+void write_record(void) {
+    bool pending[SETTINGS_MAX_DOMAINS] = {};
+    bool any = false;
+    bool fits = false;
+    size_t len = 0;
+
+    portENTER_CRITICAL(&g_lock);
+    for (size_t i = 0; i < g_domain_count; i++) {
+        pending[i] = g_domains[i]->dirty;
+        g_domains[i]->dirty = false;
+        any = any || pending[i];
+    }
+    if (any) {
+        fits = encode_record(&len);
+    }
+    portEXIT_CRITICAL(&g_lock);
+
+    if (!any) {
+        return;
+    }
+
+    esp_err_t err = ESP_ERR_INVALID_SIZE;
+    if (fits) {
+        record_header_t header = {
+            .magic = SETTINGS_RECORD_MAGIC,
+            .version = SETTINGS_RECORD_VERSION,
+            .length = (uint16_t)(len - sizeof(record_header_t)),
+            .crc32 = esp_rom_crc32_le(0, g_write_buf + sizeof(record_header_t), len - sizeof(record_header_t)),
+        };
+        memcpy(g_write_buf, &header, sizeof(header));
+
+        nvs_handle_t nvs_handle;
+        err = nvs_open(SETTINGS_NVS_NAMESPACE, NVS_READWRITE, &nvs_handle);
+        if (err == ESP_OK) {
+            err = nvs_set_blob(nvs_handle, SETTINGS_NVS_KEY, g_write_buf, len);
+            if (err == ESP_OK) {
+                err = nvs_commit(nvs_handle);
+            }
+            nvs_close(nvs_handle);
+        }
+    }
+
+    // A failed write keeps the changes pending for the next flush, at the
+    // latest the one before restart
+    portENTER_CRITICAL(&g_lock);
+    for (size_t i = 0; i < g_domain_count; i++) {
+        settings_domain_t* domain = g_domains[i];
+        if (!pending[i]) {
+            continue;
+        }
+        if (err == ESP_OK) {
+            domain->writes++;
+            domain->commits++;
+        }
+        else {
+            domain->dirty = true;
+            domain->failures++;
+        }
+    }
+    portEXIT_CRITICAL(&g_lock);
+
+    for (size_t i = 0; i < g_domain_count; i++) {
+        settings_domain_t* domain = g_domains[i];
+        if (!pending[i]) {
+            continue;
+        }
+
+        if (err != ESP_OK) {
+            ESP_LOGE(TAG, "Failed to save %s: %s", domain->name, esp_err_to_name(err));
+            continue;
+        }
+
+        ESP_LOGI(TAG, "Saved %s: %lu changes in %lu commits", domain->name,
+            (unsigned long)domain->changes, (unsigned long)domain->commits);
+        if (domain->migrated) {
+            erase_legacy(domain);
+        }
+    }
+}
+
+// Wait for a first change, then for the changes to settle
+void writer_task(void* arg) {
+    while (true) {
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+
+        TickType_t first = xTaskGetTickCount();
+        while (xTaskGetTickCount() - first < pdMS_TO_TICKS(CONFIG_SETTINGS_WRITE_MAX_DELAY_MS) &&
+            ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(CONFIG_SETTINGS_WRITE_DELAY_MS)) > 0) {
+        }
+
+        settings_store_flush();
+    }
+}
+
+// Called under the lock; false if the domain does not fit
+bool register_domain(settings_domain_t* domain) {
+    for (size_t i = 0; i < g_domain_count; i++) {
+        if (g_domains[i] == domain) {
+            return true;
+        }
+    }
+
+    if (g_domain_count == SETTINGS_MAX_DOMAINS || domain->size > SETTINGS_MAX_SIZE) {
+        return false;
+    }
+    g_domains[g_domain_count++] = domain;
+    return true;
+}
+
+} // namespace
+
+void settings_store_init(void) {
+    if (g_writer_task != nullptr) {
+        return;
+    }
+
+    read_record();
+
+    g_flush_mutex = xSemaphoreCreateMutexStatic(&g_flush_mutex_buf);
+    g_writer_task = xTaskCreateStatic(writer_task, "settings", SETTINGS_TASK_STACK_SIZE, nullptr,
+        tskIDLE_PRIORITY + 1, g_writer_stack, &g_writer_tcb);
+    task_stacks_register(g_writer_task, SETTINGS_TASK_STACK_SIZE);
+    esp_register_shutdown_handler(settings_store_flush);
+}
+
+bool settings_load(settings_domain_t* domain) {
+    portENTER_CRITICAL(&g_lock);
+    bool registered = register_domain(domain);
+    portEXIT_CRITICAL(&g_lock);
+
+    if (!registered) {
+        ESP_LOGE(TAG, "Cannot store %s (%u bytes)", domain->name, (unsigned int)domain->size);
+        return false;
+    }
+
+    const uint8_t* payload = g_record + sizeof(record_header_t);
+    size_t pos = 0;
+    size_t loaded = 0;
+    record_entry_t entry;
+    while (next_entry(payload, g_record_len, &pos, &entry)) {
+        if (entry.domain != domain->id) {
+            continue;
+        }
+
+        // Unknown fields stay in the record for the firmware that wrote them
+        const settings_field_t* field = find_field(domain, entry.field);
+        if (field == nullptr) {
+            continue;
+        }
+
+        uint8_t* member = (uint8_t*)domain->data + field->offset;
+        size_t len = entry.len < field->size ? entry.len : field->size;
+        memset(member, 0, field->size);
+        memcpy(member, entry.value, len);
+        loaded++;
+    }
+
+    if (loaded > 0) {
+        ESP_LOGI(TAG, "Loaded %s settings, %u of %u fields", domain->name, (unsigned int)loaded,
+            (unsigned int)domain->field_count);
+        return true;
+    }
+
+    if (migrate_legacy(domain)) {
+        settings_mark_dirty(domain);
+        return true;
+    }
+    if (domain->migrated) {
+        // Unusable legacy blob; write the defaults so it is erased
+        settings_mark_dirty(domain);
+    }
+    return false;
+}
+
+void settings_mark_dirty(settings_domain_t* domain) {
+    portENTER_CRITICAL(&g_lock);
+    bool registered = register_domain(domain);
+    if (registered) {
+        domain->dirty = true;
+        domain->changes++;
+    }
+    portEXIT_CRITICAL(&g_lock);
+
+    if (!registered) {
+        ESP_LOGE(TAG, "Cannot store %s (%u bytes)", domain->name, (unsigned int)domain->size);
+        return;
+    }
+
+    if (g_writer_task != nullptr) {
+        xTaskNotifyGive(g_writer_task);
+    }
+}
+
+void settings_store_flush(void) {
+    if (g_flush_mutex == nullptr) {
+        return;
+    }
+
+    xSemaphoreTake(g_flush_mutex, portMAX_DELAY);
+    write_record();
+    xSemaphoreGive(g_flush_mutex);
+}
+
+size_t settings_store_get_stats(settings_domain_stats_t* stats, size_t max) {
+    portENTER_CRITICAL(&g_lock);
+    size_t count = g_domain_count < max ? g_domain_count : max;
+    for (size_t i = 0; i < count; i++) {
+        const settings_domain_t* domain = g_domains[i];
+        stats[i] = {
+            .name = domain->name,
+            .changes = domain->changes,
+            .writes = domain->writes,
+            .commits = domain->commits,
+            .failures = domain->failures,
+            .dirty = domain->dirty,
+        };
+    }
+    portEXIT_CRITICAL(&g_lock);
+    return count;
+}
@@ -0,0 +1,138 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * Settings record
+ *
+ * All settings live in one NVS blob, read once at boot by
+ * settings_store_init(). It starts with a header holding the record format
+ * version, the payload length and a CRC32 of the payload, followed by one
+ * entry per field:
+ *
+ *   uint8_t domain; uint8_t field; uint8_t len; uint8_t value[len];
+ *
+ * Values are the struct member's bytes, little-endian. Field IDs are never
+ * reused, so a struct can change freely:
+ *  - a field this firmware does not know is kept as-is and written back,
+ *    so an older firmware does not drop what a newer one stored;
+ *  - a field missing from the record keeps the owner's default;
+ *  - a stored value shorter than the member is zero-extended, so unsigned
+ *    fields may widen; a longer one is truncated to the member.
+ */
+
+// Largest settings struct a domain may hold
+#define SETTINGS_MAX_SIZE 64
+
+// Domains that can be registered, one per settings struct
+#define SETTINGS_MAX_DOMAINS 4
+
+// Largest encoded record, header included
+#define SETTINGS_RECORD_MAX_SIZE 256
+
+// Record format, bumped only if the header or entry layout changes
+#define SETTINGS_RECORD_VERSION 1
+
+// Domain IDs in the settings record; never reuse a retired ID
+typedef enum {
+    SETTINGS_ID_NIXIE = 1,
+    SETTINGS_ID_FIBONACCI = 2,
+    SETTINGS_ID_WORDCLOCK = 3,
+} settings_domain_id_t;
+
+/**
+ * One struct member stored in the record
+ */
+typedef struct {
+    uint8_t id;                 // Field ID, never reused
+    uint8_t offset;
+    uint8_t size;
+} settings_field_t;
+
+#define SETTINGS_FIELD(field_id, type, member) \
+    { .id = (field_id), .offset = offsetof(type, member), .size = sizeof(((type*)0)->member) }
+
+/**
+ * A config struct persisted as one domain of the settings record.
+ *
+ * The owner keeps the live copy in RAM, fills it from the record once with
+ * settings_load() and calls settings_mark_dirty() after changing it; the
+ * store writes it once changes settle.
+ */
+typedef struct {
+    uint8_t id;                 // settings_domain_id_t
+    const char* name;           // For logs
+    void* data;                 // Live copy, owned by the domain
+    size_t size;
+    const settings_field_t* fields;
+    size_t field_count;
+    const char* legacy_namespace;   // Pre-record NVS blob, migrated on first load
+    bool dirty;
+    bool migrated;              // Legacy blob is erased once the record is written
+    uint32_t changes;           // settings_mark_dirty() calls
+    uint32_t writes;            // Committed record writes that included a change
+    uint32_t commits;           // Successful nvs_commit() calls for those writes
+    uint32_t failures;          // Record writes that failed; the change stays pending
+} settings_domain_t;
+
+#define SETTINGS_DOMAIN(domain_id, domain_name, object, field_table, legacy_ns) \
+    { .id = (domain_id), .name = (domain_name), .data = &(object), .size = sizeof(object), \
+      .fields = (field_table), .field_count = sizeof(field_table) / sizeof((field_table)[0]), \
+      .legacy_namespace = (legacy_ns) }
+
+/**
+ * Read the settings record and start the settings writer task.
+ * Pending changes are also written before esp_restart().
+ *
+ * Should be called before any domain is loaded or marked dirty.
+ */
+void settings_store_init(void);
+
+/**
+ * Fill the domain's live copy from the record read at boot.
+ * Fields missing from the record keep the values already in the copy.
+ * A domain with no entries yet is migrated from its legacy blob, if any.
+ *
+ * @return true if any field was loaded
+ */
+bool settings_load(settings_domain_t* domain);
+
+/**
+ * Schedule the domain's live copy for writing.
+ * The write happens CONFIG_SETTINGS_WRITE_DELAY_MS after the last change,
+ * and no later than CONFIG_SETTINGS_WRITE_MAX_DELAY_MS after the first.
+ */
+void settings_mark_dirty(settings_domain_t* domain);
+
+/**
+ * Write all pending changes now, e.g. before an update or restart.
+ */
+void settings_store_flush(void);
+
+/**
+ * Counters of one registered domain since boot
+ */
+typedef struct {
+    const char* name;
+    uint32_t changes;
+    uint32_t writes;
+    uint32_t commits;
+    uint32_t failures;
+    bool dirty;                 // Changes waiting to be written
+} settings_domain_stats_t;
+
+/**
+ * Copy the counters of the registered domains.
+ *
+ * @return Number of domains copied, at most max
+ */
+size_t settings_store_get_stats(settings_domain_stats_t* stats, size_t max);
+
+#ifdef __cplusplus
+}
+#endif
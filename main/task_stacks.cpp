@@ -0,0 +1,54 @@
+#include "task_stacks.h"
+#include "clock_events.h"
+
+#include <esp_event.h>
+#include <esp_log.h>
+
+static const char* TAG = "task_stacks";
+
+namespace {
+
+typedef struct {
+    TaskHandle_t task;
+    uint32_t stack_size;
+} tracked_task_t;
+
+tracked_task_t g_tasks[TASK_STACKS_MAX] = {};
+size_t g_task_count = 0;
+
+// Tasks owned by ESP-IDF that run clock event handlers, timer callbacks and API handlers
+const char* const g_system_tasks[] = { "sys_evt", "esp_timer", "httpd" };
+
+void on_hour_tick(void* arg, esp_event_base_t base, int32_t id, void* data) {
+    task_stacks_report();
+}
+
+} // namespace
+
+void task_stacks_register(TaskHandle_t task, uint32_t stack_size) {
+    if (task == nullptr || g_task_count == TASK_STACKS_MAX) {
+        return;
+    }
+    g_tasks[g_task_count++] = { task, stack_size };
+}
+
+void task_stacks_report(void) {
+    for (size_t i = 0; i < g_task_count; i++) {
+        // High-water marks are in bytes, StackType_t is a byte on ESP-IDF
+        uint32_t free_bytes = uxTaskGetStackHighWaterMark(g_tasks[i].task);
+        ESP_LOGI(TAG, "%s: %lu of %lu stack bytes used", pcTaskGetName(g_tasks[i].task),
+            (unsigned long)(g_tasks[i].stack_size - free_bytes), (unsigned long)g_tasks[i].stack_size);
+    }
+
+    for (size_t i = 0; i < sizeof(g_system_tasks) / sizeof(g_system_tasks[0]); i++) {
+        TaskHandle_t task = xTaskGetHandle(g_system_tasks[i]);
+        if (task != nullptr) {
+            ESP_LOGI(TAG, "%s: %lu stack bytes never used", g_system_tasks[i],
+                (unsigned long)uxTaskGetStackHighWaterMark(task));
+        }
+    }
+}
+
+void task_stacks_init(void) {
+    esp_event_handler_register(CLOCK_EVENTS, CLOCK_EVENT_HOUR_TICK, on_hour_tick, nullptr);
+}
@@ -0,0 +1,38 @@
+#pragma once
+
+#include <stdint.h>
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Firmware tasks whose stacks can be reported
+#define TASK_STACKS_MAX 6
+
+/**
+ * Track a firmware task's stack for task_stacks_report().
+ *
+ * @param task Task created with xTaskCreateStatic()
+ * @param stack_size Size of its stack buffer in bytes
+ */
+void task_stacks_register(TaskHandle_t task, uint32_t stack_size);
+
+/**
+ * Log the smallest free stack each firmware task, and each system task
+ * running firmware callbacks, has had since boot.
+ * Also called on every CLOCK_EVENT_HOUR_TICK.
+ */
+void task_stacks_report(void);
+
+/**
+ * Report on every hour tick.
+ * Should be called after the default event loop is created.
+ */
+void task_stacks_init(void);
+
+#ifdef __cplusplus
+}
+#endif
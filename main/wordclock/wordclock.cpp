@@ -1,4 +1,5 @@
 #include "wordclock.h"
+#include "wordclock_handlers.h"
 
 #include "esp_log.h"
 #include "freertos/FreeRTOS.h"
@@ -10,17 +11,18 @@
 #include <esp_random.h>
 #include <time.h>
 #include <string.h>
+#include <vector>
 #include "kd_common.h"
 #include "clock_events.h"
+#include "wordclock_grid.h"
+#include "wordclock_layers.h"
+#include "pixel_stream.h"
+#include "alloc_trace.h"
 
 #include "sdkconfig.h"
 
 static const char* TAG = "wordclock";
 
-const char* letters =
-"ITLISOTWENTYRONETWOETENMTHIRTEENFIVEMELEVENIFOURTHREEPNINETEENSUFOURTEENMIDNIGHTSIXTEENDEIGHTEENSEVENTEENOTWELVEHALFELQUARTEROTOPASTRONESATW"
-"OSIXTWELVETFOURAFIVESEVENMEIGHTENINETENTTHREECELEVENINOTHENAFTERNOONMORNINGSATENIGHTEVENINGCANDTCOLDCOOLETWARMURAHOT";
-
 #ifdef CONFIG_BASE_CLOCK_TYPE_WORDCLOCK
 
 #if defined(CONFIG_WORDCLOCK_LED_IS_RGBW) && CONFIG_WORDCLOCK_LED_IS_RGBW
@@ -29,188 +31,131 @@ static bool is_rgbw = true;
 static bool is_rgbw = false;
 #endif
 
-uint8_t bits[256] = { 0 };
-char wordclock_words_buffer[128] = { 0 };
-
-bool add_word_to_buffer(const char* word)
-{
-    size_t buffer_len = strlen(wordclock_words_buffer);
-    size_t word_len = strlen(word);
-    // Add 1 for space if buffer is not empty, plus 1 for null terminator
-    if (buffer_len + (buffer_len > 0 ? 1 : 0) + word_len >= sizeof(wordclock_words_buffer)) {
-        return false;
-    }
-    if (buffer_len > 0) {
-        strcat(wordclock_words_buffer, " ");
-    }
-    strcat(wordclock_words_buffer, word);
-    return true;
-}
-
-void clear_word_buffer()
-{
-    memset(wordclock_words_buffer, 0, sizeof(wordclock_words_buffer));
-}
-
-bool word_buffer_to_bits(const char* buffer, const char* letters, uint8_t* bits, size_t bits_size)
-{
-    // Clear all bits
-    memset(bits, 0, bits_size);
-
-    // Make a mutable copy of the buffer to tokenize by spaces
-    char buffer_copy[sizeof(wordclock_words_buffer)];
-    strncpy(buffer_copy, buffer, sizeof(buffer_copy));
-    buffer_copy[sizeof(buffer_copy) - 1] = '\0';
-
-    // Search each space-delimited word in order within letters
-    const char* search_start = letters;
-    char* token = strtok(buffer_copy, " ");
-    while (token != NULL) {
-        const char* pos = strstr(search_start, token);
-        if (pos) {
-            size_t startIndex = pos - letters;
-            size_t wordLen = strlen(token);
-            // Mark bits for each character in this word
-            for (size_t j = 0; j < wordLen; j++) {
-                if (startIndex + j < bits_size) {
-                    bits[startIndex + j] = 1;
-                }
-            }
-            // Advance search pointer past this word to enforce order
-            search_start = pos + wordLen;
+wordclock_config_t wc_config = {
+    .brightness = 255,              // Default full brightness
+    .color = 0xFFFFFF,              // Default white letters
+    .on = true,                     // Default on
+    .temperature_color = 0xFF8C1A,  // Default amber temperature word
+    .transition = WORDCLOCK_TRANSITION_FADE,
+    .mode = WORDCLOCK_MODE_EFFECT,
+};
+
+// Temperature words, coldest first; a reading lights the first word it is below
+static const struct {
+    const char* word;
+    float below_celsius;
+} temperature_words[] = {
+    { "COLD", 10.0f },
+    { "COOL", 18.0f },
+    { "WARM", 26.0f },
+    { "HOT",  1000.0f },
+};
+
+#define TEMPERATURE_WORDS_COUNT (sizeof(temperature_words) / sizeof(temperature_words[0]))
+
+// Resolved once per grid layout so a new reading is just a table pick
+static wordclock_mask_t temperature_masks[TEMPERATURE_WORDS_COUNT] = {};
+static bool temperature_set = false;
+static float temperature_celsius = 0.0f;
+
+static void init_temperature_masks(void) {
+    for (size_t i = 0; i < TEMPERATURE_WORDS_COUNT; i++) {
+        if (!wordclock_grid_word_mask(temperature_words[i].word, &temperature_masks[i])) {
+            ESP_LOGW(TAG, "Grid has no '%s', temperature word will not show", temperature_words[i].word);
         }
-        else {
-            // Word not found sequentially; stop searching further
-            break;
-        }
-        token = strtok(NULL, " ");
     }
-
-    return true;
 }
 
-void setTime(int hour, int minute) {
-    clear_word_buffer(); // Clear the buffer before setting new time
-    add_word_to_buffer("IT IS");
-    bool use_to = false;
-
-    //special case for midnight
-    if (hour == 0 && minute == 0) {
-        add_word_to_buffer("MIDNIGHT");
-        goto end;
+// Set once NTP synced and the clock owns the display
+static bool display_started = false;
+
+// Mode the driver was last set up for; differs from wc_config.mode until the switch
+static wordclock_display_mode_t active_mode = WORDCLOCK_MODE_EFFECT;
+
+// Lit letters as the effect mode sees them, mirrored from the layers
+static portMUX_TYPE masks_lock = portMUX_INITIALIZER_UNLOCKED;
+static wordclock_mask_t time_mask = {};
+static wordclock_mask_t temperature_mask = {};
+
+/*
+ * Effect mode
+ *
+ * The driver plays its effect over every LED and the mask picks the lit
+ * ones. The mask is sized once at init and only changes when the lit
+ * letters do: the LEDs set last time are kept in a list, so a change clears
+ * those and sets the new ones instead of rewriting all 256 entries, and the
+ * driver is handed the mask once per minute at most.
+ */
+static std::vector<uint8_t> effect_mask;
+static uint8_t effect_leds[WORDCLOCK_GRID_SIZE];
+static size_t effect_led_count = 0;
+static wordclock_mask_t effect_shown = {};
+static bool effect_stale = true;    // Driver mask must be sent even if unchanged
+
+// Helper function to hand the lit letters to the driver mask
+static void apply_effect_mask(void) {
+    // The stream cleared the mask; start_display() sends it again on release
+    if (pixel_stream_active()) {
+        return;
     }
 
-    if (minute != 0) {
-        if (minute > 30) { // to
-            minute = 60 - minute;
-            use_to = true;
-        }
-        else { // past
-            use_to = false;
-        }
-
-        if (minute == 30) {
-            add_word_to_buffer("HALF");
-        }
-        else if (minute >= 20) { //31-40
-            add_word_to_buffer("TWENTY");
-            switch (minute % 10) {
-            case 1: add_word_to_buffer("ONE"); break;
-            case 2: add_word_to_buffer("TWO"); break;
-            case 3: add_word_to_buffer("THREE"); break;
-            case 4: add_word_to_buffer("FOUR"); break;
-            case 5: add_word_to_buffer("FIVE"); break;
-            case 6: add_word_to_buffer("SIX"); break;
-            case 7: add_word_to_buffer("SEVEN"); break;
-            case 8: add_word_to_buffer("EIGHT"); break;
-            case 9: add_word_to_buffer("NINE"); break;
-            }
-        }
-        else if (minute >= 10) { //41 - 50
-            switch (minute) {
-            case 19: add_word_to_buffer("NINETEEN"); break;
-            case 18: add_word_to_buffer("EIGHTEEN"); break;
-            case 17: add_word_to_buffer("SEVENTEEN"); break;
-            case 16: add_word_to_buffer("SIXTEEN"); break;
-            case 15: add_word_to_buffer("A QUARTER"); break;
-            case 14: add_word_to_buffer("FOURTEEN"); break;
-            case 13: add_word_to_buffer("THIRTEEN"); break;
-            case 12: add_word_to_buffer("TWELVE"); break;
-            case 11: add_word_to_buffer("ELEVEN"); break;
-            case 10: add_word_to_buffer("TEN"); break;
-            }
-        }
-        else {
-            switch (minute) {
-            case 9: add_word_to_buffer("NINE"); break;
-            case 8: add_word_to_buffer("EIGHT"); break;
-            case 7: add_word_to_buffer("SEVEN"); break;
-            case 6: add_word_to_buffer("SIX"); break;
-            case 5: add_word_to_buffer("FIVE"); break;
-            case 4: add_word_to_buffer("FOUR"); break;
-            case 3: add_word_to_buffer("THREE"); break;
-            case 2: add_word_to_buffer("TWO"); break;
-            case 1: add_word_to_buffer("ONE"); break;
-            }
-        }
-
-        if (use_to) {
-            add_word_to_buffer("TO");
-            hour = (hour + 1) % 24; // Increment hour for "to" case
-        }
-        else {
-            add_word_to_buffer("PAST");
-        }
+    wordclock_mask_t lit = {};
+    portENTER_CRITICAL(&masks_lock);
+    if (wc_config.on) {
+        lit = wordclock_mask_or(time_mask, temperature_mask);
     }
+    portEXIT_CRITICAL(&masks_lock);
 
-    switch (hour % 12) {
-    case 0: add_word_to_buffer("TWELVE"); break; // Midnight
-    case 1: add_word_to_buffer("ONE"); break;
-    case 2: add_word_to_buffer("TWO"); break;
-    case 3: add_word_to_buffer("THREE"); break;
-    case 4: add_word_to_buffer("FOUR"); break;
-    case 5: add_word_to_buffer("FIVE"); break;
-    case 6: add_word_to_buffer("SIX"); break;
-    case 7: add_word_to_buffer("SEVEN"); break;
-    case 8: add_word_to_buffer("EIGHT"); break;
-    case 9: add_word_to_buffer("NINE"); break;
-    case 10: add_word_to_buffer("TEN"); break;
-    case 11: add_word_to_buffer("ELEVEN"); break;
+    if (!effect_stale && wordclock_mask_equal(lit, effect_shown)) {
+        return;
     }
 
-    if (hour < 5) {
-        add_word_to_buffer("AT NIGHT");
+    for (size_t i = 0; i < effect_led_count; i++) {
+        effect_mask[effect_leds[i]] = 0;
     }
-    else if (hour < 12) {
-        add_word_to_buffer("IN THE MORNING");
-    }
-    else if (hour < 17) {
-        add_word_to_buffer("IN THE AFTERNOON");
+    effect_led_count = 0;
+
+    const uint8_t* led_index = wordclock_grid_get()->tables.led_index;
+    for (size_t w = 0; w < WORDCLOCK_MASK_WORDS; w++) {
+        uint32_t word = lit.words[w];
+        while (word != 0) {
+            uint8_t led = led_index[w * 32 + __builtin_ctz(word)];
+            word &= word - 1;
+            effect_mask[led] = 1;
+            effect_leds[effect_led_count++] = led;
+        }
     }
-    else if (hour < 21) {
-        add_word_to_buffer("IN THE EVENING");
+
+    effect_shown = lit;
+    effect_stale = false;
+    PixelDriver::getMainChannel()->setMask(effect_mask);
+}
+
+// Show the current layers in the active mode
+static void render_display(void) {
+    if (active_mode == WORDCLOCK_MODE_LETTERS) {
+        wordclock_layers_render();
     }
     else {
-        add_word_to_buffer("AT NIGHT");
+        apply_effect_mask();
     }
+}
 
-end:
-    // Convert the word buffer to bits
-    if (!word_buffer_to_bits(wordclock_words_buffer, letters, bits, 256)) {
-        return;
-    }
+void setTime(int hour, int minute) {
+    wordclock_mask_t mask = wordclock_grid_mask(wordclock_grid_get()->tables, hour, minute);
+    wordclock_layer_set_mask(WORDCLOCK_LAYER_TIME, mask);
 
-    // Use static mask buffer to avoid heap allocation on every update
-    static std::vector<uint8_t> mask_buffer;
-    if (mask_buffer.empty()) {
-        mask_buffer.resize(256);
-    }
-    std::copy(bits, bits + 256, mask_buffer.begin());
-    PixelDriver::getMainChannel()->setMask(mask_buffer);
+    portENTER_CRITICAL(&masks_lock);
+    time_mask = mask;
+    portEXIT_CRITICAL(&masks_lock);
+
+    render_display();
 }
 
 // Update the display with current time
 static void update_display(void) {
+    if (!display_started) return;
+
     time_t now;
     struct tm timeinfo;
     time(&now);
@@ -220,14 +165,62 @@ static void update_display(void) {
     setTime(timeinfo.tm_hour, timeinfo.tm_min);
 }
 
+// Set the driver up for the configured mode and show the time
+static void start_display(void) {
+    active_mode = wc_config.mode == WORDCLOCK_MODE_LETTERS ? WORDCLOCK_MODE_LETTERS : WORDCLOCK_MODE_EFFECT;
+
+    if (active_mode == WORDCLOCK_MODE_LETTERS) {
+        // The renderer clears the buffer on its next frame
+        PixelDriver::getMainChannel()->setEffectByID("raw");
+        PixelDriver::getMainChannel()->setBrightness(wc_config.brightness);
+        wordclock_layers_reset();
+    }
+    else {
+        // Effect, colors and brightness as last set through the LED API
+        wordclock_layers_suspend();
+        PixelDriver::getMainChannel()->loadFromNVS();
+        effect_stale = true;
+    }
+    display_started = true;
+
+    update_display();
+}
+
+// Take the display back from a pixel stream
+static void release_display(void) {
+    if (display_started) {
+        start_display();
+    }
+    else {
+        PixelDriver::getMainChannel()->setEffectByID("CYCLIC");
+    }
+}
+
 // Event handler for clock events
 static void clock_event_handler(void* arg, esp_event_base_t base, int32_t id, void* data) {
+    ALLOC_TRACE_SCOPE(ALLOC_PATH_CLOCK);
+
     if (base == CLOCK_EVENTS) {
         switch (id) {
             case CLOCK_EVENT_MINUTE_TICK:
+                update_display();
+                break;
             case CLOCK_EVENT_CONFIG_CHANGED:
+                if (display_started && wc_config.mode != active_mode) {
+                    start_display();
+                }
+                else {
+                    update_display();
+                }
+                break;
             case CLOCK_EVENT_FORCE_REFRESH:
-                update_display();
+                // Overlay changes; the time layer is already current
+                if (display_started) {
+                    render_display();
+                }
+                break;
+            case CLOCK_EVENT_DISPLAY_RELEASED:
+                release_display();
                 break;
             default:
                 break;
@@ -238,37 +231,142 @@ static void clock_event_handler(void* arg, esp_event_base_t base, int32_t id, vo
 // Event handler for NTP sync
 static void ntp_event_handler(void* arg, esp_event_base_t base, int32_t id, void* data) {
     if (id == KD_NTP_EVENT_SYNC_COMPLETE) {
-        ESP_LOGI(TAG, "NTP synced, loading display settings");
-        PixelDriver::getMainChannel()->loadFromNVS();
-        update_display();
+        ESP_LOGI(TAG, "NTP synced, starting display");
+        start_display();
     }
 }
 
-void wordclock_clock_task(void* pvParameter) {
-    ESP_LOGI(TAG, "Wordclock task started");
+// Post config changed event to trigger display update
+static void post_config_changed(void) {
+    esp_event_post(CLOCK_EVENTS, CLOCK_EVENT_CONFIG_CHANGED, nullptr, 0, 0);
+}
+
+// Wordclock configuration functions
+wordclock_config_t wordclock_get_config(void) {
+    return wc_config;
+}
 
-    // Show syncing animation
-    PixelDriver::getMainChannel()->setColor(PixelColor(255, 255, 0)); // Yellow during sync
-    PixelDriver::getMainChannel()->setEffectByID("CYCLIC");
+void wordclock_set_brightness(uint8_t brightness) {
+    wc_config.brightness = brightness;
+    PixelDriver::getMainChannel()->setBrightness(brightness);
+    wordclock_save_to_nvs(&wc_config);
+}
 
-    // Register for clock events
-    esp_event_handler_register(CLOCK_EVENTS, ESP_EVENT_ANY_ID, clock_event_handler, nullptr);
-    esp_event_handler_register(KD_NTP_EVENTS, KD_NTP_EVENT_SYNC_COMPLETE, ntp_event_handler, nullptr);
+void wordclock_set_color(uint32_t color) {
+    wc_config.color = color & 0xFFFFFF;
+    wordclock_layer_set_color(WORDCLOCK_LAYER_TIME, wc_config.color);
+    wordclock_save_to_nvs(&wc_config);
+    post_config_changed();
+}
 
-    // If already synced, switch to display mode immediately
-    if (kd_common_ntp_is_synced()) {
-        ESP_LOGI(TAG, "Already synced, starting display");
-        PixelDriver::getMainChannel()->loadFromNVS();
-        update_display();
+void wordclock_set_temperature_color(uint32_t color) {
+    wc_config.temperature_color = color & 0xFFFFFF;
+    wordclock_layer_set_color(WORDCLOCK_LAYER_TEMPERATURE, wc_config.temperature_color);
+    wordclock_save_to_nvs(&wc_config);
+    post_config_changed();
+}
+
+void wordclock_set_transition(uint8_t transition) {
+    if (transition >= WORDCLOCK_TRANSITION_COUNT) {
+        transition = WORDCLOCK_TRANSITION_NONE;
     }
+    wc_config.transition = transition;
+    wordclock_layers_set_transition((wordclock_transition_t)transition);
+    wordclock_save_to_nvs(&wc_config);
+}
 
-    // Task sleeps indefinitely - all updates come from events
-    while (true) {
-        vTaskDelay(portMAX_DELAY);
+void wordclock_set_mode(uint8_t mode) {
+    if (mode >= WORDCLOCK_MODE_COUNT) {
+        mode = WORDCLOCK_MODE_EFFECT;
     }
+    wc_config.mode = mode;
+    wordclock_save_to_nvs(&wc_config);
+    post_config_changed();
+}
+
+void wordclock_set_on_state(bool on) {
+    wc_config.on = on;
+    wordclock_layers_set_visible(on);
+    wordclock_save_to_nvs(&wc_config);
+    post_config_changed();
+}
+
+// Apply and save a whole config at once; the caller posts CLOCK_EVENT_CONFIG_CHANGED
+void wordclock_update_config(const wordclock_config_t* config) {
+    if (config == NULL) return;
+
+    // Brightness is only pushed to the driver when it is set, so a config
+    // change leaves the brightness of an LED API effect alone
+    bool brightness_changed = config->brightness != wc_config.brightness;
+    wc_config = *config;
+    wc_config.color &= 0xFFFFFF;
+    wc_config.temperature_color &= 0xFFFFFF;
+    if (wc_config.transition >= WORDCLOCK_TRANSITION_COUNT) {
+        wc_config.transition = WORDCLOCK_TRANSITION_NONE;
+    }
+    if (wc_config.mode >= WORDCLOCK_MODE_COUNT) {
+        wc_config.mode = WORDCLOCK_MODE_EFFECT;
+    }
+
+    if (brightness_changed) {
+        PixelDriver::getMainChannel()->setBrightness(wc_config.brightness);
+    }
+    wordclock_layer_set_color(WORDCLOCK_LAYER_TIME, wc_config.color);
+    wordclock_layer_set_color(WORDCLOCK_LAYER_TEMPERATURE, wc_config.temperature_color);
+    wordclock_layers_set_transition((wordclock_transition_t)wc_config.transition);
+    wordclock_layers_set_visible(wc_config.on);
+    wordclock_save_to_nvs(&wc_config);
+}
+
+// Temperature overlay; only the temperature layer is touched
+void wordclock_set_temperature(float celsius) {
+    size_t i = 0;
+    while (i < TEMPERATURE_WORDS_COUNT - 1 && celsius >= temperature_words[i].below_celsius) {
+        i++;
+    }
+
+    temperature_celsius = celsius;
+    temperature_set = true;
+    wordclock_layer_set_mask(WORDCLOCK_LAYER_TEMPERATURE, temperature_masks[i]);
+
+    portENTER_CRITICAL(&masks_lock);
+    temperature_mask = temperature_masks[i];
+    portEXIT_CRITICAL(&masks_lock);
+    esp_event_post(CLOCK_EVENTS, CLOCK_EVENT_FORCE_REFRESH, nullptr, 0, 0);
+}
+
+void wordclock_clear_temperature(void) {
+    temperature_set = false;
+    wordclock_layer_set_mask(WORDCLOCK_LAYER_TEMPERATURE, wordclock_mask_t {});
+
+    portENTER_CRITICAL(&masks_lock);
+    temperature_mask = {};
+    portEXIT_CRITICAL(&masks_lock);
+    esp_event_post(CLOCK_EVENTS, CLOCK_EVENT_FORCE_REFRESH, nullptr, 0, 0);
+}
+
+bool wordclock_get_temperature(float* celsius) {
+    if (temperature_set && celsius != NULL) {
+        *celsius = temperature_celsius;
+    }
+    return temperature_set;
 }
 
 void wordclock_clock_init() {
+    // Register wordclock API handlers (called when httpd starts on WiFi connect)
+    kd_common_api_register_handlers(register_wordclock_handlers);
+
+    wordclock_load_from_nvs(&wc_config);
+    wordclock_grid_init();
+    init_temperature_masks();
+
+    wordclock_layer_set_color(WORDCLOCK_LAYER_TIME, wc_config.color);
+    wordclock_layer_set_color(WORDCLOCK_LAYER_TEMPERATURE, wc_config.temperature_color);
+    wordclock_layers_set_visible(wc_config.on);
+    wordclock_layers_set_transition((wordclock_transition_t)wc_config.transition);
+    wordclock_layers_init();
+    effect_mask.assign(WORDCLOCK_GRID_SIZE, 0);
+
     PixelDriver::initialize(60);
     PixelDriver::setCurrentLimit(2000); // 600mA limit for Nixie LEDs
     PixelDriver::addChannel(ChannelConfig((gpio_num_t)CONFIG_WORDCLOCK_LED_DATA_PIN, 256, is_rgbw ? PixelFormat::RGBW : PixelFormat::RGB, "Word Clock"));
@@ -276,6 +374,10 @@ void wordclock_clock_init() {
 
     PixelDriver::getMainChannel()->setColor(PixelColor(0, 255, 255));
     PixelDriver::getMainChannel()->setEffectByID("BREATHE");
+
+    // All updates come from events; the display starts on NTP sync
+    esp_event_handler_register(CLOCK_EVENTS, ESP_EVENT_ANY_ID, clock_event_handler, nullptr);
+    esp_event_handler_register(KD_NTP_EVENTS, KD_NTP_EVENT_SYNC_COMPLETE, ntp_event_handler, nullptr);
 }
 
 #endif
\ No newline at end of file
@@ -1,4 +1,36 @@
 #pragma once
 
+#include <stdint.h>
+
+// What lights the letters
+typedef enum : uint8_t {
+    WORDCLOCK_MODE_EFFECT,      // PixelDriver effect from the LED API, masked to the lit letters
+    WORDCLOCK_MODE_LETTERS,     // Solid layer colors with transitions, driver in raw mode
+    WORDCLOCK_MODE_COUNT,
+} wordclock_display_mode_t;
+
+typedef struct {
+    uint8_t brightness;          // 0-255
+    uint32_t color;              // Time letter color, 0xRRGGBB
+    bool on;                     // true if the word clock is on, false if off
+    uint32_t temperature_color;  // Temperature word color, 0xRRGGBB
+    uint8_t transition;          // wordclock_transition_t used when letters change
+    uint8_t mode;                // wordclock_display_mode_t
+} wordclock_config_t;
+
+// Wordclock configuration functions
+wordclock_config_t wordclock_get_config(void);
+void wordclock_set_brightness(uint8_t brightness);
+void wordclock_set_color(uint32_t color);
+void wordclock_set_on_state(bool on);
+void wordclock_set_temperature_color(uint32_t color);
+void wordclock_set_transition(uint8_t transition);
+void wordclock_set_mode(uint8_t mode);
+void wordclock_update_config(const wordclock_config_t* config);  // All fields, one save, no event
+
+// Temperature overlay (COLD/COOL/WARM/HOT), fed by the API or a local sensor
+void wordclock_set_temperature(float celsius);
+void wordclock_clear_temperature(void);
+bool wordclock_get_temperature(float* celsius);
+
 void wordclock_clock_init();
-void wordclock_clock_task(void* pvParameter);
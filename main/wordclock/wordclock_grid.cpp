@@ -0,0 +1,103 @@
+#include "wordclock_grid.h"
+#include "wordclock_phrases.h"
+
+#include "esp_log.h"
+#include "esp_partition.h"
+#include "esp_rom_crc.h"
+#include <string.h>
+
+#include "sdkconfig.h"
+
+static const char* TAG = "wordclock_grid";
+
+#ifdef CONFIG_BASE_CLOCK_TYPE_WORDCLOCK
+
+static const wordclock_grid_layout_t* active_layout = &wordclock_builtin_layout;
+static esp_partition_mmap_handle_t grid_mmap_handle;
+
+static bool grid_header_valid(const wordclock_grid_header_t* header, const esp_partition_t* partition) {
+    if (header->magic != WORDCLOCK_GRID_MAGIC) {
+        ESP_LOGI(TAG, "No grid image in partition '%s'", partition->label);
+        return false;
+    }
+    if (header->version != WORDCLOCK_GRID_VERSION) {
+        ESP_LOGW(TAG, "Unsupported grid image version %d", header->version);
+        return false;
+    }
+    if (header->layout_count == 0 || header->active_layout >= header->layout_count) {
+        ESP_LOGW(TAG, "Grid image has no usable layout (count=%d, active=%d)",
+            header->layout_count, header->active_layout);
+        return false;
+    }
+    if (sizeof(*header) + header->layout_count * sizeof(wordclock_grid_layout_t) > partition->size) {
+        ESP_LOGW(TAG, "Grid image larger than partition '%s'", partition->label);
+        return false;
+    }
+    return true;
+}
+
+void wordclock_grid_init(void) {
+    active_layout = &wordclock_builtin_layout;
+
+    const esp_partition_t* partition = esp_partition_find_first(ESP_PARTITION_TYPE_DATA,
+        ESP_PARTITION_SUBTYPE_ANY, CONFIG_WORDCLOCK_GRID_PARTITION);
+    if (partition == NULL) {
+        ESP_LOGI(TAG, "Grid partition '%s' not found, using built-in layout", CONFIG_WORDCLOCK_GRID_PARTITION);
+        return;
+    }
+
+    wordclock_grid_header_t header;
+    esp_err_t err = esp_partition_read(partition, 0, &header, sizeof(header));
+    if (err != ESP_OK) {
+        ESP_LOGE(TAG, "Failed to read grid header: %s", esp_err_to_name(err));
+        return;
+    }
+    if (!grid_header_valid(&header, partition)) {
+        return;
+    }
+
+    // Map the image once and keep it mapped; layouts are read in place
+    size_t image_size = sizeof(header) + header.layout_count * sizeof(wordclock_grid_layout_t);
+    const void* image = NULL;
+    err = esp_partition_mmap(partition, 0, image_size, ESP_PARTITION_MMAP_DATA, &image, &grid_mmap_handle);
+    if (err != ESP_OK) {
+        ESP_LOGE(TAG, "Failed to map grid partition: %s", esp_err_to_name(err));
+        return;
+    }
+
+    const uint8_t* layouts = (const uint8_t*)image + sizeof(header);
+    uint32_t crc = esp_rom_crc32_le(0, layouts, image_size - sizeof(header));
+    if (crc != header.crc32) {
+        ESP_LOGW(TAG, "Grid image CRC mismatch (0x%08lx != 0x%08lx), using built-in layout",
+            (unsigned long)crc, (unsigned long)header.crc32);
+        esp_partition_munmap(grid_mmap_handle);
+        return;
+    }
+
+    active_layout = (const wordclock_grid_layout_t*)layouts + header.active_layout;
+    ESP_LOGI(TAG, "Using grid layout '%.*s' (%d of %d)", (int)sizeof(active_layout->name),
+        active_layout->name, header.active_layout + 1, header.layout_count);
+}
+
+const wordclock_grid_layout_t* wordclock_grid_get(void) {
+    return active_layout;
+}
+
+bool wordclock_grid_word_mask(const char* word, wordclock_mask_t* mask) {
+    const char* letters = active_layout->tables.letters;
+    size_t len = strlen(word);
+    if (len == 0 || len > WORDCLOCK_GRID_SIZE) {
+        return false;
+    }
+
+    for (size_t pos = WORDCLOCK_GRID_SIZE - len + 1; pos-- > 0;) {
+        if (memcmp(&letters[pos], word, len) == 0) {
+            *mask = {};
+            wordclock_mask_set_span(*mask, pos, len);
+            return true;
+        }
+    }
+    return false;
+}
+
+#endif
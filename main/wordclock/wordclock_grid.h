@@ -0,0 +1,106 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "wordclock_mask.h"
+
+// Word joining the minute phrase to the hour ("TWENTY PAST", "TEN TO")
+typedef enum : uint8_t {
+    WORDCLOCK_CONNECTOR_NONE,
+    WORDCLOCK_CONNECTOR_PAST,
+    WORDCLOCK_CONNECTOR_TO,     // Hour part refers to the next hour
+    WORDCLOCK_CONNECTOR_COUNT,
+} wordclock_connector_t;
+
+/*
+ * Grid layout binary format (version 1, little-endian)
+ *
+ *   wordclock_grid_header_t
+ *   wordclock_grid_layout_t[layout_count]
+ *
+ * The image is written to the start of the grid partition by
+ * tools/wordclock_grid.py and read in place through a flash mmap, so every
+ * structure below is 4-byte aligned and used directly without copying.
+ */
+#define WORDCLOCK_GRID_MAGIC 0x52474357  // "WCGR"
+#define WORDCLOCK_GRID_VERSION 1
+
+typedef struct {
+    uint32_t magic;
+    uint16_t version;
+    uint16_t layout_count;
+    uint16_t active_layout;   // Layout shown by default
+    uint16_t reserved;
+    uint32_t crc32;           // CRC-32 (little-endian) over all layouts
+} wordclock_grid_header_t;
+
+typedef struct {
+    wordclock_mask_t midnight;
+    wordclock_mask_t minutes[60];                              // "IT IS ... PAST|TO"
+    wordclock_mask_t hours[WORDCLOCK_CONNECTOR_COUNT][24];     // "SEVEN IN THE EVENING"
+    uint8_t connectors[60];                                    // wordclock_connector_t
+    uint8_t led_index[WORDCLOCK_GRID_SIZE];                    // Letter index -> physical LED
+    char letters[WORDCLOCK_GRID_SIZE];                         // Reading order, not terminated
+} wordclock_grid_tables_t;
+
+typedef struct {
+    char name[24];
+    wordclock_grid_tables_t tables;
+} wordclock_grid_layout_t;
+
+static_assert(sizeof(wordclock_grid_header_t) == 16, "Grid header layout is part of the flash format");
+static_assert(sizeof(wordclock_grid_layout_t) == 4852, "Grid layout is part of the flash format");
+
+/**
+ * @brief Get the lit letters for a time of day
+ *
+ * @param tables Grid tables to read
+ * @param hour 0-23
+ * @param minute 0-59
+ * @return Packed mask of the letters spelling out the time, in letter order
+ */
+constexpr wordclock_mask_t wordclock_grid_mask(const wordclock_grid_tables_t& tables, int hour, int minute) {
+    if (hour == 0 && minute == 0) {
+        return tables.midnight;
+    }
+
+    uint8_t connector = tables.connectors[minute];
+    if (connector >= WORDCLOCK_CONNECTOR_COUNT) {
+        connector = WORDCLOCK_CONNECTOR_NONE;
+    }
+    if (connector == WORDCLOCK_CONNECTOR_TO) {
+        hour = (hour + 1) % 24;
+    }
+
+    return wordclock_mask_or(tables.minutes[minute], tables.hours[connector][hour]);
+}
+
+/**
+ * @brief Select the grid layout
+ *
+ * Maps the grid partition and validates its image. Falls back to the
+ * built-in English layout if the partition is missing, unformatted or
+ * corrupt.
+ */
+void wordclock_grid_init(void);
+
+/**
+ * @brief Get the active grid layout
+ *
+ * @return Layout in flash; never NULL
+ */
+const wordclock_grid_layout_t* wordclock_grid_get(void);
+
+/**
+ * @brief Find a standalone word on the active layout
+ *
+ * Searches from the end of the grid, where extra words such as COLD or HOT
+ * sit after the sentence words. Meant for building overlay masks once, not
+ * for per-update use.
+ *
+ * @param word Upper-case word
+ * @param mask Filled with the word's letters
+ * @return true if the word is on the grid
+ */
+bool wordclock_grid_word_mask(const char* word, wordclock_mask_t* mask);
@@ -0,0 +1,325 @@
+#include "wordclock_handlers.h"
+#include "wordclock.h"
+#include "wordclock_layers.h"
+#include "clock_events.h"
+#include "config_batch.h"
+#include "http_governor.h"
+#include "json_reader.h"
+#include "json_writer.h"
+#include "settings_store.h"
+#include "state_ws.h"
+#include "pixel_stream.h"
+#include "esp_log.h"
+#include <ctype.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "sdkconfig.h"
+
+static const char* TAG = "wordclock_handlers";
+
+#ifdef CONFIG_BASE_CLOCK_TYPE_WORDCLOCK
+
+// Pre-record NVS namespace, migrated into the settings record
+#define WORDCLOCK_NVS_NAMESPACE "wc_cfg"
+
+// External wc_config from wordclock.cpp
+extern wordclock_config_t wc_config;
+
+// Settings record field IDs; never reuse a retired ID
+static const settings_field_t wordclock_settings_fields[] = {
+    SETTINGS_FIELD(1, wordclock_config_t, brightness),
+    SETTINGS_FIELD(2, wordclock_config_t, color),
+    SETTINGS_FIELD(3, wordclock_config_t, on),
+    SETTINGS_FIELD(4, wordclock_config_t, temperature_color),
+    SETTINGS_FIELD(5, wordclock_config_t, transition),
+    SETTINGS_FIELD(6, wordclock_config_t, mode),
+};
+
+static settings_domain_t wordclock_settings =
+    SETTINGS_DOMAIN(SETTINGS_ID_WORDCLOCK, "wordclock", wc_config, wordclock_settings_fields, WORDCLOCK_NVS_NAMESPACE);
+
+static const wordclock_config_t wordclock_default_config = {
+    .brightness = 255,
+    .color = 0xFFFFFF,
+    .on = true,
+    .temperature_color = 0xFF8C1A,
+    .transition = WORDCLOCK_TRANSITION_FADE,
+    .mode = WORDCLOCK_MODE_EFFECT,
+};
+
+// Indexed by wordclock_transition_t
+static const char* const transition_names[WORDCLOCK_TRANSITION_COUNT] = { "none", "fade", "rain" };
+
+// Indexed by wordclock_display_mode_t
+static const char* const mode_names[WORDCLOCK_MODE_COUNT] = { "effect", "letters" };
+
+// Helper function to write word clock state JSON
+static void write_wordclock_state_json(json_writer_t* writer) {
+    wordclock_config_t config = wordclock_get_config();
+
+    json_object_begin(writer);
+    json_kv_int(writer, "brightness", config.brightness);
+    json_kv_color(writer, "color", config.color & 0xFFFFFF);
+    json_kv_bool(writer, "on", config.on);
+    json_kv_color(writer, "temperature_color", config.temperature_color & 0xFFFFFF);
+    json_kv_string(writer, "transition",
+        config.transition < WORDCLOCK_TRANSITION_COUNT ? transition_names[config.transition] : "none");
+    json_kv_string(writer, "mode", config.mode < WORDCLOCK_MODE_COUNT ? mode_names[config.mode] : "effect");
+    json_object_end(writer);
+}
+
+// Parse a "#RRGGBB" color string
+static bool parse_color(const char* str, uint32_t* color) {
+    if (str == NULL || str[0] != '#' || strlen(str) != 7) {
+        return false;
+    }
+
+    // Exactly six hex digits; strtoul alone would take a sign or spaces
+    for (size_t i = 1; i < 7; i++) {
+        if (!isxdigit((unsigned char)str[i])) {
+            return false;
+        }
+    }
+
+    *color = (uint32_t)strtoul(str + 1, NULL, 16);
+    return true;
+}
+
+// Match a string against a name table
+static bool parse_name(const char* str, const char* const* names, uint8_t count, uint8_t* value) {
+    if (str == NULL) {
+        return false;
+    }
+
+    for (uint8_t i = 0; i < count; i++) {
+        if (strcmp(str, names[i]) == 0) {
+            *value = i;
+            return true;
+        }
+    }
+    return false;
+}
+
+static bool parse_transition(const char* str, uint8_t* transition) {
+    return parse_name(str, transition_names, WORDCLOCK_TRANSITION_COUNT, transition);
+}
+
+static bool parse_mode(const char* str, uint8_t* mode) {
+    return parse_name(str, mode_names, WORDCLOCK_MODE_COUNT, mode);
+}
+
+// Config staged by a POST to /api/wordclock or /api/config until it
+// validated; both read into it on the httpd task
+static wordclock_config_t wordclock_staged_config;
+static int32_t wordclock_staged_brightness;
+static char wordclock_staged_color[8];
+static char wordclock_staged_temperature_color[8];
+static char wordclock_staged_transition[8];
+static char wordclock_staged_mode[8];
+
+// Indexes into wordclock_json_fields
+enum {
+    WORDCLOCK_FIELD_BRIGHTNESS,
+    WORDCLOCK_FIELD_ON,
+    WORDCLOCK_FIELD_COLOR,
+    WORDCLOCK_FIELD_TEMPERATURE_COLOR,
+    WORDCLOCK_FIELD_TRANSITION,
+    WORDCLOCK_FIELD_MODE,
+};
+
+static json_field_t wordclock_json_fields[] = {
+    { .key = "brightness", .type = JSON_FIELD_INT, .value = &wordclock_staged_brightness },
+    { .key = "on", .type = JSON_FIELD_BOOL, .value = &wordclock_staged_config.on },
+    { .key = "color", .type = JSON_FIELD_STRING, .value = wordclock_staged_color,
+        .size = sizeof(wordclock_staged_color) },
+    { .key = "temperature_color", .type = JSON_FIELD_STRING, .value = wordclock_staged_temperature_color,
+        .size = sizeof(wordclock_staged_temperature_color) },
+    { .key = "transition", .type = JSON_FIELD_STRING, .value = wordclock_staged_transition,
+        .size = sizeof(wordclock_staged_transition) },
+    { .key = "mode", .type = JSON_FIELD_STRING, .value = wordclock_staged_mode, .size = sizeof(wordclock_staged_mode) },
+};
+
+static void begin_wordclock_config(void) {
+    wordclock_staged_config = wordclock_get_config();
+    wordclock_staged_brightness = wordclock_staged_config.brightness;
+}
+
+// Helper function to check the strings read and finish the staged config
+static esp_err_t validate_wordclock_config(const char** error) {
+    wordclock_config_t* config = &wordclock_staged_config;
+    const json_field_t* fields = wordclock_json_fields;
+
+    if (fields[WORDCLOCK_FIELD_COLOR].found && !parse_color(wordclock_staged_color, &config->color)) {
+        *error = "color: expected \"#RRGGBB\"";
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (fields[WORDCLOCK_FIELD_TEMPERATURE_COLOR].found &&
+        !parse_color(wordclock_staged_temperature_color, &config->temperature_color)) {
+        *error = "temperature_color: expected \"#RRGGBB\"";
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (fields[WORDCLOCK_FIELD_TRANSITION].found && !parse_transition(wordclock_staged_transition, &config->transition)) {
+        *error = "transition: expected \"none\", \"fade\" or \"rain\"";
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (fields[WORDCLOCK_FIELD_MODE].found && !parse_mode(wordclock_staged_mode, &config->mode)) {
+        *error = "mode: expected \"effect\" or \"letters\"";
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    int32_t brightness = wordclock_staged_brightness;
+    config->brightness = (brightness < 0) ? 0 : (brightness > 255) ? 255 : brightness;
+    return ESP_OK;
+}
+
+static void commit_wordclock_config(void) {
+    wordclock_update_config(&wordclock_staged_config);
+}
+
+static const config_section_t wordclock_config_section = {
+    .name = "wordclock",
+    .fields = wordclock_json_fields,
+    .field_count = sizeof(wordclock_json_fields) / sizeof(wordclock_json_fields[0]),
+    .begin = begin_wordclock_config,
+    .validate = validate_wordclock_config,
+    .commit = commit_wordclock_config,
+    .write = write_wordclock_state_json,
+};
+
+esp_err_t wordclock_config_get_handler(httpd_req_t* req) {
+    char buf[160];
+    json_writer_t writer;
+    json_writer_init(&writer, buf, sizeof(buf), req);
+
+    httpd_resp_set_type(req, "application/json");
+    write_wordclock_state_json(&writer);
+    return json_writer_finish(&writer);
+}
+
+esp_err_t wordclock_config_post_handler(httpd_req_t* req) {
+    // Error responses are sent by the reader
+    if (config_section_read_request(req, &wordclock_config_section, NULL, 0) != ESP_OK) {
+        return ESP_FAIL;
+    }
+
+    wordclock_update_config(&wordclock_staged_config);
+    esp_event_post(CLOCK_EVENTS, CLOCK_EVENT_CONFIG_CHANGED, nullptr, 0, 0);
+
+    return wordclock_config_get_handler(req); // Return updated config
+}
+
+esp_err_t wordclock_temperature_get_handler(httpd_req_t* req) {
+    char buf[32];
+    json_writer_t writer;
+    json_writer_init(&writer, buf, sizeof(buf), req);
+    httpd_resp_set_type(req, "application/json");
+
+    json_object_begin(&writer);
+    json_key(&writer, "celsius");
+    float celsius;
+    if (wordclock_get_temperature(&celsius)) {
+        json_float(&writer, celsius);
+    }
+    else {
+        json_null(&writer);
+    }
+    json_object_end(&writer);
+
+    return json_writer_finish(&writer);
+}
+
+esp_err_t wordclock_temperature_post_handler(httpd_req_t* req) {
+    float celsius = 0.0f;
+    json_field_t fields[] = {
+        { .key = "celsius", .type = JSON_FIELD_FLOAT, .value = &celsius, .nullable = true },
+    };
+
+    // Syntax and type errors are answered by the reader
+    if (json_read_request(req, fields, sizeof(fields) / sizeof(fields[0])) != ESP_OK) {
+        return ESP_FAIL;
+    }
+    if (!fields[0].found) {
+        httpd_resp_send_err(req, HTTPD_400_BAD_REQUEST, "celsius: expected a number or null");
+        return ESP_FAIL;
+    }
+
+    // A number shows the matching word, null hides the overlay
+    if (fields[0].is_null) {
+        wordclock_clear_temperature();
+    }
+    else {
+        wordclock_set_temperature(celsius);
+    }
+
+    return wordclock_temperature_get_handler(req);
+}
+
+// NVS functions
+void wordclock_load_from_nvs(wordclock_config_t* config) {
+    if (!config) return;
+
+    // Defaults for fields the record does not hold
+    wc_config = wordclock_default_config;
+
+    // Read once at boot; wc_config stays the authoritative copy
+    if (!settings_load(&wordclock_settings)) {
+        ESP_LOGI(TAG, "Wordclock config not stored yet, using defaults");
+    }
+
+    *config = wc_config;
+}
+
+void wordclock_save_to_nvs(const wordclock_config_t* config) {
+    if (!config) return;
+
+    // Written by the settings store once changes settle
+    wc_config = *config;
+    settings_mark_dirty(&wordclock_settings);
+}
+
+void register_wordclock_handlers(httpd_handle_t server) {
+    // Config section of the /api/ws pushes
+    state_ws_set_config_writer(write_wordclock_state_json);
+
+    // Settable together with other sections through /api/config
+    config_batch_register(&wordclock_config_section);
+
+    // Raw frames for the whole grid at /api/ws/pixels
+    register_pixel_stream_handlers(server);
+
+    httpd_uri_t wordclock_config_get_uri = {
+        .uri = "/api/wordclock",
+        .method = HTTP_GET,
+        .handler = wordclock_config_get_handler,
+        .user_ctx = NULL
+    };
+    http_governor_register_uri(server, &wordclock_config_get_uri);
+
+    httpd_uri_t wordclock_config_post_uri = {
+        .uri = "/api/wordclock",
+        .method = HTTP_POST,
+        .handler = wordclock_config_post_handler,
+        .user_ctx = NULL
+    };
+    http_governor_register_uri(server, &wordclock_config_post_uri);
+
+    httpd_uri_t wordclock_temperature_get_uri = {
+        .uri = "/api/wordclock/temperature",
+        .method = HTTP_GET,
+        .handler = wordclock_temperature_get_handler,
+        .user_ctx = NULL
+    };
+    http_governor_register_uri(server, &wordclock_temperature_get_uri);
+
+    httpd_uri_t wordclock_temperature_post_uri = {
+        .uri = "/api/wordclock/temperature",
+        .method = HTTP_POST,
+        .handler = wordclock_temperature_post_handler,
+        .user_ctx = NULL
+    };
+    http_governor_register_uri(server, &wordclock_temperature_post_uri);
+}
+
+#endif
@@ -0,0 +1,71 @@
+#pragma once
+
+#include "esp_http_server.h"
+#include "wordclock.h"
+
+/**
+ * @brief Register all word clock HTTP handlers
+ *
+ * @param server HTTP server handle
+ */
+void register_wordclock_handlers(httpd_handle_t server);
+
+/**
+ * @brief HTTP GET handler for word clock configuration
+ *
+ * Returns current word clock configuration as JSON.
+ *
+ * @param req HTTP request
+ * @return esp_err_t ESP_OK on success
+ */
+esp_err_t wordclock_config_get_handler(httpd_req_t* req);
+
+/**
+ * @brief HTTP POST handler for word clock configuration
+ *
+ * Updates word clock configuration from JSON payload.
+ *
+ * @param req HTTP request
+ * @return esp_err_t ESP_OK on success
+ */
+esp_err_t wordclock_config_post_handler(httpd_req_t* req);
+
+/**
+ * @brief HTTP GET handler for the temperature overlay
+ *
+ * Returns the temperature shown on the grid, or null if none.
+ *
+ * @param req HTTP request
+ * @return esp_err_t ESP_OK on success
+ */
+esp_err_t wordclock_temperature_get_handler(httpd_req_t* req);
+
+/**
+ * @brief HTTP POST handler for the temperature overlay
+ *
+ * Sets the temperature shown as COLD/COOL/WARM/HOT, or clears it with null.
+ *
+ * @param req HTTP request
+ * @return esp_err_t ESP_OK on success
+ */
+esp_err_t wordclock_temperature_post_handler(httpd_req_t* req);
+
+/**
+ * @brief Load word clock configuration from NVS
+ *
+ * Fills the live configuration from the settings record read at boot,
+ * with defaults for fields the record does not hold. Call once at init.
+ *
+ * @param config Pointer to configuration structure to fill
+ */
+void wordclock_load_from_nvs(wordclock_config_t* config);
+
+/**
+ * @brief Save word clock configuration to NVS
+ *
+ * Becomes the live configuration at once; the settings store writes it
+ * to NVS once changes settle.
+ *
+ * @param config Pointer to configuration structure to save
+ */
+void wordclock_save_to_nvs(const wordclock_config_t* config);
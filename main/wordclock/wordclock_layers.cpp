@@ -0,0 +1,340 @@
+#include "wordclock_layers.h"
+#include "wordclock_grid.h"
+#include "pixel_stream.h"
+#include "alloc_trace.h"
+
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "freertos/FreeRTOS.h"
+#include "kd_pixdriver.h"
+#include <string.h>
+#include <algorithm>
+
+#include "sdkconfig.h"
+
+static const char* TAG = "wordclock_layers";
+
+#ifdef CONFIG_BASE_CLOCK_TYPE_WORDCLOCK
+
+// Matches PixelDriver::initialize() in wordclock_clock_init()
+#define WORDCLOCK_FRAME_RATE 60
+
+// Letters animated at once; larger changes switch instantly
+#define WORDCLOCK_TRANSITION_MAX_LETTERS 128
+
+#define FADE_FRAMES 30          // 0.5 s crossfade
+#define RAIN_FRAMES 12          // Per-letter fade-in once its drop arrives
+#define RAIN_ROW_DELAY 3        // Frames between rows of the cascade
+
+typedef struct {
+    wordclock_mask_t mask;
+    uint32_t color;
+} wordclock_layer_t;
+
+typedef struct {
+    wordclock_layer_t layers[WORDCLOCK_LAYER_COUNT];
+    bool visible;
+} wordclock_frame_t;
+
+// Layer state, written from any task and picked up by the frame timer
+static portMUX_TYPE layers_lock = portMUX_INITIALIZER_UNLOCKED;
+static wordclock_frame_t target = { {}, true };
+static bool target_dirty = true;
+static bool reset_requested = false;
+static bool suspended = false;          // Buffer handed to a driver effect
+static wordclock_transition_t transition_style = WORDCLOCK_TRANSITION_NONE;
+
+/*
+ * Renderer
+ *
+ * In letters mode the driver runs in raw mode, so the pixel buffer only
+ * changes when the lit letters do. Everything below is owned by the frame
+ * timer callback, which is the only writer of the pixel buffer. It runs at
+ * the driver frame rate while a change is being animated and is stopped
+ * otherwise.
+ *
+ * A change is diffed against what is shown: only letters that light up, go
+ * dark or change color get a transition entry, and each frame only walks
+ * those entries. A sentence lights ~30 of the 256 letters, so a minute change
+ * touches a few dozen pixels and nothing is allocated.
+ */
+typedef struct {
+    uint8_t led;
+    uint8_t delay;      // Frames before this letter starts changing
+    uint8_t frames;     // Frames the change takes
+    uint32_t from;      // 0xRRGGBB, 0 for dark
+    uint32_t to;
+} letter_transition_t;
+
+static esp_timer_handle_t frame_timer = nullptr;
+static wordclock_frame_t shown = {};
+static letter_transition_t transitions[WORDCLOCK_TRANSITION_MAX_LETTERS];
+static size_t transition_count = 0;
+static uint16_t transition_frame = 0;
+static uint16_t transition_length = 0;
+
+static inline PixelColor to_pixel(uint32_t color) {
+    return PixelColor((color >> 16) & 0xFF, (color >> 8) & 0xFF, color & 0xFF);
+}
+
+static inline uint32_t blend(uint32_t from, uint32_t to, uint32_t t) {
+    uint32_t out = 0;
+    for (int shift = 0; shift <= 16; shift += 8) {
+        uint32_t a = (from >> shift) & 0xFF;
+        uint32_t b = (to >> shift) & 0xFF;
+        out |= ((a * (255 - t) + b * t) / 255) << shift;
+    }
+    return out;
+}
+
+// Color of a letter in a frame, topmost layer first
+static inline bool letter_color(const wordclock_frame_t& frame, size_t letter, uint32_t* color) {
+    if (!frame.visible) return false;
+    for (int layer = WORDCLOCK_LAYER_COUNT - 1; layer >= 0; layer--) {
+        if (wordclock_mask_test(frame.layers[layer].mask, letter)) {
+            *color = frame.layers[layer].color;
+            return true;
+        }
+    }
+    return false;
+}
+
+static wordclock_mask_t lit_letters(const wordclock_frame_t& frame) {
+    wordclock_mask_t mask = {};
+    if (frame.visible) {
+        for (int layer = 0; layer < WORDCLOCK_LAYER_COUNT; layer++) {
+            mask = wordclock_mask_or(mask, frame.layers[layer].mask);
+        }
+    }
+    return mask;
+}
+
+static void finish_transition(std::vector<PixelColor>& pixels) {
+    for (size_t i = 0; i < transition_count; i++) {
+        pixels[transitions[i].led] = to_pixel(transitions[i].to);
+    }
+    transition_count = 0;
+}
+
+// Queue every letter whose color differs between what is shown and the target
+static void start_transition(const wordclock_frame_t& next, wordclock_transition_t style,
+    std::vector<PixelColor>& pixels) {
+    const uint8_t* led_index = wordclock_grid_get()->tables.led_index;
+    wordclock_mask_t before = lit_letters(shown);
+    wordclock_mask_t after = lit_letters(next);
+
+    transition_count = 0;
+    transition_length = 0;
+    bool overflow = false;
+
+    for (size_t w = 0; w < WORDCLOCK_MASK_WORDS; w++) {
+        uint32_t word = before.words[w] | after.words[w];
+        while (word != 0) {
+            size_t letter = w * 32 + __builtin_ctz(word);
+            word &= word - 1;
+
+            uint32_t from = 0, to = 0;
+            bool was_lit = letter_color(shown, letter, &from);
+            bool is_lit = letter_color(next, letter, &to);
+            if (was_lit == is_lit && from == to) {
+                continue;
+            }
+
+            letter_transition_t entry = { led_index[letter], 0, 0, from, to };
+            if (style == WORDCLOCK_TRANSITION_FADE) {
+                entry.frames = FADE_FRAMES;
+            }
+            else if (style == WORDCLOCK_TRANSITION_RAIN) {
+                // Outgoing letters drain first, incoming ones fall row by row
+                // with a little per-column jitter
+                size_t row = letter / 16, col = letter % 16;
+                entry.frames = RAIN_FRAMES;
+                entry.delay = is_lit ? (uint8_t)(RAIN_FRAMES / 2 + row * RAIN_ROW_DELAY + (col * 7) % 5) : 0;
+            }
+
+            if (entry.frames == 0 || transition_count == WORDCLOCK_TRANSITION_MAX_LETTERS) {
+                overflow |= entry.frames != 0;
+                pixels[entry.led] = to_pixel(to);
+                continue;
+            }
+
+            transitions[transition_count++] = entry;
+            transition_length = std::max<uint16_t>(transition_length, entry.delay + entry.frames);
+        }
+    }
+
+    if (overflow) {
+        ESP_LOGD(TAG, "Change too large to animate, switched part of it instantly");
+    }
+    transition_frame = 0;
+}
+
+static void step_transition(std::vector<PixelColor>& pixels) {
+    transition_frame++;
+    for (size_t i = 0; i < transition_count; i++) {
+        const letter_transition_t& entry = transitions[i];
+        if (transition_frame <= entry.delay) {
+            continue;
+        }
+
+        uint32_t elapsed = transition_frame - entry.delay;
+        if (elapsed > entry.frames) {
+            continue;   // Already at its final color
+        }
+
+        uint32_t t = elapsed * 255 / entry.frames;
+        pixels[entry.led] = to_pixel(blend(entry.from, entry.to, t));
+    }
+
+    if (transition_frame >= transition_length) {
+        transition_count = 0;
+    }
+}
+
+static void frame_callback(void* arg) {
+    ALLOC_TRACE_SCOPE(ALLOC_PATH_RENDER);
+
+    // The buffer belongs to the stream; pending changes wait for the release
+    if (pixel_stream_active()) {
+        esp_timer_stop(frame_timer);
+        return;
+    }
+
+    wordclock_frame_t next = {};
+    wordclock_transition_t style;
+    bool changed, reset;
+
+    portENTER_CRITICAL(&layers_lock);
+    if (suspended) {
+        portEXIT_CRITICAL(&layers_lock);
+        esp_timer_stop(frame_timer);
+        return;
+    }
+    changed = target_dirty;
+    reset = reset_requested;
+    if (changed) {
+        next = target;
+        target_dirty = false;
+    }
+    reset_requested = false;
+    style = transition_style;
+    portEXIT_CRITICAL(&layers_lock);
+
+    std::vector<PixelColor>& pixels = PixelDriver::getMainChannel()->getPixelBuffer();
+    if (pixels.size() < WORDCLOCK_GRID_SIZE) {
+        esp_timer_stop(frame_timer);
+        return;
+    }
+
+    if (reset) {
+        std::fill(pixels.begin(), pixels.end(), PixelColor(0, 0, 0));
+        shown = {};
+        transition_count = 0;
+    }
+
+    if (changed) {
+        // A change during a transition jumps to its end first
+        finish_transition(pixels);
+        start_transition(next, style, pixels);
+        shown = next;
+    }
+
+    if (transition_count > 0) {
+        step_transition(pixels);
+        return;
+    }
+
+    // Idle; stop until the next change, then catch one that raced the stop
+    esp_timer_stop(frame_timer);
+
+    portENTER_CRITICAL(&layers_lock);
+    bool pending = target_dirty || reset_requested;
+    portEXIT_CRITICAL(&layers_lock);
+
+    if (pending) {
+        esp_timer_start_periodic(frame_timer, 1000000 / WORDCLOCK_FRAME_RATE);
+    }
+}
+
+void wordclock_layers_init(void) {
+    if (frame_timer != nullptr) {
+        return;
+    }
+
+    esp_timer_create_args_t timer_args = {
+        .callback = frame_callback,
+        .arg = nullptr,
+        .dispatch_method = ESP_TIMER_TASK,
+        .name = "wc_frames",
+        .skip_unhandled_events = true
+    };
+
+    ESP_ERROR_CHECK(esp_timer_create(&timer_args, &frame_timer));
+}
+
+void wordclock_layer_set_mask(wordclock_layer_id_t layer, const wordclock_mask_t& mask) {
+    portENTER_CRITICAL(&layers_lock);
+    if (!wordclock_mask_equal(target.layers[layer].mask, mask)) {
+        target.layers[layer].mask = mask;
+        target_dirty = true;
+    }
+    portEXIT_CRITICAL(&layers_lock);
+}
+
+void wordclock_layer_set_color(wordclock_layer_id_t layer, uint32_t color) {
+    portENTER_CRITICAL(&layers_lock);
+    if (target.layers[layer].color != color) {
+        target.layers[layer].color = color;
+        target_dirty = true;
+    }
+    portEXIT_CRITICAL(&layers_lock);
+}
+
+void wordclock_layers_set_visible(bool visible) {
+    portENTER_CRITICAL(&layers_lock);
+    if (target.visible != visible) {
+        target.visible = visible;
+        target_dirty = true;
+    }
+    portEXIT_CRITICAL(&layers_lock);
+}
+
+void wordclock_layers_set_transition(wordclock_transition_t style) {
+    portENTER_CRITICAL(&layers_lock);
+    transition_style = style < WORDCLOCK_TRANSITION_COUNT ? style : WORDCLOCK_TRANSITION_NONE;
+    portEXIT_CRITICAL(&layers_lock);
+}
+
+void wordclock_layers_reset(void) {
+    portENTER_CRITICAL(&layers_lock);
+    reset_requested = true;
+    target_dirty = true;
+    suspended = false;
+    portEXIT_CRITICAL(&layers_lock);
+}
+
+void wordclock_layers_suspend(void) {
+    portENTER_CRITICAL(&layers_lock);
+    suspended = true;
+    portEXIT_CRITICAL(&layers_lock);
+
+    // A running frame sequence stops itself on its next frame
+}
+
+void wordclock_layers_render(void) {
+    if (frame_timer == nullptr) {
+        return;
+    }
+
+    portENTER_CRITICAL(&layers_lock);
+    bool pending = !suspended && (target_dirty || reset_requested);
+    portEXIT_CRITICAL(&layers_lock);
+    if (!pending) {
+        return;
+    }
+
+    // Fails harmlessly if a frame sequence is already running
+    esp_timer_start_periodic(frame_timer, 1000000 / WORDCLOCK_FRAME_RATE);
+}
+
+#endif
@@ -0,0 +1,77 @@
+#pragma once
+
+#include <stdint.h>
+
+#include "wordclock_mask.h"
+
+// Display layers, bottom to top. A letter lit by several layers takes the
+// color of the topmost one.
+typedef enum : uint8_t {
+    WORDCLOCK_LAYER_TIME,
+    WORDCLOCK_LAYER_TEMPERATURE,
+    WORDCLOCK_LAYER_COUNT,
+} wordclock_layer_id_t;
+
+// How letters change when the display changes
+typedef enum : uint8_t {
+    WORDCLOCK_TRANSITION_NONE,      // Switch instantly
+    WORDCLOCK_TRANSITION_FADE,      // Outgoing letters fade out while incoming fade in
+    WORDCLOCK_TRANSITION_RAIN,      // Incoming letters cascade in row by row
+    WORDCLOCK_TRANSITION_COUNT,
+} wordclock_transition_t;
+
+/**
+ * @brief Create the frame timer that drives rendering
+ *
+ * Call once before the first render.
+ */
+void wordclock_layers_init(void);
+
+/**
+ * @brief Replace the letters lit by a layer
+ *
+ * Safe to call from any task; takes effect on the next render.
+ */
+void wordclock_layer_set_mask(wordclock_layer_id_t layer, const wordclock_mask_t& mask);
+
+/**
+ * @brief Set the color of a layer's letters
+ *
+ * @param color 0xRRGGBB
+ */
+void wordclock_layer_set_color(wordclock_layer_id_t layer, uint32_t color);
+
+/**
+ * @brief Show or hide every layer (clock on/off)
+ */
+void wordclock_layers_set_visible(bool visible);
+
+/**
+ * @brief Select the animation used for later changes
+ */
+void wordclock_layers_set_transition(wordclock_transition_t style);
+
+/**
+ * @brief Clear the pixel buffer and repaint from scratch
+ *
+ * Call when the driver is switched to raw mode and the buffer is ours.
+ * Ends a suspension.
+ */
+void wordclock_layers_reset(void);
+
+/**
+ * @brief Stop writing the pixel buffer until the next reset
+ *
+ * Call before handing the buffer back to a driver effect. Layer changes are
+ * still recorded and shown after the reset.
+ */
+void wordclock_layers_suspend(void);
+
+/**
+ * @brief Compose the layers into the pixel buffer
+ *
+ * Does nothing if no layer changed since the last render. Otherwise the
+ * letters that change are animated over the following frames; the call
+ * itself returns immediately.
+ */
+void wordclock_layers_render(void);
@@ -0,0 +1,43 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+// Number of letters (and LEDs) on the word clock grid
+#define WORDCLOCK_GRID_SIZE 256
+#define WORDCLOCK_MASK_WORDS (WORDCLOCK_GRID_SIZE / 32)
+
+/**
+ * @brief Packed 256-bit letter mask, one bit per grid letter
+ *
+ * Bit i (words[i / 32], bit i % 32) corresponds to letter i of the grid in
+ * reading order (row-major, top-left first).
+ */
+typedef struct {
+    uint32_t words[WORDCLOCK_MASK_WORDS];
+} wordclock_mask_t;
+
+constexpr wordclock_mask_t wordclock_mask_or(const wordclock_mask_t& a, const wordclock_mask_t& b) {
+    wordclock_mask_t out = {};
+    for (size_t i = 0; i < WORDCLOCK_MASK_WORDS; i++) {
+        out.words[i] = a.words[i] | b.words[i];
+    }
+    return out;
+}
+
+constexpr bool wordclock_mask_equal(const wordclock_mask_t& a, const wordclock_mask_t& b) {
+    for (size_t i = 0; i < WORDCLOCK_MASK_WORDS; i++) {
+        if (a.words[i] != b.words[i]) return false;
+    }
+    return true;
+}
+
+constexpr bool wordclock_mask_test(const wordclock_mask_t& mask, size_t index) {
+    return (mask.words[index / 32] >> (index % 32)) & 1u;
+}
+
+constexpr void wordclock_mask_set_span(wordclock_mask_t& mask, size_t start, size_t length) {
+    for (size_t i = start; i < start + length && i < WORDCLOCK_GRID_SIZE; i++) {
+        mask.words[i / 32] |= 1u << (i % 32);
+    }
+}
@@ -0,0 +1,191 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "wordclock_grid.h"
+
+// English 16x16 letter grid in reading order
+constexpr char wordclock_letters[] =
+"ITLISOTWENTYRONETWOETENMTHIRTEENFIVEMELEVENIFOURTHREEPNINETEENSUFOURTEENMIDNIGHTSIXTEENDEIGHTEENSEVENTEENOTWELVEHALFELQUARTEROTOPASTRONESATW"
+"OSIXTWELVETFOURAFIVESEVENMEIGHTENINETENTTHREECELEVENINOTHENAFTERNOONMORNINGSATENIGHTEVENINGCANDTCOLDCOOLETWARMURAHOT";
+
+static_assert(sizeof(wordclock_letters) - 1 == WORDCLOCK_GRID_SIZE, "Letter grid must cover every LED");
+
+/*
+ * Phrase compiler
+ *
+ * A sentence is lit by searching for each of its words in the grid, every
+ * search starting right after the previous match so that the words read in
+ * order. All of that happens here at compile time: a sentence splits into a
+ * minute part ("IT IS TWENTY FIVE PAST") and an hour part ("SEVEN IN THE
+ * EVENING"), each resolved once into a packed mask. At runtime a time is two
+ * table lookups and an OR.
+ *
+ * The result is the built-in grid layout, used when no layout image has
+ * been flashed to the grid partition.
+ */
+namespace wordclock_phrases {
+
+constexpr size_t kNotFound = SIZE_MAX;
+
+constexpr size_t word_length(const char* word) {
+    size_t len = 0;
+    while (word[len] != '\0') len++;
+    return len;
+}
+
+constexpr size_t find_word(const char* word, size_t from) {
+    size_t len = word_length(word);
+    for (size_t pos = from; pos + len <= WORDCLOCK_GRID_SIZE; pos++) {
+        size_t i = 0;
+        while (i < len && wordclock_letters[pos + i] == word[i]) i++;
+        if (i == len) return pos;
+    }
+    return kNotFound;
+}
+
+struct phrase_t {
+    wordclock_mask_t mask;
+    size_t cursor;   // Grid index right after the last matched word
+    bool complete;   // False if any word could not be placed in order
+};
+
+constexpr void append(phrase_t& phrase, const char* word) {
+    if (!phrase.complete) return;
+
+    size_t pos = find_word(word, phrase.cursor);
+    if (pos == kNotFound) {
+        phrase.complete = false;
+        return;
+    }
+
+    size_t len = word_length(word);
+    wordclock_mask_set_span(phrase.mask, pos, len);
+    phrase.cursor = pos + len;
+}
+
+constexpr const char* kNumbers[] = {
+    "TWELVE", "ONE", "TWO", "THREE", "FOUR", "FIVE", "SIX", "SEVEN", "EIGHT", "NINE",
+    "TEN", "ELEVEN", "TWELVE", "THIRTEEN", "FOURTEEN", "QUARTER", "SIXTEEN", "SEVENTEEN", "EIGHTEEN", "NINETEEN",
+};
+
+constexpr wordclock_connector_t connector_for(int minute) {
+    if (minute == 0) return WORDCLOCK_CONNECTOR_NONE;
+    return minute > 30 ? WORDCLOCK_CONNECTOR_TO : WORDCLOCK_CONNECTOR_PAST;
+}
+
+// "IT IS [minutes] [PAST|TO]"
+constexpr phrase_t compile_minute(int minute) {
+    phrase_t phrase = { {}, 0, true };
+    append(phrase, "IT");
+    append(phrase, "IS");
+
+    wordclock_connector_t connector = connector_for(minute);
+    if (connector == WORDCLOCK_CONNECTOR_NONE) return phrase;
+
+    int count = connector == WORDCLOCK_CONNECTOR_TO ? 60 - minute : minute;
+    if (count == 30) {
+        append(phrase, "HALF");
+    }
+    else if (count >= 20) {
+        append(phrase, "TWENTY");
+        if (count % 10 != 0) append(phrase, kNumbers[count % 10]);
+    }
+    else {
+        if (count == 15) append(phrase, "A");
+        append(phrase, kNumbers[count]);
+    }
+
+    append(phrase, connector == WORDCLOCK_CONNECTOR_TO ? "TO" : "PAST");
+    return phrase;
+}
+
+// "[hour] [IN THE MORNING|...|AT NIGHT]", searched from the given cursor
+constexpr phrase_t compile_hour(size_t cursor, int hour) {
+    phrase_t phrase = { {}, cursor, true };
+    append(phrase, kNumbers[hour % 12]);
+
+    if (hour < 5 || hour >= 21) {
+        append(phrase, "AT");
+        append(phrase, "NIGHT");
+    }
+    else {
+        append(phrase, "IN");
+        append(phrase, "THE");
+        append(phrase, hour < 12 ? "MORNING" : hour < 17 ? "AFTERNOON" : "EVENING");
+    }
+    return phrase;
+}
+
+struct compiled_t {
+    wordclock_grid_tables_t tables;
+    bool valid;
+};
+
+constexpr compiled_t compile_table() {
+    compiled_t compiled = {};
+    wordclock_grid_tables_t& table = compiled.tables;
+    compiled.valid = true;
+
+    phrase_t midnight = compile_minute(0);
+    append(midnight, "MIDNIGHT");
+    table.midnight = midnight.mask;
+    compiled.valid &= midnight.complete;
+
+    // The hour part may only depend on the connector, so every minute that
+    // shares a connector must leave the search cursor at the same place
+    size_t cursors[WORDCLOCK_CONNECTOR_COUNT] = { kNotFound, kNotFound, kNotFound };
+    for (int minute = 0; minute < 60; minute++) {
+        phrase_t phrase = compile_minute(minute);
+        wordclock_connector_t connector = connector_for(minute);
+
+        table.minutes[minute] = phrase.mask;
+        table.connectors[minute] = connector;
+        compiled.valid &= phrase.complete;
+
+        if (cursors[connector] == kNotFound) {
+            cursors[connector] = phrase.cursor;
+        }
+        compiled.valid &= cursors[connector] == phrase.cursor;
+    }
+
+    for (int connector = 0; connector < WORDCLOCK_CONNECTOR_COUNT; connector++) {
+        for (int hour = 0; hour < 24; hour++) {
+            phrase_t phrase = compile_hour(cursors[connector], hour);
+            table.hours[connector][hour] = phrase.mask;
+            compiled.valid &= phrase.complete;
+        }
+    }
+
+    // Built-in panel is wired in reading order
+    for (size_t i = 0; i < WORDCLOCK_GRID_SIZE; i++) {
+        table.led_index[i] = (uint8_t)i;
+        table.letters[i] = wordclock_letters[i];
+    }
+
+    return compiled;
+}
+
+inline constexpr compiled_t kCompiled = compile_table();
+
+static_assert(kCompiled.valid, "Every wordclock phrase must be readable in order on the letter grid");
+
+}  // namespace wordclock_phrases
+
+// English 16x16 layout compiled into the firmware
+inline constexpr wordclock_grid_layout_t wordclock_builtin_layout = {
+    "en_16x16",
+    wordclock_phrases::kCompiled.tables,
+};
+
+/**
+ * @brief Get the lit letters for a time of day on the built-in layout
+ *
+ * @param hour 0-23
+ * @param minute 0-59
+ * @return Packed mask of the letters spelling out the time
+ */
+constexpr wordclock_mask_t wordclock_phrase_mask(int hour, int minute) {
+    return wordclock_grid_mask(wordclock_builtin_layout.tables, hour, minute);
+}
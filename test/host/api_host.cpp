@@ -0,0 +1,52 @@
+/*
+ * What api.cpp reaches in modules the static file bench does not build: no
+ * uploaded web UI bundle, no other endpoints, an idle worker pool and no
+ * settings domains.
+ */
+#include <string.h>
+
+#include "async_worker.h"
+#include "config_batch.h"
+#include "mem_policy.h"
+#include "settings_store.h"
+#include "state_ws.h"
+#include "webui_bundle.h"
+
+void webui_bundle_init(void) {
+}
+
+bool webui_bundle_active(void) {
+    return false;
+}
+
+bool webui_bundle_find(const char* path, size_t len, webui_bundle_file_t* file) {
+    return false;
+}
+
+void register_webui_bundle_handlers(httpd_handle_t server) {
+}
+
+void register_state_ws_handlers(httpd_handle_t server) {
+}
+
+void register_config_batch_handlers(httpd_handle_t server) {
+}
+
+void async_worker_init(void) {
+}
+
+void async_worker_get_stats(async_worker_stats_t* stats) {
+    memset(stats, 0, sizeof(*stats));
+}
+
+void mem_get_usage(mem_subsystem_t subsystem, mem_usage_t* usage) {
+    memset(usage, 0, sizeof(*usage));
+}
+
+const char* mem_subsystem_name(mem_subsystem_t subsystem) {
+    return "host";
+}
+
+size_t settings_store_get_stats(settings_domain_stats_t* stats, size_t max) {
+    return 0;
+}
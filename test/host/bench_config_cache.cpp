@@ -0,0 +1,200 @@
+/*
+ * Polling GET /api/fibonacci, before and after the config body cache:
+ *
+ * - uncached: the handler as it was, opening NVS for the config and
+ *   writing the body with the theme list on every GET
+ * - cached: config_cache.cpp resending the body built for the current
+ *   generation
+ * - conditional: the same, with If-None-Match set to the ETag of the last
+ *   response, as a browser revalidating
+ * - cached, changed every 10th: the config changes every tenth GET
+ *
+ * It reports the response, the bytes written to the socket, the body
+ * builds and NVS reads per GET, and the time per GET. The host NVS is in
+ * memory, so the time of an NVS read on the device is not in the numbers,
+ * only the count; times are host numbers, compare the rows, not the
+ * absolute values, with the device.
+ */
+#include <chrono>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "config_cache.h"
+#include "esp_http_server.h"
+#include "idf_host.h"
+#include "json_writer.h"
+#include "mem_policy.h"
+#include "nvs.h"
+#include "themes.h"
+
+#define GETS 100000
+#define CHANGE_EVERY 10
+#define FIBONACCI_NVS_NAMESPACE "fib_cfg"
+
+// The built-in themes, as in fibonacci.cpp
+static const fibonacci_colorTheme colors[] = {
+    { 0, "RGB",     0xFF0A0A, 0x0AFF0A, 0x0A0AFF },
+    { 1, "Mondrian",0xFF0A0A, 0xF8DE00, 0x0A0AFF },
+    { 2, "Basbrun", 0x502800, 0x14C814, 0xFF640A },
+    { 3, "80's",    0xF564C9, 0x72F736, 0x71EBDC },
+    { 4, "Pastel",  0xFF7B7B, 0x8FFF70, 0x7878FF },
+    { 5, "Modern",  0xD4312D, 0x91D231, 0x8D5FE0 },
+    { 6, "Cold",    0xD13EC8, 0x45E8E0, 0x5046CA },
+    { 7, "Warm",    0xED1414, 0xF6F336, 0xFF7E15 },
+    { 8, "Earth",   0x462300, 0x467A0A, 0xC8B600 },
+    { 9, "Dark",    0xD32222, 0x50974E, 0x101895 },
+};
+
+#define THEMES_COUNT (sizeof(colors) / sizeof(colors[0]))
+
+typedef struct {
+    uint8_t brightness;
+    uint8_t theme_id;
+    bool on;
+} fibonacci_config_t;
+
+static fibonacci_config_t fib_config = { 255, 0, true };
+static size_t body_builds = 0;
+static size_t nvs_reads = 0;
+
+void* mem_alloc(mem_subsystem_t subsystem, size_t size) {
+    return malloc(size);
+}
+
+void mem_free(mem_subsystem_t subsystem, void* ptr) {
+    free(ptr);
+}
+
+static void write_fibonacci_state_json(json_writer_t* writer, const fibonacci_config_t* config) {
+    json_object_begin(writer);
+    json_kv_int(writer, "brightness", config->brightness);
+    json_kv_int(writer, "theme_id", config->theme_id);
+    json_kv_bool(writer, "on", config->on);
+
+    json_key(writer, "themes");
+    json_array_begin(writer);
+    for (size_t i = 0; i < THEMES_COUNT; i++) {
+        const fibonacci_colorTheme* theme = &colors[i];
+        json_object_begin(writer);
+        json_kv_int(writer, "id", theme->id);
+        json_kv_string(writer, "name", theme->name);
+        json_kv_color(writer, "hour_color", theme->hour_color);
+        json_kv_color(writer, "minute_color", theme->minute_color);
+        json_kv_color(writer, "both_color", theme->both_color);
+        json_object_end(writer);
+    }
+    json_array_end(writer);
+
+    json_object_end(writer);
+}
+
+// The handler before the cache: the config from NVS, then the whole body
+static void fibonacci_load_from_nvs(fibonacci_config_t* config) {
+    nvs_handle_t nvs_handle;
+    *config = { 255, 0, true };
+    if (nvs_open(FIBONACCI_NVS_NAMESPACE, NVS_READONLY, &nvs_handle) != ESP_OK) {
+        return;
+    }
+    size_t required_size = sizeof(fibonacci_config_t);
+    nvs_get_blob(nvs_handle, "config", config, &required_size);
+    nvs_close(nvs_handle);
+    nvs_reads++;
+}
+
+static esp_err_t uncached_get_handler(httpd_req_t* req) {
+    fibonacci_config_t config;
+    fibonacci_load_from_nvs(&config);
+
+    char buf[1152];
+    json_writer_t writer;
+    json_writer_init(&writer, buf, sizeof(buf), NULL);
+    write_fibonacci_state_json(&writer, &config);
+    if (json_writer_finish(&writer) != ESP_OK) {
+        httpd_resp_send_500(req);
+        return ESP_FAIL;
+    }
+    body_builds++;
+
+    httpd_resp_set_type(req, "application/json");
+    return httpd_resp_send(req, buf, writer.len);
+}
+
+// The handler with the cache, as in fibonacci_handlers.cpp
+static size_t build_fibonacci_json(uint8_t* buf, size_t size) {
+    json_writer_t writer;
+    json_writer_init(&writer, (char*)buf, size, NULL);
+    write_fibonacci_state_json(&writer, &fib_config);
+    body_builds++;
+    return json_writer_finish(&writer) == ESP_OK ? writer.len : 0;
+}
+
+static config_domain_t fibonacci_domain = CONFIG_DOMAIN("fibonacci");
+static config_body_t fibonacci_json_body = CONFIG_BODY(&fibonacci_domain, "json", "application/json", build_fibonacci_json, 1152);
+
+static esp_err_t cached_get_handler(httpd_req_t* req) {
+    return config_body_send(req, &fibonacci_json_body);
+}
+
+typedef enum {
+    POLL_UNCACHED,
+    POLL_CACHED,
+    POLL_CONDITIONAL,
+    POLL_CHANGING,
+} poll_t;
+
+static void measure(const char* name, poll_t poll) {
+    // Owned by the server on the device, not the handler's stack
+    static httpd_req_t req;
+    static char headers[96];
+    headers[0] = '\0';
+
+    // A first GET, for the ETag a browser would send back
+    host_request_init(&req, "/api/fibonacci", NULL);
+    cached_get_handler(&req);
+    if (poll == POLL_CONDITIONAL) {
+        snprintf(headers, sizeof(headers), "If-None-Match: %s\r\n", fibonacci_json_body.etag);
+    }
+
+    body_builds = 0;
+    nvs_reads = 0;
+    size_t wire_bytes = 0;
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < GETS; i++) {
+        if (poll == POLL_CHANGING && i % CHANGE_EVERY == 0) {
+            fib_config.brightness = (uint8_t)i;
+            config_domain_changed(&fibonacci_domain);
+        }
+        host_request_init(&req, "/api/fibonacci", NULL);
+        req.headers = headers;
+        if (poll == POLL_UNCACHED) {
+            uncached_get_handler(&req);
+        }
+        else {
+            cached_get_handler(&req);
+        }
+        wire_bytes += req.wire_bytes;
+    }
+    double ns = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+
+    printf("%-28s %-18s %10.0f %10.2f %10.2f %10.0f\n", name, req.status, (double)wire_bytes / GETS,
+        (double)body_builds / GETS, (double)nvs_reads / GETS, ns / GETS);
+}
+
+int main() {
+    // The stored config the old handler read back on every GET
+    nvs_handle_t nvs_handle;
+    nvs_open(FIBONACCI_NVS_NAMESPACE, NVS_READWRITE, &nvs_handle);
+    nvs_set_blob(nvs_handle, "config", &fib_config, sizeof(fib_config));
+    nvs_commit(nvs_handle);
+    nvs_close(nvs_handle);
+
+    printf("%d GETs of GET /api/fibonacci each\n\n", GETS);
+    printf("%-28s %-18s %10s %10s %10s %10s\n", "", "response", "wire B", "builds", "NVS reads", "ns/GET");
+    printf("%-28s %-18s %10s %10s %10s %10s\n", "", "", "per GET", "per GET", "per GET", "");
+    measure("uncached", POLL_UNCACHED);
+    measure("cached", POLL_CACHED);
+    measure("conditional", POLL_CONDITIONAL);
+    measure("cached, changed every 10th", POLL_CHANGING);
+    return 0;
+}
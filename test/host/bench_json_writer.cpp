@@ -0,0 +1,482 @@
+/*
+ * GET /api/nixie and /api/fibonacci bodies, before and after the JSON
+ * writer:
+ *
+ * - cJSON: the handlers as they were, building a tree and rendering it
+ *   with cJSON_Print()
+ * - writer: the same documents through json_writer.cpp into a buffer, and
+ *   for fibonacci also streamed as chunks from a 256 byte stack buffer
+ *
+ * cJSON's sources are not part of the host build, so the tree below is a
+ * stand-in that allocates as cJSON 1.7 does: a node per value, a copy of
+ * every key and string value, and a print buffer of 256 bytes that is
+ * grown to twice the size needed and trimmed at the end, all with the
+ * default malloc/realloc hooks. It prints the same formatted text. Node
+ * sizes are the host's; on the ESP32 a node is 40 bytes.
+ *
+ * It reports the body size, heap calls and the most heap held at once per
+ * GET, and the time per GET. Times are host numbers; compare the rows, not
+ * the absolute values, with the device.
+ */
+#include <chrono>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "esp_http_server.h"
+#include "idf_host.h"
+#include "json_writer.h"
+#include "themes.h"
+
+#define GETS 100000
+
+// The built-in themes, as in fibonacci.cpp
+static const fibonacci_colorTheme colors[] = {
+    { 0, "RGB",     0xFF0A0A, 0x0AFF0A, 0x0A0AFF },
+    { 1, "Mondrian",0xFF0A0A, 0xF8DE00, 0x0A0AFF },
+    { 2, "Basbrun", 0x502800, 0x14C814, 0xFF640A },
+    { 3, "80's",    0xF564C9, 0x72F736, 0x71EBDC },
+    { 4, "Pastel",  0xFF7B7B, 0x8FFF70, 0x7878FF },
+    { 5, "Modern",  0xD4312D, 0x91D231, 0x8D5FE0 },
+    { 6, "Cold",    0xD13EC8, 0x45E8E0, 0x5046CA },
+    { 7, "Warm",    0xED1414, 0xF6F336, 0xFF7E15 },
+    { 8, "Earth",   0x462300, 0x467A0A, 0xC8B600 },
+    { 9, "Dark",    0xD32222, 0x50974E, 0x101895 },
+};
+
+#define THEMES_COUNT (sizeof(colors) / sizeof(colors[0]))
+
+// Heap use while counting is on
+static bool counting = false;
+static size_t heap_calls = 0;
+static size_t heap_live = 0;
+static size_t heap_peak = 0;
+
+extern "C" {
+void* __libc_malloc(size_t size);
+void* __libc_realloc(void* ptr, size_t size);
+void __libc_free(void* ptr);
+size_t malloc_usable_size(void* ptr);
+
+static void count_alloc(void* ptr) {
+    if (counting && ptr != NULL) {
+        heap_calls++;
+        heap_live += malloc_usable_size(ptr);
+        heap_peak = heap_live > heap_peak ? heap_live : heap_peak;
+    }
+}
+
+void* malloc(size_t size) {
+    void* ptr = __libc_malloc(size);
+    count_alloc(ptr);
+    return ptr;
+}
+
+void* realloc(void* ptr, size_t size) {
+    if (counting && ptr != NULL) {
+        heap_live -= malloc_usable_size(ptr);
+    }
+    void* moved = __libc_realloc(ptr, size);
+    count_alloc(moved);
+    return moved;
+}
+
+void free(void* ptr) {
+    if (counting && ptr != NULL) {
+        heap_live -= malloc_usable_size(ptr);
+    }
+    __libc_free(ptr);
+}
+}
+
+// cJSON 1.7's item, allocations and formatted printing, in as much as the
+// handlers used them
+#define cJSON_False  (1 << 0)
+#define cJSON_True   (1 << 1)
+#define cJSON_Number (1 << 3)
+#define cJSON_String (1 << 4)
+#define cJSON_Array  (1 << 5)
+#define cJSON_Object (1 << 6)
+
+typedef struct cJSON {
+    struct cJSON* next;
+    struct cJSON* prev;
+    struct cJSON* child;
+    int type;
+    char* valuestring;
+    int valueint;
+    double valuedouble;
+    char* string;
+} cJSON;
+
+static char* cJSON_strdup(const char* string) {
+    size_t length = strlen(string) + 1;
+    char* copy = (char*)malloc(length);
+    if (copy != NULL) {
+        memcpy(copy, string, length);
+    }
+    return copy;
+}
+
+static cJSON* cJSON_New_Item(int type) {
+    cJSON* item = (cJSON*)malloc(sizeof(cJSON));
+    if (item != NULL) {
+        memset(item, 0, sizeof(cJSON));
+        item->type = type;
+    }
+    return item;
+}
+
+static cJSON* cJSON_CreateObject(void) {
+    return cJSON_New_Item(cJSON_Object);
+}
+
+static cJSON* cJSON_CreateArray(void) {
+    return cJSON_New_Item(cJSON_Array);
+}
+
+static cJSON* cJSON_CreateBool(bool value) {
+    return cJSON_New_Item(value ? cJSON_True : cJSON_False);
+}
+
+static cJSON* cJSON_CreateNumber(double number) {
+    cJSON* item = cJSON_New_Item(cJSON_Number);
+    if (item != NULL) {
+        item->valuedouble = number;
+        item->valueint = (int)number;
+    }
+    return item;
+}
+
+static cJSON* cJSON_CreateString(const char* string) {
+    cJSON* item = cJSON_New_Item(cJSON_String);
+    if (item != NULL) {
+        item->valuestring = cJSON_strdup(string);
+    }
+    return item;
+}
+
+static void cJSON_AddItemToArray(cJSON* array, cJSON* item) {
+    if (array->child == NULL) {
+        array->child = item;
+        item->prev = item;
+    }
+    else {
+        cJSON* last = array->child->prev;
+        last->next = item;
+        item->prev = last;
+        array->child->prev = item;
+    }
+}
+
+static void cJSON_AddItemToObject(cJSON* object, const char* string, cJSON* item) {
+    item->string = cJSON_strdup(string);
+    cJSON_AddItemToArray(object, item);
+}
+
+static void cJSON_Delete(cJSON* item) {
+    while (item != NULL) {
+        cJSON* next = item->next;
+        cJSON_Delete(item->child);
+        free(item->valuestring);
+        free(item->string);
+        free(item);
+        item = next;
+    }
+}
+
+typedef struct {
+    char* buffer;
+    size_t length;
+    size_t offset;
+    size_t depth;
+} printbuffer;
+
+static char* ensure(printbuffer* p, size_t needed) {
+    needed += p->offset + 1;
+    if (needed <= p->length) {
+        return p->buffer + p->offset;
+    }
+    size_t newsize = needed * 2;
+    char* newbuffer = (char*)realloc(p->buffer, newsize);
+    if (newbuffer == NULL) {
+        return NULL;
+    }
+    p->length = newsize;
+    p->buffer = newbuffer;
+    return p->buffer + p->offset;
+}
+
+static bool print_text(printbuffer* p, const char* text) {
+    size_t length = strlen(text);
+    char* out = ensure(p, length);
+    if (out == NULL) {
+        return false;
+    }
+    memcpy(out, text, length + 1);
+    p->offset += length;
+    return true;
+}
+
+static bool print_number(const cJSON* item, printbuffer* p) {
+    char number[26];
+    if (item->valuedouble == (double)item->valueint) {
+        snprintf(number, sizeof(number), "%d", item->valueint);
+    }
+    else {
+        snprintf(number, sizeof(number), "%1.15g", item->valuedouble);
+    }
+    return print_text(p, number);
+}
+
+// The handlers' strings need no escapes
+static bool print_string(const char* string, printbuffer* p) {
+    char* out = ensure(p, strlen(string) + sizeof("\"\""));
+    if (out == NULL) {
+        return false;
+    }
+    p->offset += sprintf(out, "\"%s\"", string);
+    return true;
+}
+
+static bool print_value(const cJSON* item, printbuffer* p);
+
+static bool print_array(const cJSON* item, printbuffer* p) {
+    if (!print_text(p, "[")) {
+        return false;
+    }
+    p->depth++;
+    for (const cJSON* child = item->child; child != NULL; child = child->next) {
+        if (!print_value(child, p) || (child->next != NULL && !print_text(p, ", "))) {
+            return false;
+        }
+    }
+    p->depth--;
+    return print_text(p, "]");
+}
+
+static bool print_object(const cJSON* item, printbuffer* p) {
+    if (!print_text(p, "{\n")) {
+        return false;
+    }
+    p->depth++;
+    for (const cJSON* child = item->child; child != NULL; child = child->next) {
+        char* out = ensure(p, p->depth);
+        if (out == NULL) {
+            return false;
+        }
+        memset(out, '\t', p->depth);
+        p->offset += p->depth;
+        if (!print_string(child->string, p) || !print_text(p, ":\t") || !print_value(child, p) ||
+            !print_text(p, child->next != NULL ? ",\n" : "\n")) {
+            return false;
+        }
+    }
+    char* out = ensure(p, p->depth + 1);
+    if (out == NULL) {
+        return false;
+    }
+    memset(out, '\t', p->depth - 1);
+    p->offset += p->depth - 1;
+    p->depth--;
+    return print_text(p, "}");
+}
+
+static bool print_value(const cJSON* item, printbuffer* p) {
+    switch (item->type) {
+    case cJSON_False:
+        return print_text(p, "false");
+    case cJSON_True:
+        return print_text(p, "true");
+    case cJSON_Number:
+        return print_number(item, p);
+    case cJSON_String:
+        return print_string(item->valuestring, p);
+    case cJSON_Array:
+        return print_array(item, p);
+    default:
+        return print_object(item, p);
+    }
+}
+
+static char* cJSON_Print(const cJSON* item) {
+    printbuffer p = { (char*)malloc(256), 256, 0, 0 };
+    if (p.buffer == NULL) {
+        return NULL;
+    }
+    if (!print_value(item, &p)) {
+        free(p.buffer);
+        return NULL;
+    }
+    return (char*)realloc(p.buffer, p.offset + 1);
+}
+
+// The handlers' documents, as they were built for cJSON
+static cJSON* create_nixie_state_json(void) {
+    cJSON* json = cJSON_CreateObject();
+    if (json == NULL) {
+        return NULL;
+    }
+
+    cJSON* brightness_json = cJSON_CreateNumber(80);
+    cJSON* military_time_json = cJSON_CreateBool(false);
+    cJSON* blinking_dots_json = cJSON_CreateBool(true);
+    cJSON* on_json = cJSON_CreateBool(true);
+
+    cJSON_AddItemToObject(json, "brightness", brightness_json);
+    cJSON_AddItemToObject(json, "military_time", military_time_json);
+    cJSON_AddItemToObject(json, "blinking_dots", blinking_dots_json);
+    cJSON_AddItemToObject(json, "on", on_json);
+
+    return json;
+}
+
+static cJSON* create_fibonacci_state_json(void) {
+    cJSON* json = cJSON_CreateObject();
+    if (json == NULL) {
+        return NULL;
+    }
+
+    cJSON* brightness_json = cJSON_CreateNumber(255);
+    cJSON* theme_id_json = cJSON_CreateNumber(0);
+    cJSON* on_json = cJSON_CreateBool(true);
+
+    // Add theme information
+    cJSON* themes_array = cJSON_CreateArray();
+    for (size_t i = 0; i < THEMES_COUNT; i++) {
+        const fibonacci_colorTheme* theme = &colors[i];
+        cJSON* theme_obj = cJSON_CreateObject();
+        cJSON_AddItemToObject(theme_obj, "id", cJSON_CreateNumber(theme->id));
+        cJSON_AddItemToObject(theme_obj, "name", cJSON_CreateString(theme->name));
+
+        // Convert colors to hex strings
+        char hour_color_str[8], minute_color_str[8], both_color_str[8];
+        snprintf(hour_color_str, sizeof(hour_color_str), "#%06X", (unsigned int)theme->hour_color);
+        snprintf(minute_color_str, sizeof(minute_color_str), "#%06X", (unsigned int)theme->minute_color);
+        snprintf(both_color_str, sizeof(both_color_str), "#%06X", (unsigned int)theme->both_color);
+
+        cJSON_AddItemToObject(theme_obj, "hour_color", cJSON_CreateString(hour_color_str));
+        cJSON_AddItemToObject(theme_obj, "minute_color", cJSON_CreateString(minute_color_str));
+        cJSON_AddItemToObject(theme_obj, "both_color", cJSON_CreateString(both_color_str));
+
+        cJSON_AddItemToArray(themes_array, theme_obj);
+    }
+
+    cJSON_AddItemToObject(json, "brightness", brightness_json);
+    cJSON_AddItemToObject(json, "theme_id", theme_id_json);
+    cJSON_AddItemToObject(json, "on", on_json);
+    cJSON_AddItemToObject(json, "themes", themes_array);
+
+    return json;
+}
+
+// The same documents through the writer, as the handlers write them now
+static void write_nixie_state_json(json_writer_t* writer) {
+    json_object_begin(writer);
+    json_kv_int(writer, "brightness", 80);
+    json_kv_bool(writer, "military_time", false);
+    json_kv_bool(writer, "blinking_dots", true);
+    json_kv_bool(writer, "on", true);
+    json_object_end(writer);
+}
+
+static void write_fibonacci_state_json(json_writer_t* writer) {
+    json_object_begin(writer);
+    json_kv_int(writer, "brightness", 255);
+    json_kv_int(writer, "theme_id", 0);
+    json_kv_bool(writer, "on", true);
+
+    json_key(writer, "themes");
+    json_array_begin(writer);
+    for (size_t i = 0; i < THEMES_COUNT; i++) {
+        const fibonacci_colorTheme* theme = &colors[i];
+        json_object_begin(writer);
+        json_kv_int(writer, "id", theme->id);
+        json_kv_string(writer, "name", theme->name);
+        json_kv_color(writer, "hour_color", theme->hour_color);
+        json_kv_color(writer, "minute_color", theme->minute_color);
+        json_kv_color(writer, "both_color", theme->both_color);
+        json_object_end(writer);
+    }
+    json_array_end(writer);
+
+    json_object_end(writer);
+}
+
+typedef enum {
+    PATH_CJSON,
+    PATH_WRITER,
+    PATH_WRITER_CHUNKED,
+} body_path_t;
+
+typedef struct {
+    size_t bytes;
+    size_t chunks;
+} body_t;
+
+// One GET body; the response itself is not part of the measurement
+static body_t get_body(body_path_t path, cJSON* (*create)(void), void (*write)(json_writer_t* writer),
+    httpd_req_t* req) {
+    body_t body = {};
+    if (path == PATH_CJSON) {
+        cJSON* json = create();
+        char* json_string = cJSON_Print(json);
+        body.bytes = strlen(json_string);
+        free(json_string);
+        cJSON_Delete(json);
+    }
+    else if (path == PATH_WRITER) {
+        char buf[1152];
+        json_writer_t writer;
+        json_writer_init(&writer, buf, sizeof(buf), NULL);
+        write(&writer);
+        json_writer_finish(&writer);
+        body.bytes = writer.len;
+    }
+    else {
+        char buf[256];
+        host_request_init(req, "/api/fibonacci", NULL);
+        json_writer_t writer;
+        json_writer_init(&writer, buf, sizeof(buf), req);
+        write(&writer);
+        json_writer_finish(&writer);
+        body.bytes = req->response_len;
+        body.chunks = req->chunks;
+    }
+    return body;
+}
+
+static void measure(const char* name, body_path_t path, cJSON* (*create)(void),
+    void (*write)(json_writer_t* writer)) {
+    static httpd_req_t req;
+
+    heap_calls = 0;
+    heap_live = 0;
+    heap_peak = 0;
+    counting = true;
+    body_t body = get_body(path, create, write, &req);
+    counting = false;
+
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < GETS; i++) {
+        get_body(path, create, write, &req);
+    }
+    double ns = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+
+    char chunks[16] = "-";
+    if (body.chunks > 0) {
+        snprintf(chunks, sizeof(chunks), "%zu", body.chunks);
+    }
+    printf("%-28s %7zu %7s %10zu %10zu %10.0f\n", name, body.bytes, chunks, heap_calls, heap_peak, ns / GETS);
+}
+
+int main() {
+    printf("%-28s %7s %7s %10s %10s %10s\n", "", "body", "chunks", "heap", "heap", "ns/GET");
+    printf("%-28s %7s %7s %10s %10s %10s\n", "", "bytes", "", "calls", "peak (B)", "");
+    measure("nixie, cJSON", PATH_CJSON, create_nixie_state_json, NULL);
+    measure("nixie, writer", PATH_WRITER, NULL, write_nixie_state_json);
+    measure("fibonacci, cJSON", PATH_CJSON, create_fibonacci_state_json, NULL);
+    measure("fibonacci, writer", PATH_WRITER, NULL, write_fibonacci_state_json);
+    measure("fibonacci, writer chunked", PATH_WRITER_CHUNKED, NULL, write_fibonacci_state_json);
+    return 0;
+}
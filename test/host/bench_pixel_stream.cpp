@@ -0,0 +1,253 @@
+/*
+ * /api/ws/pixels against senders faster and slower than the display: how
+ * many frames are applied and dropped, how long a frame waits between
+ * reaching the device and being applied, and whether the sender's last frame is the one left
+ * showing.
+ *
+ * pixel_stream.cpp runs as on the device, on simulated time. The client
+ * writes frames of 256 RGB pixels at a fixed rate into a socketpair whose
+ * send buffer stands in for lwIP's 11520 byte receive window; when the
+ * window is full the sender waits, as TCP would make it. Receiving and
+ * applying a frame costs the handler a fixed time per frame, during which
+ * the sender keeps writing. On the socket a frame is a 2-byte length and
+ * the payload: the WebSocket framing and unmasking esp_http_server does
+ * are left out.
+ *
+ * Everything is simulated, so the numbers repeat from run to run; the
+ * per-frame cost is a parameter, not a device measurement.
+ */
+#include <algorithm>
+#include <errno.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/select.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#include <vector>
+
+#include "esp_timer.h"
+#include "idf_host.h"
+#include "kd_pixdriver.h"
+#include "mem_policy.h"
+#include "pixel_stream.h"
+
+#define PIXELS 256
+#define FRAME_LEN (PIXEL_STREAM_HEADER_SIZE + PIXELS * 3)
+#define RECEIVE_WINDOW 11520
+
+typedef struct {
+    const char* name;
+    int send_fps;
+    int frame_cost_us;          // Receiving and applying one frame on the httpd task
+    int seconds;
+} stream_case_t;
+
+static const stream_case_t cases[] = {
+    { "60 fps, 200 us per frame", 60, 200, 10 },
+    { "30 fps, 200 us per frame", 30, 200, 10 },
+    { "120 fps, 10 ms per frame", 120, 10000, 10 },
+    { "1000 fps, 2 ms per frame", 1000, 2000, 10 },
+};
+
+// The stream under way
+static int server_fd = -1;
+static int client_fd = -1;
+static int64_t stream_start = 0;
+static int64_t now = 0;
+static const stream_case_t* current = NULL;
+static int frames_to_send = 0;
+static int frames_written = 0;
+static size_t frame_offset = 0;         // Bytes of the next frame already written
+static std::vector<int64_t> written_at; // When each frame was all in the window
+
+void* mem_alloc(mem_subsystem_t subsystem, size_t size) {
+    return malloc(size);
+}
+
+void mem_free(mem_subsystem_t subsystem, void* ptr) {
+    free(ptr);
+}
+
+// Frame i: pixel 0 carries the frame number, the rest a shade of it
+static void build_frame(int i, uint8_t* frame) {
+    uint16_t len = FRAME_LEN;
+    memcpy(frame, &len, sizeof(len));
+    uint8_t* header = frame + sizeof(len);
+    header[0] = 3;
+    header[1] = 0;
+    header[2] = 0;
+    header[3] = 0;
+    uint8_t* data = header + PIXEL_STREAM_HEADER_SIZE;
+    memset(data, (uint8_t)i, PIXELS * 3);
+    data[0] = (uint8_t)i;
+    data[1] = (uint8_t)(i >> 8);
+    data[2] = 0xff;
+}
+
+static int64_t send_time(int i) {
+    return stream_start + (int64_t)i * 1000000 / current->send_fps;
+}
+
+// Helper function to write every frame due by now that the window takes
+static void deliver(void) {
+    static uint8_t frame[sizeof(uint16_t) + FRAME_LEN];
+    while (frames_written < frames_to_send && send_time(frames_written) <= now) {
+        build_frame(frames_written, frame);
+        ssize_t n = send(client_fd, frame + frame_offset, sizeof(frame) - frame_offset, MSG_DONTWAIT);
+        if (n <= 0) {
+            return;
+        }
+        frame_offset += (size_t)n;
+        if (frame_offset == sizeof(frame)) {
+            frame_offset = 0;
+            written_at[frames_written++] = now;
+        }
+    }
+}
+
+// Helper function to read exactly len bytes, letting the sender fill the
+// window as it drains
+static bool read_exact(uint8_t* buf, size_t len) {
+    size_t got = 0;
+    while (got < len) {
+        ssize_t n = recv(server_fd, buf + got, len - got, MSG_DONTWAIT);
+        if (n > 0) {
+            got += (size_t)n;
+        }
+        else if (n < 0 && errno == EAGAIN) {
+            int before = frames_written;
+            size_t offset = frame_offset;
+            deliver();
+            if (frames_written == before && frame_offset == offset) {
+                return false;
+            }
+        }
+        else {
+            return false;
+        }
+    }
+    return true;
+}
+
+esp_err_t httpd_ws_recv_frame(httpd_req_t* req, httpd_ws_frame_t* frame, size_t max_len) {
+    frame->type = HTTPD_WS_TYPE_BINARY;
+    if (max_len == 0) {
+        uint16_t len;
+        if (!read_exact((uint8_t*)&len, sizeof(len))) {
+            return ESP_FAIL;
+        }
+        frame->len = len;
+        return ESP_OK;
+    }
+    if (!read_exact(frame->payload, frame->len)) {
+        return ESP_FAIL;
+    }
+
+    // The sender keeps writing while the frame is handled
+    now += current->frame_cost_us;
+    host_run_until(now);
+    deliver();
+    return ESP_OK;
+}
+
+// Stats reports are not part of the measurement
+esp_err_t httpd_ws_send_frame(httpd_req_t* req, httpd_ws_frame_t* frame) {
+    return ESP_OK;
+}
+
+httpd_ws_client_info_t httpd_ws_get_fd_info(httpd_handle_t handle, int fd) {
+    return fd == server_fd ? HTTPD_WS_CLIENT_WEBSOCKET : HTTPD_WS_CLIENT_INVALID;
+}
+
+static bool data_waiting(void) {
+    fd_set readfds;
+    FD_ZERO(&readfds);
+    FD_SET(server_fd, &readfds);
+    struct timeval timeout = { 0, 0 };
+    return select(server_fd + 1, &readfds, NULL, NULL, &timeout) > 0;
+}
+
+static void run(const stream_case_t* c) {
+    int sv[2];
+    if (socketpair(AF_UNIX, SOCK_STREAM, 0, sv) != 0) {
+        printf("socketpair failed\n");
+        exit(1);
+    }
+    server_fd = sv[0];
+    client_fd = sv[1];
+    int window = RECEIVE_WINDOW;
+    setsockopt(client_fd, SOL_SOCKET, SO_SNDBUF, &window, sizeof(window));
+
+    current = c;
+    frames_to_send = c->send_fps * c->seconds;
+    frames_written = 0;
+    frame_offset = 0;
+    written_at.assign(frames_to_send, 0);
+    now = esp_timer_get_time();
+    stream_start = now;
+
+    httpd_req_t req;
+    host_request_init(&req, "/api/ws/pixels", NULL);
+    req.sockfd = server_fd;
+    host_uri_handlers[0].handler(&req);
+
+    // Frames after the handshake come with method 0
+    req.method = HTTP_DELETE;
+    std::vector<PixelColor>& pixels = PixelDriver::getMainChannel()->getPixelBuffer();
+    int shown = -1;
+    int received = 0;
+    int applied = 0;
+    int64_t wait_total = 0;
+    int64_t wait_worst = 0;
+    while (true) {
+        deliver();
+        if (data_waiting()) {
+            if (host_uri_handlers[0].handler(&req) != ESP_OK) {
+                printf("%s: the handler failed\n", c->name);
+                exit(1);
+            }
+            received++;
+            int frame = pixels[0].r | (pixels[0].g << 8);
+            if (pixels[0].b == 0xff && frame != shown) {
+                int64_t wait = now - written_at[frame];
+                wait_total += wait;
+                wait_worst = std::max(wait_worst, wait);
+                shown = frame;
+                applied++;
+            }
+        }
+        else if (frames_written < frames_to_send) {
+            now = std::max(now, send_time(frames_written));
+            host_run_until(now);
+        }
+        else {
+            break;
+        }
+    }
+    int64_t elapsed = now - stream_start;
+
+    // The display goes back to the clock once frames stop
+    bool streaming_after_last = pixel_stream_active();
+    host_run_until(now + (PIXEL_STREAM_IDLE_TIMEOUT_MS + 100) * 1000);
+
+    printf("%-26s %6d %8d %8d %9.1f %10.1f %9.1f %6s %9s\n", c->name, frames_to_send, applied,
+        received - applied, applied * 1000000.0 / elapsed, applied > 0 ? wait_total / 1000.0 / applied : 0.0,
+        wait_worst / 1000.0, shown == frames_to_send - 1 ? "yes" : "no",
+        streaming_after_last && !pixel_stream_active() ? "yes" : "no");
+    close(server_fd);
+    close(client_fd);
+}
+
+int main() {
+    PixelDriver::addChannel(ChannelConfig((gpio_num_t)4, PIXELS, PixelFormat::RGB, "main"));
+    register_pixel_stream_handlers(NULL);
+
+    printf("%-26s %6s %8s %8s %9s %10s %9s %6s %9s\n", "", "sent", "applied", "dropped", "applied", "mean wait",
+        "worst", "last", "released");
+    printf("%-26s %6s %8s %8s %9s %10s %9s %6s %9s\n", "", "", "", "", "fps", "(ms)", "wait (ms)", "shown", "");
+    for (const stream_case_t& c : cases) {
+        run(&c);
+    }
+    return 0;
+}
@@ -0,0 +1,196 @@
+/*
+ * /api/ws under load: 40 WebSocket clients on real socketpairs, eight of
+ * which never read, while second ticks arrive at 1 kHz and the config
+ * changes every 10 ms, for 6 simulated seconds.
+ *
+ * state_ws.cpp runs as on the device; the WebSocket calls below frame each
+ * message as esp_http_server does (server frames, unmasked) and write it to
+ * the client's socket. Each socket has a 4 KiB send buffer, about what lwIP
+ * holds for one connection, so a client that stops reading blocks within a
+ * few hundred pushes. The reading clients run on threads of their own.
+ *
+ * It reports the pushes, the frames sent and the clients dropped, the time
+ * the httpd task spends per push, and the bytes each reading client got.
+ * Time for the stall timeout is simulated and advances 1 ms per push; push
+ * times are host numbers, compare them with each other, not with the
+ * device.
+ */
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+#include <stdio.h>
+#include <string.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include "clock_events.h"
+#include "idf_host.h"
+#include "state_ws.h"
+
+#include "sdkconfig.h"
+
+#define RUN_MS 6000
+#define CONFIG_EVERY_MS 10
+#define SEND_BUFFER 4096
+#define IDLE_CLIENTS (CONFIG_STATE_WS_MAX_CLIENTS / 5)
+
+static bool closed[1024];
+static size_t frames_sent = 0;
+static size_t clients_dropped = 0;
+
+// Helper function to write one unmasked server frame to a client socket
+static esp_err_t send_frame(int fd, httpd_ws_frame_t* frame) {
+    uint8_t header[4] = { (uint8_t)(0x80 | frame->type) };
+    size_t header_len = 2;
+    if (frame->len < 126) {
+        header[1] = (uint8_t)frame->len;
+    }
+    else {
+        header[1] = 126;
+        header[2] = (uint8_t)(frame->len >> 8);
+        header[3] = (uint8_t)frame->len;
+        header_len = 4;
+    }
+    if (send(fd, header, header_len, MSG_NOSIGNAL) != (ssize_t)header_len ||
+        send(fd, frame->payload, frame->len, MSG_NOSIGNAL) != (ssize_t)frame->len) {
+        return ESP_FAIL;
+    }
+    frames_sent++;
+    return ESP_OK;
+}
+
+esp_err_t httpd_ws_send_frame(httpd_req_t* req, httpd_ws_frame_t* frame) {
+    return send_frame(req->sockfd, frame);
+}
+
+esp_err_t httpd_ws_send_frame_async(httpd_handle_t handle, int fd, httpd_ws_frame_t* frame) {
+    return send_frame(fd, frame);
+}
+
+// A client's text frame is the request body
+esp_err_t httpd_ws_recv_frame(httpd_req_t* req, httpd_ws_frame_t* frame, size_t max_len) {
+    frame->type = HTTPD_WS_TYPE_TEXT;
+    frame->len = req->content_len;
+    if (max_len > 0) {
+        memcpy(frame->payload, req->body, std::min(max_len, req->content_len));
+    }
+    return ESP_OK;
+}
+
+httpd_ws_client_info_t httpd_ws_get_fd_info(httpd_handle_t handle, int fd) {
+    return closed[fd] ? HTTPD_WS_CLIENT_INVALID : HTTPD_WS_CLIENT_WEBSOCKET;
+}
+
+esp_err_t httpd_sess_trigger_close(httpd_handle_t handle, int fd) {
+    closed[fd] = true;
+    clients_dropped++;
+    shutdown(fd, SHUT_RDWR);
+    return ESP_OK;
+}
+
+static void write_config(json_writer_t* writer) {
+    json_object_begin(writer);
+    json_kv_int(writer, "brightness", 80);
+    json_kv_bool(writer, "on", true);
+    json_kv_string(writer, "color", "#ff8000");
+    json_object_end(writer);
+}
+
+// Handshake, then {"tick":"second"}, as a dashboard does
+static void connect_client(int fd) {
+    httpd_req_t req;
+    host_request_init(&req, "/api/ws", NULL);
+    req.sockfd = fd;
+    host_uri_handlers[0].handler(&req);
+
+    // esp_http_server passes frames after the handshake with method 0
+    host_request_init(&req, "/api/ws", "{\"tick\":\"second\"}");
+    req.method = HTTP_DELETE;
+    req.sockfd = fd;
+    host_uri_handlers[0].handler(&req);
+}
+
+int main() {
+    state_ws_set_config_writer(write_config);
+    register_state_ws_handlers((httpd_handle_t)1);
+
+    const int clients = CONFIG_STATE_WS_MAX_CLIENTS;
+    std::vector<int> server_fd(clients), client_fd(clients);
+    std::vector<std::atomic<size_t>> received(clients);
+    std::vector<std::thread> readers;
+    for (int i = 0; i < clients; i++) {
+        int sv[2];
+        if (socketpair(AF_UNIX, SOCK_STREAM, 0, sv) != 0 || sv[0] >= (int)sizeof(closed)) {
+            printf("socketpair failed\n");
+            return 1;
+        }
+        int size = SEND_BUFFER;
+        setsockopt(sv[0], SOL_SOCKET, SO_SNDBUF, &size, sizeof(size));
+        server_fd[i] = sv[0];
+        client_fd[i] = sv[1];
+        connect_client(sv[0]);
+
+        if (i >= IDLE_CLIENTS) {
+            readers.emplace_back([&received, &client_fd, i] {
+                char buf[4096];
+                ssize_t n;
+                while ((n = recv(client_fd[i], buf, sizeof(buf), 0)) > 0) {
+                    received[i] += (size_t)n;
+                }
+            });
+        }
+    }
+
+    std::vector<double> push_us;
+    push_us.reserve(RUN_MS);
+    for (int ms = 0; ms < RUN_MS; ms++) {
+        host_run_until((int64_t)ms * 1000);
+        esp_event_post(CLOCK_EVENTS, CLOCK_EVENT_SECOND_TICK, NULL, 0, 0);
+        if (ms % CONFIG_EVERY_MS == 0) {
+            esp_event_post(CLOCK_EVENTS, CLOCK_EVENT_CONFIG_CHANGED, NULL, 0, 0);
+        }
+
+        // The host runs queued httpd work at once, so this is the push
+        auto start = std::chrono::steady_clock::now();
+        host_dispatch_events();
+        push_us.push_back(std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count());
+
+        // Let the readers drain, as the link would between ticks
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+
+    for (int i = 0; i < clients; i++) {
+        shutdown(client_fd[i], SHUT_RDWR);
+    }
+    for (std::thread& reader : readers) {
+        reader.join();
+    }
+
+    size_t idle_dropped = 0, reading_dropped = 0;
+    size_t least = SIZE_MAX, most = 0;
+    for (int i = 0; i < clients; i++) {
+        if (i < IDLE_CLIENTS) {
+            idle_dropped += closed[server_fd[i]];
+            continue;
+        }
+        reading_dropped += closed[server_fd[i]];
+        least = std::min(least, received[i].load());
+        most = std::max(most, received[i].load());
+    }
+
+    double total = 0;
+    for (double us : push_us) {
+        total += us;
+    }
+    std::sort(push_us.begin(), push_us.end());
+    printf("%d clients, %d never reading; %d ms of 1 kHz ticks, config every %d ms\n\n", clients, IDLE_CLIENTS,
+        RUN_MS, CONFIG_EVERY_MS);
+    printf("pushes %zu, frames sent %zu, clients dropped %zu (%zu idle, %zu reading)\n", push_us.size(),
+        frames_sent, clients_dropped, idle_dropped, reading_dropped);
+    printf("push time: mean %.1f us, p99 %.1f us, worst %.1f us\n", total / push_us.size(),
+        push_us[push_us.size() * 99 / 100], push_us.back());
+    printf("reading clients received %zu..%zu bytes\n", least, most);
+    return 0;
+}
@@ -0,0 +1,190 @@
+/*
+ * Serving the web UI, before and after the static file handler streamed
+ * assets in chunks:
+ *
+ * - before: one httpd_resp_send() per asset (the handler as it was, below)
+ * - after: the handler in api.cpp, 4 KiB httpd_resp_send_chunk() calls,
+ *   reached through the catch-all error handler as a browser request is
+ *
+ * For one page load (every asset once) it reports what esp_http_server
+ * writes to the socket, the heap the handler allocates, the stack it uses
+ * and its CPU time. The stub server frames responses as esp_http_server
+ * does: status line, one write per header, the body, and for chunks a
+ * length line and a CRLF around each.
+ *
+ * Not covered: lwIP copies every write into its send buffer, so the memory
+ * held below the socket is bounded by TCP_SND_BUF either way, and the time
+ * on air depends on the link. The UI here is a stand-in of the same shape as
+ * a clock-app build (static_files/static_files.h); stack and time are host
+ * numbers, compare the rows, not the absolute values, with the device.
+ */
+#include <chrono>
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "api.h"
+#include "esp_http_server.h"
+#include "idf_host.h"
+#include "static_files.h"
+
+#define PAGE_LOADS 2000
+#define BENCH_STACK_SIZE (64 * 1024)
+#define STACK_PAINT 0xa5
+
+static const char* const request_headers = "Host: clock.local\r\nAccept-Encoding: gzip, deflate, br\r\n";
+
+// The handler before chunked streaming, with the index found out of date as
+// it is here, so without the ETag block
+static esp_err_t baseline_send_static_file(httpd_req_t* req, const static_files::file* f) {
+    // Set appropriate headers
+    httpd_resp_set_type(req, f->type);
+    httpd_resp_set_hdr(req, "Content-Encoding", "gzip");
+
+    // Add caching headers for static assets (except HTML)
+    if (strcmp(f->type, "text/html") != 0) {
+        httpd_resp_set_hdr(req, "Cache-Control", "public, max-age=31536000"); // 1 year
+    }
+    else {
+        httpd_resp_set_hdr(req, "Cache-Control", "no-cache"); // Don't cache HTML
+        httpd_resp_set_hdr(req, "X-Frame-Options", "DENY");
+        httpd_resp_set_hdr(req, "X-Content-Type-Options", "nosniff");
+        httpd_resp_set_hdr(req, "X-XSS-Protection", "1; mode=block");
+    }
+
+    httpd_resp_send(req, reinterpret_cast<const char*>(f->contents), f->size);
+    return ESP_OK;
+}
+
+// Heap use while a request is handled
+static bool counting = false;
+static size_t heap_allocs = 0;
+static size_t heap_bytes = 0;
+
+extern "C" void* __libc_malloc(size_t size);
+
+extern "C" void* malloc(size_t size) {
+    if (counting) {
+        heap_allocs++;
+        heap_bytes += size;
+    }
+    return __libc_malloc(size);
+}
+
+typedef struct {
+    bool baseline;
+    size_t socket_sends;
+    size_t wire_bytes;
+    size_t largest_send;
+    size_t body_bytes;
+    bool failed;
+} page_load_t;
+
+static void serve(int file, bool baseline, page_load_t* load) {
+    const static_files::file& f = static_files::files[file];
+
+    // Owned by the server on the device, not the handler's stack
+    static httpd_req_t req;
+    host_request_init(&req, f.path, NULL);
+    req.headers = request_headers;
+
+    esp_err_t err = baseline ? baseline_send_static_file(&req, &f)
+        : host_err_handlers[HTTPD_404_NOT_FOUND](&req, HTTPD_404_NOT_FOUND);
+    if (err != ESP_OK || !req.finished || strcmp(req.status, "200 OK") != 0) {
+        load->failed = true;
+    }
+    load->socket_sends += req.socket_sends;
+    load->wire_bytes += req.wire_bytes;
+    load->body_bytes += f.size;
+    if (req.largest_send > load->largest_send) {
+        load->largest_send = req.largest_send;
+    }
+}
+
+static void* page_load(void* arg) {
+    page_load_t* load = (page_load_t*)arg;
+    for (int i = 0; i < static_files::num_of_files; i++) {
+        serve(i, load->baseline, load);
+    }
+    return NULL;
+}
+
+static void* idle(void* arg) {
+    return NULL;
+}
+
+static unsigned char bench_stack[BENCH_STACK_SIZE] __attribute__((aligned(64)));
+
+// Helper function to run a function on a painted stack and return how deep it went
+static size_t stack_used(void* (*fn)(void*), void* arg) {
+    memset(bench_stack, STACK_PAINT, sizeof(bench_stack));
+    pthread_attr_t attr;
+    pthread_attr_init(&attr);
+    pthread_attr_setstack(&attr, bench_stack, sizeof(bench_stack));
+    pthread_t thread;
+    pthread_create(&thread, &attr, fn, arg);
+    pthread_join(thread, NULL);
+    pthread_attr_destroy(&attr);
+
+    size_t untouched = 0;
+    while (untouched < sizeof(bench_stack) && bench_stack[untouched] == STACK_PAINT) {
+        untouched++;
+    }
+    return sizeof(bench_stack) - untouched;
+}
+
+static void measure(const char* name, bool baseline) {
+    page_load_t load = {};
+    load.baseline = baseline;
+    size_t thread_stack = stack_used(idle, NULL);
+    size_t stack = stack_used(page_load, &load) - thread_stack;
+
+    page_load_t counted = {};
+    heap_allocs = 0;
+    heap_bytes = 0;
+    counting = true;
+    for (int i = 0; i < static_files::num_of_files; i++) {
+        serve(i, baseline, &counted);
+    }
+    counting = false;
+
+    auto start = std::chrono::steady_clock::now();
+    page_load_t timed = {};
+    for (int n = 0; n < PAGE_LOADS; n++) {
+        for (int i = 0; i < static_files::num_of_files; i++) {
+            serve(i, baseline, &timed);
+        }
+    }
+    double us = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+
+    if (counted.failed || timed.failed) {
+        printf("%s: a request was not answered with 200\n", name);
+        exit(1);
+    }
+    printf("%-7s %10zu %12zu %8.2f%% %13zu %10zu %10zu %9zu %11.2f\n", name, counted.socket_sends,
+        counted.wire_bytes, 100.0 * (counted.wire_bytes - counted.body_bytes) / counted.body_bytes,
+        counted.largest_send, heap_allocs, heap_bytes, stack, us / PAGE_LOADS);
+}
+
+int main() {
+    clock_api_init();
+    host_start_httpd();
+    if (host_err_handlers[HTTPD_404_NOT_FOUND] == NULL) {
+        printf("api.cpp registered no catch-all handler\n");
+        return 1;
+    }
+
+    size_t ui_bytes = 0;
+    for (int i = 0; i < static_files::num_of_files; i++) {
+        ui_bytes += static_files::files[i].size;
+    }
+    printf("One page load: %d assets, %zu bytes of gzip bodies\n\n", static_files::num_of_files, ui_bytes);
+    printf("%-7s %10s %12s %9s %13s %10s %10s %9s %11s\n", "", "socket", "wire", "overhead", "largest",
+        "heap", "heap", "stack", "CPU");
+    printf("%-7s %10s %12s %9s %13s %10s %10s %9s %11s\n", "", "writes", "bytes", "", "write (B)", "allocs",
+        "bytes", "(B)", "us/load");
+    measure("before", true);
+    measure("after", false);
+    return 0;
+}
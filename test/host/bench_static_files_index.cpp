@@ -0,0 +1,97 @@
+/*
+ * Web UI path lookup, one handler per asset against the perfect hash
+ * index, for a synthetic UI of N assets:
+ *
+ * - scan: esp_http_server's match for handlers registered without
+ *   wildcards, the length and then the bytes of each URI in turn
+ * - index: static_files_index::find() and the one compare api.cpp makes
+ *
+ * static_files.h and static_files_index.h come from
+ * "static_files_index.py --synthetic N"; CMake builds this for 10, 100 and
+ * 500 assets, and "static_files_index.py --bench" builds and runs it for
+ * any N. Every asset is looked up in a fixed pseudo-random order. Times
+ * are host numbers; compare the columns, not the absolute values, with
+ * the device.
+ */
+#include <chrono>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <vector>
+
+#include "static_files.h"
+#include "static_files_index.h"
+
+#define LOOKUPS 2000000
+#define ORDER_SIZE 4096
+
+// Registered URIs live in the server's handler table, not in constants
+static std::vector<const char*> handler_uris;
+
+static int scan_find(const char* uri, size_t len) {
+    for (size_t i = 0; i < handler_uris.size(); i++) {
+        const char* handler_uri = handler_uris[i];
+        if (strlen(handler_uri) == len && strncmp(handler_uri, uri, len) == 0) {
+            return (int)i;
+        }
+    }
+    return -1;
+}
+
+static int index_find(const char* uri, size_t len) {
+    int i = static_files_index::find(uri, len);
+    if (i < 0) {
+        return -1;
+    }
+    const char* path = static_files::files[i].path;
+    return strncmp(path, uri, len) == 0 && path[len] == '\0' ? i : -1;
+}
+
+// Helper function to time lookups of the requests, in ns per lookup
+static double time_lookups(int (*find)(const char* uri, size_t len), const std::vector<const char*>& requests,
+    long* checksum) {
+    long sum = 0;
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < LOOKUPS; i++) {
+        const char* uri = requests[i % ORDER_SIZE];
+        sum += find(uri, strlen(uri));
+    }
+    double ns = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+    *checksum = sum;
+    return ns / LOOKUPS;
+}
+
+int main() {
+    const int n = static_files::num_of_files;
+    for (int i = 0; i < n; i++) {
+        handler_uris.push_back(strdup(static_files::files[i].path));
+    }
+
+    // Requests arrive with their own copies of the path
+    std::vector<const char*> requests;
+    uint32_t lcg = 12345;
+    for (int i = 0; i < ORDER_SIZE; i++) {
+        lcg = lcg * 1103515245 + 12345;
+        requests.push_back(handler_uris[(lcg >> 16) % n]);
+    }
+
+    for (int i = 0; i < n; i++) {
+        const char* path = static_files::files[i].path;
+        if (index_find(path, strlen(path)) != i || scan_find(path, strlen(path)) != i) {
+            printf("%s not found\n", path);
+            return 1;
+        }
+    }
+
+    long scan_sum = 0, index_sum = 0;
+    double scan_ns = time_lookups(scan_find, requests, &scan_sum);
+    double index_ns = time_lookups(index_find, requests, &index_sum);
+    if (scan_sum != index_sum) {
+        printf("The lookups disagree\n");
+        return 1;
+    }
+
+    size_t table = sizeof(static_files_index::displacements) + sizeof(static_files_index::slots);
+    printf("%8d assets: scan %7.1f ns, index %5.1f ns per lookup; table %zu bytes\n", n, scan_ns, index_ns, table);
+    return 0;
+}
@@ -0,0 +1,211 @@
+/*
+ * Per-frame CPU of the word clock at 60 fps, before and after the packed
+ * mask pipeline:
+ *
+ * - effect mode: PixelDriver evaluates its effect every frame. Before, it
+ *   did so for all 256 LEDs and the dense mask blanked the unlit ones;
+ *   with the active-index list only the lit LEDs need evaluating. The
+ *   effect is modelled by a hue cycle, as CYCLIC does.
+ * - letters mode: the layered renderer (wordclock_layers.cpp) runs only
+ *   while a change is animated, and its frames touch changing letters only.
+ * - the once-a-minute update: the string path plus a 256-byte mask copy,
+ *   against the compiled tables plus the active-list update.
+ *
+ * Host numbers; compare the rows, not the absolute times, with the device.
+ */
+#include <chrono>
+#include <stdio.h>
+#include <stdlib.h>
+#include <algorithm>
+#include <vector>
+
+#include "esp_timer.h"
+#include "idf_host.h"
+#include "kd_pixdriver.h"
+#include "wordclock.h"
+#include "wordclock_phrases.h"
+#include "wordclock_string_path.h"
+
+#define FRAME_US 16667
+#define FRAMES_PER_SECOND 60
+
+// Defined in wordclock.cpp
+void setTime(int hour, int minute);
+
+typedef std::chrono::steady_clock bench_clock;
+
+static double elapsed_ns(bench_clock::time_point start) {
+    return std::chrono::duration<double, std::nano>(bench_clock::now() - start).count();
+}
+
+// Stand-in for a driver effect: a hue cycle over the strip
+static inline PixelColor effect_pixel(size_t led, uint32_t frame) {
+    uint8_t hue = (uint8_t)(led * 4 + frame * 2);
+    uint8_t sector = hue / 43;
+    uint8_t rise = (uint8_t)((hue - sector * 43) * 6);
+    uint8_t fall = 255 - rise;
+    switch (sector) {
+    case 0: return PixelColor(255, rise, 0);
+    case 1: return PixelColor(fall, 255, 0);
+    case 2: return PixelColor(0, 255, rise);
+    case 3: return PixelColor(0, fall, 255);
+    case 4: return PixelColor(rise, 0, 255);
+    default: return PixelColor(255, 0, fall);
+    }
+}
+
+static std::vector<PixelColor> pixels(WORDCLOCK_GRID_SIZE);
+
+static void dense_frame(const uint8_t* mask, uint32_t frame) {
+    for (size_t led = 0; led < WORDCLOCK_GRID_SIZE; led++) {
+        PixelColor color = effect_pixel(led, frame);
+        pixels[led] = mask[led] ? color : PixelColor();
+    }
+}
+
+static void sparse_frame(const uint8_t* leds, size_t count, uint32_t frame) {
+    for (size_t i = 0; i < count; i++) {
+        pixels[leds[i]] = effect_pixel(leds[i], frame);
+    }
+}
+
+static size_t active_leds(const wordclock_mask_t& mask, uint8_t* leds) {
+    size_t count = 0;
+    for (size_t w = 0; w < WORDCLOCK_MASK_WORDS; w++) {
+        uint32_t word = mask.words[w];
+        while (word != 0) {
+            leds[count++] = (uint8_t)(w * 32 + __builtin_ctz(word));
+            word &= word - 1;
+        }
+    }
+    return count;
+}
+
+// One second of frames on every tenth minute of the day
+#define SAMPLE_MINUTES_STEP 10
+
+static void bench_effect_frames(double* dense_ns, double* sparse_ns, double* lit_avg) {
+    uint8_t mask[WORDCLOCK_GRID_SIZE];
+    uint8_t leds[WORDCLOCK_GRID_SIZE];
+    double dense_total = 0, sparse_total = 0;
+    size_t frames = 0, lit_total = 0;
+
+    for (int minute_of_day = 0; minute_of_day < 24 * 60; minute_of_day += SAMPLE_MINUTES_STEP) {
+        int hour = minute_of_day / 60, minute = minute_of_day % 60;
+        wordclock_mask_t packed = wordclock_phrase_mask(hour, minute);
+        string_path_set_time(hour, minute, mask);
+        size_t count = active_leds(packed, leds);
+
+        auto start = bench_clock::now();
+        for (uint32_t frame = 0; frame < FRAMES_PER_SECOND; frame++) {
+            dense_frame(mask, frame);
+        }
+        dense_total += elapsed_ns(start);
+
+        std::fill(pixels.begin(), pixels.end(), PixelColor());
+        start = bench_clock::now();
+        for (uint32_t frame = 0; frame < FRAMES_PER_SECOND; frame++) {
+            sparse_frame(leds, count, frame);
+        }
+        sparse_total += elapsed_ns(start);
+
+        frames += FRAMES_PER_SECOND;
+        lit_total += count;
+    }
+
+    *dense_ns = dense_total / frames;
+    *sparse_ns = sparse_total / frames;
+    *lit_avg = (double)lit_total / (24 * 60 / SAMPLE_MINUTES_STEP);
+}
+
+static double bench_string_path_update(void) {
+    static std::vector<uint8_t> mask_buffer(WORDCLOCK_GRID_SIZE);
+    uint8_t bits[WORDCLOCK_GRID_SIZE];
+
+    auto start = bench_clock::now();
+    for (int hour = 0; hour < 24; hour++) {
+        for (int minute = 0; minute < 60; minute++) {
+            string_path_set_time(hour, minute, bits);
+            std::copy(bits, bits + WORDCLOCK_GRID_SIZE, mask_buffer.begin());
+            PixelDriver::getMainChannel()->setMask(mask_buffer);
+        }
+    }
+    return elapsed_ns(start) / (24 * 60);
+}
+
+// Minute updates through wordclock.cpp in the mode set up by the caller
+static double bench_compiled_update(void) {
+    auto start = bench_clock::now();
+    for (int hour = 0; hour < 24; hour++) {
+        for (int minute = 0; minute < 60; minute++) {
+            setTime(hour, minute);
+        }
+    }
+    return elapsed_ns(start) / (24 * 60);
+}
+
+// Letters mode: each minute change animated to the end, frame by frame
+static void bench_letter_frames(double* frame_ns, double* frames_per_change) {
+    double total = 0;
+    size_t frames = 0;
+    int64_t now = esp_timer_get_time();
+
+    for (int hour = 0; hour < 24; hour++) {
+        for (int minute = 0; minute < 60; minute++) {
+            setTime(hour, minute);
+            while (host_timers_running() > 0) {
+                now += FRAME_US;
+                auto start = bench_clock::now();
+                host_run_until(now);
+                total += elapsed_ns(start);
+                frames++;
+            }
+        }
+    }
+
+    *frame_ns = total / frames;
+    *frames_per_change = (double)frames / (24 * 60);
+}
+
+int main() {
+    setenv("TZ", "UTC0", 1);
+    tzset();
+    host_set_epoch(1700000000);
+
+    wordclock_clock_init();
+    host_set_ntp_synced(true);
+
+    double dense_ns, sparse_ns, lit_avg;
+    bench_effect_frames(&dense_ns, &sparse_ns, &lit_avg);
+    double string_update_ns = bench_string_path_update();
+    double effect_update_ns = bench_compiled_update();
+
+    wordclock_set_mode(WORDCLOCK_MODE_LETTERS);
+    host_dispatch_events();
+    host_run_until(esp_timer_get_time() + 1000000);
+    double letters_update_ns = bench_compiled_update();
+
+    double letter_frame_ns, frames_per_change;
+    bench_letter_frames(&letter_frame_ns, &frames_per_change);
+
+    printf("Effect mode, one frame (%.0f of %d LEDs lit on average)\n", lit_avg, WORDCLOCK_GRID_SIZE);
+    printf("  effect on all LEDs, dense mask    %8.1f ns\n", dense_ns);
+    printf("  effect on lit LEDs, active list   %8.1f ns   %.1fx less\n", sparse_ns, dense_ns / sparse_ns);
+    printf("Letters mode, one frame\n");
+    printf("  animated change                   %8.1f ns   %.0f frames per minute change\n", letter_frame_ns, frames_per_change);
+    printf("  idle                                   0 ns   frame timer stopped\n");
+    printf("Minute update\n");
+    printf("  string path, 256-byte mask copy   %8.1f ns\n", string_update_ns);
+    printf("  compiled tables, effect mode      %8.1f ns\n", effect_update_ns);
+    printf("  compiled tables, letters mode     %8.1f ns\n", letters_update_ns);
+
+    // Per second of display at 60 fps, minute updates spread over 60 s
+    double before = FRAMES_PER_SECOND * dense_ns + string_update_ns / 60;
+    double effect = FRAMES_PER_SECOND * sparse_ns + effect_update_ns / 60;
+    double letters = (frames_per_change * letter_frame_ns + letters_update_ns) / 60;
+    printf("CPU per second of display at 60 fps, minute update included\n");
+    printf("  before                            %8.2f us\n", before / 1000);
+    printf("  effect mode, lit LEDs only        %8.2f us\n", effect / 1000);
+    printf("  letters mode                      %8.2f us\n", letters / 1000);
+    return 0;
+}
@@ -0,0 +1,52 @@
+/*
+ * Time to work out the lit letters for one minute: the baseline string
+ * path against the compiled phrase tables. Both walk the whole day so every
+ * phrase length is covered.
+ *
+ * Host numbers; the ratio, not the absolute time, carries over to the
+ * ESP32-S3.
+ */
+#include <chrono>
+#include <stdio.h>
+
+#include "wordclock_phrases.h"
+#include "wordclock_string_path.h"
+
+#define DAYS 200
+
+static volatile uint32_t sink;
+
+// Keeps the compiler from folding the table lookups at compile time
+static const wordclock_grid_tables_t* volatile tables = &wordclock_builtin_layout.tables;
+
+template <typename F>
+static double ns_per_minute(F&& set_time) {
+    auto start = std::chrono::steady_clock::now();
+    for (int day = 0; day < DAYS; day++) {
+        for (int hour = 0; hour < 24; hour++) {
+            for (int minute = 0; minute < 60; minute++) {
+                set_time(hour, minute);
+            }
+        }
+    }
+    std::chrono::duration<double, std::nano> elapsed = std::chrono::steady_clock::now() - start;
+    return elapsed.count() / (DAYS * 24.0 * 60.0);
+}
+
+int main() {
+    double string_ns = ns_per_minute([](int hour, int minute) {
+        uint8_t bits[WORDCLOCK_GRID_SIZE];
+        string_path_set_time(hour, minute, bits);
+        sink = bits[hour + minute];
+    });
+
+    double table_ns = ns_per_minute([](int hour, int minute) {
+        wordclock_mask_t mask = wordclock_grid_mask(*tables, hour, minute);
+        sink = mask.words[minute % WORDCLOCK_MASK_WORDS];
+    });
+
+    printf("string path     %8.1f ns/minute\n", string_ns);
+    printf("compiled tables %8.1f ns/minute\n", table_ns);
+    printf("speedup         %8.1fx\n", string_ns / table_ns);
+    return 0;
+}
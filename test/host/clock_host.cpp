@@ -0,0 +1,61 @@
+/*
+ * What the clock cores call outside themselves on the device: settings
+ * persistence, API registration and the pixel stream. The host keeps the
+ * config in memory and serves no API.
+ */
+#include "sdkconfig.h"
+
+#include "pixel_stream.h"
+
+// Set by a test to stand in for a client streaming frames
+bool host_pixel_stream = false;
+
+bool pixel_stream_active(void) {
+    return host_pixel_stream;
+}
+
+#ifdef CONFIG_BASE_CLOCK_TYPE_WORDCLOCK
+
+#include "wordclock_handlers.h"
+
+void register_wordclock_handlers(httpd_handle_t server) {
+}
+
+// wc_config keeps its defaults
+void wordclock_load_from_nvs(wordclock_config_t* config) {
+}
+
+void wordclock_save_to_nvs(const wordclock_config_t* config) {
+}
+
+#endif
+
+#ifdef CONFIG_BASE_CLOCK_TYPE_NIXIE
+
+#include "nixie_handlers.h"
+
+void register_nixie_handlers(httpd_handle_t server) {
+}
+
+void nixie_load_from_nvs(nixie_config_t* config) {
+}
+
+void nixie_save_to_nvs(const nixie_config_t* config) {
+}
+
+#endif
+
+#ifdef CONFIG_BASE_CLOCK_TYPE_FIBONACCI
+
+#include "fibonacci_handlers.h"
+
+void register_fibonacci_handlers(httpd_handle_t server) {
+}
+
+void fibonacci_load_from_nvs(fibonacci_config_t* config) {
+}
+
+void fibonacci_save_to_nvs(fibonacci_config_t* config) {
+}
+
+#endif
@@ -0,0 +1,26 @@
+#pragma once
+// Stand-in for the downloaded clock-app static_files.h: bodies of the sizes
+// of a gzip-compressed UI build, contents zeroed
+#include <stddef.h>
+
+namespace static_files {
+    struct file {
+        const char* path;
+        const unsigned char* contents;
+        size_t size;
+        const char* type;
+    };
+
+    inline unsigned char index_html[640];
+    inline unsigned char index_js[152 * 1024];
+    inline unsigned char index_css[9 * 1024];
+    inline unsigned char favicon_ico[1150];
+
+    const file files[] = {
+        { "/index.html", index_html, sizeof(index_html), "text/html" },
+        { "/assets/index.js", index_js, sizeof(index_js), "application/javascript" },
+        { "/assets/index.css", index_css, sizeof(index_css), "text/css" },
+        { "/favicon.ico", favicon_ico, sizeof(favicon_ico), "image/x-icon" },
+    };
+    const int num_of_files = 4;
+}
@@ -0,0 +1,4 @@
+#pragma once
+
+// Only named by declarations the host targets include; nothing is parsed
+typedef struct cJSON cJSON;
@@ -0,0 +1,58 @@
+#include "driver/gpio.h"
+#include "driver/ledc.h"
+#include "driver/spi_master.h"
+#include "idf_host.h"
+
+static int spi_device;
+static size_t spi_transfers = 0;
+
+size_t host_spi_transfers(void) {
+    return spi_transfers;
+}
+
+esp_err_t gpio_config(const gpio_config_t* config) {
+    return ESP_OK;
+}
+
+esp_err_t gpio_set_level(gpio_num_t gpio, uint32_t level) {
+    return ESP_OK;
+}
+
+esp_err_t spi_bus_initialize(spi_host_device_t host, const spi_bus_config_t* config, spi_dma_chan_t dma) {
+    return ESP_OK;
+}
+
+esp_err_t spi_bus_add_device(spi_host_device_t host, const spi_device_interface_config_t* config,
+    spi_device_handle_t* out) {
+    *out = (spi_device_handle_t)&spi_device;
+    return ESP_OK;
+}
+
+esp_err_t spi_device_transmit(spi_device_handle_t device, spi_transaction_t* transaction) {
+    spi_transfers++;
+    return ESP_OK;
+}
+
+esp_err_t spi_bus_remove_device(spi_device_handle_t device) {
+    return ESP_OK;
+}
+
+esp_err_t spi_bus_free(spi_host_device_t host) {
+    return ESP_OK;
+}
+
+esp_err_t ledc_timer_config(const ledc_timer_config_t* config) {
+    return ESP_OK;
+}
+
+esp_err_t ledc_channel_config(const ledc_channel_config_t* config) {
+    return ESP_OK;
+}
+
+esp_err_t ledc_set_duty(ledc_mode_t mode, ledc_channel_t channel, uint32_t duty) {
+    return ESP_OK;
+}
+
+esp_err_t ledc_update_duty(ledc_mode_t mode, ledc_channel_t channel) {
+    return ESP_OK;
+}
@@ -0,0 +1,135 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include <sys/types.h>
+
+#include "esp_err.h"
+
+/*
+ * Requests without a server: a test fills in the body with
+ * host_request_init(), runs a handler and reads back what it sent.
+ * Responses are framed the way esp_http_server writes them to the socket,
+ * so the socket counters match the device's send calls.
+ */
+typedef void* httpd_handle_t;
+
+typedef enum {
+    HTTP_DELETE = 0,
+    HTTP_GET = 1,
+    HTTP_POST = 3,
+    HTTP_PUT = 4,
+} httpd_method_t;
+
+typedef enum {
+    HTTPD_400_BAD_REQUEST,
+    HTTPD_404_NOT_FOUND,
+    HTTPD_408_REQ_TIMEOUT,
+    HTTPD_500_INTERNAL_SERVER_ERROR,
+} httpd_err_code_t;
+
+#define ESP_ERR_HTTPD_BASE 0xb000
+#define ESP_ERR_HTTPD_RESP_HDR (ESP_ERR_HTTPD_BASE + 2)
+#define ESP_ERR_HTTPD_RESULT_TRUNC (ESP_ERR_HTTPD_BASE + 3)
+
+#define HTTPD_SOCK_ERR_TIMEOUT -3
+#define HTTPD_RESP_USE_STRLEN -1
+
+#define HOST_RESPONSE_MAX 4096
+
+typedef struct httpd_req {
+    httpd_handle_t handle;
+    int method;
+    const char* uri;
+    size_t content_len;
+    void* user_ctx;
+
+    // Host side
+    int sockfd;                         // Session socket, for httpd_req_to_sockfd()
+    const char* headers;                // Request headers, "Name: value\r\n" each
+    const char* body;
+    size_t body_offset;
+    size_t recv_max;                    // Largest piece one recv returns, 0 for any
+    char status[32];
+    char content_type[32];
+    char response[HOST_RESPONSE_MAX];
+    size_t response_len;
+    size_t chunks;                      // httpd_resp_send_chunk() calls with data
+    size_t largest_send;                // Largest single socket write, in bytes
+    size_t socket_sends;                // Socket writes, headers and chunk framing included
+    size_t wire_bytes;                  // Bytes written to the socket
+    size_t header_count;                // Set with httpd_resp_set_hdr()
+    uint16_t header_len[16];            // Each as it goes out, "Name: value\r\n"
+    bool headers_sent;
+    bool finished;                      // Whole response sent
+} httpd_req_t;
+
+typedef struct {
+    const char* uri;
+    httpd_method_t method;
+    esp_err_t (*handler)(httpd_req_t* req);
+    void* user_ctx;
+    bool is_websocket;
+} httpd_uri_t;
+
+typedef esp_err_t (*httpd_err_handler_func_t)(httpd_req_t* req, httpd_err_code_t error);
+
+void host_request_init(httpd_req_t* req, const char* uri, const char* body);
+
+esp_err_t httpd_register_uri_handler(httpd_handle_t handle, const httpd_uri_t* uri);
+esp_err_t httpd_register_err_handler(httpd_handle_t handle, httpd_err_code_t error,
+    httpd_err_handler_func_t handler);
+
+// Last handlers registered, for tests to call
+extern httpd_uri_t host_uri_handlers[32];
+extern size_t host_uri_handler_count;
+extern httpd_err_handler_func_t host_err_handlers[HTTPD_500_INTERNAL_SERVER_ERROR + 1];
+
+// Work for the httpd task; the host runs it at once, as an idle server would
+typedef void (*httpd_work_fn_t)(void* arg);
+esp_err_t httpd_queue_work(httpd_handle_t handle, httpd_work_fn_t work, void* arg);
+
+int httpd_req_to_sockfd(httpd_req_t* req);
+
+esp_err_t httpd_req_get_hdr_value_str(httpd_req_t* req, const char* field, char* val, size_t val_size);
+
+int httpd_req_recv(httpd_req_t* req, char* buf, size_t len);
+esp_err_t httpd_resp_send(httpd_req_t* req, const char* buf, ssize_t len);
+esp_err_t httpd_resp_send_chunk(httpd_req_t* req, const char* buf, ssize_t len);
+esp_err_t httpd_resp_set_status(httpd_req_t* req, const char* status);
+esp_err_t httpd_resp_set_type(httpd_req_t* req, const char* type);
+esp_err_t httpd_resp_set_hdr(httpd_req_t* req, const char* field, const char* value);
+esp_err_t httpd_resp_send_err(httpd_req_t* req, httpd_err_code_t error, const char* message);
+esp_err_t httpd_resp_send_404(httpd_req_t* req);
+esp_err_t httpd_resp_send_408(httpd_req_t* req);
+esp_err_t httpd_resp_send_500(httpd_req_t* req);
+
+// WebSocket calls are left to the test, which owns the sockets behind them
+typedef enum {
+    HTTPD_WS_TYPE_CONTINUE = 0x0,
+    HTTPD_WS_TYPE_TEXT = 0x1,
+    HTTPD_WS_TYPE_BINARY = 0x2,
+    HTTPD_WS_TYPE_CLOSE = 0x8,
+    HTTPD_WS_TYPE_PING = 0x9,
+    HTTPD_WS_TYPE_PONG = 0xA,
+} httpd_ws_type_t;
+
+typedef enum {
+    HTTPD_WS_CLIENT_INVALID = 0x0,
+    HTTPD_WS_CLIENT_HTTP = 0x1,
+    HTTPD_WS_CLIENT_WEBSOCKET = 0x2,
+} httpd_ws_client_info_t;
+
+typedef struct {
+    bool final;
+    bool fragmented;
+    httpd_ws_type_t type;
+    uint8_t* payload;
+    size_t len;
+} httpd_ws_frame_t;
+
+esp_err_t httpd_ws_recv_frame(httpd_req_t* req, httpd_ws_frame_t* frame, size_t max_len);
+esp_err_t httpd_ws_send_frame(httpd_req_t* req, httpd_ws_frame_t* frame);
+esp_err_t httpd_ws_send_frame_async(httpd_handle_t handle, int fd, httpd_ws_frame_t* frame);
+httpd_ws_client_info_t httpd_ws_get_fd_info(httpd_handle_t handle, int fd);
+esp_err_t httpd_sess_trigger_close(httpd_handle_t handle, int fd);
@@ -0,0 +1,13 @@
+#pragma once
+
+#include "esp_err.h"
+
+// Logging is compiled out; arguments are still type-checked
+template <typename... Args>
+static inline void esp_log_discard(const char*, const char*, Args...) {}
+
+#define ESP_LOGE(tag, format, ...) esp_log_discard(tag, format, ##__VA_ARGS__)
+#define ESP_LOGW(tag, format, ...) esp_log_discard(tag, format, ##__VA_ARGS__)
+#define ESP_LOGI(tag, format, ...) esp_log_discard(tag, format, ##__VA_ARGS__)
+#define ESP_LOGD(tag, format, ...) esp_log_discard(tag, format, ##__VA_ARGS__)
+#define ESP_LOGV(tag, format, ...) esp_log_discard(tag, format, ##__VA_ARGS__)
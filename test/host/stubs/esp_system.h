@@ -0,0 +1,11 @@
+#pragma once
+
+#include "esp_err.h"
+
+typedef void (*shutdown_handler_t)(void);
+
+// Exits the process
+void esp_restart(void);
+
+// Handlers are kept but never run
+esp_err_t esp_register_shutdown_handler(shutdown_handler_t handler);
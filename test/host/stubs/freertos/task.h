@@ -0,0 +1,28 @@
+#pragma once
+
+#include "FreeRTOS.h"
+
+// Tasks run as coroutines inside host_run_until(), blocking in vTaskDelay()
+// and ulTaskNotifyTake()
+typedef void* TaskHandle_t;
+typedef void (*TaskFunction_t)(void* arg);
+
+typedef struct {
+    int unused;
+} StaticTask_t;
+
+TaskHandle_t xTaskCreateStatic(TaskFunction_t task, const char* name, uint32_t stack_size, void* arg,
+    UBaseType_t priority, StackType_t* stack, StaticTask_t* tcb);
+#define tskIDLE_PRIORITY 0
+
+void vTaskDelay(TickType_t ticks);
+TickType_t xTaskGetTickCount(void);
+const char* pcTaskGetName(TaskHandle_t task);
+TaskHandle_t xTaskGetCurrentTaskHandle(void);
+TaskHandle_t xTaskGetHandle(const char* name);
+
+uint32_t ulTaskNotifyTake(BaseType_t clear_on_exit, TickType_t wait);
+void xTaskNotifyGive(TaskHandle_t task);
+
+// Nothing runs on a task stack of its own; always 0
+UBaseType_t uxTaskGetStackHighWaterMark(TaskHandle_t task);
@@ -0,0 +1,191 @@
+#include "esp_http_server.h"
+#include "lwip/sockets.h"
+
+#include <stdio.h>
+#include <string.h>
+#include <strings.h>
+
+httpd_uri_t host_uri_handlers[32];
+size_t host_uri_handler_count = 0;
+httpd_err_handler_func_t host_err_handlers[HTTPD_500_INTERNAL_SERVER_ERROR + 1];
+
+void host_request_init(httpd_req_t* req, const char* uri, const char* body) {
+    memset(req, 0, sizeof(*req));
+    req->method = HTTP_GET;
+    req->uri = uri;
+    req->body = body;
+    req->content_len = body != NULL ? strlen(body) : 0;
+    strcpy(req->status, "200 OK");
+    strcpy(req->content_type, "text/html");
+}
+
+esp_err_t httpd_register_uri_handler(httpd_handle_t handle, const httpd_uri_t* uri) {
+    if (host_uri_handler_count == sizeof(host_uri_handlers) / sizeof(host_uri_handlers[0])) {
+        return ESP_FAIL;
+    }
+    host_uri_handlers[host_uri_handler_count++] = *uri;
+    return ESP_OK;
+}
+
+esp_err_t httpd_register_err_handler(httpd_handle_t handle, httpd_err_code_t error,
+    httpd_err_handler_func_t handler) {
+    host_err_handlers[error] = handler;
+    return ESP_OK;
+}
+
+esp_err_t httpd_queue_work(httpd_handle_t handle, httpd_work_fn_t work, void* arg) {
+    work(arg);
+    return ESP_OK;
+}
+
+int httpd_req_to_sockfd(httpd_req_t* req) {
+    return req->sockfd;
+}
+
+int lwip_getpeername(int s, struct sockaddr* name, socklen_t* namelen) {
+    if (s < 0 || s > 255 || *namelen < sizeof(struct sockaddr_in)) {
+        return -1;
+    }
+    struct sockaddr_in* peer = (struct sockaddr_in*)name;
+    memset(peer, 0, sizeof(*peer));
+    peer->sin_family = AF_INET;
+    peer->sin_addr.s_addr = htonl(0x0a000000 | (uint32_t)s);
+    *namelen = sizeof(*peer);
+    return 0;
+}
+
+esp_err_t httpd_req_get_hdr_value_str(httpd_req_t* req, const char* field, char* val, size_t val_size) {
+    size_t field_len = strlen(field);
+    for (const char* line = req->headers; line != NULL && *line != '\0';) {
+        const char* end = strstr(line, "\r\n");
+        size_t len = end != NULL ? (size_t)(end - line) : strlen(line);
+        if (len > field_len && line[field_len] == ':' && strncasecmp(line, field, field_len) == 0) {
+            const char* value = line + field_len + 1;
+            value += strspn(value, " ");
+            size_t value_len = line + len - value;
+            if (value_len >= val_size) {
+                return ESP_ERR_HTTPD_RESULT_TRUNC;
+            }
+            memcpy(val, value, value_len);
+            val[value_len] = '\0';
+            return ESP_OK;
+        }
+        line += len + (end != NULL ? 2 : 0);
+    }
+    return ESP_ERR_NOT_FOUND;
+}
+
+int httpd_req_recv(httpd_req_t* req, char* buf, size_t len) {
+    size_t remaining = req->content_len - req->body_offset;
+    if (remaining == 0) {
+        return 0;
+    }
+    if (len > remaining) len = remaining;
+    if (req->recv_max > 0 && len > req->recv_max) len = req->recv_max;
+
+    memcpy(buf, req->body + req->body_offset, len);
+    req->body_offset += len;
+    return (int)len;
+}
+
+// One send() on the session socket
+static void socket_send(httpd_req_t* req, size_t len) {
+    req->socket_sends++;
+    req->wire_bytes += len;
+    if (len > req->largest_send) {
+        req->largest_send = len;
+    }
+}
+
+// Status line and headers, one write for the fixed part and one per extra header
+static void send_headers(httpd_req_t* req, const char* length_hdr) {
+    char scratch[160];
+    int len = snprintf(scratch, sizeof(scratch), "HTTP/1.1 %s\r\nContent-Type: %s\r\n%s\r\n", req->status,
+        req->content_type, length_hdr);
+    socket_send(req, len);
+    for (size_t i = 0; i < req->header_count; i++) {
+        socket_send(req, req->header_len[i]);
+    }
+    socket_send(req, 2);
+    req->headers_sent = true;
+}
+
+static void append(httpd_req_t* req, const char* buf, size_t len) {
+    if (req->response_len + len >= sizeof(req->response)) {
+        len = sizeof(req->response) - 1 - req->response_len;
+    }
+    memcpy(req->response + req->response_len, buf, len);
+    req->response_len += len;
+    req->response[req->response_len] = '\0';
+}
+
+esp_err_t httpd_resp_send(httpd_req_t* req, const char* buf, ssize_t len) {
+    size_t size = buf == NULL ? 0 : len == HTTPD_RESP_USE_STRLEN ? strlen(buf) : (size_t)len;
+    char length_hdr[40];
+    snprintf(length_hdr, sizeof(length_hdr), "Content-Length: %u", (unsigned int)size);
+    send_headers(req, length_hdr);
+    if (size > 0) {
+        socket_send(req, size);
+        append(req, buf, size);
+    }
+    req->finished = true;
+    return ESP_OK;
+}
+
+esp_err_t httpd_resp_send_chunk(httpd_req_t* req, const char* buf, ssize_t len) {
+    size_t size = buf == NULL ? 0 : len == HTTPD_RESP_USE_STRLEN ? strlen(buf) : (size_t)len;
+    if (!req->headers_sent) {
+        send_headers(req, "Transfer-Encoding: chunked");
+    }
+
+    char len_str[10];
+    socket_send(req, snprintf(len_str, sizeof(len_str), "%x\r\n", (unsigned int)size));
+    if (size > 0) {
+        socket_send(req, size);
+        req->chunks++;
+        append(req, buf, size);
+    }
+    socket_send(req, 2);
+    if (size == 0) {
+        req->finished = true;
+    }
+    return ESP_OK;
+}
+
+esp_err_t httpd_resp_set_status(httpd_req_t* req, const char* status) {
+    strncpy(req->status, status, sizeof(req->status) - 1);
+    return ESP_OK;
+}
+
+esp_err_t httpd_resp_set_type(httpd_req_t* req, const char* type) {
+    strncpy(req->content_type, type, sizeof(req->content_type) - 1);
+    return ESP_OK;
+}
+
+esp_err_t httpd_resp_set_hdr(httpd_req_t* req, const char* field, const char* value) {
+    if (req->header_count == sizeof(req->header_len) / sizeof(req->header_len[0])) {
+        return ESP_ERR_HTTPD_RESP_HDR;
+    }
+    req->header_len[req->header_count++] = strlen(field) + 2 + strlen(value) + 2;
+    return ESP_OK;
+}
+
+esp_err_t httpd_resp_send_err(httpd_req_t* req, httpd_err_code_t error, const char* message) {
+    static const char* const statuses[] = {
+        "400 Bad Request", "404 Not Found", "408 Request Timeout", "500 Internal Server Error",
+    };
+    httpd_resp_set_status(req, statuses[error]);
+    return httpd_resp_send(req, message, HTTPD_RESP_USE_STRLEN);
+}
+
+esp_err_t httpd_resp_send_404(httpd_req_t* req) {
+    return httpd_resp_send_err(req, HTTPD_404_NOT_FOUND, "Not found");
+}
+
+esp_err_t httpd_resp_send_408(httpd_req_t* req) {
+    return httpd_resp_send_err(req, HTTPD_408_REQ_TIMEOUT, "Request timeout");
+}
+
+esp_err_t httpd_resp_send_500(httpd_req_t* req) {
+    return httpd_resp_send_err(req, HTTPD_500_INTERNAL_SERVER_ERROR, "Internal error");
+}
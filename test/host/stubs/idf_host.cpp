@@ -0,0 +1,534 @@
+#include "idf_host.h"
+
+#include <stdlib.h>
+#include <string.h>
+#include <ucontext.h>
+
+#include "esp_event.h"
+#include "esp_heap_caps.h"
+#include "esp_partition.h"
+#include "esp_random.h"
+#include "esp_rom_crc.h"
+#include "esp_system.h"
+#include "esp_timer.h"
+#include "freertos/semphr.h"
+#include "freertos/task.h"
+#include "kd_common.h"
+#include "kd_pixdriver.h"
+
+#define HOST_TIMERS_MAX 8
+#define HOST_HANDLERS_MAX 16
+#define HOST_EVENTS_MAX 64
+#define HOST_TASKS_MAX 4
+#define HOST_PARTITIONS_MAX 2
+#define HOST_SECTOR_SIZE 4096
+// Host frames are larger than the device's; the task's own stack is not used
+#define HOST_TASK_STACK_SIZE (256 * 1024)
+#define HOST_NEVER INT64_MAX
+
+struct esp_timer {
+    esp_timer_cb_t callback;
+    void* arg;
+    uint64_t period_us;     // 0 for one-shot
+    int64_t due_us;
+    bool running;
+};
+
+typedef struct {
+    esp_event_base_t base;
+    int32_t id;
+    esp_event_handler_t handler;
+    void* arg;
+} host_handler_t;
+
+typedef struct {
+    esp_event_base_t base;
+    int32_t id;
+    void* data;
+} host_event_t;
+
+static int64_t now_us = 0;
+static time_t epoch_at_zero = 0;
+static bool ntp_synced = false;
+
+static struct esp_timer timers[HOST_TIMERS_MAX];
+static int timer_count = 0;
+
+// A task runs as a coroutine on simulated time, until it blocks
+typedef struct {
+    TaskFunction_t function;
+    void* arg;
+    ucontext_t context;
+    int64_t due_us;         // HOST_NEVER while waiting for a notification
+    uint32_t notifications;
+    bool waiting;
+} host_task_t;
+
+static host_task_t tasks[HOST_TASKS_MAX];
+static int task_count = 0;
+static host_task_t* current_task = NULL;
+static host_task_t main_task;           // The test itself, which never blocks
+static ucontext_t scheduler_context;
+
+static host_handler_t handlers[HOST_HANDLERS_MAX];
+static int handler_count = 0;
+
+static host_event_t events[HOST_EVENTS_MAX];
+static int event_count = 0;
+
+ESP_EVENT_DEFINE_BASE(KD_NTP_EVENTS);
+
+// Wall clock, on simulated time
+extern "C" time_t time(time_t* out) {
+    time_t now = epoch_at_zero + (time_t)(now_us / 1000000);
+    if (out != NULL) {
+        *out = now;
+    }
+    return now;
+}
+
+void host_set_epoch(time_t epoch) {
+    epoch_at_zero = epoch - (time_t)(now_us / 1000000);
+}
+
+int64_t esp_timer_get_time(void) {
+    return now_us;
+}
+
+esp_err_t esp_timer_create(const esp_timer_create_args_t* args, esp_timer_handle_t* out) {
+    if (timer_count == HOST_TIMERS_MAX) {
+        return ESP_ERR_NO_MEM;
+    }
+    struct esp_timer* timer = &timers[timer_count++];
+    *timer = {};
+    timer->callback = args->callback;
+    timer->arg = args->arg;
+    *out = timer;
+    return ESP_OK;
+}
+
+static esp_err_t timer_start(esp_timer_handle_t timer, uint64_t timeout_us, uint64_t period_us) {
+    if (timer->running) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    timer->running = true;
+    timer->period_us = period_us;
+    timer->due_us = now_us + (int64_t)timeout_us;
+    return ESP_OK;
+}
+
+esp_err_t esp_timer_start_periodic(esp_timer_handle_t timer, uint64_t period_us) {
+    return timer_start(timer, period_us, period_us);
+}
+
+esp_err_t esp_timer_start_once(esp_timer_handle_t timer, uint64_t timeout_us) {
+    return timer_start(timer, timeout_us, 0);
+}
+
+esp_err_t esp_timer_stop(esp_timer_handle_t timer) {
+    if (!timer->running) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    timer->running = false;
+    return ESP_OK;
+}
+
+int host_timers_running(void) {
+    int running = 0;
+    for (int i = 0; i < timer_count; i++) {
+        running += timers[i].running;
+    }
+    return running;
+}
+
+void host_run_until(int64_t until_us) {
+    while (true) {
+        struct esp_timer* next = NULL;
+        for (int i = 0; i < timer_count; i++) {
+            if (timers[i].running && timers[i].due_us <= until_us && (next == NULL || timers[i].due_us < next->due_us)) {
+                next = &timers[i];
+            }
+        }
+
+        // A task due at the same time as a timer runs after it
+        host_task_t* task = NULL;
+        for (int i = 0; i < task_count; i++) {
+            if (tasks[i].due_us <= until_us && (next == NULL || tasks[i].due_us < next->due_us)
+                && (task == NULL || tasks[i].due_us < task->due_us)) {
+                task = &tasks[i];
+            }
+        }
+
+        if (task != NULL) {
+            now_us = task->due_us;
+            current_task = task;
+            swapcontext(&scheduler_context, &task->context);
+            current_task = NULL;
+            host_dispatch_events();
+            continue;
+        }
+        if (next == NULL) {
+            break;
+        }
+
+        now_us = next->due_us;
+        if (next->period_us == 0) {
+            next->running = false;
+        }
+        next->callback(next->arg);
+
+        // Unless the callback stopped or restarted it
+        if (next->running && next->due_us == now_us) {
+            next->due_us += (int64_t)next->period_us;
+        }
+        host_dispatch_events();
+    }
+
+    now_us = until_us;
+}
+
+esp_err_t esp_event_handler_register(esp_event_base_t base, int32_t id, esp_event_handler_t handler, void* arg) {
+    if (handler_count == HOST_HANDLERS_MAX) {
+        return ESP_ERR_NO_MEM;
+    }
+    handlers[handler_count++] = { base, id, handler, arg };
+    return ESP_OK;
+}
+
+// Like the default event loop, data is copied to the heap
+esp_err_t esp_event_post(esp_event_base_t base, int32_t id, const void* data, size_t size, TickType_t wait) {
+    if (event_count == HOST_EVENTS_MAX) {
+        return ESP_ERR_TIMEOUT;
+    }
+
+    void* copy = NULL;
+    if (data != NULL && size > 0) {
+        copy = malloc(size);
+        memcpy(copy, data, size);
+    }
+    events[event_count++] = { base, id, copy };
+    return ESP_OK;
+}
+
+void host_dispatch_events(void) {
+    // Handlers may post more events; those run in the same pass
+    for (int i = 0; i < event_count; i++) {
+        host_event_t event = events[i];
+        for (int h = 0; h < handler_count; h++) {
+            if (strcmp(handlers[h].base, event.base) == 0 && (handlers[h].id == ESP_EVENT_ANY_ID || handlers[h].id == event.id)) {
+                handlers[h].handler(handlers[h].arg, event.base, event.id, event.data);
+            }
+        }
+        free(event.data);
+    }
+    event_count = 0;
+}
+
+bool kd_common_ntp_is_synced(void) {
+    return ntp_synced;
+}
+
+void host_set_ntp_synced(bool synced) {
+    ntp_synced = synced;
+    esp_event_post(KD_NTP_EVENTS, synced ? KD_NTP_EVENT_SYNC_COMPLETE : KD_NTP_EVENT_SYNC_LOST, NULL, 0, 0);
+    host_dispatch_events();
+}
+
+static kd_common_api_handler_cb api_callbacks[4];
+static int api_callback_count = 0;
+
+void kd_common_api_register_handlers(kd_common_api_handler_cb callback) {
+    if (api_callback_count < 4) {
+        api_callbacks[api_callback_count++] = callback;
+    }
+}
+
+void kd_common_set_device_info(const char* model, const char* type) {
+}
+
+void host_start_httpd(void) {
+    for (int i = 0; i < api_callback_count; i++) {
+        api_callbacks[i](&api_callbacks);
+    }
+}
+
+const char* esp_err_to_name(esp_err_t err) {
+    return err == ESP_OK ? "ESP_OK" : "ESP_ERR";
+}
+
+uint32_t esp_random(void) {
+    return (uint32_t)rand();
+}
+
+uint32_t esp_rom_crc32_le(uint32_t crc, uint8_t const* buf, uint32_t len) {
+    crc = ~crc;
+    for (uint32_t i = 0; i < len; i++) {
+        crc ^= buf[i];
+        for (int bit = 0; bit < 8; bit++) {
+            crc = (crc >> 1) ^ (0xEDB88320u & (0u - (crc & 1u)));
+        }
+    }
+    return ~crc;
+}
+
+typedef struct {
+    esp_partition_t partition;
+    uint8_t* flash;
+    int mappings;
+} host_partition_t;
+
+static host_partition_t partitions[HOST_PARTITIONS_MAX];
+static int partition_count = 0;
+
+void host_partition_add(const char* label, size_t size) {
+    host_partition_t* p = &partitions[partition_count++];
+    p->partition.type = ESP_PARTITION_TYPE_DATA;
+    p->partition.size = size;
+    p->partition.erase_size = HOST_SECTOR_SIZE;
+    strncpy(p->partition.label, label, sizeof(p->partition.label) - 1);
+    p->flash = (uint8_t*)malloc(size);
+    memset(p->flash, 0xff, size);
+}
+
+static host_partition_t* find_partition(const esp_partition_t* partition) {
+    for (int i = 0; i < partition_count; i++) {
+        if (&partitions[i].partition == partition) {
+            return &partitions[i];
+        }
+    }
+    return NULL;
+}
+
+int host_partition_mappings(const char* label) {
+    for (int i = 0; i < partition_count; i++) {
+        if (strcmp(partitions[i].partition.label, label) == 0) {
+            return partitions[i].mappings;
+        }
+    }
+    return 0;
+}
+
+const esp_partition_t* esp_partition_find_first(esp_partition_type_t type, esp_partition_subtype_t subtype, const char* label) {
+    for (int i = 0; i < partition_count; i++) {
+        if (label != NULL && strcmp(partitions[i].partition.label, label) == 0) {
+            return &partitions[i].partition;
+        }
+    }
+    return NULL;
+}
+
+esp_err_t esp_partition_read(const esp_partition_t* partition, size_t offset, void* dst, size_t size) {
+    host_partition_t* p = find_partition(partition);
+    if (p == NULL || offset > partition->size || size > partition->size - offset) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    memcpy(dst, p->flash + offset, size);
+    return ESP_OK;
+}
+
+esp_err_t esp_partition_write(const esp_partition_t* partition, size_t offset, const void* src, size_t size) {
+    host_partition_t* p = find_partition(partition);
+    if (p == NULL || offset > partition->size || size > partition->size - offset) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    for (size_t i = 0; i < size; i++) {
+        p->flash[offset + i] &= ((const uint8_t*)src)[i];
+    }
+    return ESP_OK;
+}
+
+esp_err_t esp_partition_erase_range(const esp_partition_t* partition, size_t offset, size_t size) {
+    host_partition_t* p = find_partition(partition);
+    if (p == NULL || offset % HOST_SECTOR_SIZE != 0 || size % HOST_SECTOR_SIZE != 0 || offset > partition->size ||
+        size > partition->size - offset) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    memset(p->flash + offset, 0xff, size);
+    return ESP_OK;
+}
+
+// The handle is the partition index; mappings are only counted
+esp_err_t esp_partition_mmap(const esp_partition_t* partition, size_t offset, size_t size,
+    esp_partition_mmap_memory_t memory, const void** out_ptr, esp_partition_mmap_handle_t* out_handle) {
+    host_partition_t* p = find_partition(partition);
+    if (p == NULL || offset > partition->size || size > partition->size - offset) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    p->mappings++;
+    *out_ptr = p->flash + offset;
+    *out_handle = (esp_partition_mmap_handle_t)(p - partitions);
+    return ESP_OK;
+}
+
+void esp_partition_munmap(esp_partition_mmap_handle_t handle) {
+    partitions[handle].mappings--;
+}
+
+static void task_entry(void) {
+    current_task->function(current_task->arg);
+    // FreeRTOS tasks never return
+    abort();
+}
+
+// Helper function to hand the CPU back to host_run_until() until due_us
+static void task_block(int64_t due_us) {
+    host_task_t* task = current_task;
+    task->due_us = due_us;
+    swapcontext(&task->context, &scheduler_context);
+}
+
+TaskHandle_t xTaskCreateStatic(TaskFunction_t function, const char* name, uint32_t stack_size, void* arg,
+    UBaseType_t priority, StackType_t* stack, StaticTask_t* tcb) {
+    if (task_count == HOST_TASKS_MAX) {
+        return NULL;
+    }
+    host_task_t* task = &tasks[task_count++];
+    *task = {};
+    task->function = function;
+    task->arg = arg;
+    task->due_us = now_us;
+
+    getcontext(&task->context);
+    task->context.uc_stack.ss_sp = malloc(HOST_TASK_STACK_SIZE);
+    task->context.uc_stack.ss_size = HOST_TASK_STACK_SIZE;
+    task->context.uc_link = NULL;
+    makecontext(&task->context, task_entry, 0);
+    return task;
+}
+
+void vTaskDelay(TickType_t ticks) {
+    // Outside a task there is nothing else to run
+    if (current_task != NULL) {
+        task_block(now_us + (int64_t)ticks * 1000);
+    }
+}
+
+UBaseType_t uxTaskGetStackHighWaterMark(TaskHandle_t task) {
+    return 0;
+}
+
+TickType_t xTaskGetTickCount(void) {
+    return (TickType_t)(now_us / 1000);
+}
+
+const char* pcTaskGetName(TaskHandle_t task) {
+    return "host";
+}
+
+TaskHandle_t xTaskGetHandle(const char* name) {
+    return NULL;
+}
+
+TaskHandle_t xTaskGetCurrentTaskHandle(void) {
+    return current_task != NULL ? current_task : &main_task;
+}
+
+uint32_t ulTaskNotifyTake(BaseType_t clear_on_exit, TickType_t wait) {
+    host_task_t* task = current_task != NULL ? current_task : &main_task;
+    if (task->notifications == 0 && wait > 0 && task != &main_task) {
+        task->waiting = true;
+        task_block(wait == portMAX_DELAY ? HOST_NEVER : now_us + (int64_t)wait * 1000);
+        task->waiting = false;
+    }
+
+    uint32_t value = task->notifications;
+    if (value > 0) {
+        task->notifications = clear_on_exit ? 0 : value - 1;
+    }
+    return value;
+}
+
+void xTaskNotifyGive(TaskHandle_t handle) {
+    host_task_t* task = (host_task_t*)handle;
+    if (task == NULL) {
+        return;
+    }
+    task->notifications++;
+    if (task->waiting) {
+        task->due_us = now_us;
+    }
+}
+
+SemaphoreHandle_t xSemaphoreCreateMutexStatic(StaticSemaphore_t* buffer) {
+    buffer->held = 0;
+    return buffer;
+}
+
+BaseType_t xSemaphoreTake(SemaphoreHandle_t semaphore, TickType_t wait) {
+    semaphore->held++;
+    return pdTRUE;
+}
+
+BaseType_t xSemaphoreGive(SemaphoreHandle_t semaphore) {
+    semaphore->held--;
+    return pdTRUE;
+}
+
+esp_err_t esp_register_shutdown_handler(shutdown_handler_t handler) {
+    return ESP_OK;
+}
+
+void esp_restart(void) {
+    exit(2);
+}
+
+size_t heap_caps_get_free_size(uint32_t caps) {
+    return 0;
+}
+
+size_t heap_caps_get_minimum_free_size(uint32_t caps) {
+    return 0;
+}
+
+size_t heap_caps_get_largest_free_block(uint32_t caps) {
+    return 0;
+}
+
+// A single channel, sized by addChannel()
+static PixelChannel main_channel;
+
+void PixelDriver::initialize(int frame_rate) {
+}
+
+void PixelDriver::setCurrentLimit(int milliamps) {
+}
+
+void PixelDriver::addChannel(ChannelConfig config) {
+    main_channel.pixels.assign(config.count, PixelColor());
+    main_channel.mask.assign(config.count, 0);
+}
+
+void PixelDriver::start() {
+}
+
+PixelChannel* PixelDriver::getMainChannel() {
+    return &main_channel;
+}
+
+void PixelChannel::setColor(PixelColor color) {
+}
+
+void PixelChannel::setEffectByID(const char* id) {
+    strncpy(effect, id, sizeof(effect) - 1);
+}
+
+void PixelChannel::setBrightness(uint8_t value) {
+    brightness = value;
+}
+
+void PixelChannel::loadFromNVS() {
+    setEffectByID("stored");
+    brightness = stored_brightness;
+}
+
+void PixelChannel::setMask(const std::vector<uint8_t>& value) {
+    mask = value;
+    masks_set++;
+}
+
+std::vector<PixelColor>& PixelChannel::getPixelBuffer() {
+    return pixels;
+}
+
+void PixelDriver::attach_api(httpd_handle_t server) {
+}
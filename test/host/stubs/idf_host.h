@@ -0,0 +1,72 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include <time.h>
+
+#include "esp_err.h"
+
+/*
+ * Host stand-in for the parts of ESP-IDF the clock code runs on
+ *
+ * Time is simulated: nothing happens until the test advances it. Timers
+ * fire in order of their due time, and events posted from a timer callback
+ * are handled right after it returns, as the default event loop would.
+ * Tasks run in the same order of time, each until it next blocks in
+ * vTaskDelay() or ulTaskNotifyTake().
+ */
+
+/**
+ * @brief Set the wall clock time at the current simulated instant
+ *
+ * time() advances from it with esp_timer_get_time().
+ */
+void host_set_epoch(time_t epoch);
+
+/**
+ * @brief Fire every timer and run every task due up to until_us, and handle
+ *        the events they post
+ */
+void host_run_until(int64_t until_us);
+
+/**
+ * @brief Handle queued events
+ */
+void host_dispatch_events(void);
+
+/**
+ * @brief Change what kd_common_ntp_is_synced() reports and post the matching
+ *        KD_NTP_EVENTS event
+ */
+void host_set_ntp_synced(bool synced);
+
+/**
+ * @brief Number of timers currently started
+ */
+int host_timers_running(void);
+
+/**
+ * @brief Run the handler registration callbacks, as kd_common does once the
+ *        HTTP server is up
+ */
+void host_start_httpd(void);
+
+/**
+ * @brief Make the next nvs_commit() fail with err, without committing
+ */
+void host_nvs_fail_next(esp_err_t err);
+
+/**
+ * @brief Add an erased data partition of the given size, 4 KiB sectors
+ */
+void host_partition_add(const char* label, size_t size);
+
+/**
+ * @brief Number of mappings of a partition not yet unmapped
+ */
+int host_partition_mappings(const char* label);
+
+/**
+ * @brief Number of spi_device_transmit() calls so far
+ */
+size_t host_spi_transfers(void);
@@ -0,0 +1,21 @@
+#pragma once
+
+#include "esp_event.h"
+#include "esp_http_server.h"
+#include "esp_system.h"
+
+ESP_EVENT_DECLARE_BASE(KD_NTP_EVENTS);
+
+enum {
+    KD_NTP_EVENT_SYNC_COMPLETE,
+    KD_NTP_EVENT_SYNC_LOST,
+};
+
+// Follows host_set_ntp_synced()
+bool kd_common_ntp_is_synced(void);
+
+void kd_common_set_device_info(const char* model, const char* type);
+
+// Callbacks run from host_start_httpd()
+typedef void (*kd_common_api_handler_cb)(httpd_handle_t server);
+void kd_common_api_register_handlers(kd_common_api_handler_cb callback);
@@ -0,0 +1,48 @@
+#pragma once
+
+#include <stdint.h>
+#include <vector>
+
+#include "esp_http_server.h"
+#include "soc/gpio_num.h"
+
+// The driver surface the clocks use; effects are not rendered on the host
+struct PixelColor {
+    uint8_t r, g, b, w;
+    PixelColor(uint8_t r = 0, uint8_t g = 0, uint8_t b = 0, uint8_t w = 0) : r(r), g(g), b(b), w(w) {}
+};
+
+enum class PixelFormat { RGB, RGBW };
+
+struct ChannelConfig {
+    ChannelConfig(gpio_num_t pin, uint16_t count, PixelFormat format, const char* name) : count(count) {}
+    uint16_t count;
+};
+
+class PixelChannel {
+public:
+    void setColor(PixelColor color);
+    void setEffectByID(const char* id);
+    void setBrightness(uint8_t brightness);
+    void loadFromNVS();
+    void setMask(const std::vector<uint8_t>& mask);
+    std::vector<PixelColor>& getPixelBuffer();
+
+    // Host inspection
+    std::vector<PixelColor> pixels;
+    std::vector<uint8_t> mask;
+    char effect[16] = "";
+    uint8_t brightness = 255;
+    uint8_t stored_brightness = 255;    // Restored by loadFromNVS(), as set through the LED API
+    uint32_t masks_set = 0;
+};
+
+class PixelDriver {
+public:
+    static void initialize(int frame_rate);
+    static void setCurrentLimit(int milliamps);
+    static void addChannel(ChannelConfig config);
+    static void start();
+    static PixelChannel* getMainChannel();
+    static void attach_api(httpd_handle_t server);
+};
@@ -0,0 +1,14 @@
+#pragma once
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+
+/*
+ * Request sockets have no peer on the host: getpeername() reports
+ * 10.0.0.<fd> for the fd a test put in the request, as lwIP's compat
+ * macros route it to lwip_getpeername() on the device.
+ */
+int lwip_getpeername(int s, struct sockaddr* name, socklen_t* namelen);
+
+#define getpeername(s, name, namelen) lwip_getpeername(s, name, namelen)
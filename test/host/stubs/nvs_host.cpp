@@ -0,0 +1,95 @@
+#include "nvs.h"
+
+#include <string.h>
+#include <map>
+#include <string>
+#include <vector>
+
+#include "idf_host.h"
+
+// Namespaces by handle; blobs by "namespace/key"
+static std::vector<std::string> handles;
+static std::map<std::string, std::vector<uint8_t>> committed;
+static std::map<std::string, std::vector<uint8_t>> staged;
+static bool staged_erase_all = false;
+static esp_err_t next_failure = ESP_OK;
+
+void host_nvs_fail_next(esp_err_t err) {
+    next_failure = err;
+}
+
+// Helper function to return and clear the injected failure
+static esp_err_t take_failure(void) {
+    esp_err_t err = next_failure;
+    next_failure = ESP_OK;
+    return err;
+}
+
+esp_err_t nvs_open(const char* name, nvs_open_mode_t mode, nvs_handle_t* out) {
+    if (mode == NVS_READONLY) {
+        bool exists = false;
+        for (const auto& blob : committed) {
+            exists = exists || blob.first.compare(0, strlen(name) + 1, std::string(name) + "/") == 0;
+        }
+        if (!exists) {
+            return ESP_ERR_NVS_NOT_FOUND;
+        }
+    }
+    handles.push_back(name);
+    *out = (nvs_handle_t)handles.size();
+    return ESP_OK;
+}
+
+void nvs_close(nvs_handle_t handle) {
+    staged.clear();
+    staged_erase_all = false;
+}
+
+esp_err_t nvs_get_blob(nvs_handle_t handle, const char* key, void* out, size_t* length) {
+    auto blob = committed.find(handles[handle - 1] + "/" + key);
+    if (blob == committed.end()) {
+        return ESP_ERR_NVS_NOT_FOUND;
+    }
+    if (*length < blob->second.size()) {
+        return ESP_ERR_NVS_BASE + 0x07;     // ESP_ERR_NVS_INVALID_LENGTH
+    }
+    memcpy(out, blob->second.data(), blob->second.size());
+    *length = blob->second.size();
+    return ESP_OK;
+}
+
+esp_err_t nvs_set_blob(nvs_handle_t handle, const char* key, const void* value, size_t length) {
+    const uint8_t* bytes = (const uint8_t*)value;
+    staged[handles[handle - 1] + "/" + key] = std::vector<uint8_t>(bytes, bytes + length);
+    return ESP_OK;
+}
+
+esp_err_t nvs_erase_key(nvs_handle_t handle, const char* key) {
+    committed.erase(handles[handle - 1] + "/" + key);
+    return ESP_OK;
+}
+
+esp_err_t nvs_erase_all(nvs_handle_t handle) {
+    staged_erase_all = true;
+    return ESP_OK;
+}
+
+esp_err_t nvs_commit(nvs_handle_t handle) {
+    esp_err_t err = take_failure();
+    if (err != ESP_OK) {
+        return err;
+    }
+
+    const std::string prefix = handles[handle - 1] + "/";
+    if (staged_erase_all) {
+        for (auto blob = committed.begin(); blob != committed.end();) {
+            blob = blob->first.compare(0, prefix.size(), prefix) == 0 ? committed.erase(blob) : std::next(blob);
+        }
+    }
+    for (const auto& blob : staged) {
+        committed[blob.first] = blob.second;
+    }
+    staged.clear();
+    staged_erase_all = false;
+    return ESP_OK;
+}
@@ -0,0 +1,23 @@
+#pragma once
+
+// Host build configuration. The clock type (CONFIG_BASE_CLOCK_TYPE_*),
+// CONFIG_ALLOC_TRACE, CONFIG_HTTP_GOVERNOR and CONFIG_STATE_WS_MAX_CLIENTS
+// are set per target in test/host/CMakeLists.txt.
+#define CONFIG_WORDCLOCK_LED_DATA_PIN 4
+#define CONFIG_WORDCLOCK_GRID_PARTITION "wc_grid"
+#define CONFIG_SETTINGS_WRITE_DELAY_MS 1000
+#define CONFIG_SETTINGS_WRITE_MAX_DELAY_MS 5000
+#define CONFIG_FIBONACCI_LED_DATA_PIN 4
+#define CONFIG_NIXIE_LED_DATA_PIN 21
+#define CONFIG_NIXIE_LED_COUNT 6
+#define CONFIG_NIXIE_BRIGHTNESS_PIN 11
+#define CONFIG_SHIFTREG_SPI_MOSI_PIN 10
+#define CONFIG_SHIFTREG_SPI_CLK_PIN 12
+#define CONFIG_SHIFTREG_LATCH_PIN 13
+#define CONFIG_SHIFTREG_SPI_MODE 3
+#define CONFIG_WEBUI_BUNDLE_PARTITION "webui"
+#define CONFIG_HTTP_GOVERNOR_CLIENT_RATE 10
+#define CONFIG_HTTP_GOVERNOR_CLIENT_BURST 20
+#define CONFIG_HTTP_GOVERNOR_CONTROL_RESERVE 4
+#define CONFIG_HTTP_GOVERNOR_MAX_IN_FLIGHT 4
+#define CONFIG_STATE_WS_STALL_TIMEOUT_MS 3000
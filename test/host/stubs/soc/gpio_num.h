@@ -0,0 +1,6 @@
+#pragma once
+
+// Pins are passed as casts from Kconfig numbers
+typedef enum : int {
+    GPIO_NUM_NC = -1,
+} gpio_num_t;
@@ -0,0 +1,262 @@
+/*
+ * 20000 config requests through the JSON request path: POST /api/config
+ * with valid, rejected and unknown sections, a section's own POST and
+ * GET /api/config, against a section of the nixie's shape.
+ *
+ * Every heap call of the process is counted, as the allocation tracer does
+ * on the device. The only allocation a request may make is the batch job,
+ * one block of the same size whatever the body, so repeated requests
+ * cannot fragment the heap; nothing may be left allocated afterwards.
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "async_worker.h"
+#include "config_batch.h"
+#include "idf_host.h"
+#include "mem_policy.h"
+#include "settings_store.h"
+
+#define SOAK_REQUESTS 20000
+
+static int failures = 0;
+
+#define CHECK(cond) do { \
+    if (!(cond)) { \
+        printf("FAIL line %d: %s\n", __LINE__, #cond); \
+        failures++; \
+    } \
+} while (0)
+
+// Heap calls while counting is on; sizes only matter while it is
+static bool counting = false;
+static uint32_t allocations = 0;
+static int32_t live_blocks = 0;
+static int32_t most_live = 0;
+static size_t block_sizes[4];
+static size_t block_size_count = 0;
+
+static void record_alloc(size_t size) {
+    if (!counting) {
+        return;
+    }
+    allocations++;
+    live_blocks++;
+    if (live_blocks > most_live) {
+        most_live = live_blocks;
+    }
+    for (size_t i = 0; i < block_size_count; i++) {
+        if (block_sizes[i] == size) {
+            return;
+        }
+    }
+    if (block_size_count < sizeof(block_sizes) / sizeof(block_sizes[0])) {
+        block_sizes[block_size_count] = size;
+    }
+    block_size_count++;
+}
+
+extern "C" {
+void* __libc_malloc(size_t size);
+void* __libc_calloc(size_t count, size_t size);
+void* __libc_realloc(void* ptr, size_t size);
+void __libc_free(void* ptr);
+
+void* malloc(size_t size) {
+    record_alloc(size);
+    return __libc_malloc(size);
+}
+
+void* calloc(size_t count, size_t size) {
+    record_alloc(count * size);
+    return __libc_calloc(count, size);
+}
+
+void* realloc(void* ptr, size_t size) {
+    if (ptr == NULL) {
+        record_alloc(size);
+    }
+    else if (counting) {
+        allocations++;
+    }
+    return __libc_realloc(ptr, size);
+}
+
+void free(void* ptr) {
+    if (ptr != NULL && counting) {
+        live_blocks--;
+    }
+    __libc_free(ptr);
+}
+}
+
+// No worker pool and an idle server: everything runs on the calling task
+esp_err_t async_worker_submit(httpd_req_t* req, esp_err_t (*handler)(httpd_req_t* req)) {
+    return handler(req);
+}
+
+esp_err_t async_worker_run_on_httpd(httpd_req_t* req, void (*work)(void* arg), void* arg, void (*release)(void* arg)) {
+    work(arg);
+    return ESP_OK;
+}
+
+void* mem_alloc(mem_subsystem_t subsystem, size_t size) {
+    return malloc(size);
+}
+
+void mem_free(mem_subsystem_t subsystem, void* ptr) {
+    free(ptr);
+}
+
+static uint32_t flushes = 0;
+
+void settings_store_flush(void) {
+    flushes++;
+}
+
+// The section: a brightness, a switch and a name that must not be "bad"
+typedef struct {
+    int32_t brightness;
+    bool on;
+    char name[8];
+} soak_config_t;
+
+static soak_config_t soak_config = { 50, true, "clock" };
+static soak_config_t soak_staged;
+static int32_t soak_staged_brightness;
+static uint32_t commits = 0;
+
+static json_field_t soak_fields[] = {
+    { .key = "brightness", .type = JSON_FIELD_INT, .value = &soak_staged_brightness },
+    { .key = "on", .type = JSON_FIELD_BOOL, .value = &soak_staged.on },
+    { .key = "name", .type = JSON_FIELD_STRING, .value = soak_staged.name, .size = sizeof(soak_staged.name) },
+};
+
+static void begin_soak_config(void) {
+    soak_staged = soak_config;
+    soak_staged_brightness = soak_config.brightness;
+}
+
+static esp_err_t validate_soak_config(const char** error) {
+    if (strcmp(soak_staged.name, "bad") == 0) {
+        *error = "name: not allowed";
+        return ESP_ERR_INVALID_ARG;
+    }
+    soak_staged.brightness = (soak_staged_brightness < 0) ? 0 : (soak_staged_brightness > 100) ? 100 : soak_staged_brightness;
+    return ESP_OK;
+}
+
+static void commit_soak_config(void) {
+    soak_config = soak_staged;
+    commits++;
+}
+
+static void write_soak_config(json_writer_t* writer) {
+    json_object_begin(writer);
+    json_kv_int(writer, "brightness", soak_config.brightness);
+    json_kv_bool(writer, "on", soak_config.on);
+    json_kv_string(writer, "name", soak_config.name);
+    json_object_end(writer);
+}
+
+static const config_section_t soak_section = {
+    .name = "soak",
+    .fields = soak_fields,
+    .field_count = sizeof(soak_fields) / sizeof(soak_fields[0]),
+    .begin = begin_soak_config,
+    .validate = validate_soak_config,
+    .commit = commit_soak_config,
+    .write = write_soak_config,
+};
+
+static esp_err_t soak_post_handler(httpd_req_t* req) {
+    if (config_section_read_request(req, &soak_section, NULL, 0) != ESP_OK) {
+        return ESP_FAIL;
+    }
+    commit_soak_config();
+    return ESP_OK;
+}
+
+static httpd_uri_t* find_handler(const char* uri, httpd_method_t method) {
+    for (size_t i = 0; i < host_uri_handler_count; i++) {
+        if (host_uri_handlers[i].method == method && strcmp(host_uri_handlers[i].uri, uri) == 0) {
+            return &host_uri_handlers[i];
+        }
+    }
+    return NULL;
+}
+
+static const char* request(httpd_req_t* req, const char* uri, httpd_method_t method, const char* body) {
+    host_request_init(req, uri, body);
+    req->method = method;
+    req->recv_max = 64;
+    if (strcmp(uri, "/api/soak") == 0) {
+        soak_post_handler(req);
+    }
+    else {
+        find_handler(uri, method)->handler(req);
+    }
+    host_dispatch_events();
+    return req->status;
+}
+
+int main() {
+    config_batch_register(&soak_section);
+    register_config_batch_handlers(NULL);
+
+    static httpd_req_t req;
+    char body[96];
+    uint32_t batch_posts = 0;
+    counting = true;
+
+    for (int i = 0; i < SOAK_REQUESTS; i++) {
+        int brightness = (i * 7919) % 100000;
+        switch (i % 5) {
+        case 0:
+            // Bodies of different lengths, for blocks of the same size
+            snprintf(body, sizeof(body), "{\"soak\": {\"brightness\": %d, \"on\": %s, \"name\": \"%.*s\"}}",
+                brightness, i % 2 ? "true" : "false", 1 + i % 7, "abcdefg");
+            CHECK(strcmp(request(&req, "/api/config", HTTP_POST, body), "200 OK") == 0);
+            batch_posts++;
+            break;
+        case 1:
+            CHECK(strcmp(request(&req, "/api/config", HTTP_POST, "{\"soak\": {}, \"other\": {\"on\": true}}"),
+                "400 Bad Request") == 0);
+            batch_posts++;
+            break;
+        case 2:
+            CHECK(strcmp(request(&req, "/api/config", HTTP_POST, "{\"soak\": {\"on\": true, \"name\": \"bad\"}}"),
+                "400 Bad Request") == 0);
+            CHECK(strstr(req.response, "soak: name: not allowed") != NULL);
+            batch_posts++;
+            break;
+        case 3:
+            snprintf(body, sizeof(body), "{\"brightness\": %d}", brightness);
+            CHECK(strcmp(request(&req, "/api/soak", HTTP_POST, body), "200 OK") == 0);
+            break;
+        default:
+            CHECK(strcmp(request(&req, "/api/config", HTTP_GET, NULL), "200 OK") == 0);
+            CHECK(strstr(req.response, "\"soak\":{\"brightness\":") != NULL);
+            break;
+        }
+        CHECK(live_blocks == 0);
+    }
+    counting = false;
+
+    printf("%d requests: %u allocations of %zu size(s), %d block(s) live at most, %u commits, %u flushes\n",
+        SOAK_REQUESTS, (unsigned)allocations, block_size_count, (int)most_live, (unsigned)commits, (unsigned)flushes);
+    CHECK(allocations == batch_posts);
+    CHECK(block_size_count == 1);
+    CHECK(most_live == 1);
+    CHECK(commits == SOAK_REQUESTS / 5 * 2);
+    CHECK(flushes == SOAK_REQUESTS / 5);
+    CHECK(soak_config.brightness >= 0 && soak_config.brightness <= 100);
+
+    if (failures > 0) {
+        printf("%d checks failed\n", failures);
+        return 1;
+    }
+    printf("The request path leaves the heap as it found it\n");
+    return 0;
+}
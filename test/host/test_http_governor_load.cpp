@@ -0,0 +1,296 @@
+/*
+ * The HTTP governor under a request flood, on a model of one core with
+ * FreeRTOS priorities: lwIP at 18, the event loop at 20, and the httpd and
+ * render tasks at 5 with 1 ms round robin. Admission is the real
+ * http_governor.cpp; the per-request costs below are estimates, not device
+ * measurements.
+ *
+ * One client sends 1000 mixed requests/s while a dashboard reads once a
+ * second and changes a setting every tenth. A second tick is posted to the
+ * event loop each second and ends in a frame on the render task. Without
+ * the governor the ticks miss their budget; with it every tick makes it
+ * and every dashboard request is answered.
+ *
+ *   test_http_governor_load [requests per second]
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <algorithm>
+#include <deque>
+#include <vector>
+
+#include "esp_timer.h"
+#include "http_governor.h"
+#include "idf_host.h"
+
+#define FLOOD_RATE 1000
+#define RUN_SECONDS 300
+#define STEP_US 10
+
+// Tick posted to frame shown
+#define TICK_BUDGET_US 10000
+
+// Costs in microseconds
+#define RX_US 250                   // lwIP, per request received
+#define TX_US_PER_KB 100            // lwIP, per KB sent
+#define TX_MIN_US 30
+#define PARSE_US 150                // httpd, request line and headers
+#define REJECT_US 60                // Governor decision and a tiny response
+#define CONTROL_US 600
+#define READ_US 400
+#define STATIC_US 2000
+#define CONFIG_EVENT_US 3000        // CONFIG_CHANGED: apply and redraw on the event loop
+#define TICK_EVENT_US 200           // SECOND_TICK handler, wakes the render task
+#define RENDER_US 1500              // Frame after a tick
+
+#define EVENT_QUEUE 32              // Default event loop queue
+#define HTTPD_BACKLOG 16            // Requests waiting on open sockets
+
+#define FLOOD_FD 1
+#define DASHBOARD_FD 2
+
+static int failures = 0;
+
+#define CHECK(cond) do { \
+    if (!(cond)) { \
+        printf("FAIL line %d: %s\n", __LINE__, #cond); \
+        failures++; \
+    } \
+} while (0)
+
+typedef enum { TASK_TCPIP, TASK_EVENT, TASK_HTTPD, TASK_RENDER, TASK_COUNT } task_id_t;
+
+static const int task_priority[TASK_COUNT] = { 18, 20, 5, 5 };
+
+typedef enum {
+    DONE_NOTHING,
+    DONE_RECEIVED,      // Request waits for the httpd task
+    DONE_HANDLED,       // Response goes to lwIP, a control request posts a redraw
+    DONE_TICK,          // Render task draws the frame
+    DONE_FRAME,         // Tick latency recorded
+} job_done_t;
+
+typedef struct {
+    int us;
+    job_done_t done;
+    int fd;
+    http_class_t cls;
+    int kb;
+    bool posts;
+    int64_t posted_at;
+} job_t;
+
+typedef struct {
+    int fd;
+    http_class_t cls;
+} pending_t;
+
+typedef struct {
+    std::vector<int64_t> tick_latency;
+    int ticks_missed;
+    int over_budget;
+    int answered[DASHBOARD_FD + 1];
+    int limited[DASHBOARD_FD + 1];
+    int shed[DASHBOARD_FD + 1];
+    int backlog_drops;
+} load_result_t;
+
+static std::deque<job_t> queues[TASK_COUNT];
+static std::deque<pending_t> backlog;
+static load_result_t* result;
+
+static esp_err_t handled(httpd_req_t* req) {
+    return ESP_OK;
+}
+
+static bool post_event(int us, job_done_t done, int64_t posted_at) {
+    if (queues[TASK_EVENT].size() >= EVENT_QUEUE) {
+        return false;
+    }
+    queues[TASK_EVENT].push_back({ .us = us, .done = done, .posted_at = posted_at });
+    return true;
+}
+
+static void arrive(int fd, http_class_t cls) {
+    queues[TASK_TCPIP].push_back({ .us = RX_US, .done = DONE_RECEIVED, .fd = fd, .cls = cls });
+}
+
+// Helper function to take the next request on the httpd task and admit it
+static void start_request(bool governed) {
+    pending_t pending = backlog.front();
+    backlog.pop_front();
+
+    httpd_req_t req;
+    host_request_init(&req, "/api/test", NULL);
+    req.sockfd = pending.fd;
+    if (governed) {
+        http_governor_run(&req, pending.cls, handled);
+    }
+    int status = atoi(req.status);
+
+    job_t job = { .us = PARSE_US, .done = DONE_HANDLED, .fd = pending.fd, .cls = pending.cls };
+    if (status == 429) {
+        result->limited[pending.fd]++;
+        job.us += REJECT_US;
+    }
+    else if (status == 503) {
+        result->shed[pending.fd]++;
+        job.us += REJECT_US;
+    }
+    else {
+        result->answered[pending.fd]++;
+        job.us += pending.cls == HTTP_CLASS_CONTROL ? CONTROL_US : pending.cls == HTTP_CLASS_READ ? READ_US : STATIC_US;
+        job.kb = pending.cls == HTTP_CLASS_STATIC ? 8 : 1;
+        job.posts = pending.cls == HTTP_CLASS_CONTROL;
+    }
+    queues[TASK_HTTPD].push_back(job);
+}
+
+static void finish(const job_t& job, int64_t now) {
+    switch (job.done) {
+        case DONE_RECEIVED:
+            if (backlog.size() >= HTTPD_BACKLOG) {
+                result->backlog_drops++;
+            }
+            else {
+                backlog.push_back({ job.fd, job.cls });
+            }
+            break;
+        case DONE_HANDLED:
+            if (job.posts) {
+                post_event(CONFIG_EVENT_US, DONE_NOTHING, 0);
+            }
+            queues[TASK_TCPIP].push_back({ .us = job.kb > 0 ? job.kb * TX_US_PER_KB : TX_MIN_US });
+            break;
+        case DONE_TICK:
+            queues[TASK_RENDER].push_back({ .us = RENDER_US, .done = DONE_FRAME, .posted_at = job.posted_at });
+            break;
+        case DONE_FRAME:
+            result->tick_latency.push_back(now - job.posted_at);
+            break;
+        default:
+            break;
+    }
+}
+
+static void run_load(int rate, bool governed, load_result_t* out) {
+    result = out;
+    for (int t = 0; t < TASK_COUNT; t++) {
+        queues[t].clear();
+    }
+    backlog.clear();
+
+    const int64_t start = esp_timer_get_time();
+    const int64_t end = start + (int64_t)RUN_SECONDS * 1000000;
+    int64_t next_flood = start, next_dashboard = start, next_tick = start + 500000;
+    int64_t slice_end = 0;
+    int current = -1;
+    uint32_t lcg = 12345;
+
+    for (int64_t now = start; now < end; now += STEP_US) {
+        host_run_until(now);
+
+        // Four in ten control, four reads, two static assets
+        if (now >= next_flood) {
+            lcg = lcg * 1103515245 + 12345;
+            int pick = (lcg >> 16) % 10;
+            arrive(FLOOD_FD, pick < 4 ? HTTP_CLASS_CONTROL : pick < 8 ? HTTP_CLASS_READ : HTTP_CLASS_STATIC);
+            next_flood += 1000000 / rate;
+        }
+        if (now >= next_dashboard) {
+            bool control = ((next_dashboard - start) / 1000000) % 10 == 0;
+            arrive(DASHBOARD_FD, control ? HTTP_CLASS_CONTROL : HTTP_CLASS_READ);
+            next_dashboard += 1000000;
+        }
+        if (now >= next_tick) {
+            if (!post_event(TICK_EVENT_US, DONE_TICK, now)) {
+                out->ticks_missed++;
+            }
+            next_tick += 1000000;
+        }
+        if (queues[TASK_HTTPD].empty() && !backlog.empty()) {
+            start_request(governed);
+        }
+
+        int best = -1;
+        for (int t = 0; t < TASK_COUNT; t++) {
+            if (!queues[t].empty() && (best < 0 || task_priority[t] > task_priority[best])) {
+                best = t;
+            }
+        }
+        if (best < 0) {
+            continue;
+        }
+
+        // Equal priorities take turns every tick
+        if (task_priority[best] == task_priority[TASK_HTTPD]) {
+            bool keep = current >= 0 && !queues[current].empty() && now < slice_end;
+            if (!keep) {
+                int next = current < 0 ? TASK_HTTPD : current;
+                do {
+                    next = (next + 1) % TASK_COUNT;
+                } while (task_priority[next] != task_priority[TASK_HTTPD] || queues[next].empty());
+                current = next;
+                slice_end = now + 1000;
+            }
+            best = current;
+        }
+
+        job_t& job = queues[best].front();
+        job.us -= STEP_US;
+        if (job.us <= 0) {
+            job_t done = job;
+            queues[best].pop_front();
+            finish(done, now);
+        }
+    }
+
+    for (int64_t latency : out->tick_latency) {
+        out->over_budget += latency > TICK_BUDGET_US;
+    }
+}
+
+static void report(const char* name, load_result_t* r) {
+    std::sort(r->tick_latency.begin(), r->tick_latency.end());
+    size_t n = r->tick_latency.size();
+    double p50 = n > 0 ? r->tick_latency[n / 2] / 1000.0 : -1;
+    double p99 = n > 0 ? r->tick_latency[std::min(n - 1, n * 99 / 100)] / 1000.0 : -1;
+    double max = n > 0 ? r->tick_latency[n - 1] / 1000.0 : -1;
+    printf("%s: %zu ticks, %d missed, %d over budget, p50 %.1f ms, p99 %.1f ms, max %.1f ms\n",
+        name, n, r->ticks_missed, r->over_budget, p50, p99, max);
+    printf("  flood %d answered, %d limited, %d shed; dashboard %d answered, %d limited, %d shed; %d dropped\n",
+        r->answered[FLOOD_FD], r->limited[FLOOD_FD], r->shed[FLOOD_FD],
+        r->answered[DASHBOARD_FD], r->limited[DASHBOARD_FD], r->shed[DASHBOARD_FD], r->backlog_drops);
+}
+
+int main(int argc, char** argv) {
+    int rate = argc > 1 ? atoi(argv[1]) : FLOOD_RATE;
+    if (rate <= 0 || rate > 1000000 / STEP_US) {
+        printf("usage: %s [requests per second, 1 to %d]\n", argv[0], 1000000 / STEP_US);
+        return 2;
+    }
+    printf("%d requests/s for %d s\n", rate, RUN_SECONDS);
+
+    static load_result_t ungoverned = {};
+    run_load(rate, false, &ungoverned);
+    report("Ungoverned", &ungoverned);
+
+    static load_result_t governed = {};
+    run_load(rate, true, &governed);
+    report("Governed", &governed);
+
+    // The flood is heavy enough to matter, and the governor keeps the ticks on time
+    if (rate == FLOOD_RATE) {
+        CHECK(ungoverned.over_budget > 0);
+    }
+    CHECK(governed.ticks_missed == 0);
+    CHECK(governed.over_budget == 0);
+    CHECK(governed.answered[DASHBOARD_FD] == RUN_SECONDS);
+
+    if (failures > 0) {
+        printf("%d checks failed\n", failures);
+        return 1;
+    }
+    printf("Ticks stay within %d ms under the flood\n", TICK_BUDGET_US / 1000);
+    return 0;
+}
@@ -0,0 +1,164 @@
+/*
+ * json_read_request() against bodies received in small pieces, as httpd
+ * hands them over.
+ */
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "json_reader.h"
+
+static int failures = 0;
+
+#define CHECK(cond) do { \
+    if (!(cond)) { \
+        printf("FAIL line %d: %s\n", __LINE__, #cond); \
+        failures++; \
+    } \
+} while (0)
+
+typedef struct {
+    int32_t brightness;
+    bool on;
+    char name[8];
+    float celsius;
+    json_field_t fields[4];
+} sample_t;
+
+// Helper function to read a body into the sample fields, 5 bytes per recv
+static esp_err_t read_sample(const char* body, sample_t* sample, httpd_req_t* req) {
+    memset(sample, 0, sizeof(*sample));
+    json_field_t fields[] = {
+        { .key = "brightness", .type = JSON_FIELD_INT, .value = &sample->brightness },
+        { .key = "on", .type = JSON_FIELD_BOOL, .value = &sample->on },
+        { .key = "name", .type = JSON_FIELD_STRING, .value = sample->name, .size = sizeof(sample->name) },
+        { .key = "celsius", .type = JSON_FIELD_FLOAT, .value = &sample->celsius, .nullable = true },
+    };
+    memcpy(sample->fields, fields, sizeof(fields));
+
+    host_request_init(req, "/api/test", body);
+    req->recv_max = 5;
+    return json_read_request(req, sample->fields, 4);
+}
+
+// Helper function to read a body of sections, each an object of sample fields
+static esp_err_t read_sections(const char* body, sample_t* first, sample_t* second) {
+    memset(first, 0, sizeof(*first));
+    memset(second, 0, sizeof(*second));
+    sample_t* samples[] = { first, second };
+    for (sample_t* sample : samples) {
+        json_field_t fields[] = {
+            { .key = "brightness", .type = JSON_FIELD_INT, .value = &sample->brightness },
+            { .key = "on", .type = JSON_FIELD_BOOL, .value = &sample->on },
+            { .key = "name", .type = JSON_FIELD_STRING, .value = sample->name, .size = sizeof(sample->name) },
+            { .key = "celsius", .type = JSON_FIELD_FLOAT, .value = &sample->celsius, .nullable = true },
+        };
+        memcpy(sample->fields, fields, sizeof(fields));
+    }
+    json_field_t sections[] = {
+        { .key = "first", .type = JSON_FIELD_OBJECT, .value = first->fields, .size = 4 },
+        { .key = "second", .type = JSON_FIELD_OBJECT, .value = second->fields, .size = 4 },
+    };
+
+    json_reader_t reader;
+    json_reader_init(&reader, sections, 2);
+    reader.reject_unknown = true;
+    size_t len = strlen(body);
+    for (size_t offset = 0; offset < len && reader.err == ESP_OK; offset += 3) {
+        json_reader_feed(&reader, body + offset, len - offset < 3 ? len - offset : 3);
+    }
+    return json_reader_finish(&reader);
+}
+
+static bool rejected_with(const httpd_req_t& req, const char* status, const char* message) {
+    return strcmp(req.status, status) == 0 && strstr(req.response, message) != NULL;
+}
+
+int main() {
+    sample_t sample;
+    httpd_req_t req;
+
+    CHECK(read_sample("{\"brightness\": 300, \"on\": true, \"name\": \"x\\u00e9\", \"extra\": [1, {\"a\": null}]}",
+        &sample, &req) == ESP_OK);
+    CHECK(sample.fields[0].found && sample.brightness == 300);
+    CHECK(sample.fields[1].found && sample.on);
+    CHECK(sample.fields[2].found && strcmp(sample.name, "x\xc3\xa9") == 0);
+    CHECK(!sample.fields[3].found);
+    CHECK(!req.finished);
+
+    // Floats keep their fraction, integers are truncated
+    CHECK(read_sample("{\"celsius\": -12.75, \"brightness\": 7.9}", &sample, &req) == ESP_OK);
+    CHECK(sample.fields[3].found && !sample.fields[3].is_null && fabsf(sample.celsius + 12.75f) < 1e-6f);
+    CHECK(sample.brightness == 7);
+    CHECK(read_sample("{\"celsius\": 2e1}", &sample, &req) == ESP_OK);
+    CHECK(sample.celsius == 20.0f);
+
+    // Null only where the field allows it
+    sample.celsius = 5.0f;
+    CHECK(read_sample("{\"celsius\": null}", &sample, &req) == ESP_OK);
+    CHECK(sample.fields[3].found && sample.fields[3].is_null && sample.celsius == 0.0f);
+    CHECK(read_sample("{\"brightness\": null}", &sample, &req) == ESP_FAIL);
+    CHECK(rejected_with(req, "400 Bad Request", "brightness: expected a number at byte"));
+    CHECK(read_sample("{\"on\": null}", &sample, &req) == ESP_FAIL);
+    CHECK(rejected_with(req, "400 Bad Request", "on: expected a boolean at byte"));
+
+    // Wrong types name the field
+    CHECK(read_sample("{\"celsius\": \"warm\"}", &sample, &req) == ESP_FAIL);
+    CHECK(rejected_with(req, "400 Bad Request", "celsius: expected a number or null at byte 12"));
+    CHECK(read_sample("{\"celsius\": true}", &sample, &req) == ESP_FAIL);
+    CHECK(rejected_with(req, "400 Bad Request", "celsius: expected a number or null"));
+    CHECK(read_sample("{\"on\": 1}", &sample, &req) == ESP_FAIL);
+    CHECK(rejected_with(req, "400 Bad Request", "on: expected a boolean"));
+
+    // Limits
+    CHECK(read_sample("{\"name\": \"12345678\"}", &sample, &req) == ESP_FAIL);
+    CHECK(rejected_with(req, "400 Bad Request", "name: longer than 7 bytes"));
+    char large[JSON_READER_MAX_BODY + 16];
+    memset(large, ' ', sizeof(large) - 1);
+    large[0] = '{';
+    large[sizeof(large) - 2] = '}';
+    large[sizeof(large) - 1] = '\0';
+    CHECK(read_sample(large, &sample, &req) == ESP_FAIL);
+    CHECK(rejected_with(req, "413 Content Too Large", "too large"));
+
+    // Malformed bodies
+    CHECK(read_sample("{\"brightness\": 1", &sample, &req) == ESP_FAIL);
+    CHECK(rejected_with(req, "400 Bad Request", "Unexpected end of body"));
+    CHECK(read_sample("[1]", &sample, &req) == ESP_FAIL);
+    CHECK(rejected_with(req, "400 Bad Request", "Body must be a JSON object"));
+    CHECK(read_sample("{\"celsius\": 01}", &sample, &req) == ESP_FAIL);
+    CHECK(rejected_with(req, "400 Bad Request", "Invalid number"));
+
+    // Members of a nested object go to that object's fields only
+    sample_t first, second;
+    CHECK(read_sections("{\"second\": {\"on\": true, \"first\": 1, \"x\": {\"brightness\": 9}}, "
+        "\"first\": {\"brightness\": 40}}", &first, &second) == ESP_OK);
+    CHECK(first.fields[0].found && first.brightness == 40 && !first.fields[1].found);
+    CHECK(second.fields[1].found && second.on && !second.fields[0].found);
+    CHECK(read_sections("{\"first\": {}}", &first, &second) == ESP_OK);
+    CHECK(!first.fields[0].found && !second.fields[0].found);
+
+    // Type errors name the object, and only known top-level members pass
+    CHECK(read_sections("{\"first\": {\"on\": 1}}", &first, &second) == ESP_ERR_INVALID_ARG);
+    CHECK(read_sections("{\"first\": [1]}", &first, &second) == ESP_ERR_INVALID_ARG);
+    CHECK(read_sections("{\"third\": {}}", &first, &second) == ESP_ERR_INVALID_ARG);
+    json_field_t bad[] = { { .key = "first", .type = JSON_FIELD_OBJECT, .value = first.fields, .size = 4 } };
+    json_reader_t reader;
+    json_reader_init(&reader, bad, 1);
+    reader.reject_unknown = true;
+    const char* nested = "{\"first\": {\"on\": 1}}";
+    json_reader_feed(&reader, nested, strlen(nested));
+    CHECK(strcmp(json_reader_error(&reader), "first: on: expected a boolean at byte 17") == 0);
+    json_reader_init(&reader, bad, 1);
+    reader.reject_unknown = true;
+    const char* unknown = "{\"third\": {}}";
+    json_reader_feed(&reader, unknown, strlen(unknown));
+    CHECK(strcmp(json_reader_error(&reader), "third: unknown member at byte 7") == 0);
+
+    if (failures > 0) {
+        printf("%d checks failed\n", failures);
+        return 1;
+    }
+    printf("json_reader behaves\n");
+    return 0;
+}
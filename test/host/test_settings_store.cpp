@@ -0,0 +1,123 @@
+/*
+ * Settings record writes: counters move only for committed writes, and a
+ * failed write leaves every domain it carried pending.
+ */
+#include <stdio.h>
+#include <string.h>
+
+#include "idf_host.h"
+#include "nvs.h"
+#include "settings_store.h"
+
+static int failures = 0;
+
+#define CHECK(cond) do { \
+    if (!(cond)) { \
+        printf("FAIL line %d: %s\n", __LINE__, #cond); \
+        failures++; \
+    } \
+} while (0)
+
+typedef struct {
+    uint8_t level;
+    uint16_t period;
+} first_config_t;
+
+typedef struct {
+    bool enabled;
+} second_config_t;
+
+static first_config_t first_config = { .level = 1, .period = 500 };
+static second_config_t second_config = { .enabled = false };
+
+static const settings_field_t first_fields[] = {
+    SETTINGS_FIELD(1, first_config_t, level),
+    SETTINGS_FIELD(2, first_config_t, period),
+};
+
+static const settings_field_t second_fields[] = {
+    SETTINGS_FIELD(1, second_config_t, enabled),
+};
+
+static settings_domain_t first_domain =
+    SETTINGS_DOMAIN(SETTINGS_ID_NIXIE, "first", first_config, first_fields, nullptr);
+static settings_domain_t second_domain =
+    SETTINGS_DOMAIN(SETTINGS_ID_FIBONACCI, "second", second_config, second_fields, nullptr);
+
+static settings_domain_stats_t stats_of(const char* name) {
+    settings_domain_stats_t stats[SETTINGS_MAX_DOMAINS];
+    size_t count = settings_store_get_stats(stats, SETTINGS_MAX_DOMAINS);
+    for (size_t i = 0; i < count; i++) {
+        if (strcmp(stats[i].name, name) == 0) {
+            return stats[i];
+        }
+    }
+    return {};
+}
+
+static size_t stored_record_size(void) {
+    nvs_handle_t handle;
+    if (nvs_open("settings", NVS_READONLY, &handle) != ESP_OK) {
+        return 0;
+    }
+    uint8_t record[SETTINGS_RECORD_MAX_SIZE];
+    size_t size = sizeof(record);
+    esp_err_t err = nvs_get_blob(handle, "record", record, &size);
+    nvs_close(handle);
+    return err == ESP_OK ? size : 0;
+}
+
+int main() {
+    settings_store_init();
+    CHECK(!settings_load(&first_domain));
+    CHECK(!settings_load(&second_domain));
+    CHECK(settings_store_get_stats(NULL, 0) == 0);
+
+    // A failed commit counts as a failure only and keeps the change pending
+    first_config.level = 7;
+    settings_mark_dirty(&first_domain);
+    host_nvs_fail_next(ESP_ERR_NVS_NOT_ENOUGH_SPACE);
+    settings_store_flush();
+    settings_domain_stats_t first = stats_of("first");
+    CHECK(first.changes == 1 && first.writes == 0 && first.commits == 0 && first.failures == 1);
+    CHECK(first.dirty);
+    CHECK(stored_record_size() == 0);
+
+    // The next flush writes it
+    settings_store_flush();
+    first = stats_of("first");
+    CHECK(first.writes == 1 && first.commits == 1 && first.failures == 1 && !first.dirty);
+    size_t record_size = stored_record_size();
+    CHECK(record_size == 12 + (3 + 1) + (3 + 2) + (3 + 1));
+
+    // Nothing pending, nothing written
+    settings_store_flush();
+    CHECK(stats_of("first").writes == 1);
+
+    // Every domain the failed write carried stays pending
+    first_config.period = 250;
+    second_config.enabled = true;
+    settings_mark_dirty(&first_domain);
+    settings_mark_dirty(&second_domain);
+    host_nvs_fail_next(ESP_FAIL);
+    settings_store_flush();
+    first = stats_of("first");
+    settings_domain_stats_t second = stats_of("second");
+    CHECK(first.dirty && second.dirty);
+    CHECK(first.writes == 1 && first.failures == 2);
+    CHECK(second.writes == 0 && second.failures == 1);
+
+    settings_store_flush();
+    first = stats_of("first");
+    second = stats_of("second");
+    CHECK(!first.dirty && !second.dirty);
+    CHECK(first.writes == 2 && first.commits == 2 && first.changes == 2);
+    CHECK(second.writes == 1 && second.commits == 1 && second.changes == 1);
+
+    if (failures > 0) {
+        printf("%d checks failed\n", failures);
+        return 1;
+    }
+    printf("settings_store behaves\n");
+    return 0;
+}
@@ -0,0 +1,154 @@
+/*
+ * A simulated day of the clock with CONFIG_ALLOC_TRACE: the real time
+ * ticker, the variant's clock event handlers and, on the word clock, the
+ * letter transition frames run for 86400 seconds after sync, and no hot
+ * path may allocate once steady.
+ *
+ * Built once per clock type. Every heap call of the process goes through
+ * the malloc family below, as the heap hooks do on the device. The nixie
+ * clock task runs too, so the 04:00 cathode cleaning cycle is part of the
+ * day.
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "alloc_trace.h"
+#include "clock_events.h"
+#include "clock_time_ticker.h"
+#include "esp_timer.h"
+#include "idf_host.h"
+
+#if defined(CONFIG_BASE_CLOCK_TYPE_NIXIE)
+#include "nixie.h"
+#elif defined(CONFIG_BASE_CLOCK_TYPE_FIBONACCI)
+#include "fibonacci.h"
+#elif defined(CONFIG_BASE_CLOCK_TYPE_WORDCLOCK)
+#include "wordclock.h"
+#endif
+
+// 2023-11-14 22:13:20 UTC
+#define START_EPOCH 1700000000
+#define DAY_SECONDS 86400
+#define HOUR_SECONDS 3600
+
+static int failures = 0;
+
+#define CHECK(cond) do { \
+    if (!(cond)) { \
+        printf("FAIL line %d: %s\n", __LINE__, #cond); \
+        failures++; \
+    } \
+} while (0)
+
+extern "C" {
+void* __libc_malloc(size_t size);
+void* __libc_calloc(size_t count, size_t size);
+void* __libc_realloc(void* ptr, size_t size);
+void __libc_free(void* ptr);
+
+void* malloc(size_t size) {
+    alloc_trace_record_alloc(size);
+    return __libc_malloc(size);
+}
+
+void* calloc(size_t count, size_t size) {
+    alloc_trace_record_alloc(count * size);
+    return __libc_calloc(count, size);
+}
+
+void* realloc(void* ptr, size_t size) {
+    alloc_trace_record_alloc(size);
+    return __libc_realloc(ptr, size);
+}
+
+void free(void* ptr) {
+    if (ptr != NULL) {
+        alloc_trace_record_free();
+    }
+    __libc_free(ptr);
+}
+}
+
+static uint32_t second_ticks = 0;
+static uint32_t minute_ticks = 0;
+static uint32_t hour_ticks = 0;
+
+static void count_ticks(void* arg, esp_event_base_t base, int32_t id, void* data) {
+    switch (id) {
+    case CLOCK_EVENT_SECOND_TICK: second_ticks++; break;
+    case CLOCK_EVENT_MINUTE_TICK: minute_ticks++; break;
+    case CLOCK_EVENT_HOUR_TICK: hour_ticks++; break;
+    default: break;
+    }
+}
+
+static void run_seconds(int seconds) {
+    host_run_until(esp_timer_get_time() + (int64_t)seconds * 1000000);
+}
+
+int main() {
+    setenv("TZ", "CET-1CEST,M3.5.0,M10.5.0/3", 1);
+    tzset();
+    host_set_epoch(START_EPOCH);
+
+#if defined(CONFIG_BASE_CLOCK_TYPE_NIXIE)
+    nixie_clock_init();
+#elif defined(CONFIG_BASE_CLOCK_TYPE_FIBONACCI)
+    fibonacci_clock_init();
+#elif defined(CONFIG_BASE_CLOCK_TYPE_WORDCLOCK)
+    wordclock_clock_init();
+#endif
+    clock_time_ticker_init();
+    alloc_trace_init();
+    esp_event_handler_register(CLOCK_EVENTS, ESP_EVENT_ANY_ID, count_ticks, nullptr);
+
+    host_set_ntp_synced(true);
+    for (int hour = 0; hour < DAY_SECONDS / HOUR_SECONDS; hour++) {
+#ifdef CONFIG_BASE_CLOCK_TYPE_WORDCLOCK
+        // Half the day in each mode; letters mode animates every minute change
+        if (hour == 12) {
+            wordclock_set_mode(WORDCLOCK_MODE_LETTERS);
+        }
+#endif
+        run_seconds(HOUR_SECONDS);
+    }
+
+    printf("%lu second, %lu minute, %lu hour ticks, %zu SPI transfers\n", (unsigned long)second_ticks,
+        (unsigned long)minute_ticks, (unsigned long)hour_ticks, host_spi_transfers());
+
+    // The day really ran
+    CHECK(second_ticks >= DAY_SECONDS - 1 && second_ticks <= DAY_SECONDS + 1);
+    CHECK(minute_ticks >= DAY_SECONDS / 60);
+    CHECK(hour_ticks == DAY_SECONDS / HOUR_SECONDS);
+#ifdef CONFIG_BASE_CLOCK_TYPE_NIXIE
+    // One frame a second, and 3000 for the 10 minutes of cathode cleaning
+    CHECK(host_spi_transfers() >= DAY_SECONDS);
+#endif
+
+    const alloc_path_t hot_paths[] = { ALLOC_PATH_TICKER, ALLOC_PATH_CLOCK, ALLOC_PATH_RENDER };
+    for (alloc_path_t path : hot_paths) {
+        alloc_trace_stats_t stats;
+        alloc_trace_get_stats(path, &stats);
+        printf("%-7s %8lu allocs %8lu frees %8lu in steady state\n", alloc_trace_path_name(path),
+            (unsigned long)stats.allocs, (unsigned long)stats.frees, (unsigned long)stats.violations);
+        CHECK(stats.violations == 0);
+    }
+
+    // And an allocation on a hot path would have been caught
+    {
+        ALLOC_TRACE_SCOPE(ALLOC_PATH_RENDER);
+        void* volatile block = malloc(32);
+        free(block);
+    }
+    alloc_trace_stats_t render;
+    alloc_trace_get_stats(ALLOC_PATH_RENDER, &render);
+    CHECK(render.violations == 1 && render.last_size == 32);
+
+    if (failures > 0) {
+        printf("%d checks failed\n", failures);
+        return 1;
+    }
+    printf("No hot-path allocations in a simulated day\n");
+    return 0;
+}
@@ -0,0 +1,193 @@
+/*
+ * The web UI bundle partition against a bundle of the stand-in UI in
+ * static_files/, which has the shape of a clock-app build:
+ *
+ *   test_webui_bundle export <dir>     write the UI as a dist tree of .gz files
+ *   test_webui_bundle check <image>    serve the image tools/webui_bundle.py
+ *                                      built from that tree
+ *
+ * ctest runs them in that order, with the tool in between; the tool fails
+ * if the image does not fit the webui partition in partitions.csv. check
+ * then finds the image at boot, uploads it again, and checks that a bundle
+ * that fails verification leaves the built-in UI served.
+ */
+#include <errno.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+
+#include "async_worker.h"
+#include "esp_partition.h"
+#include "idf_host.h"
+#include "static_files.h"
+#include "webui_bundle.h"
+
+#include "sdkconfig.h"
+
+static int failures = 0;
+
+#define CHECK(cond) do { \
+    if (!(cond)) { \
+        printf("FAIL line %d: %s\n", __LINE__, #cond); \
+        failures++; \
+    } \
+} while (0)
+
+// No worker pool: an upload runs on the calling task
+esp_err_t async_worker_submit(httpd_req_t* req, esp_err_t (*handler)(httpd_req_t* req)) {
+    return handler(req);
+}
+
+bool async_worker_current(void) {
+    return false;
+}
+
+esp_err_t async_worker_run_on_httpd(httpd_req_t* req, void (*work)(void* arg), void* arg, void (*release)(void* arg)) {
+    work(arg);
+    return ESP_OK;
+}
+
+// Helper function to create every directory above a file
+static bool make_parents(char* path) {
+    for (char* slash = strchr(path + 1, '/'); slash != NULL; slash = strchr(slash + 1, '/')) {
+        *slash = '\0';
+        bool made = mkdir(path, 0755) == 0 || errno == EEXIST;
+        *slash = '/';
+        if (!made) {
+            return false;
+        }
+    }
+    return true;
+}
+
+static int export_dist(const char* dir) {
+    for (int i = 0; i < static_files::num_of_files; i++) {
+        const static_files::file& f = static_files::files[i];
+        char path[256];
+        snprintf(path, sizeof(path), "%s%s.gz", dir, f.path);
+
+        FILE* out = make_parents(path) ? fopen(path, "wb") : NULL;
+        if (out == NULL || fwrite(f.contents, 1, f.size, out) != f.size) {
+            printf("Cannot write %s\n", path);
+            return 1;
+        }
+        fclose(out);
+    }
+    return 0;
+}
+
+static char* read_image(const char* path, size_t* size) {
+    FILE* in = fopen(path, "rb");
+    if (in == NULL) {
+        return NULL;
+    }
+    fseek(in, 0, SEEK_END);
+    *size = (size_t)ftell(in);
+    fseek(in, 0, SEEK_SET);
+    char* image = (char*)malloc(*size);
+    if (fread(image, 1, *size, in) != *size) {
+        free(image);
+        image = NULL;
+    }
+    fclose(in);
+    return image;
+}
+
+// Every file of the stand-in UI is served from the bundle, byte for byte;
+// the MIME types are the tool's own
+static bool serves_ui(void) {
+    for (int i = 0; i < static_files::num_of_files; i++) {
+        const static_files::file& f = static_files::files[i];
+        webui_bundle_file_t file;
+        if (!webui_bundle_find(f.path, strlen(f.path), &file) ||
+            file.size[WEBUI_ENCODING_GZIP] != f.size ||
+            memcmp(file.contents[WEBUI_ENCODING_GZIP], f.contents, f.size) != 0) {
+            printf("%s not served from the bundle\n", f.path);
+            return false;
+        }
+    }
+    return true;
+}
+
+static httpd_uri_t* find_handler(const char* uri, httpd_method_t method) {
+    for (size_t i = 0; i < host_uri_handler_count; i++) {
+        if (host_uri_handlers[i].method == method && strcmp(host_uri_handlers[i].uri, uri) == 0) {
+            return &host_uri_handlers[i];
+        }
+    }
+    return NULL;
+}
+
+static esp_err_t upload(const char* image, size_t size, httpd_req_t* req) {
+    host_request_init(req, "/api/webui", NULL);
+    req->method = HTTP_POST;
+    req->body = image;
+    req->content_len = size;
+    req->recv_max = 1460;
+    return find_handler("/api/webui", HTTP_POST)->handler(req);
+}
+
+static int check_image(const char* path) {
+    size_t size = 0;
+    char* image = read_image(path, &size);
+    if (image == NULL) {
+        printf("Cannot read %s\n", path);
+        return 1;
+    }
+    printf("Bundle of %d files: %zu of %u bytes\n", static_files::num_of_files, size, HOST_WEBUI_PARTITION_SIZE);
+    CHECK(size <= HOST_WEBUI_PARTITION_SIZE);
+
+    // Flashed with parttool, then found at boot
+    host_partition_add(CONFIG_WEBUI_BUNDLE_PARTITION, HOST_WEBUI_PARTITION_SIZE);
+    const esp_partition_t* partition = esp_partition_find_first(ESP_PARTITION_TYPE_DATA, ESP_PARTITION_SUBTYPE_ANY,
+        CONFIG_WEBUI_BUNDLE_PARTITION);
+    esp_partition_write(partition, 0, image, size);
+    webui_bundle_init();
+    CHECK(webui_bundle_active());
+    CHECK(serves_ui());
+
+    // Uploaded over the one being served
+    register_webui_bundle_handlers(NULL);
+    static httpd_req_t req;
+    CHECK(upload(image, size, &req) == ESP_OK);
+    CHECK(strcmp(req.status, "200 OK") == 0);
+    CHECK(strstr(req.response, "\"sequence\":1") != NULL);
+    CHECK(webui_bundle_active());
+    CHECK(serves_ui());
+    CHECK(host_partition_mappings(CONFIG_WEBUI_BUNDLE_PARTITION) == 1);
+
+    // A corrupt body fails verification and leaves the built-in UI
+    image[size - 1] ^= 0x01;
+    CHECK(upload(image, size, &req) == ESP_FAIL);
+    CHECK(strcmp(req.status, "400 Bad Request") == 0);
+    CHECK(!webui_bundle_active());
+    CHECK(host_partition_mappings(CONFIG_WEBUI_BUNDLE_PARTITION) == 0);
+
+    // One byte past the partition is turned away before anything is erased
+    image[size - 1] ^= 0x01;
+    CHECK(upload(image, size, &req) == ESP_OK);
+    char* oversized = (char*)calloc(HOST_WEBUI_PARTITION_SIZE + 1, 1);
+    CHECK(upload(oversized, HOST_WEBUI_PARTITION_SIZE + 1, &req) == ESP_FAIL);
+    CHECK(webui_bundle_active());
+    free(oversized);
+    free(image);
+
+    if (failures > 0) {
+        printf("%d checks failed\n", failures);
+        return 1;
+    }
+    printf("The stand-in UI fits the webui partition and is served from it\n");
+    return 0;
+}
+
+int main(int argc, char** argv) {
+    if (argc == 3 && strcmp(argv[1], "export") == 0) {
+        return export_dist(argv[2]);
+    }
+    if (argc == 3 && strcmp(argv[1], "check") == 0) {
+        return check_image(argv[2]);
+    }
+    printf("usage: %s export <dir> | check <image>\n", argv[0]);
+    return 2;
+}
@@ -0,0 +1,149 @@
+/*
+ * Word clock display modes on simulated time: the effect mode hands the
+ * driver a mask of the lit letters, only when they change, and the letters
+ * mode paints them itself in raw mode.
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <vector>
+
+#include "clock_events.h"
+#include "esp_timer.h"
+#include "idf_host.h"
+#include "kd_pixdriver.h"
+#include "wordclock.h"
+#include "wordclock_phrases.h"
+
+// 2023-11-14 22:13:00 UTC
+#define START_EPOCH 1700000000
+#define START_HOUR 22
+#define START_MINUTE 13
+
+static int failures = 0;
+
+#define CHECK(cond) do { \
+    if (!(cond)) { \
+        printf("FAIL line %d: %s\n", __LINE__, #cond); \
+        failures++; \
+    } \
+} while (0)
+
+extern bool host_pixel_stream;
+
+static PixelChannel* channel(void) {
+    return PixelDriver::getMainChannel();
+}
+
+static bool mask_matches(const wordclock_mask_t& expected) {
+    for (size_t i = 0; i < WORDCLOCK_GRID_SIZE; i++) {
+        if ((channel()->mask[i] != 0) != wordclock_mask_test(expected, i)) return false;
+    }
+    return true;
+}
+
+static bool pixels_match(const wordclock_mask_t& expected) {
+    for (size_t i = 0; i < WORDCLOCK_GRID_SIZE; i++) {
+        const PixelColor& pixel = channel()->pixels[i];
+        bool lit = pixel.r != 0 || pixel.g != 0 || pixel.b != 0;
+        if (lit != wordclock_mask_test(expected, i)) return false;
+    }
+    return true;
+}
+
+static void run_seconds(int seconds) {
+    host_run_until(esp_timer_get_time() + (int64_t)seconds * 1000000);
+}
+
+int main() {
+    setenv("TZ", "UTC0", 1);
+    tzset();
+    host_set_epoch(START_EPOCH - 20);
+
+    wordclock_clock_init();
+    CHECK(strcmp(channel()->effect, "BREATHE") == 0);
+
+    // Effect mode is the default: the stored LED API effect through the mask,
+    // at the brightness the LED API stored
+    channel()->stored_brightness = 40;
+    run_seconds(20);
+    host_set_ntp_synced(true);
+    CHECK(strcmp(channel()->effect, "stored") == 0);
+    CHECK(channel()->brightness == 40);
+    CHECK(mask_matches(wordclock_phrase_mask(START_HOUR, START_MINUTE)));
+    CHECK(host_timers_running() == 0);
+
+    // Nothing new to show, nothing sent
+    uint32_t masks_set = channel()->masks_set;
+    esp_event_post(CLOCK_EVENTS, CLOCK_EVENT_MINUTE_TICK, nullptr, 0, 0);
+    host_dispatch_events();
+    CHECK(channel()->masks_set == masks_set);
+
+    // Temperature word joins the mask
+    wordclock_set_temperature(30.0f);
+    host_dispatch_events();
+    wordclock_mask_t hot = {};
+    for (size_t i = WORDCLOCK_GRID_SIZE - 3; i < WORDCLOCK_GRID_SIZE; i++) {
+        hot.words[i / 32] |= 1u << (i % 32);
+    }
+    CHECK(mask_matches(wordclock_mask_or(wordclock_phrase_mask(START_HOUR, START_MINUTE), hot)));
+    wordclock_clear_temperature();
+    host_dispatch_events();
+
+    // A stream owns the buffer and the mask; the clock sends it again after
+    host_pixel_stream = true;
+    std::vector<uint8_t> streamed(WORDCLOCK_GRID_SIZE, 1);
+    channel()->setMask(streamed);
+    masks_set = channel()->masks_set;
+    wordclock_set_temperature(30.0f);
+    host_dispatch_events();
+    CHECK(channel()->masks_set == masks_set);
+    CHECK(channel()->mask == streamed);
+    wordclock_clear_temperature();
+    host_dispatch_events();
+    host_pixel_stream = false;
+    esp_event_post(CLOCK_EVENTS, CLOCK_EVENT_DISPLAY_RELEASED, nullptr, 0, 0);
+    host_dispatch_events();
+    CHECK(mask_matches(wordclock_phrase_mask(START_HOUR, START_MINUTE)));
+
+    // A config change that does not set the brightness keeps the driver's
+    wordclock_config_t config = wordclock_get_config();
+    config.color = 0x00FF00;
+    wordclock_update_config(&config);
+    CHECK(channel()->brightness == 40);
+
+    // Off leaves the mask empty
+    wordclock_set_on_state(false);
+    host_dispatch_events();
+    CHECK(mask_matches(wordclock_mask_t {}));
+    wordclock_set_on_state(true);
+    host_dispatch_events();
+
+    // Letters mode takes the buffer in raw mode and paints the time
+    wordclock_set_mode(WORDCLOCK_MODE_LETTERS);
+    host_dispatch_events();
+    CHECK(strcmp(channel()->effect, "raw") == 0);
+    CHECK(channel()->brightness == config.brightness);
+    run_seconds(2);
+    CHECK(pixels_match(wordclock_phrase_mask(START_HOUR, START_MINUTE)));
+    CHECK(host_timers_running() == 0);
+
+    // Back to the effect; the renderer leaves the buffer alone from then on
+    wordclock_set_mode(WORDCLOCK_MODE_EFFECT);
+    host_dispatch_events();
+    CHECK(strcmp(channel()->effect, "stored") == 0);
+    CHECK(channel()->brightness == 40);
+    CHECK(mask_matches(wordclock_phrase_mask(START_HOUR, START_MINUTE)));
+    wordclock_set_color(0xFF0000);
+    host_dispatch_events();
+    run_seconds(2);
+    CHECK(host_timers_running() == 0);
+    CHECK(channel()->pixels[0].g != 0);
+
+    if (failures > 0) {
+        printf("%d checks failed\n", failures);
+        return 1;
+    }
+    printf("Display modes behave\n");
+    return 0;
+}
@@ -0,0 +1,96 @@
+/*
+ * The phrase compiler must light exactly the letters the string-search path
+ * lit before it, for every minute of the day.
+ *
+ * wordclock_golden_masks.h holds those 1440 masks. It is checked at compile
+ * time against the compiled tables and at run time against the reference
+ * string path, so a change to either side fails here. To regenerate it after
+ * a deliberate change to the phrases:
+ *
+ *   test_wordclock_phrases --print-golden > wordclock_golden_masks.h
+ */
+#include <stdio.h>
+#include <string.h>
+
+#include "wordclock_golden_masks.h"
+#include "wordclock_phrases.h"
+#include "wordclock_string_path.h"
+
+constexpr bool phrase_masks_match_golden() {
+    for (int hour = 0; hour < 24; hour++) {
+        for (int minute = 0; minute < 60; minute++) {
+            wordclock_mask_t mask = wordclock_phrase_mask(hour, minute);
+            for (size_t i = 0; i < WORDCLOCK_MASK_WORDS; i++) {
+                if (mask.words[i] != wordclock_golden_masks[hour * 60 + minute][i]) return false;
+            }
+        }
+    }
+    return true;
+}
+
+static_assert(phrase_masks_match_golden(), "Compiled phrases differ from the baseline golden masks");
+
+// Helper function to pack the string path's byte-per-letter output
+static wordclock_mask_t string_path_mask(int hour, int minute) {
+    uint8_t bits[WORDCLOCK_GRID_SIZE];
+    string_path_set_time(hour, minute, bits);
+
+    wordclock_mask_t mask = {};
+    for (size_t i = 0; i < WORDCLOCK_GRID_SIZE; i++) {
+        if (bits[i]) {
+            mask.words[i / 32] |= 1u << (i % 32);
+        }
+    }
+    return mask;
+}
+
+static void print_golden(void) {
+    printf("#pragma once\n\n");
+    printf("#include <stdint.h>\n\n");
+    printf("// Lit letters for every minute of the day, from the baseline string path.\n");
+    printf("// Generated by test_wordclock_phrases --print-golden; do not edit by hand.\n");
+    printf("inline constexpr uint32_t wordclock_golden_masks[24 * 60][8] = {\n");
+    for (int hour = 0; hour < 24; hour++) {
+        for (int minute = 0; minute < 60; minute++) {
+            wordclock_mask_t mask = string_path_mask(hour, minute);
+            printf("    {");
+            for (size_t i = 0; i < WORDCLOCK_MASK_WORDS; i++) {
+                printf(" 0x%08x%s", (unsigned)mask.words[i], i + 1 < WORDCLOCK_MASK_WORDS ? "," : " ");
+            }
+            printf("},  // %02d:%02d\n", hour, minute);
+        }
+    }
+    printf("};\n");
+}
+
+int main(int argc, char** argv) {
+    if (argc > 1 && strcmp(argv[1], "--print-golden") == 0) {
+        print_golden();
+        return 0;
+    }
+
+    int failures = 0;
+    for (int hour = 0; hour < 24; hour++) {
+        for (int minute = 0; minute < 60; minute++) {
+            const uint32_t* golden = wordclock_golden_masks[hour * 60 + minute];
+            wordclock_mask_t reference = string_path_mask(hour, minute);
+            wordclock_mask_t compiled = wordclock_phrase_mask(hour, minute);
+
+            if (memcmp(reference.words, golden, sizeof(reference.words)) != 0) {
+                printf("FAIL %02d:%02d: string path differs from the golden mask\n", hour, minute);
+                failures++;
+            }
+            if (memcmp(compiled.words, golden, sizeof(compiled.words)) != 0) {
+                printf("FAIL %02d:%02d: compiled phrase differs from the golden mask\n", hour, minute);
+                failures++;
+            }
+        }
+    }
+
+    if (failures > 0) {
+        printf("%d mismatches\n", failures);
+        return 1;
+    }
+    printf("1440 minutes match the golden masks\n");
+    return 0;
+}
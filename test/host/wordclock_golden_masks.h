@@ -0,0 +1,1448 @@
+#pragma once
+
+#include <stdint.h>
+
+// Lit letters for every minute of the day, from the baseline string path.
+// Generated by test_wordclock_phrases --print-golden; do not edit by hand.
+inline constexpr uint32_t wordclock_golden_masks[24 * 60][8] = {
+    { 0x0000001b, 0x00000000, 0x0000ff00, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000 },  // 00:00
+    { 0x0000e01b, 0x00000000, 0x00000000, 0x00000000, 0x003f000f, 0x00000000, 0xfb000000, 0x00000000 },  // 00:01
+    { 0x0007001b, 0x00000000, 0x00000000, 0x00000000, 0x003f000f, 0x00000000, 0xfb000000, 0x00000000 },  // 00:02
+    { 0x0000001b, 0x001f0000, 0x00000000, 0x00000000, 0x003f000f, 0x00000000, 0xfb000000, 0x00000000 },  // 00:03
+    { 0x0000001b, 0x0000f000, 0x00000000, 0x00000000, 0x003f000f, 0x00000000, 0xfb000000, 0x00000000 },  // 00:04
+    { 0x0000001b, 0x0000000f, 0x00000000, 0x00000000, 0x003f000f, 0x00000000, 0xfb000000, 0x00000000 },  // 00:05
+    { 0x0000001b, 0x00000000, 0x00070000, 0x00000000, 0x003f000f, 0x00000000, 0xfb000000, 0x00000000 },  // 00:06
+    { 0x0000001b, 0x00000000, 0x00000000, 0x0000001f, 0x003f000f, 0x00000000, 0xfb000000, 0x00000000 },  // 00:07
+    { 0x0000001b, 0x00000000, 0x1f000000, 0x00000000, 0x003f000f, 0x00000000, 0xfb000000, 0x00000000 },  // 00:08
+    { 0x0000001b, 0x03c00000, 0x00000000, 0x00000000, 0x003f000f, 0x00000000, 0xfb000000, 0x00000000 },  // 00:09
+    { 0x0070001b, 0x00000000, 0x00000000, 0x00000000, 0x003f000f, 0x00000000, 0xfb000000, 0x00000000 },  // 00:10
+    { 0x0000001b, 0x000007e0, 0x00000000, 0x00000000, 0x003f000f, 0x00000000, 0xfb000000, 0x00000000 },  // 00:11
+    { 0x0000001b, 0x00000000, 0x00000000, 0x0000fc00, 0x003f000f, 0x00000000, 0xfb000000, 0x00000000 },  // 00:12
+    { 0xff00001b, 0x00000000, 0x00000000, 0x00000000, 0x003f000f, 0x00000000, 0xfb000000, 0x00000000 },  // 00:13
+    { 0x0000001b, 0x00000000, 0x000000ff, 0x00000000, 0x003f000f, 0x00000000, 0xfb000000, 0x00000000 },  // 00:14
+    { 0x0000001b, 0x00000000, 0x00000000, 0x1fc20000, 0x003f000f, 0x00000000, 0xfb000000, 0x00000000 },  // 00:15
+    { 0x0000001b, 0x00000000, 0x007f0000, 0x00000000, 0x003f000f, 0x00000000, 0xfb000000, 0x00000000 },  // 00:16
+    { 0x0000001b, 0x00000000, 0x00000000, 0x000001ff, 0x003f000f, 0x00000000, 0xfb000000, 0x00000000 },  // 00:17
+    { 0x0000001b, 0x00000000, 0xff000000, 0x00000000, 0x003f000f, 0x00000000, 0xfb000000, 0x00000000 },  // 00:18
+    { 0x0000001b, 0x3fc00000, 0x00000000, 0x00000000, 0x003f000f, 0x00000000, 0xfb000000, 0x00000000 },  // 00:19
+    { 0x00000fdb, 0x00000000, 0x00000000, 0x00000000, 0x003f000f, 0x00000000, 0xfb000000, 0x00000000 },  // 00:20
+    { 0x0000efdb, 0x00000000, 0x00000000, 0x00000000, 0x003f000f, 0x00000000, 0xfb000000, 0x00000000 },  // 00:21
+    { 0x00070fdb, 0x00000000, 0x00000000, 0x00000000, 0x003f000f, 0x00000000, 0xfb000000, 0x00000000 },  // 00:22
+    { 0x00000fdb, 0x001f0000, 0x00000000, 0x00000000, 0x003f000f, 0x00000000, 0xfb000000, 0x00000000 },  // 00:23
+    { 0x00000fdb, 0x0000f000, 0x00000000, 0x00000000, 0x003f000f, 0x00000000, 0xfb000000, 0x00000000 },  // 00:24
+    { 0x00000fdb, 0x0000000f, 0x00000000, 0x00000000, 0x003f000f, 0x00000000, 0xfb000000, 0x00000000 },  // 00:25
+    { 0x00000fdb, 0x00000000, 0x00070000, 0x00000000, 0x003f000f, 0x00000000, 0xfb000000, 0x00000000 },  // 00:26
+    { 0x00000fdb, 0x00000000, 0x00000000, 0x0000001f, 0x003f000f, 0x00000000, 0xfb000000, 0x00000000 },  // 00:27
+    { 0x00000fdb, 0x00000000, 0x1f000000, 0x00000000, 0x003f000f, 0x00000000, 0xfb000000, 0x00000000 },  // 00:28
+    { 0x00000fdb, 0x03c00000, 0x00000000, 0x00000000, 0x003f000f, 0x00000000, 0xfb000000, 0x00000000 },  // 00:29
+    { 0x0000001b, 0x00000000, 0x00000000, 0x000f0000, 0x003f000f, 0x00000000, 0xfb000000, 0x00000000 },  // 00:30
+    { 0x00000fdb, 0x03c00000, 0x00000000, 0xc0000000, 0x000006e0, 0x00000000, 0xf8000000, 0x00000000 },  // 00:31
+    { 0x00000fdb, 0x00000000, 0x1f000000, 0xc0000000, 0x000006e0, 0x00000000, 0xf8000000, 0x00000000 },  // 00:32
+    { 0x00000fdb, 0x00000000, 0x00000000, 0xc000001f, 0x000006e0, 0x00000000, 0xf8000000, 0x00000000 },  // 00:33
+    { 0x00000fdb, 0x00000000, 0x00070000, 0xc0000000, 0x000006e0, 0x00000000, 0xf8000000, 0x00000000 },  // 00:34
+    { 0x00000fdb, 0x0000000f, 0x00000000, 0xc0000000, 0x000006e0, 0x00000000, 0xf8000000, 0x00000000 },  // 00:35
+    { 0x00000fdb, 0x0000f000, 0x00000000, 0xc0000000, 0x000006e0, 0x00000000, 0xf8000000, 0x00000000 },  // 00:36
+    { 0x00000fdb, 0x001f0000, 0x00000000, 0xc0000000, 0x000006e0, 0x00000000, 0xf8000000, 0x00000000 },  // 00:37
+    { 0x00070fdb, 0x00000000, 0x00000000, 0xc0000000, 0x000006e0, 0x00000000, 0xf8000000, 0x00000000 },  // 00:38
+    { 0x0000efdb, 0x00000000, 0x00000000, 0xc0000000, 0x000006e0, 0x00000000, 0xf8000000, 0x00000000 },  // 00:39
+    { 0x00000fdb, 0x00000000, 0x00000000, 0xc0000000, 0x000006e0, 0x00000000, 0xf8000000, 0x00000000 },  // 00:40
+    { 0x0000001b, 0x3fc00000, 0x00000000, 0xc0000000, 0x000006e0, 0x00000000, 0xf8000000, 0x00000000 },  // 00:41
+    { 0x0000001b, 0x00000000, 0xff000000, 0xc0000000, 0x000006e0, 0x00000000, 0xf8000000, 0x00000000 },  // 00:42
+    { 0x0000001b, 0x00000000, 0x00000000, 0xc00001ff, 0x000006e0, 0x00000000, 0xf8000000, 0x00000000 },  // 00:43
+    { 0x0000001b, 0x00000000, 0x007f0000, 0xc0000000, 0x000006e0, 0x00000000, 0xf8000000, 0x00000000 },  // 00:44
+    { 0x0000001b, 0x00000000, 0x00000000, 0xdfc20000, 0x000006e0, 0x00000000, 0xf8000000, 0x00000000 },  // 00:45
+    { 0x0000001b, 0x00000000, 0x000000ff, 0xc0000000, 0x000006e0, 0x00000000, 0xf8000000, 0x00000000 },  // 00:46
+    { 0xff00001b, 0x00000000, 0x00000000, 0xc0000000, 0x000006e0, 0x00000000, 0xf8000000, 0x00000000 },  // 00:47
+    { 0x0000001b, 0x00000000, 0x00000000, 0xc000fc00, 0x000006e0, 0x00000000, 0xf8000000, 0x00000000 },  // 00:48
+    { 0x0000001b, 0x000007e0, 0x00000000, 0xc0000000, 0x000006e0, 0x00000000, 0xf8000000, 0x00000000 },  // 00:49
+    { 0x0070001b, 0x00000000, 0x00000000, 0xc0000000, 0x000006e0, 0x00000000, 0xf8000000, 0x00000000 },  // 00:50
+    { 0x0000001b, 0x03c00000, 0x00000000, 0xc0000000, 0x000006e0, 0x00000000, 0xf8000000, 0x00000000 },  // 00:51
+    { 0x0000001b, 0x00000000, 0x1f000000, 0xc0000000, 0x000006e0, 0x00000000, 0xf8000000, 0x00000000 },  // 00:52
+    { 0x0000001b, 0x00000000, 0x00000000, 0xc000001f, 0x000006e0, 0x00000000, 0xf8000000, 0x00000000 },  // 00:53
+    { 0x0000001b, 0x00000000, 0x00070000, 0xc0000000, 0x000006e0, 0x00000000, 0xf8000000, 0x00000000 },  // 00:54
+    { 0x0000001b, 0x0000000f, 0x00000000, 0xc0000000, 0x000006e0, 0x00000000, 0xf8000000, 0x00000000 },  // 00:55
+    { 0x0000001b, 0x0000f000, 0x00000000, 0xc0000000, 0x000006e0, 0x00000000, 0xf8000000, 0x00000000 },  // 00:56
+    { 0x0000001b, 0x001f0000, 0x00000000, 0xc0000000, 0x000006e0, 0x00000000, 0xf8000000, 0x00000000 },  // 00:57
+    { 0x0007001b, 0x00000000, 0x00000000, 0xc0000000, 0x000006e0, 0x00000000, 0xf8000000, 0x00000000 },  // 00:58
+    { 0x0000e01b, 0x00000000, 0x00000000, 0xc0000000, 0x000006e0, 0x00000000, 0xf8000000, 0x00000000 },  // 00:59
+    { 0x0000e01b, 0x00000000, 0x00000000, 0x00000000, 0x00000600, 0x00000000, 0xf8000000, 0x00000000 },  // 01:00
+    { 0x0000e01b, 0x00000000, 0x00000000, 0x00000000, 0x000006ef, 0x00000000, 0xf8000000, 0x00000000 },  // 01:01
+    { 0x0007001b, 0x00000000, 0x00000000, 0x00000000, 0x000006ef, 0x00000000, 0xf8000000, 0x00000000 },  // 01:02
+    { 0x0000001b, 0x001f0000, 0x00000000, 0x00000000, 0x000006ef, 0x00000000, 0xf8000000, 0x00000000 },  // 01:03
+    { 0x0000001b, 0x0000f000, 0x00000000, 0x00000000, 0x000006ef, 0x00000000, 0xf8000000, 0x00000000 },  // 01:04
+    { 0x0000001b, 0x0000000f, 0x00000000, 0x00000000, 0x000006ef, 0x00000000, 0xf8000000, 0x00000000 },  // 01:05
+    { 0x0000001b, 0x00000000, 0x00070000, 0x00000000, 0x000006ef, 0x00000000, 0xf8000000, 0x00000000 },  // 01:06
+    { 0x0000001b, 0x00000000, 0x00000000, 0x0000001f, 0x000006ef, 0x00000000, 0xf8000000, 0x00000000 },  // 01:07
+    { 0x0000001b, 0x00000000, 0x1f000000, 0x00000000, 0x000006ef, 0x00000000, 0xf8000000, 0x00000000 },  // 01:08
+    { 0x0000001b, 0x03c00000, 0x00000000, 0x00000000, 0x000006ef, 0x00000000, 0xf8000000, 0x00000000 },  // 01:09
+    { 0x0070001b, 0x00000000, 0x00000000, 0x00000000, 0x000006ef, 0x00000000, 0xf8000000, 0x00000000 },  // 01:10
+    { 0x0000001b, 0x000007e0, 0x00000000, 0x00000000, 0x000006ef, 0x00000000, 0xf8000000, 0x00000000 },  // 01:11
+    { 0x0000001b, 0x00000000, 0x00000000, 0x0000fc00, 0x000006ef, 0x00000000, 0xf8000000, 0x00000000 },  // 01:12
+    { 0xff00001b, 0x00000000, 0x00000000, 0x00000000, 0x000006ef, 0x00000000, 0xf8000000, 0x00000000 },  // 01:13
+    { 0x0000001b, 0x00000000, 0x000000ff, 0x00000000, 0x000006ef, 0x00000000, 0xf8000000, 0x00000000 },  // 01:14
+    { 0x0000001b, 0x00000000, 0x00000000, 0x1fc20000, 0x000006ef, 0x00000000, 0xf8000000, 0x00000000 },  // 01:15
+    { 0x0000001b, 0x00000000, 0x007f0000, 0x00000000, 0x000006ef, 0x00000000, 0xf8000000, 0x00000000 },  // 01:16
+    { 0x0000001b, 0x00000000, 0x00000000, 0x000001ff, 0x000006ef, 0x00000000, 0xf8000000, 0x00000000 },  // 01:17
+    { 0x0000001b, 0x00000000, 0xff000000, 0x00000000, 0x000006ef, 0x00000000, 0xf8000000, 0x00000000 },  // 01:18
+    { 0x0000001b, 0x3fc00000, 0x00000000, 0x00000000, 0x000006ef, 0x00000000, 0xf8000000, 0x00000000 },  // 01:19
+    { 0x00000fdb, 0x00000000, 0x00000000, 0x00000000, 0x000006ef, 0x00000000, 0xf8000000, 0x00000000 },  // 01:20
+    { 0x0000efdb, 0x00000000, 0x00000000, 0x00000000, 0x000006ef, 0x00000000, 0xf8000000, 0x00000000 },  // 01:21
+    { 0x00070fdb, 0x00000000, 0x00000000, 0x00000000, 0x000006ef, 0x00000000, 0xf8000000, 0x00000000 },  // 01:22
+    { 0x00000fdb, 0x001f0000, 0x00000000, 0x00000000, 0x000006ef, 0x00000000, 0xf8000000, 0x00000000 },  // 01:23
+    { 0x00000fdb, 0x0000f000, 0x00000000, 0x00000000, 0x000006ef, 0x00000000, 0xf8000000, 0x00000000 },  // 01:24
+    { 0x00000fdb, 0x0000000f, 0x00000000, 0x00000000, 0x000006ef, 0x00000000, 0xf8000000, 0x00000000 },  // 01:25
+    { 0x00000fdb, 0x00000000, 0x00070000, 0x00000000, 0x000006ef, 0x00000000, 0xf8000000, 0x00000000 },  // 01:26
+    { 0x00000fdb, 0x00000000, 0x00000000, 0x0000001f, 0x000006ef, 0x00000000, 0xf8000000, 0x00000000 },  // 01:27
+    { 0x00000fdb, 0x00000000, 0x1f000000, 0x00000000, 0x000006ef, 0x00000000, 0xf8000000, 0x00000000 },  // 01:28
+    { 0x00000fdb, 0x03c00000, 0x00000000, 0x00000000, 0x000006ef, 0x00000000, 0xf8000000, 0x00000000 },  // 01:29
+    { 0x0000001b, 0x00000000, 0x00000000, 0x000f0000, 0x000006ef, 0x00000000, 0xf8000000, 0x00000000 },  // 01:30
+    { 0x00000fdb, 0x03c00000, 0x00000000, 0xc0000000, 0x00001c00, 0x00000000, 0xfb000000, 0x00000000 },  // 01:31
+    { 0x00000fdb, 0x00000000, 0x1f000000, 0xc0000000, 0x00001c00, 0x00000000, 0xfb000000, 0x00000000 },  // 01:32
+    { 0x00000fdb, 0x00000000, 0x00000000, 0xc000001f, 0x00001c00, 0x00000000, 0xfb000000, 0x00000000 },  // 01:33
+    { 0x00000fdb, 0x00000000, 0x00070000, 0xc0000000, 0x00001c00, 0x00000000, 0xfb000000, 0x00000000 },  // 01:34
+    { 0x00000fdb, 0x0000000f, 0x00000000, 0xc0000000, 0x00001c00, 0x00000000, 0xfb000000, 0x00000000 },  // 01:35
+    { 0x00000fdb, 0x0000f000, 0x00000000, 0xc0000000, 0x00001c00, 0x00000000, 0xfb000000, 0x00000000 },  // 01:36
+    { 0x00000fdb, 0x001f0000, 0x00000000, 0xc0000000, 0x00001c00, 0x00000000, 0xfb000000, 0x00000000 },  // 01:37
+    { 0x00070fdb, 0x00000000, 0x00000000, 0xc0000000, 0x00001c00, 0x00000000, 0xfb000000, 0x00000000 },  // 01:38
+    { 0x0000efdb, 0x00000000, 0x00000000, 0xc0000000, 0x00001c00, 0x00000000, 0xfb000000, 0x00000000 },  // 01:39
+    { 0x00000fdb, 0x00000000, 0x00000000, 0xc0000000, 0x00001c00, 0x00000000, 0xfb000000, 0x00000000 },  // 01:40
+    { 0x0000001b, 0x3fc00000, 0x00000000, 0xc0000000, 0x00001c00, 0x00000000, 0xfb000000, 0x00000000 },  // 01:41
+    { 0x0000001b, 0x00000000, 0xff000000, 0xc0000000, 0x00001c00, 0x00000000, 0xfb000000, 0x00000000 },  // 01:42
+    { 0x0000001b, 0x00000000, 0x00000000, 0xc00001ff, 0x00001c00, 0x00000000, 0xfb000000, 0x00000000 },  // 01:43
+    { 0x0000001b, 0x00000000, 0x007f0000, 0xc0000000, 0x00001c00, 0x00000000, 0xfb000000, 0x00000000 },  // 01:44
+    { 0x0000001b, 0x00000000, 0x00000000, 0xdfc20000, 0x00001c00, 0x00000000, 0xfb000000, 0x00000000 },  // 01:45
+    { 0x0000001b, 0x00000000, 0x000000ff, 0xc0000000, 0x00001c00, 0x00000000, 0xfb000000, 0x00000000 },  // 01:46
+    { 0xff00001b, 0x00000000, 0x00000000, 0xc0000000, 0x00001c00, 0x00000000, 0xfb000000, 0x00000000 },  // 01:47
+    { 0x0000001b, 0x00000000, 0x00000000, 0xc000fc00, 0x00001c00, 0x00000000, 0xfb000000, 0x00000000 },  // 01:48
+    { 0x0000001b, 0x000007e0, 0x00000000, 0xc0000000, 0x00001c00, 0x00000000, 0xfb000000, 0x00000000 },  // 01:49
+    { 0x0070001b, 0x00000000, 0x00000000, 0xc0000000, 0x00001c00, 0x00000000, 0xfb000000, 0x00000000 },  // 01:50
+    { 0x0000001b, 0x03c00000, 0x00000000, 0xc0000000, 0x00001c00, 0x00000000, 0xfb000000, 0x00000000 },  // 01:51
+    { 0x0000001b, 0x00000000, 0x1f000000, 0xc0000000, 0x00001c00, 0x00000000, 0xfb000000, 0x00000000 },  // 01:52
+    { 0x0000001b, 0x00000000, 0x00000000, 0xc000001f, 0x00001c00, 0x00000000, 0xfb000000, 0x00000000 },  // 01:53
+    { 0x0000001b, 0x00000000, 0x00070000, 0xc0000000, 0x00001c00, 0x00000000, 0xfb000000, 0x00000000 },  // 01:54
+    { 0x0000001b, 0x0000000f, 0x00000000, 0xc0000000, 0x00001c00, 0x00000000, 0xfb000000, 0x00000000 },  // 01:55
+    { 0x0000001b, 0x0000f000, 0x00000000, 0xc0000000, 0x00001c00, 0x00000000, 0xfb000000, 0x00000000 },  // 01:56
+    { 0x0000001b, 0x001f0000, 0x00000000, 0xc0000000, 0x00001c00, 0x00000000, 0xfb000000, 0x00000000 },  // 01:57
+    { 0x0007001b, 0x00000000, 0x00000000, 0xc0000000, 0x00001c00, 0x00000000, 0xfb000000, 0x00000000 },  // 01:58
+    { 0x0000e01b, 0x00000000, 0x00000000, 0xc0000000, 0x00001c00, 0x00000000, 0xfb000000, 0x00000000 },  // 01:59
+    { 0x0007001b, 0x00000000, 0x00000000, 0x00000000, 0x00000600, 0x00000000, 0xf8000000, 0x00000000 },  // 02:00
+    { 0x0000e01b, 0x00000000, 0x00000000, 0x00000000, 0x00001c0f, 0x00000000, 0xfb000000, 0x00000000 },  // 02:01
+    { 0x0007001b, 0x00000000, 0x00000000, 0x00000000, 0x00001c0f, 0x00000000, 0xfb000000, 0x00000000 },  // 02:02
+    { 0x0000001b, 0x001f0000, 0x00000000, 0x00000000, 0x00001c0f, 0x00000000, 0xfb000000, 0x00000000 },  // 02:03
+    { 0x0000001b, 0x0000f000, 0x00000000, 0x00000000, 0x00001c0f, 0x00000000, 0xfb000000, 0x00000000 },  // 02:04
+    { 0x0000001b, 0x0000000f, 0x00000000, 0x00000000, 0x00001c0f, 0x00000000, 0xfb000000, 0x00000000 },  // 02:05
+    { 0x0000001b, 0x00000000, 0x00070000, 0x00000000, 0x00001c0f, 0x00000000, 0xfb000000, 0x00000000 },  // 02:06
+    { 0x0000001b, 0x00000000, 0x00000000, 0x0000001f, 0x00001c0f, 0x00000000, 0xfb000000, 0x00000000 },  // 02:07
+    { 0x0000001b, 0x00000000, 0x1f000000, 0x00000000, 0x00001c0f, 0x00000000, 0xfb000000, 0x00000000 },  // 02:08
+    { 0x0000001b, 0x03c00000, 0x00000000, 0x00000000, 0x00001c0f, 0x00000000, 0xfb000000, 0x00000000 },  // 02:09
+    { 0x0070001b, 0x00000000, 0x00000000, 0x00000000, 0x00001c0f, 0x00000000, 0xfb000000, 0x00000000 },  // 02:10
+    { 0x0000001b, 0x000007e0, 0x00000000, 0x00000000, 0x00001c0f, 0x00000000, 0xfb000000, 0x00000000 },  // 02:11
+    { 0x0000001b, 0x00000000, 0x00000000, 0x0000fc00, 0x00001c0f, 0x00000000, 0xfb000000, 0x00000000 },  // 02:12
+    { 0xff00001b, 0x00000000, 0x00000000, 0x00000000, 0x00001c0f, 0x00000000, 0xfb000000, 0x00000000 },  // 02:13
+    { 0x0000001b, 0x00000000, 0x000000ff, 0x00000000, 0x00001c0f, 0x00000000, 0xfb000000, 0x00000000 },  // 02:14
+    { 0x0000001b, 0x00000000, 0x00000000, 0x1fc20000, 0x00001c0f, 0x00000000, 0xfb000000, 0x00000000 },  // 02:15
+    { 0x0000001b, 0x00000000, 0x007f0000, 0x00000000, 0x00001c0f, 0x00000000, 0xfb000000, 0x00000000 },  // 02:16
+    { 0x0000001b, 0x00000000, 0x00000000, 0x000001ff, 0x00001c0f, 0x00000000, 0xfb000000, 0x00000000 },  // 02:17
+    { 0x0000001b, 0x00000000, 0xff000000, 0x00000000, 0x00001c0f, 0x00000000, 0xfb000000, 0x00000000 },  // 02:18
+    { 0x0000001b, 0x3fc00000, 0x00000000, 0x00000000, 0x00001c0f, 0x00000000, 0xfb000000, 0x00000000 },  // 02:19
+    { 0x00000fdb, 0x00000000, 0x00000000, 0x00000000, 0x00001c0f, 0x00000000, 0xfb000000, 0x00000000 },  // 02:20
+    { 0x0000efdb, 0x00000000, 0x00000000, 0x00000000, 0x00001c0f, 0x00000000, 0xfb000000, 0x00000000 },  // 02:21
+    { 0x00070fdb, 0x00000000, 0x00000000, 0x00000000, 0x00001c0f, 0x00000000, 0xfb000000, 0x00000000 },  // 02:22
+    { 0x00000fdb, 0x001f0000, 0x00000000, 0x00000000, 0x00001c0f, 0x00000000, 0xfb000000, 0x00000000 },  // 02:23
+    { 0x00000fdb, 0x0000f000, 0x00000000, 0x00000000, 0x00001c0f, 0x00000000, 0xfb000000, 0x00000000 },  // 02:24
+    { 0x00000fdb, 0x0000000f, 0x00000000, 0x00000000, 0x00001c0f, 0x00000000, 0xfb000000, 0x00000000 },  // 02:25
+    { 0x00000fdb, 0x00000000, 0x00070000, 0x00000000, 0x00001c0f, 0x00000000, 0xfb000000, 0x00000000 },  // 02:26
+    { 0x00000fdb, 0x00000000, 0x00000000, 0x0000001f, 0x00001c0f, 0x00000000, 0xfb000000, 0x00000000 },  // 02:27
+    { 0x00000fdb, 0x00000000, 0x1f000000, 0x00000000, 0x00001c0f, 0x00000000, 0xfb000000, 0x00000000 },  // 02:28
+    { 0x00000fdb, 0x03c00000, 0x00000000, 0x00000000, 0x00001c0f, 0x00000000, 0xfb000000, 0x00000000 },  // 02:29
+    { 0x0000001b, 0x00000000, 0x00000000, 0x000f0000, 0x00001c0f, 0x00000000, 0xfb000000, 0x00000000 },  // 02:30
+    { 0x00000fdb, 0x03c00000, 0x00000000, 0xc0000000, 0x00000000, 0x01f00000, 0xfb000000, 0x00000000 },  // 02:31
+    { 0x00000fdb, 0x00000000, 0x1f000000, 0xc0000000, 0x00000000, 0x01f00000, 0xfb000000, 0x00000000 },  // 02:32
+    { 0x00000fdb, 0x00000000, 0x00000000, 0xc000001f, 0x00000000, 0x01f00000, 0xfb000000, 0x00000000 },  // 02:33
+    { 0x00000fdb, 0x00000000, 0x00070000, 0xc0000000, 0x00000000, 0x01f00000, 0xfb000000, 0x00000000 },  // 02:34
+    { 0x00000fdb, 0x0000000f, 0x00000000, 0xc0000000, 0x00000000, 0x01f00000, 0xfb000000, 0x00000000 },  // 02:35
+    { 0x00000fdb, 0x0000f000, 0x00000000, 0xc0000000, 0x00000000, 0x01f00000, 0xfb000000, 0x00000000 },  // 02:36
+    { 0x00000fdb, 0x001f0000, 0x00000000, 0xc0000000, 0x00000000, 0x01f00000, 0xfb000000, 0x00000000 },  // 02:37
+    { 0x00070fdb, 0x00000000, 0x00000000, 0xc0000000, 0x00000000, 0x01f00000, 0xfb000000, 0x00000000 },  // 02:38
+    { 0x0000efdb, 0x00000000, 0x00000000, 0xc0000000, 0x00000000, 0x01f00000, 0xfb000000, 0x00000000 },  // 02:39
+    { 0x00000fdb, 0x00000000, 0x00000000, 0xc0000000, 0x00000000, 0x01f00000, 0xfb000000, 0x00000000 },  // 02:40
+    { 0x0000001b, 0x3fc00000, 0x00000000, 0xc0000000, 0x00000000, 0x01f00000, 0xfb000000, 0x00000000 },  // 02:41
+    { 0x0000001b, 0x00000000, 0xff000000, 0xc0000000, 0x00000000, 0x01f00000, 0xfb000000, 0x00000000 },  // 02:42
+    { 0x0000001b, 0x00000000, 0x00000000, 0xc00001ff, 0x00000000, 0x01f00000, 0xfb000000, 0x00000000 },  // 02:43
+    { 0x0000001b, 0x00000000, 0x007f0000, 0xc0000000, 0x00000000, 0x01f00000, 0xfb000000, 0x00000000 },  // 02:44
+    { 0x0000001b, 0x00000000, 0x00000000, 0xdfc20000, 0x00000000, 0x01f00000, 0xfb000000, 0x00000000 },  // 02:45
+    { 0x0000001b, 0x00000000, 0x000000ff, 0xc0000000, 0x00000000, 0x01f00000, 0xfb000000, 0x00000000 },  // 02:46
+    { 0xff00001b, 0x00000000, 0x00000000, 0xc0000000, 0x00000000, 0x01f00000, 0xfb000000, 0x00000000 },  // 02:47
+    { 0x0000001b, 0x00000000, 0x00000000, 0xc000fc00, 0x00000000, 0x01f00000, 0xfb000000, 0x00000000 },  // 02:48
+    { 0x0000001b, 0x000007e0, 0x00000000, 0xc0000000, 0x00000000, 0x01f00000, 0xfb000000, 0x00000000 },  // 02:49
+    { 0x0070001b, 0x00000000, 0x00000000, 0xc0000000, 0x00000000, 0x01f00000, 0xfb000000, 0x00000000 },  // 02:50
+    { 0x0000001b, 0x03c00000, 0x00000000, 0xc0000000, 0x00000000, 0x01f00000, 0xfb000000, 0x00000000 },  // 02:51
+    { 0x0000001b, 0x00000000, 0x1f000000, 0xc0000000, 0x00000000, 0x01f00000, 0xfb000000, 0x00000000 },  // 02:52
+    { 0x0000001b, 0x00000000, 0x00000000, 0xc000001f, 0x00000000, 0x01f00000, 0xfb000000, 0x00000000 },  // 02:53
+    { 0x0000001b, 0x00000000, 0x00070000, 0xc0000000, 0x00000000, 0x01f00000, 0xfb000000, 0x00000000 },  // 02:54
+    { 0x0000001b, 0x0000000f, 0x00000000, 0xc0000000, 0x00000000, 0x01f00000, 0xfb000000, 0x00000000 },  // 02:55
+    { 0x0000001b, 0x0000f000, 0x00000000, 0xc0000000, 0x00000000, 0x01f00000, 0xfb000000, 0x00000000 },  // 02:56
+    { 0x0000001b, 0x001f0000, 0x00000000, 0xc0000000, 0x00000000, 0x01f00000, 0xfb000000, 0x00000000 },  // 02:57
+    { 0x0007001b, 0x00000000, 0x00000000, 0xc0000000, 0x00000000, 0x01f00000, 0xfb000000, 0x00000000 },  // 02:58
+    { 0x0000e01b, 0x00000000, 0x00000000, 0xc0000000, 0x00000000, 0x01f00000, 0xfb000000, 0x00000000 },  // 02:59
+    { 0x0000001b, 0x001f0000, 0x00000000, 0x00000000, 0x00000600, 0x00000000, 0xf8000000, 0x00000000 },  // 03:00
+    { 0x0000e01b, 0x00000000, 0x00000000, 0x00000000, 0x0000000f, 0x01f00000, 0xfb000000, 0x00000000 },  // 03:01
+    { 0x0007001b, 0x00000000, 0x00000000, 0x00000000, 0x0000000f, 0x01f00000, 0xfb000000, 0x00000000 },  // 03:02
+    { 0x0000001b, 0x001f0000, 0x00000000, 0x00000000, 0x0000000f, 0x01f00000, 0xfb000000, 0x00000000 },  // 03:03
+    { 0x0000001b, 0x0000f000, 0x00000000, 0x00000000, 0x0000000f, 0x01f00000, 0xfb000000, 0x00000000 },  // 03:04
+    { 0x0000001b, 0x0000000f, 0x00000000, 0x00000000, 0x0000000f, 0x01f00000, 0xfb000000, 0x00000000 },  // 03:05
+    { 0x0000001b, 0x00000000, 0x00070000, 0x00000000, 0x0000000f, 0x01f00000, 0xfb000000, 0x00000000 },  // 03:06
+    { 0x0000001b, 0x00000000, 0x00000000, 0x0000001f, 0x0000000f, 0x01f00000, 0xfb000000, 0x00000000 },  // 03:07
+    { 0x0000001b, 0x00000000, 0x1f000000, 0x00000000, 0x0000000f, 0x01f00000, 0xfb000000, 0x00000000 },  // 03:08
+    { 0x0000001b, 0x03c00000, 0x00000000, 0x00000000, 0x0000000f, 0x01f00000, 0xfb000000, 0x00000000 },  // 03:09
+    { 0x0070001b, 0x00000000, 0x00000000, 0x00000000, 0x0000000f, 0x01f00000, 0xfb000000, 0x00000000 },  // 03:10
+    { 0x0000001b, 0x000007e0, 0x00000000, 0x00000000, 0x0000000f, 0x01f00000, 0xfb000000, 0x00000000 },  // 03:11
+    { 0x0000001b, 0x00000000, 0x00000000, 0x0000fc00, 0x0000000f, 0x01f00000, 0xfb000000, 0x00000000 },  // 03:12
+    { 0xff00001b, 0x00000000, 0x00000000, 0x00000000, 0x0000000f, 0x01f00000, 0xfb000000, 0x00000000 },  // 03:13
+    { 0x0000001b, 0x00000000, 0x000000ff, 0x00000000, 0x0000000f, 0x01f00000, 0xfb000000, 0x00000000 },  // 03:14
+    { 0x0000001b, 0x00000000, 0x00000000, 0x1fc20000, 0x0000000f, 0x01f00000, 0xfb000000, 0x00000000 },  // 03:15
+    { 0x0000001b, 0x00000000, 0x007f0000, 0x00000000, 0x0000000f, 0x01f00000, 0xfb000000, 0x00000000 },  // 03:16
+    { 0x0000001b, 0x00000000, 0x00000000, 0x000001ff, 0x0000000f, 0x01f00000, 0xfb000000, 0x00000000 },  // 03:17
+    { 0x0000001b, 0x00000000, 0xff000000, 0x00000000, 0x0000000f, 0x01f00000, 0xfb000000, 0x00000000 },  // 03:18
+    { 0x0000001b, 0x3fc00000, 0x00000000, 0x00000000, 0x0000000f, 0x01f00000, 0xfb000000, 0x00000000 },  // 03:19
+    { 0x00000fdb, 0x00000000, 0x00000000, 0x00000000, 0x0000000f, 0x01f00000, 0xfb000000, 0x00000000 },  // 03:20
+    { 0x0000efdb, 0x00000000, 0x00000000, 0x00000000, 0x0000000f, 0x01f00000, 0xfb000000, 0x00000000 },  // 03:21
+    { 0x00070fdb, 0x00000000, 0x00000000, 0x00000000, 0x0000000f, 0x01f00000, 0xfb000000, 0x00000000 },  // 03:22
+    { 0x00000fdb, 0x001f0000, 0x00000000, 0x00000000, 0x0000000f, 0x01f00000, 0xfb000000, 0x00000000 },  // 03:23
+    { 0x00000fdb, 0x0000f000, 0x00000000, 0x00000000, 0x0000000f, 0x01f00000, 0xfb000000, 0x00000000 },  // 03:24
+    { 0x00000fdb, 0x0000000f, 0x00000000, 0x00000000, 0x0000000f, 0x01f00000, 0xfb000000, 0x00000000 },  // 03:25
+    { 0x00000fdb, 0x00000000, 0x00070000, 0x00000000, 0x0000000f, 0x01f00000, 0xfb000000, 0x00000000 },  // 03:26
+    { 0x00000fdb, 0x00000000, 0x00000000, 0x0000001f, 0x0000000f, 0x01f00000, 0xfb000000, 0x00000000 },  // 03:27
+    { 0x00000fdb, 0x00000000, 0x1f000000, 0x00000000, 0x0000000f, 0x01f00000, 0xfb000000, 0x00000000 },  // 03:28
+    { 0x00000fdb, 0x03c00000, 0x00000000, 0x00000000, 0x0000000f, 0x01f00000, 0xfb000000, 0x00000000 },  // 03:29
+    { 0x0000001b, 0x00000000, 0x00000000, 0x000f0000, 0x0000000f, 0x01f00000, 0xfb000000, 0x00000000 },  // 03:30
+    { 0x00000fdb, 0x03c00000, 0x00000000, 0xc0000000, 0x07800000, 0x00000000, 0xfb000000, 0x00000000 },  // 03:31
+    { 0x00000fdb, 0x00000000, 0x1f000000, 0xc0000000, 0x07800000, 0x00000000, 0xfb000000, 0x00000000 },  // 03:32
+    { 0x00000fdb, 0x00000000, 0x00000000, 0xc000001f, 0x07800000, 0x00000000, 0xfb000000, 0x00000000 },  // 03:33
+    { 0x00000fdb, 0x00000000, 0x00070000, 0xc0000000, 0x07800000, 0x00000000, 0xfb000000, 0x00000000 },  // 03:34
+    { 0x00000fdb, 0x0000000f, 0x00000000, 0xc0000000, 0x07800000, 0x00000000, 0xfb000000, 0x00000000 },  // 03:35
+    { 0x00000fdb, 0x0000f000, 0x00000000, 0xc0000000, 0x07800000, 0x00000000, 0xfb000000, 0x00000000 },  // 03:36
+    { 0x00000fdb, 0x001f0000, 0x00000000, 0xc0000000, 0x07800000, 0x00000000, 0xfb000000, 0x00000000 },  // 03:37
+    { 0x00070fdb, 0x00000000, 0x00000000, 0xc0000000, 0x07800000, 0x00000000, 0xfb000000, 0x00000000 },  // 03:38
+    { 0x0000efdb, 0x00000000, 0x00000000, 0xc0000000, 0x07800000, 0x00000000, 0xfb000000, 0x00000000 },  // 03:39
+    { 0x00000fdb, 0x00000000, 0x00000000, 0xc0000000, 0x07800000, 0x00000000, 0xfb000000, 0x00000000 },  // 03:40
+    { 0x0000001b, 0x3fc00000, 0x00000000, 0xc0000000, 0x07800000, 0x00000000, 0xfb000000, 0x00000000 },  // 03:41
+    { 0x0000001b, 0x00000000, 0xff000000, 0xc0000000, 0x07800000, 0x00000000, 0xfb000000, 0x00000000 },  // 03:42
+    { 0x0000001b, 0x00000000, 0x00000000, 0xc00001ff, 0x07800000, 0x00000000, 0xfb000000, 0x00000000 },  // 03:43
+    { 0x0000001b, 0x00000000, 0x007f0000, 0xc0000000, 0x07800000, 0x00000000, 0xfb000000, 0x00000000 },  // 03:44
+    { 0x0000001b, 0x00000000, 0x00000000, 0xdfc20000, 0x07800000, 0x00000000, 0xfb000000, 0x00000000 },  // 03:45
+    { 0x0000001b, 0x00000000, 0x000000ff, 0xc0000000, 0x07800000, 0x00000000, 0xfb000000, 0x00000000 },  // 03:46
+    { 0xff00001b, 0x00000000, 0x00000000, 0xc0000000, 0x07800000, 0x00000000, 0xfb000000, 0x00000000 },  // 03:47
+    { 0x0000001b, 0x00000000, 0x00000000, 0xc000fc00, 0x07800000, 0x00000000, 0xfb000000, 0x00000000 },  // 03:48
+    { 0x0000001b, 0x000007e0, 0x00000000, 0xc0000000, 0x07800000, 0x00000000, 0xfb000000, 0x00000000 },  // 03:49
+    { 0x0070001b, 0x00000000, 0x00000000, 0xc0000000, 0x07800000, 0x00000000, 0xfb000000, 0x00000000 },  // 03:50
+    { 0x0000001b, 0x03c00000, 0x00000000, 0xc0000000, 0x07800000, 0x00000000, 0xfb000000, 0x00000000 },  // 03:51
+    { 0x0000001b, 0x00000000, 0x1f000000, 0xc0000000, 0x07800000, 0x00000000, 0xfb000000, 0x00000000 },  // 03:52
+    { 0x0000001b, 0x00000000, 0x00000000, 0xc000001f, 0x07800000, 0x00000000, 0xfb000000, 0x00000000 },  // 03:53
+    { 0x0000001b, 0x00000000, 0x00070000, 0xc0000000, 0x07800000, 0x00000000, 0xfb000000, 0x00000000 },  // 03:54
+    { 0x0000001b, 0x0000000f, 0x00000000, 0xc0000000, 0x07800000, 0x00000000, 0xfb000000, 0x00000000 },  // 03:55
+    { 0x0000001b, 0x0000f000, 0x00000000, 0xc0000000, 0x07800000, 0x00000000, 0xfb000000, 0x00000000 },  // 03:56
+    { 0x0000001b, 0x001f0000, 0x00000000, 0xc0000000, 0x07800000, 0x00000000, 0xfb000000, 0x00000000 },  // 03:57
+    { 0x0007001b, 0x00000000, 0x00000000, 0xc0000000, 0x07800000, 0x00000000, 0xfb000000, 0x00000000 },  // 03:58
+    { 0x0000e01b, 0x00000000, 0x00000000, 0xc0000000, 0x07800000, 0x00000000, 0xfb000000, 0x00000000 },  // 03:59
+    { 0x0000001b, 0x0000f000, 0x00000000, 0x00000000, 0x00000600, 0x00000000, 0xf8000000, 0x00000000 },  // 04:00
+    { 0x0000e01b, 0x00000000, 0x00000000, 0x00000000, 0x0780000f, 0x00000000, 0xfb000000, 0x00000000 },  // 04:01
+    { 0x0007001b, 0x00000000, 0x00000000, 0x00000000, 0x0780000f, 0x00000000, 0xfb000000, 0x00000000 },  // 04:02
+    { 0x0000001b, 0x001f0000, 0x00000000, 0x00000000, 0x0780000f, 0x00000000, 0xfb000000, 0x00000000 },  // 04:03
+    { 0x0000001b, 0x0000f000, 0x00000000, 0x00000000, 0x0780000f, 0x00000000, 0xfb000000, 0x00000000 },  // 04:04
+    { 0x0000001b, 0x0000000f, 0x00000000, 0x00000000, 0x0780000f, 0x00000000, 0xfb000000, 0x00000000 },  // 04:05
+    { 0x0000001b, 0x00000000, 0x00070000, 0x00000000, 0x0780000f, 0x00000000, 0xfb000000, 0x00000000 },  // 04:06
+    { 0x0000001b, 0x00000000, 0x00000000, 0x0000001f, 0x0780000f, 0x00000000, 0xfb000000, 0x00000000 },  // 04:07
+    { 0x0000001b, 0x00000000, 0x1f000000, 0x00000000, 0x0780000f, 0x00000000, 0xfb000000, 0x00000000 },  // 04:08
+    { 0x0000001b, 0x03c00000, 0x00000000, 0x00000000, 0x0780000f, 0x00000000, 0xfb000000, 0x00000000 },  // 04:09
+    { 0x0070001b, 0x00000000, 0x00000000, 0x00000000, 0x0780000f, 0x00000000, 0xfb000000, 0x00000000 },  // 04:10
+    { 0x0000001b, 0x000007e0, 0x00000000, 0x00000000, 0x0780000f, 0x00000000, 0xfb000000, 0x00000000 },  // 04:11
+    { 0x0000001b, 0x00000000, 0x00000000, 0x0000fc00, 0x0780000f, 0x00000000, 0xfb000000, 0x00000000 },  // 04:12
+    { 0xff00001b, 0x00000000, 0x00000000, 0x00000000, 0x0780000f, 0x00000000, 0xfb000000, 0x00000000 },  // 04:13
+    { 0x0000001b, 0x00000000, 0x000000ff, 0x00000000, 0x0780000f, 0x00000000, 0xfb000000, 0x00000000 },  // 04:14
+    { 0x0000001b, 0x00000000, 0x00000000, 0x1fc20000, 0x0780000f, 0x00000000, 0xfb000000, 0x00000000 },  // 04:15
+    { 0x0000001b, 0x00000000, 0x007f0000, 0x00000000, 0x0780000f, 0x00000000, 0xfb000000, 0x00000000 },  // 04:16
+    { 0x0000001b, 0x00000000, 0x00000000, 0x000001ff, 0x0780000f, 0x00000000, 0xfb000000, 0x00000000 },  // 04:17
+    { 0x0000001b, 0x00000000, 0xff000000, 0x00000000, 0x0780000f, 0x00000000, 0xfb000000, 0x00000000 },  // 04:18
+    { 0x0000001b, 0x3fc00000, 0x00000000, 0x00000000, 0x0780000f, 0x00000000, 0xfb000000, 0x00000000 },  // 04:19
+    { 0x00000fdb, 0x00000000, 0x00000000, 0x00000000, 0x0780000f, 0x00000000, 0xfb000000, 0x00000000 },  // 04:20
+    { 0x0000efdb, 0x00000000, 0x00000000, 0x00000000, 0x0780000f, 0x00000000, 0xfb000000, 0x00000000 },  // 04:21
+    { 0x00070fdb, 0x00000000, 0x00000000, 0x00000000, 0x0780000f, 0x00000000, 0xfb000000, 0x00000000 },  // 04:22
+    { 0x00000fdb, 0x001f0000, 0x00000000, 0x00000000, 0x0780000f, 0x00000000, 0xfb000000, 0x00000000 },  // 04:23
+    { 0x00000fdb, 0x0000f000, 0x00000000, 0x00000000, 0x0780000f, 0x00000000, 0xfb000000, 0x00000000 },  // 04:24
+    { 0x00000fdb, 0x0000000f, 0x00000000, 0x00000000, 0x0780000f, 0x00000000, 0xfb000000, 0x00000000 },  // 04:25
+    { 0x00000fdb, 0x00000000, 0x00070000, 0x00000000, 0x0780000f, 0x00000000, 0xfb000000, 0x00000000 },  // 04:26
+    { 0x00000fdb, 0x00000000, 0x00000000, 0x0000001f, 0x0780000f, 0x00000000, 0xfb000000, 0x00000000 },  // 04:27
+    { 0x00000fdb, 0x00000000, 0x1f000000, 0x00000000, 0x0780000f, 0x00000000, 0xfb000000, 0x00000000 },  // 04:28
+    { 0x00000fdb, 0x03c00000, 0x00000000, 0x00000000, 0x0780000f, 0x00000000, 0xfb000000, 0x00000000 },  // 04:29
+    { 0x0000001b, 0x00000000, 0x00000000, 0x000f0000, 0x0780000f, 0x00000000, 0xfb000000, 0x00000000 },  // 04:30
+    { 0x00000fdb, 0x03c00000, 0x00000000, 0xc0000000, 0xf0000000, 0x00006000, 0x007f0038, 0x00000000 },  // 04:31
+    { 0x00000fdb, 0x00000000, 0x1f000000, 0xc0000000, 0xf0000000, 0x00006000, 0x007f0038, 0x00000000 },  // 04:32
+    { 0x00000fdb, 0x00000000, 0x00000000, 0xc000001f, 0xf0000000, 0x00006000, 0x007f0038, 0x00000000 },  // 04:33
+    { 0x00000fdb, 0x00000000, 0x00070000, 0xc0000000, 0xf0000000, 0x00006000, 0x007f0038, 0x00000000 },  // 04:34
+    { 0x00000fdb, 0x0000000f, 0x00000000, 0xc0000000, 0xf0000000, 0x00006000, 0x007f0038, 0x00000000 },  // 04:35
+    { 0x00000fdb, 0x0000f000, 0x00000000, 0xc0000000, 0xf0000000, 0x00006000, 0x007f0038, 0x00000000 },  // 04:36
+    { 0x00000fdb, 0x001f0000, 0x00000000, 0xc0000000, 0xf0000000, 0x00006000, 0x007f0038, 0x00000000 },  // 04:37
+    { 0x00070fdb, 0x00000000, 0x00000000, 0xc0000000, 0xf0000000, 0x00006000, 0x007f0038, 0x00000000 },  // 04:38
+    { 0x0000efdb, 0x00000000, 0x00000000, 0xc0000000, 0xf0000000, 0x00006000, 0x007f0038, 0x00000000 },  // 04:39
+    { 0x00000fdb, 0x00000000, 0x00000000, 0xc0000000, 0xf0000000, 0x00006000, 0x007f0038, 0x00000000 },  // 04:40
+    { 0x0000001b, 0x3fc00000, 0x00000000, 0xc0000000, 0xf0000000, 0x00006000, 0x007f0038, 0x00000000 },  // 04:41
+    { 0x0000001b, 0x00000000, 0xff000000, 0xc0000000, 0xf0000000, 0x00006000, 0x007f0038, 0x00000000 },  // 04:42
+    { 0x0000001b, 0x00000000, 0x00000000, 0xc00001ff, 0xf0000000, 0x00006000, 0x007f0038, 0x00000000 },  // 04:43
+    { 0x0000001b, 0x00000000, 0x007f0000, 0xc0000000, 0xf0000000, 0x00006000, 0x007f0038, 0x00000000 },  // 04:44
+    { 0x0000001b, 0x00000000, 0x00000000, 0xdfc20000, 0xf0000000, 0x00006000, 0x007f0038, 0x00000000 },  // 04:45
+    { 0x0000001b, 0x00000000, 0x000000ff, 0xc0000000, 0xf0000000, 0x00006000, 0x007f0038, 0x00000000 },  // 04:46
+    { 0xff00001b, 0x00000000, 0x00000000, 0xc0000000, 0xf0000000, 0x00006000, 0x007f0038, 0x00000000 },  // 04:47
+    { 0x0000001b, 0x00000000, 0x00000000, 0xc000fc00, 0xf0000000, 0x00006000, 0x007f0038, 0x00000000 },  // 04:48
+    { 0x0000001b, 0x000007e0, 0x00000000, 0xc0000000, 0xf0000000, 0x00006000, 0x007f0038, 0x00000000 },  // 04:49
+    { 0x0070001b, 0x00000000, 0x00000000, 0xc0000000, 0xf0000000, 0x00006000, 0x007f0038, 0x00000000 },  // 04:50
+    { 0x0000001b, 0x03c00000, 0x00000000, 0xc0000000, 0xf0000000, 0x00006000, 0x007f0038, 0x00000000 },  // 04:51
+    { 0x0000001b, 0x00000000, 0x1f000000, 0xc0000000, 0xf0000000, 0x00006000, 0x007f0038, 0x00000000 },  // 04:52
+    { 0x0000001b, 0x00000000, 0x00000000, 0xc000001f, 0xf0000000, 0x00006000, 0x007f0038, 0x00000000 },  // 04:53
+    { 0x0000001b, 0x00000000, 0x00070000, 0xc0000000, 0xf0000000, 0x00006000, 0x007f0038, 0x00000000 },  // 04:54
+    { 0x0000001b, 0x0000000f, 0x00000000, 0xc0000000, 0xf0000000, 0x00006000, 0x007f0038, 0x00000000 },  // 04:55
+    { 0x0000001b, 0x0000f000, 0x00000000, 0xc0000000, 0xf0000000, 0x00006000, 0x007f0038, 0x00000000 },  // 04:56
+    { 0x0000001b, 0x001f0000, 0x00000000, 0xc0000000, 0xf0000000, 0x00006000, 0x007f0038, 0x00000000 },  // 04:57
+    { 0x0007001b, 0x00000000, 0x00000000, 0xc0000000, 0xf0000000, 0x00006000, 0x007f0038, 0x00000000 },  // 04:58
+    { 0x0000e01b, 0x00000000, 0x00000000, 0xc0000000, 0xf0000000, 0x00006000, 0x007f0038, 0x00000000 },  // 04:59
+    { 0x0000001b, 0x0180000f, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x007f0038, 0x00000000 },  // 05:00
+    { 0x0000e01b, 0x00000000, 0x00000000, 0x00000000, 0xf000000f, 0x00006000, 0x007f0038, 0x00000000 },  // 05:01
+    { 0x0007001b, 0x00000000, 0x00000000, 0x00000000, 0xf000000f, 0x00006000, 0x007f0038, 0x00000000 },  // 05:02
+    { 0x0000001b, 0x001f0000, 0x00000000, 0x00000000, 0xf000000f, 0x00006000, 0x007f0038, 0x00000000 },  // 05:03
+    { 0x0000001b, 0x0000f000, 0x00000000, 0x00000000, 0xf000000f, 0x00006000, 0x007f0038, 0x00000000 },  // 05:04
+    { 0x0000001b, 0x0000000f, 0x00000000, 0x00000000, 0xf000000f, 0x00006000, 0x007f0038, 0x00000000 },  // 05:05
+    { 0x0000001b, 0x00000000, 0x00070000, 0x00000000, 0xf000000f, 0x00006000, 0x007f0038, 0x00000000 },  // 05:06
+    { 0x0000001b, 0x00000000, 0x00000000, 0x0000001f, 0xf000000f, 0x00006000, 0x007f0038, 0x00000000 },  // 05:07
+    { 0x0000001b, 0x00000000, 0x1f000000, 0x00000000, 0xf000000f, 0x00006000, 0x007f0038, 0x00000000 },  // 05:08
+    { 0x0000001b, 0x03c00000, 0x00000000, 0x00000000, 0xf000000f, 0x00006000, 0x007f0038, 0x00000000 },  // 05:09
+    { 0x0070001b, 0x00000000, 0x00000000, 0x00000000, 0xf000000f, 0x00006000, 0x007f0038, 0x00000000 },  // 05:10
+    { 0x0000001b, 0x000007e0, 0x00000000, 0x00000000, 0xf000000f, 0x00006000, 0x007f0038, 0x00000000 },  // 05:11
+    { 0x0000001b, 0x00000000, 0x00000000, 0x0000fc00, 0xf000000f, 0x00006000, 0x007f0038, 0x00000000 },  // 05:12
+    { 0xff00001b, 0x00000000, 0x00000000, 0x00000000, 0xf000000f, 0x00006000, 0x007f0038, 0x00000000 },  // 05:13
+    { 0x0000001b, 0x00000000, 0x000000ff, 0x00000000, 0xf000000f, 0x00006000, 0x007f0038, 0x00000000 },  // 05:14
+    { 0x0000001b, 0x00000000, 0x00000000, 0x1fc20000, 0xf000000f, 0x00006000, 0x007f0038, 0x00000000 },  // 05:15
+    { 0x0000001b, 0x00000000, 0x007f0000, 0x00000000, 0xf000000f, 0x00006000, 0x007f0038, 0x00000000 },  // 05:16
+    { 0x0000001b, 0x00000000, 0x00000000, 0x000001ff, 0xf000000f, 0x00006000, 0x007f0038, 0x00000000 },  // 05:17
+    { 0x0000001b, 0x00000000, 0xff000000, 0x00000000, 0xf000000f, 0x00006000, 0x007f0038, 0x00000000 },  // 05:18
+    { 0x0000001b, 0x3fc00000, 0x00000000, 0x00000000, 0xf000000f, 0x00006000, 0x007f0038, 0x00000000 },  // 05:19
+    { 0x00000fdb, 0x00000000, 0x00000000, 0x00000000, 0xf000000f, 0x00006000, 0x007f0038, 0x00000000 },  // 05:20
+    { 0x0000efdb, 0x00000000, 0x00000000, 0x00000000, 0xf000000f, 0x00006000, 0x007f0038, 0x00000000 },  // 05:21
+    { 0x00070fdb, 0x00000000, 0x00000000, 0x00000000, 0xf000000f, 0x00006000, 0x007f0038, 0x00000000 },  // 05:22
+    { 0x00000fdb, 0x001f0000, 0x00000000, 0x00000000, 0xf000000f, 0x00006000, 0x007f0038, 0x00000000 },  // 05:23
+    { 0x00000fdb, 0x0000f000, 0x00000000, 0x00000000, 0xf000000f, 0x00006000, 0x007f0038, 0x00000000 },  // 05:24
+    { 0x00000fdb, 0x0000000f, 0x00000000, 0x00000000, 0xf000000f, 0x00006000, 0x007f0038, 0x00000000 },  // 05:25
+    { 0x00000fdb, 0x00000000, 0x00070000, 0x00000000, 0xf000000f, 0x00006000, 0x007f0038, 0x00000000 },  // 05:26
+    { 0x00000fdb, 0x00000000, 0x00000000, 0x0000001f, 0xf000000f, 0x00006000, 0x007f0038, 0x00000000 },  // 05:27
+    { 0x00000fdb, 0x00000000, 0x1f000000, 0x00000000, 0xf000000f, 0x00006000, 0x007f0038, 0x00000000 },  // 05:28
+    { 0x00000fdb, 0x03c00000, 0x00000000, 0x00000000, 0xf000000f, 0x00006000, 0x007f0038, 0x00000000 },  // 05:29
+    { 0x0000001b, 0x00000000, 0x00000000, 0x000f0000, 0xf000000f, 0x00006000, 0x007f0038, 0x00000000 },  // 05:30
+    { 0x00000fdb, 0x03c00000, 0x00000000, 0xc0000000, 0x0000e000, 0x00006000, 0x007f0038, 0x00000000 },  // 05:31
+    { 0x00000fdb, 0x00000000, 0x1f000000, 0xc0000000, 0x0000e000, 0x00006000, 0x007f0038, 0x00000000 },  // 05:32
+    { 0x00000fdb, 0x00000000, 0x00000000, 0xc000001f, 0x0000e000, 0x00006000, 0x007f0038, 0x00000000 },  // 05:33
+    { 0x00000fdb, 0x00000000, 0x00070000, 0xc0000000, 0x0000e000, 0x00006000, 0x007f0038, 0x00000000 },  // 05:34
+    { 0x00000fdb, 0x0000000f, 0x00000000, 0xc0000000, 0x0000e000, 0x00006000, 0x007f0038, 0x00000000 },  // 05:35
+    { 0x00000fdb, 0x0000f000, 0x00000000, 0xc0000000, 0x0000e000, 0x00006000, 0x007f0038, 0x00000000 },  // 05:36
+    { 0x00000fdb, 0x001f0000, 0x00000000, 0xc0000000, 0x0000e000, 0x00006000, 0x007f0038, 0x00000000 },  // 05:37
+    { 0x00070fdb, 0x00000000, 0x00000000, 0xc0000000, 0x0000e000, 0x00006000, 0x007f0038, 0x00000000 },  // 05:38
+    { 0x0000efdb, 0x00000000, 0x00000000, 0xc0000000, 0x0000e000, 0x00006000, 0x007f0038, 0x00000000 },  // 05:39
+    { 0x00000fdb, 0x00000000, 0x00000000, 0xc0000000, 0x0000e000, 0x00006000, 0x007f0038, 0x00000000 },  // 05:40
+    { 0x0000001b, 0x3fc00000, 0x00000000, 0xc0000000, 0x0000e000, 0x00006000, 0x007f0038, 0x00000000 },  // 05:41
+    { 0x0000001b, 0x00000000, 0xff000000, 0xc0000000, 0x0000e000, 0x00006000, 0x007f0038, 0x00000000 },  // 05:42
+    { 0x0000001b, 0x00000000, 0x00000000, 0xc00001ff, 0x0000e000, 0x00006000, 0x007f0038, 0x00000000 },  // 05:43
+    { 0x0000001b, 0x00000000, 0x007f0000, 0xc0000000, 0x0000e000, 0x00006000, 0x007f0038, 0x00000000 },  // 05:44
+    { 0x0000001b, 0x00000000, 0x00000000, 0xdfc20000, 0x0000e000, 0x00006000, 0x007f0038, 0x00000000 },  // 05:45
+    { 0x0000001b, 0x00000000, 0x000000ff, 0xc0000000, 0x0000e000, 0x00006000, 0x007f0038, 0x00000000 },  // 05:46
+    { 0xff00001b, 0x00000000, 0x00000000, 0xc0000000, 0x0000e000, 0x00006000, 0x007f0038, 0x00000000 },  // 05:47
+    { 0x0000001b, 0x00000000, 0x00000000, 0xc000fc00, 0x0000e000, 0x00006000, 0x007f0038, 0x00000000 },  // 05:48
+    { 0x0000001b, 0x000007e0, 0x00000000, 0xc0000000, 0x0000e000, 0x00006000, 0x007f0038, 0x00000000 },  // 05:49
+    { 0x0070001b, 0x00000000, 0x00000000, 0xc0000000, 0x0000e000, 0x00006000, 0x007f0038, 0x00000000 },  // 05:50
+    { 0x0000001b, 0x03c00000, 0x00000000, 0xc0000000, 0x0000e000, 0x00006000, 0x007f0038, 0x00000000 },  // 05:51
+    { 0x0000001b, 0x00000000, 0x1f000000, 0xc0000000, 0x0000e000, 0x00006000, 0x007f0038, 0x00000000 },  // 05:52
+    { 0x0000001b, 0x00000000, 0x00000000, 0xc000001f, 0x0000e000, 0x00006000, 0x007f0038, 0x00000000 },  // 05:53
+    { 0x0000001b, 0x00000000, 0x00070000, 0xc0000000, 0x0000e000, 0x00006000, 0x007f0038, 0x00000000 },  // 05:54
+    { 0x0000001b, 0x0000000f, 0x00000000, 0xc0000000, 0x0000e000, 0x00006000, 0x007f0038, 0x00000000 },  // 05:55
+    { 0x0000001b, 0x0000f000, 0x00000000, 0xc0000000, 0x0000e000, 0x00006000, 0x007f0038, 0x00000000 },  // 05:56
+    { 0x0000001b, 0x001f0000, 0x00000000, 0xc0000000, 0x0000e000, 0x00006000, 0x007f0038, 0x00000000 },  // 05:57
+    { 0x0007001b, 0x00000000, 0x00000000, 0xc0000000, 0x0000e000, 0x00006000, 0x007f0038, 0x00000000 },  // 05:58
+    { 0x0000e01b, 0x00000000, 0x00000000, 0xc0000000, 0x0000e000, 0x00006000, 0x007f0038, 0x00000000 },  // 05:59
+    { 0x0000001b, 0x00000000, 0x00070000, 0x00000000, 0x00000000, 0x00006000, 0x007f0038, 0x00000000 },  // 06:00
+    { 0x0000e01b, 0x00000000, 0x00000000, 0x00000000, 0x0000e00f, 0x00006000, 0x007f0038, 0x00000000 },  // 06:01
+    { 0x0007001b, 0x00000000, 0x00000000, 0x00000000, 0x0000e00f, 0x00006000, 0x007f0038, 0x00000000 },  // 06:02
+    { 0x0000001b, 0x001f0000, 0x00000000, 0x00000000, 0x0000e00f, 0x00006000, 0x007f0038, 0x00000000 },  // 06:03
+    { 0x0000001b, 0x0000f000, 0x00000000, 0x00000000, 0x0000e00f, 0x00006000, 0x007f0038, 0x00000000 },  // 06:04
+    { 0x0000001b, 0x0000000f, 0x00000000, 0x00000000, 0x0000e00f, 0x00006000, 0x007f0038, 0x00000000 },  // 06:05
+    { 0x0000001b, 0x00000000, 0x00070000, 0x00000000, 0x0000e00f, 0x00006000, 0x007f0038, 0x00000000 },  // 06:06
+    { 0x0000001b, 0x00000000, 0x00000000, 0x0000001f, 0x0000e00f, 0x00006000, 0x007f0038, 0x00000000 },  // 06:07
+    { 0x0000001b, 0x00000000, 0x1f000000, 0x00000000, 0x0000e00f, 0x00006000, 0x007f0038, 0x00000000 },  // 06:08
+    { 0x0000001b, 0x03c00000, 0x00000000, 0x00000000, 0x0000e00f, 0x00006000, 0x007f0038, 0x00000000 },  // 06:09
+    { 0x0070001b, 0x00000000, 0x00000000, 0x00000000, 0x0000e00f, 0x00006000, 0x007f0038, 0x00000000 },  // 06:10
+    { 0x0000001b, 0x000007e0, 0x00000000, 0x00000000, 0x0000e00f, 0x00006000, 0x007f0038, 0x00000000 },  // 06:11
+    { 0x0000001b, 0x00000000, 0x00000000, 0x0000fc00, 0x0000e00f, 0x00006000, 0x007f0038, 0x00000000 },  // 06:12
+    { 0xff00001b, 0x00000000, 0x00000000, 0x00000000, 0x0000e00f, 0x00006000, 0x007f0038, 0x00000000 },  // 06:13
+    { 0x0000001b, 0x00000000, 0x000000ff, 0x00000000, 0x0000e00f, 0x00006000, 0x007f0038, 0x00000000 },  // 06:14
+    { 0x0000001b, 0x00000000, 0x00000000, 0x1fc20000, 0x0000e00f, 0x00006000, 0x007f0038, 0x00000000 },  // 06:15
+    { 0x0000001b, 0x00000000, 0x007f0000, 0x00000000, 0x0000e00f, 0x00006000, 0x007f0038, 0x00000000 },  // 06:16
+    { 0x0000001b, 0x00000000, 0x00000000, 0x000001ff, 0x0000e00f, 0x00006000, 0x007f0038, 0x00000000 },  // 06:17
+    { 0x0000001b, 0x00000000, 0xff000000, 0x00000000, 0x0000e00f, 0x00006000, 0x007f0038, 0x00000000 },  // 06:18
+    { 0x0000001b, 0x3fc00000, 0x00000000, 0x00000000, 0x0000e00f, 0x00006000, 0x007f0038, 0x00000000 },  // 06:19
+    { 0x00000fdb, 0x00000000, 0x00000000, 0x00000000, 0x0000e00f, 0x00006000, 0x007f0038, 0x00000000 },  // 06:20
+    { 0x0000efdb, 0x00000000, 0x00000000, 0x00000000, 0x0000e00f, 0x00006000, 0x007f0038, 0x00000000 },  // 06:21
+    { 0x00070fdb, 0x00000000, 0x00000000, 0x00000000, 0x0000e00f, 0x00006000, 0x007f0038, 0x00000000 },  // 06:22
+    { 0x00000fdb, 0x001f0000, 0x00000000, 0x00000000, 0x0000e00f, 0x00006000, 0x007f0038, 0x00000000 },  // 06:23
+    { 0x00000fdb, 0x0000f000, 0x00000000, 0x00000000, 0x0000e00f, 0x00006000, 0x007f0038, 0x00000000 },  // 06:24
+    { 0x00000fdb, 0x0000000f, 0x00000000, 0x00000000, 0x0000e00f, 0x00006000, 0x007f0038, 0x00000000 },  // 06:25
+    { 0x00000fdb, 0x00000000, 0x00070000, 0x00000000, 0x0000e00f, 0x00006000, 0x007f0038, 0x00000000 },  // 06:26
+    { 0x00000fdb, 0x00000000, 0x00000000, 0x0000001f, 0x0000e00f, 0x00006000, 0x007f0038, 0x00000000 },  // 06:27
+    { 0x00000fdb, 0x00000000, 0x1f000000, 0x00000000, 0x0000e00f, 0x00006000, 0x007f0038, 0x00000000 },  // 06:28
+    { 0x00000fdb, 0x03c00000, 0x00000000, 0x00000000, 0x0000e00f, 0x00006000, 0x007f0038, 0x00000000 },  // 06:29
+    { 0x0000001b, 0x00000000, 0x00000000, 0x000f0000, 0x0000e00f, 0x00006000, 0x007f0038, 0x00000000 },  // 06:30
+    { 0x00000fdb, 0x03c00000, 0x00000000, 0xc0000000, 0x00000000, 0x0000601f, 0x007f0038, 0x00000000 },  // 06:31
+    { 0x00000fdb, 0x00000000, 0x1f000000, 0xc0000000, 0x00000000, 0x0000601f, 0x007f0038, 0x00000000 },  // 06:32
+    { 0x00000fdb, 0x00000000, 0x00000000, 0xc000001f, 0x00000000, 0x0000601f, 0x007f0038, 0x00000000 },  // 06:33
+    { 0x00000fdb, 0x00000000, 0x00070000, 0xc0000000, 0x00000000, 0x0000601f, 0x007f0038, 0x00000000 },  // 06:34
+    { 0x00000fdb, 0x0000000f, 0x00000000, 0xc0000000, 0x00000000, 0x0000601f, 0x007f0038, 0x00000000 },  // 06:35
+    { 0x00000fdb, 0x0000f000, 0x00000000, 0xc0000000, 0x00000000, 0x0000601f, 0x007f0038, 0x00000000 },  // 06:36
+    { 0x00000fdb, 0x001f0000, 0x00000000, 0xc0000000, 0x00000000, 0x0000601f, 0x007f0038, 0x00000000 },  // 06:37
+    { 0x00070fdb, 0x00000000, 0x00000000, 0xc0000000, 0x00000000, 0x0000601f, 0x007f0038, 0x00000000 },  // 06:38
+    { 0x0000efdb, 0x00000000, 0x00000000, 0xc0000000, 0x00000000, 0x0000601f, 0x007f0038, 0x00000000 },  // 06:39
+    { 0x00000fdb, 0x00000000, 0x00000000, 0xc0000000, 0x00000000, 0x0000601f, 0x007f0038, 0x00000000 },  // 06:40
+    { 0x0000001b, 0x3fc00000, 0x00000000, 0xc0000000, 0x00000000, 0x0000601f, 0x007f0038, 0x00000000 },  // 06:41
+    { 0x0000001b, 0x00000000, 0xff000000, 0xc0000000, 0x00000000, 0x0000601f, 0x007f0038, 0x00000000 },  // 06:42
+    { 0x0000001b, 0x00000000, 0x00000000, 0xc00001ff, 0x00000000, 0x0000601f, 0x007f0038, 0x00000000 },  // 06:43
+    { 0x0000001b, 0x00000000, 0x007f0000, 0xc0000000, 0x00000000, 0x0000601f, 0x007f0038, 0x00000000 },  // 06:44
+    { 0x0000001b, 0x00000000, 0x00000000, 0xdfc20000, 0x00000000, 0x0000601f, 0x007f0038, 0x00000000 },  // 06:45
+    { 0x0000001b, 0x00000000, 0x000000ff, 0xc0000000, 0x00000000, 0x0000601f, 0x007f0038, 0x00000000 },  // 06:46
+    { 0xff00001b, 0x00000000, 0x00000000, 0xc0000000, 0x00000000, 0x0000601f, 0x007f0038, 0x00000000 },  // 06:47
+    { 0x0000001b, 0x00000000, 0x00000000, 0xc000fc00, 0x00000000, 0x0000601f, 0x007f0038, 0x00000000 },  // 06:48
+    { 0x0000001b, 0x000007e0, 0x00000000, 0xc0000000, 0x00000000, 0x0000601f, 0x007f0038, 0x00000000 },  // 06:49
+    { 0x0070001b, 0x00000000, 0x00000000, 0xc0000000, 0x00000000, 0x0000601f, 0x007f0038, 0x00000000 },  // 06:50
+    { 0x0000001b, 0x03c00000, 0x00000000, 0xc0000000, 0x00000000, 0x0000601f, 0x007f0038, 0x00000000 },  // 06:51
+    { 0x0000001b, 0x00000000, 0x1f000000, 0xc0000000, 0x00000000, 0x0000601f, 0x007f0038, 0x00000000 },  // 06:52
+    { 0x0000001b, 0x00000000, 0x00000000, 0xc000001f, 0x00000000, 0x0000601f, 0x007f0038, 0x00000000 },  // 06:53
+    { 0x0000001b, 0x00000000, 0x00070000, 0xc0000000, 0x00000000, 0x0000601f, 0x007f0038, 0x00000000 },  // 06:54
+    { 0x0000001b, 0x0000000f, 0x00000000, 0xc0000000, 0x00000000, 0x0000601f, 0x007f0038, 0x00000000 },  // 06:55
+    { 0x0000001b, 0x0000f000, 0x00000000, 0xc0000000, 0x00000000, 0x0000601f, 0x007f0038, 0x00000000 },  // 06:56
+    { 0x0000001b, 0x001f0000, 0x00000000, 0xc0000000, 0x00000000, 0x0000601f, 0x007f0038, 0x00000000 },  // 06:57
+    { 0x0007001b, 0x00000000, 0x00000000, 0xc0000000, 0x00000000, 0x0000601f, 0x007f0038, 0x00000000 },  // 06:58
+    { 0x0000e01b, 0x00000000, 0x00000000, 0xc0000000, 0x00000000, 0x0000601f, 0x007f0038, 0x00000000 },  // 06:59
+    { 0x0000001b, 0x00000000, 0x00000000, 0x0000001f, 0x00000000, 0x00006000, 0x007f0038, 0x00000000 },  // 07:00
+    { 0x0000e01b, 0x00000000, 0x00000000, 0x00000000, 0x0000000f, 0x0000601f, 0x007f0038, 0x00000000 },  // 07:01
+    { 0x0007001b, 0x00000000, 0x00000000, 0x00000000, 0x0000000f, 0x0000601f, 0x007f0038, 0x00000000 },  // 07:02
+    { 0x0000001b, 0x001f0000, 0x00000000, 0x00000000, 0x0000000f, 0x0000601f, 0x007f0038, 0x00000000 },  // 07:03
+    { 0x0000001b, 0x0000f000, 0x00000000, 0x00000000, 0x0000000f, 0x0000601f, 0x007f0038, 0x00000000 },  // 07:04
+    { 0x0000001b, 0x0000000f, 0x00000000, 0x00000000, 0x0000000f, 0x0000601f, 0x007f0038, 0x00000000 },  // 07:05
+    { 0x0000001b, 0x00000000, 0x00070000, 0x00000000, 0x0000000f, 0x0000601f, 0x007f0038, 0x00000000 },  // 07:06
+    { 0x0000001b, 0x00000000, 0x00000000, 0x0000001f, 0x0000000f, 0x0000601f, 0x007f0038, 0x00000000 },  // 07:07
+    { 0x0000001b, 0x00000000, 0x1f000000, 0x00000000, 0x0000000f, 0x0000601f, 0x007f0038, 0x00000000 },  // 07:08
+    { 0x0000001b, 0x03c00000, 0x00000000, 0x00000000, 0x0000000f, 0x0000601f, 0x007f0038, 0x00000000 },  // 07:09
+    { 0x0070001b, 0x00000000, 0x00000000, 0x00000000, 0x0000000f, 0x0000601f, 0x007f0038, 0x00000000 },  // 07:10
+    { 0x0000001b, 0x000007e0, 0x00000000, 0x00000000, 0x0000000f, 0x0000601f, 0x007f0038, 0x00000000 },  // 07:11
+    { 0x0000001b, 0x00000000, 0x00000000, 0x0000fc00, 0x0000000f, 0x0000601f, 0x007f0038, 0x00000000 },  // 07:12
+    { 0xff00001b, 0x00000000, 0x00000000, 0x00000000, 0x0000000f, 0x0000601f, 0x007f0038, 0x00000000 },  // 07:13
+    { 0x0000001b, 0x00000000, 0x000000ff, 0x00000000, 0x0000000f, 0x0000601f, 0x007f0038, 0x00000000 },  // 07:14
+    { 0x0000001b, 0x00000000, 0x00000000, 0x1fc20000, 0x0000000f, 0x0000601f, 0x007f0038, 0x00000000 },  // 07:15
+    { 0x0000001b, 0x00000000, 0x007f0000, 0x00000000, 0x0000000f, 0x0000601f, 0x007f0038, 0x00000000 },  // 07:16
+    { 0x0000001b, 0x00000000, 0x00000000, 0x000001ff, 0x0000000f, 0x0000601f, 0x007f0038, 0x00000000 },  // 07:17
+    { 0x0000001b, 0x00000000, 0xff000000, 0x00000000, 0x0000000f, 0x0000601f, 0x007f0038, 0x00000000 },  // 07:18
+    { 0x0000001b, 0x3fc00000, 0x00000000, 0x00000000, 0x0000000f, 0x0000601f, 0x007f0038, 0x00000000 },  // 07:19
+    { 0x00000fdb, 0x00000000, 0x00000000, 0x00000000, 0x0000000f, 0x0000601f, 0x007f0038, 0x00000000 },  // 07:20
+    { 0x0000efdb, 0x00000000, 0x00000000, 0x00000000, 0x0000000f, 0x0000601f, 0x007f0038, 0x00000000 },  // 07:21
+    { 0x00070fdb, 0x00000000, 0x00000000, 0x00000000, 0x0000000f, 0x0000601f, 0x007f0038, 0x00000000 },  // 07:22
+    { 0x00000fdb, 0x001f0000, 0x00000000, 0x00000000, 0x0000000f, 0x0000601f, 0x007f0038, 0x00000000 },  // 07:23
+    { 0x00000fdb, 0x0000f000, 0x00000000, 0x00000000, 0x0000000f, 0x0000601f, 0x007f0038, 0x00000000 },  // 07:24
+    { 0x00000fdb, 0x0000000f, 0x00000000, 0x00000000, 0x0000000f, 0x0000601f, 0x007f0038, 0x00000000 },  // 07:25
+    { 0x00000fdb, 0x00000000, 0x00070000, 0x00000000, 0x0000000f, 0x0000601f, 0x007f0038, 0x00000000 },  // 07:26
+    { 0x00000fdb, 0x00000000, 0x00000000, 0x0000001f, 0x0000000f, 0x0000601f, 0x007f0038, 0x00000000 },  // 07:27
+    { 0x00000fdb, 0x00000000, 0x1f000000, 0x00000000, 0x0000000f, 0x0000601f, 0x007f0038, 0x00000000 },  // 07:28
+    { 0x00000fdb, 0x03c00000, 0x00000000, 0x00000000, 0x0000000f, 0x0000601f, 0x007f0038, 0x00000000 },  // 07:29
+    { 0x0000001b, 0x00000000, 0x00000000, 0x000f0000, 0x0000000f, 0x0000601f, 0x007f0038, 0x00000000 },  // 07:30
+    { 0x00000fdb, 0x03c00000, 0x00000000, 0xc0000000, 0x00000000, 0x000067c0, 0x007f0038, 0x00000000 },  // 07:31
+    { 0x00000fdb, 0x00000000, 0x1f000000, 0xc0000000, 0x00000000, 0x000067c0, 0x007f0038, 0x00000000 },  // 07:32
+    { 0x00000fdb, 0x00000000, 0x00000000, 0xc000001f, 0x00000000, 0x000067c0, 0x007f0038, 0x00000000 },  // 07:33
+    { 0x00000fdb, 0x00000000, 0x00070000, 0xc0000000, 0x00000000, 0x000067c0, 0x007f0038, 0x00000000 },  // 07:34
+    { 0x00000fdb, 0x0000000f, 0x00000000, 0xc0000000, 0x00000000, 0x000067c0, 0x007f0038, 0x00000000 },  // 07:35
+    { 0x00000fdb, 0x0000f000, 0x00000000, 0xc0000000, 0x00000000, 0x000067c0, 0x007f0038, 0x00000000 },  // 07:36
+    { 0x00000fdb, 0x001f0000, 0x00000000, 0xc0000000, 0x00000000, 0x000067c0, 0x007f0038, 0x00000000 },  // 07:37
+    { 0x00070fdb, 0x00000000, 0x00000000, 0xc0000000, 0x00000000, 0x000067c0, 0x007f0038, 0x00000000 },  // 07:38
+    { 0x0000efdb, 0x00000000, 0x00000000, 0xc0000000, 0x00000000, 0x000067c0, 0x007f0038, 0x00000000 },  // 07:39
+    { 0x00000fdb, 0x00000000, 0x00000000, 0xc0000000, 0x00000000, 0x000067c0, 0x007f0038, 0x00000000 },  // 07:40
+    { 0x0000001b, 0x3fc00000, 0x00000000, 0xc0000000, 0x00000000, 0x000067c0, 0x007f0038, 0x00000000 },  // 07:41
+    { 0x0000001b, 0x00000000, 0xff000000, 0xc0000000, 0x00000000, 0x000067c0, 0x007f0038, 0x00000000 },  // 07:42
+    { 0x0000001b, 0x00000000, 0x00000000, 0xc00001ff, 0x00000000, 0x000067c0, 0x007f0038, 0x00000000 },  // 07:43
+    { 0x0000001b, 0x00000000, 0x007f0000, 0xc0000000, 0x00000000, 0x000067c0, 0x007f0038, 0x00000000 },  // 07:44
+    { 0x0000001b, 0x00000000, 0x00000000, 0xdfc20000, 0x00000000, 0x000067c0, 0x007f0038, 0x00000000 },  // 07:45
+    { 0x0000001b, 0x00000000, 0x000000ff, 0xc0000000, 0x00000000, 0x000067c0, 0x007f0038, 0x00000000 },  // 07:46
+    { 0xff00001b, 0x00000000, 0x00000000, 0xc0000000, 0x00000000, 0x000067c0, 0x007f0038, 0x00000000 },  // 07:47
+    { 0x0000001b, 0x00000000, 0x00000000, 0xc000fc00, 0x00000000, 0x000067c0, 0x007f0038, 0x00000000 },  // 07:48
+    { 0x0000001b, 0x000007e0, 0x00000000, 0xc0000000, 0x00000000, 0x000067c0, 0x007f0038, 0x00000000 },  // 07:49
+    { 0x0070001b, 0x00000000, 0x00000000, 0xc0000000, 0x00000000, 0x000067c0, 0x007f0038, 0x00000000 },  // 07:50
+    { 0x0000001b, 0x03c00000, 0x00000000, 0xc0000000, 0x00000000, 0x000067c0, 0x007f0038, 0x00000000 },  // 07:51
+    { 0x0000001b, 0x00000000, 0x1f000000, 0xc0000000, 0x00000000, 0x000067c0, 0x007f0038, 0x00000000 },  // 07:52
+    { 0x0000001b, 0x00000000, 0x00000000, 0xc000001f, 0x00000000, 0x000067c0, 0x007f0038, 0x00000000 },  // 07:53
+    { 0x0000001b, 0x00000000, 0x00070000, 0xc0000000, 0x00000000, 0x000067c0, 0x007f0038, 0x00000000 },  // 07:54
+    { 0x0000001b, 0x0000000f, 0x00000000, 0xc0000000, 0x00000000, 0x000067c0, 0x007f0038, 0x00000000 },  // 07:55
+    { 0x0000001b, 0x0000f000, 0x00000000, 0xc0000000, 0x00000000, 0x000067c0, 0x007f0038, 0x00000000 },  // 07:56
+    { 0x0000001b, 0x001f0000, 0x00000000, 0xc0000000, 0x00000000, 0x000067c0, 0x007f0038, 0x00000000 },  // 07:57
+    { 0x0007001b, 0x00000000, 0x00000000, 0xc0000000, 0x00000000, 0x000067c0, 0x007f0038, 0x00000000 },  // 07:58
+    { 0x0000e01b, 0x00000000, 0x00000000, 0xc0000000, 0x00000000, 0x000067c0, 0x007f0038, 0x00000000 },  // 07:59
+    { 0x0000001b, 0x00000000, 0x1f000000, 0x00000000, 0x00000000, 0x00006000, 0x007f0038, 0x00000000 },  // 08:00
+    { 0x0000e01b, 0x00000000, 0x00000000, 0x00000000, 0x0000000f, 0x000067c0, 0x007f0038, 0x00000000 },  // 08:01
+    { 0x0007001b, 0x00000000, 0x00000000, 0x00000000, 0x0000000f, 0x000067c0, 0x007f0038, 0x00000000 },  // 08:02
+    { 0x0000001b, 0x001f0000, 0x00000000, 0x00000000, 0x0000000f, 0x000067c0, 0x007f0038, 0x00000000 },  // 08:03
+    { 0x0000001b, 0x0000f000, 0x00000000, 0x00000000, 0x0000000f, 0x000067c0, 0x007f0038, 0x00000000 },  // 08:04
+    { 0x0000001b, 0x0000000f, 0x00000000, 0x00000000, 0x0000000f, 0x000067c0, 0x007f0038, 0x00000000 },  // 08:05
+    { 0x0000001b, 0x00000000, 0x00070000, 0x00000000, 0x0000000f, 0x000067c0, 0x007f0038, 0x00000000 },  // 08:06
+    { 0x0000001b, 0x00000000, 0x00000000, 0x0000001f, 0x0000000f, 0x000067c0, 0x007f0038, 0x00000000 },  // 08:07
+    { 0x0000001b, 0x00000000, 0x1f000000, 0x00000000, 0x0000000f, 0x000067c0, 0x007f0038, 0x00000000 },  // 08:08
+    { 0x0000001b, 0x03c00000, 0x00000000, 0x00000000, 0x0000000f, 0x000067c0, 0x007f0038, 0x00000000 },  // 08:09
+    { 0x0070001b, 0x00000000, 0x00000000, 0x00000000, 0x0000000f, 0x000067c0, 0x007f0038, 0x00000000 },  // 08:10
+    { 0x0000001b, 0x000007e0, 0x00000000, 0x00000000, 0x0000000f, 0x000067c0, 0x007f0038, 0x00000000 },  // 08:11
+    { 0x0000001b, 0x00000000, 0x00000000, 0x0000fc00, 0x0000000f, 0x000067c0, 0x007f0038, 0x00000000 },  // 08:12
+    { 0xff00001b, 0x00000000, 0x00000000, 0x00000000, 0x0000000f, 0x000067c0, 0x007f0038, 0x00000000 },  // 08:13
+    { 0x0000001b, 0x00000000, 0x000000ff, 0x00000000, 0x0000000f, 0x000067c0, 0x007f0038, 0x00000000 },  // 08:14
+    { 0x0000001b, 0x00000000, 0x00000000, 0x1fc20000, 0x0000000f, 0x000067c0, 0x007f0038, 0x00000000 },  // 08:15
+    { 0x0000001b, 0x00000000, 0x007f0000, 0x00000000, 0x0000000f, 0x000067c0, 0x007f0038, 0x00000000 },  // 08:16
+    { 0x0000001b, 0x00000000, 0x00000000, 0x000001ff, 0x0000000f, 0x000067c0, 0x007f0038, 0x00000000 },  // 08:17
+    { 0x0000001b, 0x00000000, 0xff000000, 0x00000000, 0x0000000f, 0x000067c0, 0x007f0038, 0x00000000 },  // 08:18
+    { 0x0000001b, 0x3fc00000, 0x00000000, 0x00000000, 0x0000000f, 0x000067c0, 0x007f0038, 0x00000000 },  // 08:19
+    { 0x00000fdb, 0x00000000, 0x00000000, 0x00000000, 0x0000000f, 0x000067c0, 0x007f0038, 0x00000000 },  // 08:20
+    { 0x0000efdb, 0x00000000, 0x00000000, 0x00000000, 0x0000000f, 0x000067c0, 0x007f0038, 0x00000000 },  // 08:21
+    { 0x00070fdb, 0x00000000, 0x00000000, 0x00000000, 0x0000000f, 0x000067c0, 0x007f0038, 0x00000000 },  // 08:22
+    { 0x00000fdb, 0x001f0000, 0x00000000, 0x00000000, 0x0000000f, 0x000067c0, 0x007f0038, 0x00000000 },  // 08:23
+    { 0x00000fdb, 0x0000f000, 0x00000000, 0x00000000, 0x0000000f, 0x000067c0, 0x007f0038, 0x00000000 },  // 08:24
+    { 0x00000fdb, 0x0000000f, 0x00000000, 0x00000000, 0x0000000f, 0x000067c0, 0x007f0038, 0x00000000 },  // 08:25
+    { 0x00000fdb, 0x00000000, 0x00070000, 0x00000000, 0x0000000f, 0x000067c0, 0x007f0038, 0x00000000 },  // 08:26
+    { 0x00000fdb, 0x00000000, 0x00000000, 0x0000001f, 0x0000000f, 0x000067c0, 0x007f0038, 0x00000000 },  // 08:27
+    { 0x00000fdb, 0x00000000, 0x1f000000, 0x00000000, 0x0000000f, 0x000067c0, 0x007f0038, 0x00000000 },  // 08:28
+    { 0x00000fdb, 0x03c00000, 0x00000000, 0x00000000, 0x0000000f, 0x000067c0, 0x007f0038, 0x00000000 },  // 08:29
+    { 0x0000001b, 0x00000000, 0x00000000, 0x000f0000, 0x0000000f, 0x000067c0, 0x007f0038, 0x00000000 },  // 08:30
+    { 0x00000fdb, 0x03c00000, 0x00000000, 0xc0000000, 0x00000000, 0x0000f000, 0x007f003b, 0x00000000 },  // 08:31
+    { 0x00000fdb, 0x00000000, 0x1f000000, 0xc0000000, 0x00000000, 0x0000f000, 0x007f003b, 0x00000000 },  // 08:32
+    { 0x00000fdb, 0x00000000, 0x00000000, 0xc000001f, 0x00000000, 0x0000f000, 0x007f003b, 0x00000000 },  // 08:33
+    { 0x00000fdb, 0x00000000, 0x00070000, 0xc0000000, 0x00000000, 0x0000f000, 0x007f003b, 0x00000000 },  // 08:34
+    { 0x00000fdb, 0x0000000f, 0x00000000, 0xc0000000, 0x00000000, 0x0000f000, 0x007f003b, 0x00000000 },  // 08:35
+    { 0x00000fdb, 0x0000f000, 0x00000000, 0xc0000000, 0x00000000, 0x0000f000, 0x007f003b, 0x00000000 },  // 08:36
+    { 0x00000fdb, 0x001f0000, 0x00000000, 0xc0000000, 0x00000000, 0x0000f000, 0x007f003b, 0x00000000 },  // 08:37
+    { 0x00070fdb, 0x00000000, 0x00000000, 0xc0000000, 0x00000000, 0x0000f000, 0x007f003b, 0x00000000 },  // 08:38
+    { 0x0000efdb, 0x00000000, 0x00000000, 0xc0000000, 0x00000000, 0x0000f000, 0x007f003b, 0x00000000 },  // 08:39
+    { 0x00000fdb, 0x00000000, 0x00000000, 0xc0000000, 0x00000000, 0x0000f000, 0x007f003b, 0x00000000 },  // 08:40
+    { 0x0000001b, 0x3fc00000, 0x00000000, 0xc0000000, 0x00000000, 0x0000f000, 0x007f003b, 0x00000000 },  // 08:41
+    { 0x0000001b, 0x00000000, 0xff000000, 0xc0000000, 0x00000000, 0x0000f000, 0x007f003b, 0x00000000 },  // 08:42
+    { 0x0000001b, 0x00000000, 0x00000000, 0xc00001ff, 0x00000000, 0x0000f000, 0x007f003b, 0x00000000 },  // 08:43
+    { 0x0000001b, 0x00000000, 0x007f0000, 0xc0000000, 0x00000000, 0x0000f000, 0x007f003b, 0x00000000 },  // 08:44
+    { 0x0000001b, 0x00000000, 0x00000000, 0xdfc20000, 0x00000000, 0x0000f000, 0x007f003b, 0x00000000 },  // 08:45
+    { 0x0000001b, 0x00000000, 0x000000ff, 0xc0000000, 0x00000000, 0x0000f000, 0x007f003b, 0x00000000 },  // 08:46
+    { 0xff00001b, 0x00000000, 0x00000000, 0xc0000000, 0x00000000, 0x0000f000, 0x007f003b, 0x00000000 },  // 08:47
+    { 0x0000001b, 0x00000000, 0x00000000, 0xc000fc00, 0x00000000, 0x0000f000, 0x007f003b, 0x00000000 },  // 08:48
+    { 0x0000001b, 0x000007e0, 0x00000000, 0xc0000000, 0x00000000, 0x0000f000, 0x007f003b, 0x00000000 },  // 08:49
+    { 0x0070001b, 0x00000000, 0x00000000, 0xc0000000, 0x00000000, 0x0000f000, 0x007f003b, 0x00000000 },  // 08:50
+    { 0x0000001b, 0x03c00000, 0x00000000, 0xc0000000, 0x00000000, 0x0000f000, 0x007f003b, 0x00000000 },  // 08:51
+    { 0x0000001b, 0x00000000, 0x1f000000, 0xc0000000, 0x00000000, 0x0000f000, 0x007f003b, 0x00000000 },  // 08:52
+    { 0x0000001b, 0x00000000, 0x00000000, 0xc000001f, 0x00000000, 0x0000f000, 0x007f003b, 0x00000000 },  // 08:53
+    { 0x0000001b, 0x00000000, 0x00070000, 0xc0000000, 0x00000000, 0x0000f000, 0x007f003b, 0x00000000 },  // 08:54
+    { 0x0000001b, 0x0000000f, 0x00000000, 0xc0000000, 0x00000000, 0x0000f000, 0x007f003b, 0x00000000 },  // 08:55
+    { 0x0000001b, 0x0000f000, 0x00000000, 0xc0000000, 0x00000000, 0x0000f000, 0x007f003b, 0x00000000 },  // 08:56
+    { 0x0000001b, 0x001f0000, 0x00000000, 0xc0000000, 0x00000000, 0x0000f000, 0x007f003b, 0x00000000 },  // 08:57
+    { 0x0007001b, 0x00000000, 0x00000000, 0xc0000000, 0x00000000, 0x0000f000, 0x007f003b, 0x00000000 },  // 08:58
+    { 0x0000e01b, 0x00000000, 0x00000000, 0xc0000000, 0x00000000, 0x0000f000, 0x007f003b, 0x00000000 },  // 08:59
+    { 0x0000001b, 0x03c00000, 0x00000000, 0x00000000, 0x00000000, 0x00006000, 0x007f0038, 0x00000000 },  // 09:00
+    { 0x0000e01b, 0x00000000, 0x00000000, 0x00000000, 0x0000000f, 0x0000f000, 0x007f003b, 0x00000000 },  // 09:01
+    { 0x0007001b, 0x00000000, 0x00000000, 0x00000000, 0x0000000f, 0x0000f000, 0x007f003b, 0x00000000 },  // 09:02
+    { 0x0000001b, 0x001f0000, 0x00000000, 0x00000000, 0x0000000f, 0x0000f000, 0x007f003b, 0x00000000 },  // 09:03
+    { 0x0000001b, 0x0000f000, 0x00000000, 0x00000000, 0x0000000f, 0x0000f000, 0x007f003b, 0x00000000 },  // 09:04
+    { 0x0000001b, 0x0000000f, 0x00000000, 0x00000000, 0x0000000f, 0x0000f000, 0x007f003b, 0x00000000 },  // 09:05
+    { 0x0000001b, 0x00000000, 0x00070000, 0x00000000, 0x0000000f, 0x0000f000, 0x007f003b, 0x00000000 },  // 09:06
+    { 0x0000001b, 0x00000000, 0x00000000, 0x0000001f, 0x0000000f, 0x0000f000, 0x007f003b, 0x00000000 },  // 09:07
+    { 0x0000001b, 0x00000000, 0x1f000000, 0x00000000, 0x0000000f, 0x0000f000, 0x007f003b, 0x00000000 },  // 09:08
+    { 0x0000001b, 0x03c00000, 0x00000000, 0x00000000, 0x0000000f, 0x0000f000, 0x007f003b, 0x00000000 },  // 09:09
+    { 0x0070001b, 0x00000000, 0x00000000, 0x00000000, 0x0000000f, 0x0000f000, 0x007f003b, 0x00000000 },  // 09:10
+    { 0x0000001b, 0x000007e0, 0x00000000, 0x00000000, 0x0000000f, 0x0000f000, 0x007f003b, 0x00000000 },  // 09:11
+    { 0x0000001b, 0x00000000, 0x00000000, 0x0000fc00, 0x0000000f, 0x0000f000, 0x007f003b, 0x00000000 },  // 09:12
+    { 0xff00001b, 0x00000000, 0x00000000, 0x00000000, 0x0000000f, 0x0000f000, 0x007f003b, 0x00000000 },  // 09:13
+    { 0x0000001b, 0x00000000, 0x000000ff, 0x00000000, 0x0000000f, 0x0000f000, 0x007f003b, 0x00000000 },  // 09:14
+    { 0x0000001b, 0x00000000, 0x00000000, 0x1fc20000, 0x0000000f, 0x0000f000, 0x007f003b, 0x00000000 },  // 09:15
+    { 0x0000001b, 0x00000000, 0x007f0000, 0x00000000, 0x0000000f, 0x0000f000, 0x007f003b, 0x00000000 },  // 09:16
+    { 0x0000001b, 0x00000000, 0x00000000, 0x000001ff, 0x0000000f, 0x0000f000, 0x007f003b, 0x00000000 },  // 09:17
+    { 0x0000001b, 0x00000000, 0xff000000, 0x00000000, 0x0000000f, 0x0000f000, 0x007f003b, 0x00000000 },  // 09:18
+    { 0x0000001b, 0x3fc00000, 0x00000000, 0x00000000, 0x0000000f, 0x0000f000, 0x007f003b, 0x00000000 },  // 09:19
+    { 0x00000fdb, 0x00000000, 0x00000000, 0x00000000, 0x0000000f, 0x0000f000, 0x007f003b, 0x00000000 },  // 09:20
+    { 0x0000efdb, 0x00000000, 0x00000000, 0x00000000, 0x0000000f, 0x0000f000, 0x007f003b, 0x00000000 },  // 09:21
+    { 0x00070fdb, 0x00000000, 0x00000000, 0x00000000, 0x0000000f, 0x0000f000, 0x007f003b, 0x00000000 },  // 09:22
+    { 0x00000fdb, 0x001f0000, 0x00000000, 0x00000000, 0x0000000f, 0x0000f000, 0x007f003b, 0x00000000 },  // 09:23
+    { 0x00000fdb, 0x0000f000, 0x00000000, 0x00000000, 0x0000000f, 0x0000f000, 0x007f003b, 0x00000000 },  // 09:24
+    { 0x00000fdb, 0x0000000f, 0x00000000, 0x00000000, 0x0000000f, 0x0000f000, 0x007f003b, 0x00000000 },  // 09:25
+    { 0x00000fdb, 0x00000000, 0x00070000, 0x00000000, 0x0000000f, 0x0000f000, 0x007f003b, 0x00000000 },  // 09:26
+    { 0x00000fdb, 0x00000000, 0x00000000, 0x0000001f, 0x0000000f, 0x0000f000, 0x007f003b, 0x00000000 },  // 09:27
+    { 0x00000fdb, 0x00000000, 0x1f000000, 0x00000000, 0x0000000f, 0x0000f000, 0x007f003b, 0x00000000 },  // 09:28
+    { 0x00000fdb, 0x03c00000, 0x00000000, 0x00000000, 0x0000000f, 0x0000f000, 0x007f003b, 0x00000000 },  // 09:29
+    { 0x0000001b, 0x00000000, 0x00000000, 0x000f0000, 0x0000000f, 0x0000f000, 0x007f003b, 0x00000000 },  // 09:30
+    { 0x00000fdb, 0x03c00000, 0x00000000, 0xc0000000, 0x00000000, 0x00007c00, 0x007f0038, 0x00000000 },  // 09:31
+    { 0x00000fdb, 0x00000000, 0x1f000000, 0xc0000000, 0x00000000, 0x00007c00, 0x007f0038, 0x00000000 },  // 09:32
+    { 0x00000fdb, 0x00000000, 0x00000000, 0xc000001f, 0x00000000, 0x00007c00, 0x007f0038, 0x00000000 },  // 09:33
+    { 0x00000fdb, 0x00000000, 0x00070000, 0xc0000000, 0x00000000, 0x00007c00, 0x007f0038, 0x00000000 },  // 09:34
+    { 0x00000fdb, 0x0000000f, 0x00000000, 0xc0000000, 0x00000000, 0x00007c00, 0x007f0038, 0x00000000 },  // 09:35
+    { 0x00000fdb, 0x0000f000, 0x00000000, 0xc0000000, 0x00000000, 0x00007c00, 0x007f0038, 0x00000000 },  // 09:36
+    { 0x00000fdb, 0x001f0000, 0x00000000, 0xc0000000, 0x00000000, 0x00007c00, 0x007f0038, 0x00000000 },  // 09:37
+    { 0x00070fdb, 0x00000000, 0x00000000, 0xc0000000, 0x00000000, 0x00007c00, 0x007f0038, 0x00000000 },  // 09:38
+    { 0x0000efdb, 0x00000000, 0x00000000, 0xc0000000, 0x00000000, 0x00007c00, 0x007f0038, 0x00000000 },  // 09:39
+    { 0x00000fdb, 0x00000000, 0x00000000, 0xc0000000, 0x00000000, 0x00007c00, 0x007f0038, 0x00000000 },  // 09:40
+    { 0x0000001b, 0x3fc00000, 0x00000000, 0xc0000000, 0x00000000, 0x00007c00, 0x007f0038, 0x00000000 },  // 09:41
+    { 0x0000001b, 0x00000000, 0xff000000, 0xc0000000, 0x00000000, 0x00007c00, 0x007f0038, 0x00000000 },  // 09:42
+    { 0x0000001b, 0x00000000, 0x00000000, 0xc00001ff, 0x00000000, 0x00007c00, 0x007f0038, 0x00000000 },  // 09:43
+    { 0x0000001b, 0x00000000, 0x007f0000, 0xc0000000, 0x00000000, 0x00007c00, 0x007f0038, 0x00000000 },  // 09:44
+    { 0x0000001b, 0x00000000, 0x00000000, 0xdfc20000, 0x00000000, 0x00007c00, 0x007f0038, 0x00000000 },  // 09:45
+    { 0x0000001b, 0x00000000, 0x000000ff, 0xc0000000, 0x00000000, 0x00007c00, 0x007f0038, 0x00000000 },  // 09:46
+    { 0xff00001b, 0x00000000, 0x00000000, 0xc0000000, 0x00000000, 0x00007c00, 0x007f0038, 0x00000000 },  // 09:47
+    { 0x0000001b, 0x00000000, 0x00000000, 0xc000fc00, 0x00000000, 0x00007c00, 0x007f0038, 0x00000000 },  // 09:48
+    { 0x0000001b, 0x000007e0, 0x00000000, 0xc0000000, 0x00000000, 0x00007c00, 0x007f0038, 0x00000000 },  // 09:49
+    { 0x0070001b, 0x00000000, 0x00000000, 0xc0000000, 0x00000000, 0x00007c00, 0x007f0038, 0x00000000 },  // 09:50
+    { 0x0000001b, 0x03c00000, 0x00000000, 0xc0000000, 0x00000000, 0x00007c00, 0x007f0038, 0x00000000 },  // 09:51
+    { 0x0000001b, 0x00000000, 0x1f000000, 0xc0000000, 0x00000000, 0x00007c00, 0x007f0038, 0x00000000 },  // 09:52
+    { 0x0000001b, 0x00000000, 0x00000000, 0xc000001f, 0x00000000, 0x00007c00, 0x007f0038, 0x00000000 },  // 09:53
+    { 0x0000001b, 0x00000000, 0x00070000, 0xc0000000, 0x00000000, 0x00007c00, 0x007f0038, 0x00000000 },  // 09:54
+    { 0x0000001b, 0x0000000f, 0x00000000, 0xc0000000, 0x00000000, 0x00007c00, 0x007f0038, 0x00000000 },  // 09:55
+    { 0x0000001b, 0x0000f000, 0x00000000, 0xc0000000, 0x00000000, 0x00007c00, 0x007f0038, 0x00000000 },  // 09:56
+    { 0x0000001b, 0x001f0000, 0x00000000, 0xc0000000, 0x00000000, 0x00007c00, 0x007f0038, 0x00000000 },  // 09:57
+    { 0x0007001b, 0x00000000, 0x00000000, 0xc0000000, 0x00000000, 0x00007c00, 0x007f0038, 0x00000000 },  // 09:58
+    { 0x0000e01b, 0x00000000, 0x00000000, 0xc0000000, 0x00000000, 0x00007c00, 0x007f0038, 0x00000000 },  // 09:59
+    { 0x0070001b, 0x01800000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x007f0038, 0x00000000 },  // 10:00
+    { 0x0000e01b, 0x00000000, 0x00000000, 0x00000000, 0x0000000f, 0x00007c00, 0x007f0038, 0x00000000 },  // 10:01
+    { 0x0007001b, 0x00000000, 0x00000000, 0x00000000, 0x0000000f, 0x00007c00, 0x007f0038, 0x00000000 },  // 10:02
+    { 0x0000001b, 0x001f0000, 0x00000000, 0x00000000, 0x0000000f, 0x00007c00, 0x007f0038, 0x00000000 },  // 10:03
+    { 0x0000001b, 0x0000f000, 0x00000000, 0x00000000, 0x0000000f, 0x00007c00, 0x007f0038, 0x00000000 },  // 10:04
+    { 0x0000001b, 0x0000000f, 0x00000000, 0x00000000, 0x0000000f, 0x00007c00, 0x007f0038, 0x00000000 },  // 10:05
+    { 0x0000001b, 0x00000000, 0x00070000, 0x00000000, 0x0000000f, 0x00007c00, 0x007f0038, 0x00000000 },  // 10:06
+    { 0x0000001b, 0x00000000, 0x00000000, 0x0000001f, 0x0000000f, 0x00007c00, 0x007f0038, 0x00000000 },  // 10:07
+    { 0x0000001b, 0x00000000, 0x1f000000, 0x00000000, 0x0000000f, 0x00007c00, 0x007f0038, 0x00000000 },  // 10:08
+    { 0x0000001b, 0x03c00000, 0x00000000, 0x00000000, 0x0000000f, 0x00007c00, 0x007f0038, 0x00000000 },  // 10:09
+    { 0x0070001b, 0x00000000, 0x00000000, 0x00000000, 0x0000000f, 0x00007c00, 0x007f0038, 0x00000000 },  // 10:10
+    { 0x0000001b, 0x000007e0, 0x00000000, 0x00000000, 0x0000000f, 0x00007c00, 0x007f0038, 0x00000000 },  // 10:11
+    { 0x0000001b, 0x00000000, 0x00000000, 0x0000fc00, 0x0000000f, 0x00007c00, 0x007f0038, 0x00000000 },  // 10:12
+    { 0xff00001b, 0x00000000, 0x00000000, 0x00000000, 0x0000000f, 0x00007c00, 0x007f0038, 0x00000000 },  // 10:13
+    { 0x0000001b, 0x00000000, 0x000000ff, 0x00000000, 0x0000000f, 0x00007c00, 0x007f0038, 0x00000000 },  // 10:14
+    { 0x0000001b, 0x00000000, 0x00000000, 0x1fc20000, 0x0000000f, 0x00007c00, 0x007f0038, 0x00000000 },  // 10:15
+    { 0x0000001b, 0x00000000, 0x007f0000, 0x00000000, 0x0000000f, 0x00007c00, 0x007f0038, 0x00000000 },  // 10:16
+    { 0x0000001b, 0x00000000, 0x00000000, 0x000001ff, 0x0000000f, 0x00007c00, 0x007f0038, 0x00000000 },  // 10:17
+    { 0x0000001b, 0x00000000, 0xff000000, 0x00000000, 0x0000000f, 0x00007c00, 0x007f0038, 0x00000000 },  // 10:18
+    { 0x0000001b, 0x3fc00000, 0x00000000, 0x00000000, 0x0000000f, 0x00007c00, 0x007f0038, 0x00000000 },  // 10:19
+    { 0x00000fdb, 0x00000000, 0x00000000, 0x00000000, 0x0000000f, 0x00007c00, 0x007f0038, 0x00000000 },  // 10:20
+    { 0x0000efdb, 0x00000000, 0x00000000, 0x00000000, 0x0000000f, 0x00007c00, 0x007f0038, 0x00000000 },  // 10:21
+    { 0x00070fdb, 0x00000000, 0x00000000, 0x00000000, 0x0000000f, 0x00007c00, 0x007f0038, 0x00000000 },  // 10:22
+    { 0x00000fdb, 0x001f0000, 0x00000000, 0x00000000, 0x0000000f, 0x00007c00, 0x007f0038, 0x00000000 },  // 10:23
+    { 0x00000fdb, 0x0000f000, 0x00000000, 0x00000000, 0x0000000f, 0x00007c00, 0x007f0038, 0x00000000 },  // 10:24
+    { 0x00000fdb, 0x0000000f, 0x00000000, 0x00000000, 0x0000000f, 0x00007c00, 0x007f0038, 0x00000000 },  // 10:25
+    { 0x00000fdb, 0x00000000, 0x00070000, 0x00000000, 0x0000000f, 0x00007c00, 0x007f0038, 0x00000000 },  // 10:26
+    { 0x00000fdb, 0x00000000, 0x00000000, 0x0000001f, 0x0000000f, 0x00007c00, 0x007f0038, 0x00000000 },  // 10:27
+    { 0x00000fdb, 0x00000000, 0x1f000000, 0x00000000, 0x0000000f, 0x00007c00, 0x007f0038, 0x00000000 },  // 10:28
+    { 0x00000fdb, 0x03c00000, 0x00000000, 0x00000000, 0x0000000f, 0x00007c00, 0x007f0038, 0x00000000 },  // 10:29
+    { 0x0000001b, 0x00000000, 0x00000000, 0x000f0000, 0x0000000f, 0x00007c00, 0x007f0038, 0x00000000 },  // 10:30
+    { 0x00000fdb, 0x03c00000, 0x00000000, 0xc0000000, 0x00000000, 0xfc000000, 0x007f003b, 0x00000000 },  // 10:31
+    { 0x00000fdb, 0x00000000, 0x1f000000, 0xc0000000, 0x00000000, 0xfc000000, 0x007f003b, 0x00000000 },  // 10:32
+    { 0x00000fdb, 0x00000000, 0x00000000, 0xc000001f, 0x00000000, 0xfc000000, 0x007f003b, 0x00000000 },  // 10:33
+    { 0x00000fdb, 0x00000000, 0x00070000, 0xc0000000, 0x00000000, 0xfc000000, 0x007f003b, 0x00000000 },  // 10:34
+    { 0x00000fdb, 0x0000000f, 0x00000000, 0xc0000000, 0x00000000, 0xfc000000, 0x007f003b, 0x00000000 },  // 10:35
+    { 0x00000fdb, 0x0000f000, 0x00000000, 0xc0000000, 0x00000000, 0xfc000000, 0x007f003b, 0x00000000 },  // 10:36
+    { 0x00000fdb, 0x001f0000, 0x00000000, 0xc0000000, 0x00000000, 0xfc000000, 0x007f003b, 0x00000000 },  // 10:37
+    { 0x00070fdb, 0x00000000, 0x00000000, 0xc0000000, 0x00000000, 0xfc000000, 0x007f003b, 0x00000000 },  // 10:38
+    { 0x0000efdb, 0x00000000, 0x00000000, 0xc0000000, 0x00000000, 0xfc000000, 0x007f003b, 0x00000000 },  // 10:39
+    { 0x00000fdb, 0x00000000, 0x00000000, 0xc0000000, 0x00000000, 0xfc000000, 0x007f003b, 0x00000000 },  // 10:40
+    { 0x0000001b, 0x3fc00000, 0x00000000, 0xc0000000, 0x00000000, 0xfc000000, 0x007f003b, 0x00000000 },  // 10:41
+    { 0x0000001b, 0x00000000, 0xff000000, 0xc0000000, 0x00000000, 0xfc000000, 0x007f003b, 0x00000000 },  // 10:42
+    { 0x0000001b, 0x00000000, 0x00000000, 0xc00001ff, 0x00000000, 0xfc000000, 0x007f003b, 0x00000000 },  // 10:43
+    { 0x0000001b, 0x00000000, 0x007f0000, 0xc0000000, 0x00000000, 0xfc000000, 0x007f003b, 0x00000000 },  // 10:44
+    { 0x0000001b, 0x00000000, 0x00000000, 0xdfc20000, 0x00000000, 0xfc000000, 0x007f003b, 0x00000000 },  // 10:45
+    { 0x0000001b, 0x00000000, 0x000000ff, 0xc0000000, 0x00000000, 0xfc000000, 0x007f003b, 0x00000000 },  // 10:46
+    { 0xff00001b, 0x00000000, 0x00000000, 0xc0000000, 0x00000000, 0xfc000000, 0x007f003b, 0x00000000 },  // 10:47
+    { 0x0000001b, 0x00000000, 0x00000000, 0xc000fc00, 0x00000000, 0xfc000000, 0x007f003b, 0x00000000 },  // 10:48
+    { 0x0000001b, 0x000007e0, 0x00000000, 0xc0000000, 0x00000000, 0xfc000000, 0x007f003b, 0x00000000 },  // 10:49
+    { 0x0070001b, 0x00000000, 0x00000000, 0xc0000000, 0x00000000, 0xfc000000, 0x007f003b, 0x00000000 },  // 10:50
+    { 0x0000001b, 0x03c00000, 0x00000000, 0xc0000000, 0x00000000, 0xfc000000, 0x007f003b, 0x00000000 },  // 10:51
+    { 0x0000001b, 0x00000000, 0x1f000000, 0xc0000000, 0x00000000, 0xfc000000, 0x007f003b, 0x00000000 },  // 10:52
+    { 0x0000001b, 0x00000000, 0x00000000, 0xc000001f, 0x00000000, 0xfc000000, 0x007f003b, 0x00000000 },  // 10:53
+    { 0x0000001b, 0x00000000, 0x00070000, 0xc0000000, 0x00000000, 0xfc000000, 0x007f003b, 0x00000000 },  // 10:54
+    { 0x0000001b, 0x0000000f, 0x00000000, 0xc0000000, 0x00000000, 0xfc000000, 0x007f003b, 0x00000000 },  // 10:55
+    { 0x0000001b, 0x0000f000, 0x00000000, 0xc0000000, 0x00000000, 0xfc000000, 0x007f003b, 0x00000000 },  // 10:56
+    { 0x0000001b, 0x001f0000, 0x00000000, 0xc0000000, 0x00000000, 0xfc000000, 0x007f003b, 0x00000000 },  // 10:57
+    { 0x0007001b, 0x00000000, 0x00000000, 0xc0000000, 0x00000000, 0xfc000000, 0x007f003b, 0x00000000 },  // 10:58
+    { 0x0000e01b, 0x00000000, 0x00000000, 0xc0000000, 0x00000000, 0xfc000000, 0x007f003b, 0x00000000 },  // 10:59
+    { 0x0000001b, 0x018007e0, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x007f0038, 0x00000000 },  // 11:00
+    { 0x0000e01b, 0x00000000, 0x00000000, 0x00000000, 0x0000000f, 0xfc000000, 0x007f003b, 0x00000000 },  // 11:01
+    { 0x0007001b, 0x00000000, 0x00000000, 0x00000000, 0x0000000f, 0xfc000000, 0x007f003b, 0x00000000 },  // 11:02
+    { 0x0000001b, 0x001f0000, 0x00000000, 0x00000000, 0x0000000f, 0xfc000000, 0x007f003b, 0x00000000 },  // 11:03
+    { 0x0000001b, 0x0000f000, 0x00000000, 0x00000000, 0x0000000f, 0xfc000000, 0x007f003b, 0x00000000 },  // 11:04
+    { 0x0000001b, 0x0000000f, 0x00000000, 0x00000000, 0x0000000f, 0xfc000000, 0x007f003b, 0x00000000 },  // 11:05
+    { 0x0000001b, 0x00000000, 0x00070000, 0x00000000, 0x0000000f, 0xfc000000, 0x007f003b, 0x00000000 },  // 11:06
+    { 0x0000001b, 0x00000000, 0x00000000, 0x0000001f, 0x0000000f, 0xfc000000, 0x007f003b, 0x00000000 },  // 11:07
+    { 0x0000001b, 0x00000000, 0x1f000000, 0x00000000, 0x0000000f, 0xfc000000, 0x007f003b, 0x00000000 },  // 11:08
+    { 0x0000001b, 0x03c00000, 0x00000000, 0x00000000, 0x0000000f, 0xfc000000, 0x007f003b, 0x00000000 },  // 11:09
+    { 0x0070001b, 0x00000000, 0x00000000, 0x00000000, 0x0000000f, 0xfc000000, 0x007f003b, 0x00000000 },  // 11:10
+    { 0x0000001b, 0x000007e0, 0x00000000, 0x00000000, 0x0000000f, 0xfc000000, 0x007f003b, 0x00000000 },  // 11:11
+    { 0x0000001b, 0x00000000, 0x00000000, 0x0000fc00, 0x0000000f, 0xfc000000, 0x007f003b, 0x00000000 },  // 11:12
+    { 0xff00001b, 0x00000000, 0x00000000, 0x00000000, 0x0000000f, 0xfc000000, 0x007f003b, 0x00000000 },  // 11:13
+    { 0x0000001b, 0x00000000, 0x000000ff, 0x00000000, 0x0000000f, 0xfc000000, 0x007f003b, 0x00000000 },  // 11:14
+    { 0x0000001b, 0x00000000, 0x00000000, 0x1fc20000, 0x0000000f, 0xfc000000, 0x007f003b, 0x00000000 },  // 11:15
+    { 0x0000001b, 0x00000000, 0x007f0000, 0x00000000, 0x0000000f, 0xfc000000, 0x007f003b, 0x00000000 },  // 11:16
+    { 0x0000001b, 0x00000000, 0x00000000, 0x000001ff, 0x0000000f, 0xfc000000, 0x007f003b, 0x00000000 },  // 11:17
+    { 0x0000001b, 0x00000000, 0xff000000, 0x00000000, 0x0000000f, 0xfc000000, 0x007f003b, 0x00000000 },  // 11:18
+    { 0x0000001b, 0x3fc00000, 0x00000000, 0x00000000, 0x0000000f, 0xfc000000, 0x007f003b, 0x00000000 },  // 11:19
+    { 0x00000fdb, 0x00000000, 0x00000000, 0x00000000, 0x0000000f, 0xfc000000, 0x007f003b, 0x00000000 },  // 11:20
+    { 0x0000efdb, 0x00000000, 0x00000000, 0x00000000, 0x0000000f, 0xfc000000, 0x007f003b, 0x00000000 },  // 11:21
+    { 0x00070fdb, 0x00000000, 0x00000000, 0x00000000, 0x0000000f, 0xfc000000, 0x007f003b, 0x00000000 },  // 11:22
+    { 0x00000fdb, 0x001f0000, 0x00000000, 0x00000000, 0x0000000f, 0xfc000000, 0x007f003b, 0x00000000 },  // 11:23
+    { 0x00000fdb, 0x0000f000, 0x00000000, 0x00000000, 0x0000000f, 0xfc000000, 0x007f003b, 0x00000000 },  // 11:24
+    { 0x00000fdb, 0x0000000f, 0x00000000, 0x00000000, 0x0000000f, 0xfc000000, 0x007f003b, 0x00000000 },  // 11:25
+    { 0x00000fdb, 0x00000000, 0x00070000, 0x00000000, 0x0000000f, 0xfc000000, 0x007f003b, 0x00000000 },  // 11:26
+    { 0x00000fdb, 0x00000000, 0x00000000, 0x0000001f, 0x0000000f, 0xfc000000, 0x007f003b, 0x00000000 },  // 11:27
+    { 0x00000fdb, 0x00000000, 0x1f000000, 0x00000000, 0x0000000f, 0xfc000000, 0x007f003b, 0x00000000 },  // 11:28
+    { 0x00000fdb, 0x03c00000, 0x00000000, 0x00000000, 0x0000000f, 0xfc000000, 0x007f003b, 0x00000000 },  // 11:29
+    { 0x0000001b, 0x00000000, 0x00000000, 0x000f0000, 0x0000000f, 0xfc000000, 0x007f003b, 0x00000000 },  // 11:30
+    { 0x00000fdb, 0x03c00000, 0x00000000, 0xc0000000, 0x003f0000, 0x00006000, 0x0000ffb8, 0x00000000 },  // 11:31
+    { 0x00000fdb, 0x00000000, 0x1f000000, 0xc0000000, 0x003f0000, 0x00006000, 0x0000ffb8, 0x00000000 },  // 11:32
+    { 0x00000fdb, 0x00000000, 0x00000000, 0xc000001f, 0x003f0000, 0x00006000, 0x0000ffb8, 0x00000000 },  // 11:33
+    { 0x00000fdb, 0x00000000, 0x00070000, 0xc0000000, 0x003f0000, 0x00006000, 0x0000ffb8, 0x00000000 },  // 11:34
+    { 0x00000fdb, 0x0000000f, 0x00000000, 0xc0000000, 0x003f0000, 0x00006000, 0x0000ffb8, 0x00000000 },  // 11:35
+    { 0x00000fdb, 0x0000f000, 0x00000000, 0xc0000000, 0x003f0000, 0x00006000, 0x0000ffb8, 0x00000000 },  // 11:36
+    { 0x00000fdb, 0x001f0000, 0x00000000, 0xc0000000, 0x003f0000, 0x00006000, 0x0000ffb8, 0x00000000 },  // 11:37
+    { 0x00070fdb, 0x00000000, 0x00000000, 0xc0000000, 0x003f0000, 0x00006000, 0x0000ffb8, 0x00000000 },  // 11:38
+    { 0x0000efdb, 0x00000000, 0x00000000, 0xc0000000, 0x003f0000, 0x00006000, 0x0000ffb8, 0x00000000 },  // 11:39
+    { 0x00000fdb, 0x00000000, 0x00000000, 0xc0000000, 0x003f0000, 0x00006000, 0x0000ffb8, 0x00000000 },  // 11:40
+    { 0x0000001b, 0x3fc00000, 0x00000000, 0xc0000000, 0x003f0000, 0x00006000, 0x0000ffb8, 0x00000000 },  // 11:41
+    { 0x0000001b, 0x00000000, 0xff000000, 0xc0000000, 0x003f0000, 0x00006000, 0x0000ffb8, 0x00000000 },  // 11:42
+    { 0x0000001b, 0x00000000, 0x00000000, 0xc00001ff, 0x003f0000, 0x00006000, 0x0000ffb8, 0x00000000 },  // 11:43
+    { 0x0000001b, 0x00000000, 0x007f0000, 0xc0000000, 0x003f0000, 0x00006000, 0x0000ffb8, 0x00000000 },  // 11:44
+    { 0x0000001b, 0x00000000, 0x00000000, 0xdfc20000, 0x003f0000, 0x00006000, 0x0000ffb8, 0x00000000 },  // 11:45
+    { 0x0000001b, 0x00000000, 0x000000ff, 0xc0000000, 0x003f0000, 0x00006000, 0x0000ffb8, 0x00000000 },  // 11:46
+    { 0xff00001b, 0x00000000, 0x00000000, 0xc0000000, 0x003f0000, 0x00006000, 0x0000ffb8, 0x00000000 },  // 11:47
+    { 0x0000001b, 0x00000000, 0x00000000, 0xc000fc00, 0x003f0000, 0x00006000, 0x0000ffb8, 0x00000000 },  // 11:48
+    { 0x0000001b, 0x000007e0, 0x00000000, 0xc0000000, 0x003f0000, 0x00006000, 0x0000ffb8, 0x00000000 },  // 11:49
+    { 0x0070001b, 0x00000000, 0x00000000, 0xc0000000, 0x003f0000, 0x00006000, 0x0000ffb8, 0x00000000 },  // 11:50
+    { 0x0000001b, 0x03c00000, 0x00000000, 0xc0000000, 0x003f0000, 0x00006000, 0x0000ffb8, 0x00000000 },  // 11:51
+    { 0x0000001b, 0x00000000, 0x1f000000, 0xc0000000, 0x003f0000, 0x00006000, 0x0000ffb8, 0x00000000 },  // 11:52
+    { 0x0000001b, 0x00000000, 0x00000000, 0xc000001f, 0x003f0000, 0x00006000, 0x0000ffb8, 0x00000000 },  // 11:53
+    { 0x0000001b, 0x00000000, 0x00070000, 0xc0000000, 0x003f0000, 0x00006000, 0x0000ffb8, 0x00000000 },  // 11:54
+    { 0x0000001b, 0x0000000f, 0x00000000, 0xc0000000, 0x003f0000, 0x00006000, 0x0000ffb8, 0x00000000 },  // 11:55
+    { 0x0000001b, 0x0000f000, 0x00000000, 0xc0000000, 0x003f0000, 0x00006000, 0x0000ffb8, 0x00000000 },  // 11:56
+    { 0x0000001b, 0x001f0000, 0x00000000, 0xc0000000, 0x003f0000, 0x00006000, 0x0000ffb8, 0x00000000 },  // 11:57
+    { 0x0007001b, 0x00000000, 0x00000000, 0xc0000000, 0x003f0000, 0x00006000, 0x0000ffb8, 0x00000000 },  // 11:58
+    { 0x0000e01b, 0x00000000, 0x00000000, 0xc0000000, 0x003f0000, 0x00006000, 0x0000ffb8, 0x00000000 },  // 11:59
+    { 0x0000001b, 0x00000000, 0x00000000, 0x0000fc00, 0x00000000, 0x00006000, 0x0000ffb8, 0x00000000 },  // 12:00
+    { 0x0000e01b, 0x00000000, 0x00000000, 0x00000000, 0x003f000f, 0x00006000, 0x0000ffb8, 0x00000000 },  // 12:01
+    { 0x0007001b, 0x00000000, 0x00000000, 0x00000000, 0x003f000f, 0x00006000, 0x0000ffb8, 0x00000000 },  // 12:02
+    { 0x0000001b, 0x001f0000, 0x00000000, 0x00000000, 0x003f000f, 0x00006000, 0x0000ffb8, 0x00000000 },  // 12:03
+    { 0x0000001b, 0x0000f000, 0x00000000, 0x00000000, 0x003f000f, 0x00006000, 0x0000ffb8, 0x00000000 },  // 12:04
+    { 0x0000001b, 0x0000000f, 0x00000000, 0x00000000, 0x003f000f, 0x00006000, 0x0000ffb8, 0x00000000 },  // 12:05
+    { 0x0000001b, 0x00000000, 0x00070000, 0x00000000, 0x003f000f, 0x00006000, 0x0000ffb8, 0x00000000 },  // 12:06
+    { 0x0000001b, 0x00000000, 0x00000000, 0x0000001f, 0x003f000f, 0x00006000, 0x0000ffb8, 0x00000000 },  // 12:07
+    { 0x0000001b, 0x00000000, 0x1f000000, 0x00000000, 0x003f000f, 0x00006000, 0x0000ffb8, 0x00000000 },  // 12:08
+    { 0x0000001b, 0x03c00000, 0x00000000, 0x00000000, 0x003f000f, 0x00006000, 0x0000ffb8, 0x00000000 },  // 12:09
+    { 0x0070001b, 0x00000000, 0x00000000, 0x00000000, 0x003f000f, 0x00006000, 0x0000ffb8, 0x00000000 },  // 12:10
+    { 0x0000001b, 0x000007e0, 0x00000000, 0x00000000, 0x003f000f, 0x00006000, 0x0000ffb8, 0x00000000 },  // 12:11
+    { 0x0000001b, 0x00000000, 0x00000000, 0x0000fc00, 0x003f000f, 0x00006000, 0x0000ffb8, 0x00000000 },  // 12:12
+    { 0xff00001b, 0x00000000, 0x00000000, 0x00000000, 0x003f000f, 0x00006000, 0x0000ffb8, 0x00000000 },  // 12:13
+    { 0x0000001b, 0x00000000, 0x000000ff, 0x00000000, 0x003f000f, 0x00006000, 0x0000ffb8, 0x00000000 },  // 12:14
+    { 0x0000001b, 0x00000000, 0x00000000, 0x1fc20000, 0x003f000f, 0x00006000, 0x0000ffb8, 0x00000000 },  // 12:15
+    { 0x0000001b, 0x00000000, 0x007f0000, 0x00000000, 0x003f000f, 0x00006000, 0x0000ffb8, 0x00000000 },  // 12:16
+    { 0x0000001b, 0x00000000, 0x00000000, 0x000001ff, 0x003f000f, 0x00006000, 0x0000ffb8, 0x00000000 },  // 12:17
+    { 0x0000001b, 0x00000000, 0xff000000, 0x00000000, 0x003f000f, 0x00006000, 0x0000ffb8, 0x00000000 },  // 12:18
+    { 0x0000001b, 0x3fc00000, 0x00000000, 0x00000000, 0x003f000f, 0x00006000, 0x0000ffb8, 0x00000000 },  // 12:19
+    { 0x00000fdb, 0x00000000, 0x00000000, 0x00000000, 0x003f000f, 0x00006000, 0x0000ffb8, 0x00000000 },  // 12:20
+    { 0x0000efdb, 0x00000000, 0x00000000, 0x00000000, 0x003f000f, 0x00006000, 0x0000ffb8, 0x00000000 },  // 12:21
+    { 0x00070fdb, 0x00000000, 0x00000000, 0x00000000, 0x003f000f, 0x00006000, 0x0000ffb8, 0x00000000 },  // 12:22
+    { 0x00000fdb, 0x001f0000, 0x00000000, 0x00000000, 0x003f000f, 0x00006000, 0x0000ffb8, 0x00000000 },  // 12:23
+    { 0x00000fdb, 0x0000f000, 0x00000000, 0x00000000, 0x003f000f, 0x00006000, 0x0000ffb8, 0x00000000 },  // 12:24
+    { 0x00000fdb, 0x0000000f, 0x00000000, 0x00000000, 0x003f000f, 0x00006000, 0x0000ffb8, 0x00000000 },  // 12:25
+    { 0x00000fdb, 0x00000000, 0x00070000, 0x00000000, 0x003f000f, 0x00006000, 0x0000ffb8, 0x00000000 },  // 12:26
+    { 0x00000fdb, 0x00000000, 0x00000000, 0x0000001f, 0x003f000f, 0x00006000, 0x0000ffb8, 0x00000000 },  // 12:27
+    { 0x00000fdb, 0x00000000, 0x1f000000, 0x00000000, 0x003f000f, 0x00006000, 0x0000ffb8, 0x00000000 },  // 12:28
+    { 0x00000fdb, 0x03c00000, 0x00000000, 0x00000000, 0x003f000f, 0x00006000, 0x0000ffb8, 0x00000000 },  // 12:29
+    { 0x0000001b, 0x00000000, 0x00000000, 0x000f0000, 0x003f000f, 0x00006000, 0x0000ffb8, 0x00000000 },  // 12:30
+    { 0x00000fdb, 0x03c00000, 0x00000000, 0xc0000000, 0x000000e0, 0x00006000, 0x0000ffb8, 0x00000000 },  // 12:31
+    { 0x00000fdb, 0x00000000, 0x1f000000, 0xc0000000, 0x000000e0, 0x00006000, 0x0000ffb8, 0x00000000 },  // 12:32
+    { 0x00000fdb, 0x00000000, 0x00000000, 0xc000001f, 0x000000e0, 0x00006000, 0x0000ffb8, 0x00000000 },  // 12:33
+    { 0x00000fdb, 0x00000000, 0x00070000, 0xc0000000, 0x000000e0, 0x00006000, 0x0000ffb8, 0x00000000 },  // 12:34
+    { 0x00000fdb, 0x0000000f, 0x00000000, 0xc0000000, 0x000000e0, 0x00006000, 0x0000ffb8, 0x00000000 },  // 12:35
+    { 0x00000fdb, 0x0000f000, 0x00000000, 0xc0000000, 0x000000e0, 0x00006000, 0x0000ffb8, 0x00000000 },  // 12:36
+    { 0x00000fdb, 0x001f0000, 0x00000000, 0xc0000000, 0x000000e0, 0x00006000, 0x0000ffb8, 0x00000000 },  // 12:37
+    { 0x00070fdb, 0x00000000, 0x00000000, 0xc0000000, 0x000000e0, 0x00006000, 0x0000ffb8, 0x00000000 },  // 12:38
+    { 0x0000efdb, 0x00000000, 0x00000000, 0xc0000000, 0x000000e0, 0x00006000, 0x0000ffb8, 0x00000000 },  // 12:39
+    { 0x00000fdb, 0x00000000, 0x00000000, 0xc0000000, 0x000000e0, 0x00006000, 0x0000ffb8, 0x00000000 },  // 12:40
+    { 0x0000001b, 0x3fc00000, 0x00000000, 0xc0000000, 0x000000e0, 0x00006000, 0x0000ffb8, 0x00000000 },  // 12:41
+    { 0x0000001b, 0x00000000, 0xff000000, 0xc0000000, 0x000000e0, 0x00006000, 0x0000ffb8, 0x00000000 },  // 12:42
+    { 0x0000001b, 0x00000000, 0x00000000, 0xc00001ff, 0x000000e0, 0x00006000, 0x0000ffb8, 0x00000000 },  // 12:43
+    { 0x0000001b, 0x00000000, 0x007f0000, 0xc0000000, 0x000000e0, 0x00006000, 0x0000ffb8, 0x00000000 },  // 12:44
+    { 0x0000001b, 0x00000000, 0x00000000, 0xdfc20000, 0x000000e0, 0x00006000, 0x0000ffb8, 0x00000000 },  // 12:45
+    { 0x0000001b, 0x00000000, 0x000000ff, 0xc0000000, 0x000000e0, 0x00006000, 0x0000ffb8, 0x00000000 },  // 12:46
+    { 0xff00001b, 0x00000000, 0x00000000, 0xc0000000, 0x000000e0, 0x00006000, 0x0000ffb8, 0x00000000 },  // 12:47
+    { 0x0000001b, 0x00000000, 0x00000000, 0xc000fc00, 0x000000e0, 0x00006000, 0x0000ffb8, 0x00000000 },  // 12:48
+    { 0x0000001b, 0x000007e0, 0x00000000, 0xc0000000, 0x000000e0, 0x00006000, 0x0000ffb8, 0x00000000 },  // 12:49
+    { 0x0070001b, 0x00000000, 0x00000000, 0xc0000000, 0x000000e0, 0x00006000, 0x0000ffb8, 0x00000000 },  // 12:50
+    { 0x0000001b, 0x03c00000, 0x00000000, 0xc0000000, 0x000000e0, 0x00006000, 0x0000ffb8, 0x00000000 },  // 12:51
+    { 0x0000001b, 0x00000000, 0x1f000000, 0xc0000000, 0x000000e0, 0x00006000, 0x0000ffb8, 0x00000000 },  // 12:52
+    { 0x0000001b, 0x00000000, 0x00000000, 0xc000001f, 0x000000e0, 0x00006000, 0x0000ffb8, 0x00000000 },  // 12:53
+    { 0x0000001b, 0x00000000, 0x00070000, 0xc0000000, 0x000000e0, 0x00006000, 0x0000ffb8, 0x00000000 },  // 12:54
+    { 0x0000001b, 0x0000000f, 0x00000000, 0xc0000000, 0x000000e0, 0x00006000, 0x0000ffb8, 0x00000000 },  // 12:55
+    { 0x0000001b, 0x0000f000, 0x00000000, 0xc0000000, 0x000000e0, 0x00006000, 0x0000ffb8, 0x00000000 },  // 12:56
+    { 0x0000001b, 0x001f0000, 0x00000000, 0xc0000000, 0x000000e0, 0x00006000, 0x0000ffb8, 0x00000000 },  // 12:57
+    { 0x0007001b, 0x00000000, 0x00000000, 0xc0000000, 0x000000e0, 0x00006000, 0x0000ffb8, 0x00000000 },  // 12:58
+    { 0x0000e01b, 0x00000000, 0x00000000, 0xc0000000, 0x000000e0, 0x00006000, 0x0000ffb8, 0x00000000 },  // 12:59
+    { 0x0000e01b, 0x01800000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0000ffb8, 0x00000000 },  // 13:00
+    { 0x0000e01b, 0x00000000, 0x00000000, 0x00000000, 0x000000ef, 0x00006000, 0x0000ffb8, 0x00000000 },  // 13:01
+    { 0x0007001b, 0x00000000, 0x00000000, 0x00000000, 0x000000ef, 0x00006000, 0x0000ffb8, 0x00000000 },  // 13:02
+    { 0x0000001b, 0x001f0000, 0x00000000, 0x00000000, 0x000000ef, 0x00006000, 0x0000ffb8, 0x00000000 },  // 13:03
+    { 0x0000001b, 0x0000f000, 0x00000000, 0x00000000, 0x000000ef, 0x00006000, 0x0000ffb8, 0x00000000 },  // 13:04
+    { 0x0000001b, 0x0000000f, 0x00000000, 0x00000000, 0x000000ef, 0x00006000, 0x0000ffb8, 0x00000000 },  // 13:05
+    { 0x0000001b, 0x00000000, 0x00070000, 0x00000000, 0x000000ef, 0x00006000, 0x0000ffb8, 0x00000000 },  // 13:06
+    { 0x0000001b, 0x00000000, 0x00000000, 0x0000001f, 0x000000ef, 0x00006000, 0x0000ffb8, 0x00000000 },  // 13:07
+    { 0x0000001b, 0x00000000, 0x1f000000, 0x00000000, 0x000000ef, 0x00006000, 0x0000ffb8, 0x00000000 },  // 13:08
+    { 0x0000001b, 0x03c00000, 0x00000000, 0x00000000, 0x000000ef, 0x00006000, 0x0000ffb8, 0x00000000 },  // 13:09
+    { 0x0070001b, 0x00000000, 0x00000000, 0x00000000, 0x000000ef, 0x00006000, 0x0000ffb8, 0x00000000 },  // 13:10
+    { 0x0000001b, 0x000007e0, 0x00000000, 0x00000000, 0x000000ef, 0x00006000, 0x0000ffb8, 0x00000000 },  // 13:11
+    { 0x0000001b, 0x00000000, 0x00000000, 0x0000fc00, 0x000000ef, 0x00006000, 0x0000ffb8, 0x00000000 },  // 13:12
+    { 0xff00001b, 0x00000000, 0x00000000, 0x00000000, 0x000000ef, 0x00006000, 0x0000ffb8, 0x00000000 },  // 13:13
+    { 0x0000001b, 0x00000000, 0x000000ff, 0x00000000, 0x000000ef, 0x00006000, 0x0000ffb8, 0x00000000 },  // 13:14
+    { 0x0000001b, 0x00000000, 0x00000000, 0x1fc20000, 0x000000ef, 0x00006000, 0x0000ffb8, 0x00000000 },  // 13:15
+    { 0x0000001b, 0x00000000, 0x007f0000, 0x00000000, 0x000000ef, 0x00006000, 0x0000ffb8, 0x00000000 },  // 13:16
+    { 0x0000001b, 0x00000000, 0x00000000, 0x000001ff, 0x000000ef, 0x00006000, 0x0000ffb8, 0x00000000 },  // 13:17
+    { 0x0000001b, 0x00000000, 0xff000000, 0x00000000, 0x000000ef, 0x00006000, 0x0000ffb8, 0x00000000 },  // 13:18
+    { 0x0000001b, 0x3fc00000, 0x00000000, 0x00000000, 0x000000ef, 0x00006000, 0x0000ffb8, 0x00000000 },  // 13:19
+    { 0x00000fdb, 0x00000000, 0x00000000, 0x00000000, 0x000000ef, 0x00006000, 0x0000ffb8, 0x00000000 },  // 13:20
+    { 0x0000efdb, 0x00000000, 0x00000000, 0x00000000, 0x000000ef, 0x00006000, 0x0000ffb8, 0x00000000 },  // 13:21
+    { 0x00070fdb, 0x00000000, 0x00000000, 0x00000000, 0x000000ef, 0x00006000, 0x0000ffb8, 0x00000000 },  // 13:22
+    { 0x00000fdb, 0x001f0000, 0x00000000, 0x00000000, 0x000000ef, 0x00006000, 0x0000ffb8, 0x00000000 },  // 13:23
+    { 0x00000fdb, 0x0000f000, 0x00000000, 0x00000000, 0x000000ef, 0x00006000, 0x0000ffb8, 0x00000000 },  // 13:24
+    { 0x00000fdb, 0x0000000f, 0x00000000, 0x00000000, 0x000000ef, 0x00006000, 0x0000ffb8, 0x00000000 },  // 13:25
+    { 0x00000fdb, 0x00000000, 0x00070000, 0x00000000, 0x000000ef, 0x00006000, 0x0000ffb8, 0x00000000 },  // 13:26
+    { 0x00000fdb, 0x00000000, 0x00000000, 0x0000001f, 0x000000ef, 0x00006000, 0x0000ffb8, 0x00000000 },  // 13:27
+    { 0x00000fdb, 0x00000000, 0x1f000000, 0x00000000, 0x000000ef, 0x00006000, 0x0000ffb8, 0x00000000 },  // 13:28
+    { 0x00000fdb, 0x03c00000, 0x00000000, 0x00000000, 0x000000ef, 0x00006000, 0x0000ffb8, 0x00000000 },  // 13:29
+    { 0x0000001b, 0x00000000, 0x00000000, 0x000f0000, 0x000000ef, 0x00006000, 0x0000ffb8, 0x00000000 },  // 13:30
+    { 0x00000fdb, 0x03c00000, 0x00000000, 0xc0000000, 0x00001c00, 0x00006000, 0x0000ffb8, 0x00000000 },  // 13:31
+    { 0x00000fdb, 0x00000000, 0x1f000000, 0xc0000000, 0x00001c00, 0x00006000, 0x0000ffb8, 0x00000000 },  // 13:32
+    { 0x00000fdb, 0x00000000, 0x00000000, 0xc000001f, 0x00001c00, 0x00006000, 0x0000ffb8, 0x00000000 },  // 13:33
+    { 0x00000fdb, 0x00000000, 0x00070000, 0xc0000000, 0x00001c00, 0x00006000, 0x0000ffb8, 0x00000000 },  // 13:34
+    { 0x00000fdb, 0x0000000f, 0x00000000, 0xc0000000, 0x00001c00, 0x00006000, 0x0000ffb8, 0x00000000 },  // 13:35
+    { 0x00000fdb, 0x0000f000, 0x00000000, 0xc0000000, 0x00001c00, 0x00006000, 0x0000ffb8, 0x00000000 },  // 13:36
+    { 0x00000fdb, 0x001f0000, 0x00000000, 0xc0000000, 0x00001c00, 0x00006000, 0x0000ffb8, 0x00000000 },  // 13:37
+    { 0x00070fdb, 0x00000000, 0x00000000, 0xc0000000, 0x00001c00, 0x00006000, 0x0000ffb8, 0x00000000 },  // 13:38
+    { 0x0000efdb, 0x00000000, 0x00000000, 0xc0000000, 0x00001c00, 0x00006000, 0x0000ffb8, 0x00000000 },  // 13:39
+    { 0x00000fdb, 0x00000000, 0x00000000, 0xc0000000, 0x00001c00, 0x00006000, 0x0000ffb8, 0x00000000 },  // 13:40
+    { 0x0000001b, 0x3fc00000, 0x00000000, 0xc0000000, 0x00001c00, 0x00006000, 0x0000ffb8, 0x00000000 },  // 13:41
+    { 0x0000001b, 0x00000000, 0xff000000, 0xc0000000, 0x00001c00, 0x00006000, 0x0000ffb8, 0x00000000 },  // 13:42
+    { 0x0000001b, 0x00000000, 0x00000000, 0xc00001ff, 0x00001c00, 0x00006000, 0x0000ffb8, 0x00000000 },  // 13:43
+    { 0x0000001b, 0x00000000, 0x007f0000, 0xc0000000, 0x00001c00, 0x00006000, 0x0000ffb8, 0x00000000 },  // 13:44
+    { 0x0000001b, 0x00000000, 0x00000000, 0xdfc20000, 0x00001c00, 0x00006000, 0x0000ffb8, 0x00000000 },  // 13:45
+    { 0x0000001b, 0x00000000, 0x000000ff, 0xc0000000, 0x00001c00, 0x00006000, 0x0000ffb8, 0x00000000 },  // 13:46
+    { 0xff00001b, 0x00000000, 0x00000000, 0xc0000000, 0x00001c00, 0x00006000, 0x0000ffb8, 0x00000000 },  // 13:47
+    { 0x0000001b, 0x00000000, 0x00000000, 0xc000fc00, 0x00001c00, 0x00006000, 0x0000ffb8, 0x00000000 },  // 13:48
+    { 0x0000001b, 0x000007e0, 0x00000000, 0xc0000000, 0x00001c00, 0x00006000, 0x0000ffb8, 0x00000000 },  // 13:49
+    { 0x0070001b, 0x00000000, 0x00000000, 0xc0000000, 0x00001c00, 0x00006000, 0x0000ffb8, 0x00000000 },  // 13:50
+    { 0x0000001b, 0x03c00000, 0x00000000, 0xc0000000, 0x00001c00, 0x00006000, 0x0000ffb8, 0x00000000 },  // 13:51
+    { 0x0000001b, 0x00000000, 0x1f000000, 0xc0000000, 0x00001c00, 0x00006000, 0x0000ffb8, 0x00000000 },  // 13:52
+    { 0x0000001b, 0x00000000, 0x00000000, 0xc000001f, 0x00001c00, 0x00006000, 0x0000ffb8, 0x00000000 },  // 13:53
+    { 0x0000001b, 0x00000000, 0x00070000, 0xc0000000, 0x00001c00, 0x00006000, 0x0000ffb8, 0x00000000 },  // 13:54
+    { 0x0000001b, 0x0000000f, 0x00000000, 0xc0000000, 0x00001c00, 0x00006000, 0x0000ffb8, 0x00000000 },  // 13:55
+    { 0x0000001b, 0x0000f000, 0x00000000, 0xc0000000, 0x00001c00, 0x00006000, 0x0000ffb8, 0x00000000 },  // 13:56
+    { 0x0000001b, 0x001f0000, 0x00000000, 0xc0000000, 0x00001c00, 0x00006000, 0x0000ffb8, 0x00000000 },  // 13:57
+    { 0x0007001b, 0x00000000, 0x00000000, 0xc0000000, 0x00001c00, 0x00006000, 0x0000ffb8, 0x00000000 },  // 13:58
+    { 0x0000e01b, 0x00000000, 0x00000000, 0xc0000000, 0x00001c00, 0x00006000, 0x0000ffb8, 0x00000000 },  // 13:59
+    { 0x0007001b, 0x01800000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0000ffb8, 0x00000000 },  // 14:00
+    { 0x0000e01b, 0x00000000, 0x00000000, 0x00000000, 0x00001c0f, 0x00006000, 0x0000ffb8, 0x00000000 },  // 14:01
+    { 0x0007001b, 0x00000000, 0x00000000, 0x00000000, 0x00001c0f, 0x00006000, 0x0000ffb8, 0x00000000 },  // 14:02
+    { 0x0000001b, 0x001f0000, 0x00000000, 0x00000000, 0x00001c0f, 0x00006000, 0x0000ffb8, 0x00000000 },  // 14:03
+    { 0x0000001b, 0x0000f000, 0x00000000, 0x00000000, 0x00001c0f, 0x00006000, 0x0000ffb8, 0x00000000 },  // 14:04
+    { 0x0000001b, 0x0000000f, 0x00000000, 0x00000000, 0x00001c0f, 0x00006000, 0x0000ffb8, 0x00000000 },  // 14:05
+    { 0x0000001b, 0x00000000, 0x00070000, 0x00000000, 0x00001c0f, 0x00006000, 0x0000ffb8, 0x00000000 },  // 14:06
+    { 0x0000001b, 0x00000000, 0x00000000, 0x0000001f, 0x00001c0f, 0x00006000, 0x0000ffb8, 0x00000000 },  // 14:07
+    { 0x0000001b, 0x00000000, 0x1f000000, 0x00000000, 0x00001c0f, 0x00006000, 0x0000ffb8, 0x00000000 },  // 14:08
+    { 0x0000001b, 0x03c00000, 0x00000000, 0x00000000, 0x00001c0f, 0x00006000, 0x0000ffb8, 0x00000000 },  // 14:09
+    { 0x0070001b, 0x00000000, 0x00000000, 0x00000000, 0x00001c0f, 0x00006000, 0x0000ffb8, 0x00000000 },  // 14:10
+    { 0x0000001b, 0x000007e0, 0x00000000, 0x00000000, 0x00001c0f, 0x00006000, 0x0000ffb8, 0x00000000 },  // 14:11
+    { 0x0000001b, 0x00000000, 0x00000000, 0x0000fc00, 0x00001c0f, 0x00006000, 0x0000ffb8, 0x00000000 },  // 14:12
+    { 0xff00001b, 0x00000000, 0x00000000, 0x00000000, 0x00001c0f, 0x00006000, 0x0000ffb8, 0x00000000 },  // 14:13
+    { 0x0000001b, 0x00000000, 0x000000ff, 0x00000000, 0x00001c0f, 0x00006000, 0x0000ffb8, 0x00000000 },  // 14:14
+    { 0x0000001b, 0x00000000, 0x00000000, 0x1fc20000, 0x00001c0f, 0x00006000, 0x0000ffb8, 0x00000000 },  // 14:15
+    { 0x0000001b, 0x00000000, 0x007f0000, 0x00000000, 0x00001c0f, 0x00006000, 0x0000ffb8, 0x00000000 },  // 14:16
+    { 0x0000001b, 0x00000000, 0x00000000, 0x000001ff, 0x00001c0f, 0x00006000, 0x0000ffb8, 0x00000000 },  // 14:17
+    { 0x0000001b, 0x00000000, 0xff000000, 0x00000000, 0x00001c0f, 0x00006000, 0x0000ffb8, 0x00000000 },  // 14:18
+    { 0x0000001b, 0x3fc00000, 0x00000000, 0x00000000, 0x00001c0f, 0x00006000, 0x0000ffb8, 0x00000000 },  // 14:19
+    { 0x00000fdb, 0x00000000, 0x00000000, 0x00000000, 0x00001c0f, 0x00006000, 0x0000ffb8, 0x00000000 },  // 14:20
+    { 0x0000efdb, 0x00000000, 0x00000000, 0x00000000, 0x00001c0f, 0x00006000, 0x0000ffb8, 0x00000000 },  // 14:21
+    { 0x00070fdb, 0x00000000, 0x00000000, 0x00000000, 0x00001c0f, 0x00006000, 0x0000ffb8, 0x00000000 },  // 14:22
+    { 0x00000fdb, 0x001f0000, 0x00000000, 0x00000000, 0x00001c0f, 0x00006000, 0x0000ffb8, 0x00000000 },  // 14:23
+    { 0x00000fdb, 0x0000f000, 0x00000000, 0x00000000, 0x00001c0f, 0x00006000, 0x0000ffb8, 0x00000000 },  // 14:24
+    { 0x00000fdb, 0x0000000f, 0x00000000, 0x00000000, 0x00001c0f, 0x00006000, 0x0000ffb8, 0x00000000 },  // 14:25
+    { 0x00000fdb, 0x00000000, 0x00070000, 0x00000000, 0x00001c0f, 0x00006000, 0x0000ffb8, 0x00000000 },  // 14:26
+    { 0x00000fdb, 0x00000000, 0x00000000, 0x0000001f, 0x00001c0f, 0x00006000, 0x0000ffb8, 0x00000000 },  // 14:27
+    { 0x00000fdb, 0x00000000, 0x1f000000, 0x00000000, 0x00001c0f, 0x00006000, 0x0000ffb8, 0x00000000 },  // 14:28
+    { 0x00000fdb, 0x03c00000, 0x00000000, 0x00000000, 0x00001c0f, 0x00006000, 0x0000ffb8, 0x00000000 },  // 14:29
+    { 0x0000001b, 0x00000000, 0x00000000, 0x000f0000, 0x00001c0f, 0x00006000, 0x0000ffb8, 0x00000000 },  // 14:30
+    { 0x00000fdb, 0x03c00000, 0x00000000, 0xc0000000, 0x00000000, 0x01f00000, 0x0000ffbb, 0x00000000 },  // 14:31
+    { 0x00000fdb, 0x00000000, 0x1f000000, 0xc0000000, 0x00000000, 0x01f00000, 0x0000ffbb, 0x00000000 },  // 14:32
+    { 0x00000fdb, 0x00000000, 0x00000000, 0xc000001f, 0x00000000, 0x01f00000, 0x0000ffbb, 0x00000000 },  // 14:33
+    { 0x00000fdb, 0x00000000, 0x00070000, 0xc0000000, 0x00000000, 0x01f00000, 0x0000ffbb, 0x00000000 },  // 14:34
+    { 0x00000fdb, 0x0000000f, 0x00000000, 0xc0000000, 0x00000000, 0x01f00000, 0x0000ffbb, 0x00000000 },  // 14:35
+    { 0x00000fdb, 0x0000f000, 0x00000000, 0xc0000000, 0x00000000, 0x01f00000, 0x0000ffbb, 0x00000000 },  // 14:36
+    { 0x00000fdb, 0x001f0000, 0x00000000, 0xc0000000, 0x00000000, 0x01f00000, 0x0000ffbb, 0x00000000 },  // 14:37
+    { 0x00070fdb, 0x00000000, 0x00000000, 0xc0000000, 0x00000000, 0x01f00000, 0x0000ffbb, 0x00000000 },  // 14:38
+    { 0x0000efdb, 0x00000000, 0x00000000, 0xc0000000, 0x00000000, 0x01f00000, 0x0000ffbb, 0x00000000 },  // 14:39
+    { 0x00000fdb, 0x00000000, 0x00000000, 0xc0000000, 0x00000000, 0x01f00000, 0x0000ffbb, 0x00000000 },  // 14:40
+    { 0x0000001b, 0x3fc00000, 0x00000000, 0xc0000000, 0x00000000, 0x01f00000, 0x0000ffbb, 0x00000000 },  // 14:41
+    { 0x0000001b, 0x00000000, 0xff000000, 0xc0000000, 0x00000000, 0x01f00000, 0x0000ffbb, 0x00000000 },  // 14:42
+    { 0x0000001b, 0x00000000, 0x00000000, 0xc00001ff, 0x00000000, 0x01f00000, 0x0000ffbb, 0x00000000 },  // 14:43
+    { 0x0000001b, 0x00000000, 0x007f0000, 0xc0000000, 0x00000000, 0x01f00000, 0x0000ffbb, 0x00000000 },  // 14:44
+    { 0x0000001b, 0x00000000, 0x00000000, 0xdfc20000, 0x00000000, 0x01f00000, 0x0000ffbb, 0x00000000 },  // 14:45
+    { 0x0000001b, 0x00000000, 0x000000ff, 0xc0000000, 0x00000000, 0x01f00000, 0x0000ffbb, 0x00000000 },  // 14:46
+    { 0xff00001b, 0x00000000, 0x00000000, 0xc0000000, 0x00000000, 0x01f00000, 0x0000ffbb, 0x00000000 },  // 14:47
+    { 0x0000001b, 0x00000000, 0x00000000, 0xc000fc00, 0x00000000, 0x01f00000, 0x0000ffbb, 0x00000000 },  // 14:48
+    { 0x0000001b, 0x000007e0, 0x00000000, 0xc0000000, 0x00000000, 0x01f00000, 0x0000ffbb, 0x00000000 },  // 14:49
+    { 0x0070001b, 0x00000000, 0x00000000, 0xc0000000, 0x00000000, 0x01f00000, 0x0000ffbb, 0x00000000 },  // 14:50
+    { 0x0000001b, 0x03c00000, 0x00000000, 0xc0000000, 0x00000000, 0x01f00000, 0x0000ffbb, 0x00000000 },  // 14:51
+    { 0x0000001b, 0x00000000, 0x1f000000, 0xc0000000, 0x00000000, 0x01f00000, 0x0000ffbb, 0x00000000 },  // 14:52
+    { 0x0000001b, 0x00000000, 0x00000000, 0xc000001f, 0x00000000, 0x01f00000, 0x0000ffbb, 0x00000000 },  // 14:53
+    { 0x0000001b, 0x00000000, 0x00070000, 0xc0000000, 0x00000000, 0x01f00000, 0x0000ffbb, 0x00000000 },  // 14:54
+    { 0x0000001b, 0x0000000f, 0x00000000, 0xc0000000, 0x00000000, 0x01f00000, 0x0000ffbb, 0x00000000 },  // 14:55
+    { 0x0000001b, 0x0000f000, 0x00000000, 0xc0000000, 0x00000000, 0x01f00000, 0x0000ffbb, 0x00000000 },  // 14:56
+    { 0x0000001b, 0x001f0000, 0x00000000, 0xc0000000, 0x00000000, 0x01f00000, 0x0000ffbb, 0x00000000 },  // 14:57
+    { 0x0007001b, 0x00000000, 0x00000000, 0xc0000000, 0x00000000, 0x01f00000, 0x0000ffbb, 0x00000000 },  // 14:58
+    { 0x0000e01b, 0x00000000, 0x00000000, 0xc0000000, 0x00000000, 0x01f00000, 0x0000ffbb, 0x00000000 },  // 14:59
+    { 0x0000001b, 0x019f0000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0000ffb8, 0x00000000 },  // 15:00
+    { 0x0000e01b, 0x00000000, 0x00000000, 0x00000000, 0x0000000f, 0x01f00000, 0x0000ffbb, 0x00000000 },  // 15:01
+    { 0x0007001b, 0x00000000, 0x00000000, 0x00000000, 0x0000000f, 0x01f00000, 0x0000ffbb, 0x00000000 },  // 15:02
+    { 0x0000001b, 0x001f0000, 0x00000000, 0x00000000, 0x0000000f, 0x01f00000, 0x0000ffbb, 0x00000000 },  // 15:03
+    { 0x0000001b, 0x0000f000, 0x00000000, 0x00000000, 0x0000000f, 0x01f00000, 0x0000ffbb, 0x00000000 },  // 15:04
+    { 0x0000001b, 0x0000000f, 0x00000000, 0x00000000, 0x0000000f, 0x01f00000, 0x0000ffbb, 0x00000000 },  // 15:05
+    { 0x0000001b, 0x00000000, 0x00070000, 0x00000000, 0x0000000f, 0x01f00000, 0x0000ffbb, 0x00000000 },  // 15:06
+    { 0x0000001b, 0x00000000, 0x00000000, 0x0000001f, 0x0000000f, 0x01f00000, 0x0000ffbb, 0x00000000 },  // 15:07
+    { 0x0000001b, 0x00000000, 0x1f000000, 0x00000000, 0x0000000f, 0x01f00000, 0x0000ffbb, 0x00000000 },  // 15:08
+    { 0x0000001b, 0x03c00000, 0x00000000, 0x00000000, 0x0000000f, 0x01f00000, 0x0000ffbb, 0x00000000 },  // 15:09
+    { 0x0070001b, 0x00000000, 0x00000000, 0x00000000, 0x0000000f, 0x01f00000, 0x0000ffbb, 0x00000000 },  // 15:10
+    { 0x0000001b, 0x000007e0, 0x00000000, 0x00000000, 0x0000000f, 0x01f00000, 0x0000ffbb, 0x00000000 },  // 15:11
+    { 0x0000001b, 0x00000000, 0x00000000, 0x0000fc00, 0x0000000f, 0x01f00000, 0x0000ffbb, 0x00000000 },  // 15:12
+    { 0xff00001b, 0x00000000, 0x00000000, 0x00000000, 0x0000000f, 0x01f00000, 0x0000ffbb, 0x00000000 },  // 15:13
+    { 0x0000001b, 0x00000000, 0x000000ff, 0x00000000, 0x0000000f, 0x01f00000, 0x0000ffbb, 0x00000000 },  // 15:14
+    { 0x0000001b, 0x00000000, 0x00000000, 0x1fc20000, 0x0000000f, 0x01f00000, 0x0000ffbb, 0x00000000 },  // 15:15
+    { 0x0000001b, 0x00000000, 0x007f0000, 0x00000000, 0x0000000f, 0x01f00000, 0x0000ffbb, 0x00000000 },  // 15:16
+    { 0x0000001b, 0x00000000, 0x00000000, 0x000001ff, 0x0000000f, 0x01f00000, 0x0000ffbb, 0x00000000 },  // 15:17
+    { 0x0000001b, 0x00000000, 0xff000000, 0x00000000, 0x0000000f, 0x01f00000, 0x0000ffbb, 0x00000000 },  // 15:18
+    { 0x0000001b, 0x3fc00000, 0x00000000, 0x00000000, 0x0000000f, 0x01f00000, 0x0000ffbb, 0x00000000 },  // 15:19
+    { 0x00000fdb, 0x00000000, 0x00000000, 0x00000000, 0x0000000f, 0x01f00000, 0x0000ffbb, 0x00000000 },  // 15:20
+    { 0x0000efdb, 0x00000000, 0x00000000, 0x00000000, 0x0000000f, 0x01f00000, 0x0000ffbb, 0x00000000 },  // 15:21
+    { 0x00070fdb, 0x00000000, 0x00000000, 0x00000000, 0x0000000f, 0x01f00000, 0x0000ffbb, 0x00000000 },  // 15:22
+    { 0x00000fdb, 0x001f0000, 0x00000000, 0x00000000, 0x0000000f, 0x01f00000, 0x0000ffbb, 0x00000000 },  // 15:23
+    { 0x00000fdb, 0x0000f000, 0x00000000, 0x00000000, 0x0000000f, 0x01f00000, 0x0000ffbb, 0x00000000 },  // 15:24
+    { 0x00000fdb, 0x0000000f, 0x00000000, 0x00000000, 0x0000000f, 0x01f00000, 0x0000ffbb, 0x00000000 },  // 15:25
+    { 0x00000fdb, 0x00000000, 0x00070000, 0x00000000, 0x0000000f, 0x01f00000, 0x0000ffbb, 0x00000000 },  // 15:26
+    { 0x00000fdb, 0x00000000, 0x00000000, 0x0000001f, 0x0000000f, 0x01f00000, 0x0000ffbb, 0x00000000 },  // 15:27
+    { 0x00000fdb, 0x00000000, 0x1f000000, 0x00000000, 0x0000000f, 0x01f00000, 0x0000ffbb, 0x00000000 },  // 15:28
+    { 0x00000fdb, 0x03c00000, 0x00000000, 0x00000000, 0x0000000f, 0x01f00000, 0x0000ffbb, 0x00000000 },  // 15:29
+    { 0x0000001b, 0x00000000, 0x00000000, 0x000f0000, 0x0000000f, 0x01f00000, 0x0000ffbb, 0x00000000 },  // 15:30
+    { 0x00000fdb, 0x03c00000, 0x00000000, 0xc0000000, 0x07800000, 0x00006000, 0x0000ffb8, 0x00000000 },  // 15:31
+    { 0x00000fdb, 0x00000000, 0x1f000000, 0xc0000000, 0x07800000, 0x00006000, 0x0000ffb8, 0x00000000 },  // 15:32
+    { 0x00000fdb, 0x00000000, 0x00000000, 0xc000001f, 0x07800000, 0x00006000, 0x0000ffb8, 0x00000000 },  // 15:33
+    { 0x00000fdb, 0x00000000, 0x00070000, 0xc0000000, 0x07800000, 0x00006000, 0x0000ffb8, 0x00000000 },  // 15:34
+    { 0x00000fdb, 0x0000000f, 0x00000000, 0xc0000000, 0x07800000, 0x00006000, 0x0000ffb8, 0x00000000 },  // 15:35
+    { 0x00000fdb, 0x0000f000, 0x00000000, 0xc0000000, 0x07800000, 0x00006000, 0x0000ffb8, 0x00000000 },  // 15:36
+    { 0x00000fdb, 0x001f0000, 0x00000000, 0xc0000000, 0x07800000, 0x00006000, 0x0000ffb8, 0x00000000 },  // 15:37
+    { 0x00070fdb, 0x00000000, 0x00000000, 0xc0000000, 0x07800000, 0x00006000, 0x0000ffb8, 0x00000000 },  // 15:38
+    { 0x0000efdb, 0x00000000, 0x00000000, 0xc0000000, 0x07800000, 0x00006000, 0x0000ffb8, 0x00000000 },  // 15:39
+    { 0x00000fdb, 0x00000000, 0x00000000, 0xc0000000, 0x07800000, 0x00006000, 0x0000ffb8, 0x00000000 },  // 15:40
+    { 0x0000001b, 0x3fc00000, 0x00000000, 0xc0000000, 0x07800000, 0x00006000, 0x0000ffb8, 0x00000000 },  // 15:41
+    { 0x0000001b, 0x00000000, 0xff000000, 0xc0000000, 0x07800000, 0x00006000, 0x0000ffb8, 0x00000000 },  // 15:42
+    { 0x0000001b, 0x00000000, 0x00000000, 0xc00001ff, 0x07800000, 0x00006000, 0x0000ffb8, 0x00000000 },  // 15:43
+    { 0x0000001b, 0x00000000, 0x007f0000, 0xc0000000, 0x07800000, 0x00006000, 0x0000ffb8, 0x00000000 },  // 15:44
+    { 0x0000001b, 0x00000000, 0x00000000, 0xdfc20000, 0x07800000, 0x00006000, 0x0000ffb8, 0x00000000 },  // 15:45
+    { 0x0000001b, 0x00000000, 0x000000ff, 0xc0000000, 0x07800000, 0x00006000, 0x0000ffb8, 0x00000000 },  // 15:46
+    { 0xff00001b, 0x00000000, 0x00000000, 0xc0000000, 0x07800000, 0x00006000, 0x0000ffb8, 0x00000000 },  // 15:47
+    { 0x0000001b, 0x00000000, 0x00000000, 0xc000fc00, 0x07800000, 0x00006000, 0x0000ffb8, 0x00000000 },  // 15:48
+    { 0x0000001b, 0x000007e0, 0x00000000, 0xc0000000, 0x07800000, 0x00006000, 0x0000ffb8, 0x00000000 },  // 15:49
+    { 0x0070001b, 0x00000000, 0x00000000, 0xc0000000, 0x07800000, 0x00006000, 0x0000ffb8, 0x00000000 },  // 15:50
+    { 0x0000001b, 0x03c00000, 0x00000000, 0xc0000000, 0x07800000, 0x00006000, 0x0000ffb8, 0x00000000 },  // 15:51
+    { 0x0000001b, 0x00000000, 0x1f000000, 0xc0000000, 0x07800000, 0x00006000, 0x0000ffb8, 0x00000000 },  // 15:52
+    { 0x0000001b, 0x00000000, 0x00000000, 0xc000001f, 0x07800000, 0x00006000, 0x0000ffb8, 0x00000000 },  // 15:53
+    { 0x0000001b, 0x00000000, 0x00070000, 0xc0000000, 0x07800000, 0x00006000, 0x0000ffb8, 0x00000000 },  // 15:54
+    { 0x0000001b, 0x0000000f, 0x00000000, 0xc0000000, 0x07800000, 0x00006000, 0x0000ffb8, 0x00000000 },  // 15:55
+    { 0x0000001b, 0x0000f000, 0x00000000, 0xc0000000, 0x07800000, 0x00006000, 0x0000ffb8, 0x00000000 },  // 15:56
+    { 0x0000001b, 0x001f0000, 0x00000000, 0xc0000000, 0x07800000, 0x00006000, 0x0000ffb8, 0x00000000 },  // 15:57
+    { 0x0007001b, 0x00000000, 0x00000000, 0xc0000000, 0x07800000, 0x00006000, 0x0000ffb8, 0x00000000 },  // 15:58
+    { 0x0000e01b, 0x00000000, 0x00000000, 0xc0000000, 0x07800000, 0x00006000, 0x0000ffb8, 0x00000000 },  // 15:59
+    { 0x0000001b, 0x0180f000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0000ffb8, 0x00000000 },  // 16:00
+    { 0x0000e01b, 0x00000000, 0x00000000, 0x00000000, 0x0780000f, 0x00006000, 0x0000ffb8, 0x00000000 },  // 16:01
+    { 0x0007001b, 0x00000000, 0x00000000, 0x00000000, 0x0780000f, 0x00006000, 0x0000ffb8, 0x00000000 },  // 16:02
+    { 0x0000001b, 0x001f0000, 0x00000000, 0x00000000, 0x0780000f, 0x00006000, 0x0000ffb8, 0x00000000 },  // 16:03
+    { 0x0000001b, 0x0000f000, 0x00000000, 0x00000000, 0x0780000f, 0x00006000, 0x0000ffb8, 0x00000000 },  // 16:04
+    { 0x0000001b, 0x0000000f, 0x00000000, 0x00000000, 0x0780000f, 0x00006000, 0x0000ffb8, 0x00000000 },  // 16:05
+    { 0x0000001b, 0x00000000, 0x00070000, 0x00000000, 0x0780000f, 0x00006000, 0x0000ffb8, 0x00000000 },  // 16:06
+    { 0x0000001b, 0x00000000, 0x00000000, 0x0000001f, 0x0780000f, 0x00006000, 0x0000ffb8, 0x00000000 },  // 16:07
+    { 0x0000001b, 0x00000000, 0x1f000000, 0x00000000, 0x0780000f, 0x00006000, 0x0000ffb8, 0x00000000 },  // 16:08
+    { 0x0000001b, 0x03c00000, 0x00000000, 0x00000000, 0x0780000f, 0x00006000, 0x0000ffb8, 0x00000000 },  // 16:09
+    { 0x0070001b, 0x00000000, 0x00000000, 0x00000000, 0x0780000f, 0x00006000, 0x0000ffb8, 0x00000000 },  // 16:10
+    { 0x0000001b, 0x000007e0, 0x00000000, 0x00000000, 0x0780000f, 0x00006000, 0x0000ffb8, 0x00000000 },  // 16:11
+    { 0x0000001b, 0x00000000, 0x00000000, 0x0000fc00, 0x0780000f, 0x00006000, 0x0000ffb8, 0x00000000 },  // 16:12
+    { 0xff00001b, 0x00000000, 0x00000000, 0x00000000, 0x0780000f, 0x00006000, 0x0000ffb8, 0x00000000 },  // 16:13
+    { 0x0000001b, 0x00000000, 0x000000ff, 0x00000000, 0x0780000f, 0x00006000, 0x0000ffb8, 0x00000000 },  // 16:14
+    { 0x0000001b, 0x00000000, 0x00000000, 0x1fc20000, 0x0780000f, 0x00006000, 0x0000ffb8, 0x00000000 },  // 16:15
+    { 0x0000001b, 0x00000000, 0x007f0000, 0x00000000, 0x0780000f, 0x00006000, 0x0000ffb8, 0x00000000 },  // 16:16
+    { 0x0000001b, 0x00000000, 0x00000000, 0x000001ff, 0x0780000f, 0x00006000, 0x0000ffb8, 0x00000000 },  // 16:17
+    { 0x0000001b, 0x00000000, 0xff000000, 0x00000000, 0x0780000f, 0x00006000, 0x0000ffb8, 0x00000000 },  // 16:18
+    { 0x0000001b, 0x3fc00000, 0x00000000, 0x00000000, 0x0780000f, 0x00006000, 0x0000ffb8, 0x00000000 },  // 16:19
+    { 0x00000fdb, 0x00000000, 0x00000000, 0x00000000, 0x0780000f, 0x00006000, 0x0000ffb8, 0x00000000 },  // 16:20
+    { 0x0000efdb, 0x00000000, 0x00000000, 0x00000000, 0x0780000f, 0x00006000, 0x0000ffb8, 0x00000000 },  // 16:21
+    { 0x00070fdb, 0x00000000, 0x00000000, 0x00000000, 0x0780000f, 0x00006000, 0x0000ffb8, 0x00000000 },  // 16:22
+    { 0x00000fdb, 0x001f0000, 0x00000000, 0x00000000, 0x0780000f, 0x00006000, 0x0000ffb8, 0x00000000 },  // 16:23
+    { 0x00000fdb, 0x0000f000, 0x00000000, 0x00000000, 0x0780000f, 0x00006000, 0x0000ffb8, 0x00000000 },  // 16:24
+    { 0x00000fdb, 0x0000000f, 0x00000000, 0x00000000, 0x0780000f, 0x00006000, 0x0000ffb8, 0x00000000 },  // 16:25
+    { 0x00000fdb, 0x00000000, 0x00070000, 0x00000000, 0x0780000f, 0x00006000, 0x0000ffb8, 0x00000000 },  // 16:26
+    { 0x00000fdb, 0x00000000, 0x00000000, 0x0000001f, 0x0780000f, 0x00006000, 0x0000ffb8, 0x00000000 },  // 16:27
+    { 0x00000fdb, 0x00000000, 0x1f000000, 0x00000000, 0x0780000f, 0x00006000, 0x0000ffb8, 0x00000000 },  // 16:28
+    { 0x00000fdb, 0x03c00000, 0x00000000, 0x00000000, 0x0780000f, 0x00006000, 0x0000ffb8, 0x00000000 },  // 16:29
+    { 0x0000001b, 0x00000000, 0x00000000, 0x000f0000, 0x0780000f, 0x00006000, 0x0000ffb8, 0x00000000 },  // 16:30
+    { 0x00000fdb, 0x03c00000, 0x00000000, 0xc0000000, 0xf0000000, 0x00006000, 0x00000038, 0x0000007f },  // 16:31
+    { 0x00000fdb, 0x00000000, 0x1f000000, 0xc0000000, 0xf0000000, 0x00006000, 0x00000038, 0x0000007f },  // 16:32
+    { 0x00000fdb, 0x00000000, 0x00000000, 0xc000001f, 0xf0000000, 0x00006000, 0x00000038, 0x0000007f },  // 16:33
+    { 0x00000fdb, 0x00000000, 0x00070000, 0xc0000000, 0xf0000000, 0x00006000, 0x00000038, 0x0000007f },  // 16:34
+    { 0x00000fdb, 0x0000000f, 0x00000000, 0xc0000000, 0xf0000000, 0x00006000, 0x00000038, 0x0000007f },  // 16:35
+    { 0x00000fdb, 0x0000f000, 0x00000000, 0xc0000000, 0xf0000000, 0x00006000, 0x00000038, 0x0000007f },  // 16:36
+    { 0x00000fdb, 0x001f0000, 0x00000000, 0xc0000000, 0xf0000000, 0x00006000, 0x00000038, 0x0000007f },  // 16:37
+    { 0x00070fdb, 0x00000000, 0x00000000, 0xc0000000, 0xf0000000, 0x00006000, 0x00000038, 0x0000007f },  // 16:38
+    { 0x0000efdb, 0x00000000, 0x00000000, 0xc0000000, 0xf0000000, 0x00006000, 0x00000038, 0x0000007f },  // 16:39
+    { 0x00000fdb, 0x00000000, 0x00000000, 0xc0000000, 0xf0000000, 0x00006000, 0x00000038, 0x0000007f },  // 16:40
+    { 0x0000001b, 0x3fc00000, 0x00000000, 0xc0000000, 0xf0000000, 0x00006000, 0x00000038, 0x0000007f },  // 16:41
+    { 0x0000001b, 0x00000000, 0xff000000, 0xc0000000, 0xf0000000, 0x00006000, 0x00000038, 0x0000007f },  // 16:42
+    { 0x0000001b, 0x00000000, 0x00000000, 0xc00001ff, 0xf0000000, 0x00006000, 0x00000038, 0x0000007f },  // 16:43
+    { 0x0000001b, 0x00000000, 0x007f0000, 0xc0000000, 0xf0000000, 0x00006000, 0x00000038, 0x0000007f },  // 16:44
+    { 0x0000001b, 0x00000000, 0x00000000, 0xdfc20000, 0xf0000000, 0x00006000, 0x00000038, 0x0000007f },  // 16:45
+    { 0x0000001b, 0x00000000, 0x000000ff, 0xc0000000, 0xf0000000, 0x00006000, 0x00000038, 0x0000007f },  // 16:46
+    { 0xff00001b, 0x00000000, 0x00000000, 0xc0000000, 0xf0000000, 0x00006000, 0x00000038, 0x0000007f },  // 16:47
+    { 0x0000001b, 0x00000000, 0x00000000, 0xc000fc00, 0xf0000000, 0x00006000, 0x00000038, 0x0000007f },  // 16:48
+    { 0x0000001b, 0x000007e0, 0x00000000, 0xc0000000, 0xf0000000, 0x00006000, 0x00000038, 0x0000007f },  // 16:49
+    { 0x0070001b, 0x00000000, 0x00000000, 0xc0000000, 0xf0000000, 0x00006000, 0x00000038, 0x0000007f },  // 16:50
+    { 0x0000001b, 0x03c00000, 0x00000000, 0xc0000000, 0xf0000000, 0x00006000, 0x00000038, 0x0000007f },  // 16:51
+    { 0x0000001b, 0x00000000, 0x1f000000, 0xc0000000, 0xf0000000, 0x00006000, 0x00000038, 0x0000007f },  // 16:52
+    { 0x0000001b, 0x00000000, 0x00000000, 0xc000001f, 0xf0000000, 0x00006000, 0x00000038, 0x0000007f },  // 16:53
+    { 0x0000001b, 0x00000000, 0x00070000, 0xc0000000, 0xf0000000, 0x00006000, 0x00000038, 0x0000007f },  // 16:54
+    { 0x0000001b, 0x0000000f, 0x00000000, 0xc0000000, 0xf0000000, 0x00006000, 0x00000038, 0x0000007f },  // 16:55
+    { 0x0000001b, 0x0000f000, 0x00000000, 0xc0000000, 0xf0000000, 0x00006000, 0x00000038, 0x0000007f },  // 16:56
+    { 0x0000001b, 0x001f0000, 0x00000000, 0xc0000000, 0xf0000000, 0x00006000, 0x00000038, 0x0000007f },  // 16:57
+    { 0x0007001b, 0x00000000, 0x00000000, 0xc0000000, 0xf0000000, 0x00006000, 0x00000038, 0x0000007f },  // 16:58
+    { 0x0000e01b, 0x00000000, 0x00000000, 0xc0000000, 0xf0000000, 0x00006000, 0x00000038, 0x0000007f },  // 16:59
+    { 0x0000001b, 0x0180000f, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000038, 0x0000007f },  // 17:00
+    { 0x0000e01b, 0x00000000, 0x00000000, 0x00000000, 0xf000000f, 0x00006000, 0x00000038, 0x0000007f },  // 17:01
+    { 0x0007001b, 0x00000000, 0x00000000, 0x00000000, 0xf000000f, 0x00006000, 0x00000038, 0x0000007f },  // 17:02
+    { 0x0000001b, 0x001f0000, 0x00000000, 0x00000000, 0xf000000f, 0x00006000, 0x00000038, 0x0000007f },  // 17:03
+    { 0x0000001b, 0x0000f000, 0x00000000, 0x00000000, 0xf000000f, 0x00006000, 0x00000038, 0x0000007f },  // 17:04
+    { 0x0000001b, 0x0000000f, 0x00000000, 0x00000000, 0xf000000f, 0x00006000, 0x00000038, 0x0000007f },  // 17:05
+    { 0x0000001b, 0x00000000, 0x00070000, 0x00000000, 0xf000000f, 0x00006000, 0x00000038, 0x0000007f },  // 17:06
+    { 0x0000001b, 0x00000000, 0x00000000, 0x0000001f, 0xf000000f, 0x00006000, 0x00000038, 0x0000007f },  // 17:07
+    { 0x0000001b, 0x00000000, 0x1f000000, 0x00000000, 0xf000000f, 0x00006000, 0x00000038, 0x0000007f },  // 17:08
+    { 0x0000001b, 0x03c00000, 0x00000000, 0x00000000, 0xf000000f, 0x00006000, 0x00000038, 0x0000007f },  // 17:09
+    { 0x0070001b, 0x00000000, 0x00000000, 0x00000000, 0xf000000f, 0x00006000, 0x00000038, 0x0000007f },  // 17:10
+    { 0x0000001b, 0x000007e0, 0x00000000, 0x00000000, 0xf000000f, 0x00006000, 0x00000038, 0x0000007f },  // 17:11
+    { 0x0000001b, 0x00000000, 0x00000000, 0x0000fc00, 0xf000000f, 0x00006000, 0x00000038, 0x0000007f },  // 17:12
+    { 0xff00001b, 0x00000000, 0x00000000, 0x00000000, 0xf000000f, 0x00006000, 0x00000038, 0x0000007f },  // 17:13
+    { 0x0000001b, 0x00000000, 0x000000ff, 0x00000000, 0xf000000f, 0x00006000, 0x00000038, 0x0000007f },  // 17:14
+    { 0x0000001b, 0x00000000, 0x00000000, 0x1fc20000, 0xf000000f, 0x00006000, 0x00000038, 0x0000007f },  // 17:15
+    { 0x0000001b, 0x00000000, 0x007f0000, 0x00000000, 0xf000000f, 0x00006000, 0x00000038, 0x0000007f },  // 17:16
+    { 0x0000001b, 0x00000000, 0x00000000, 0x000001ff, 0xf000000f, 0x00006000, 0x00000038, 0x0000007f },  // 17:17
+    { 0x0000001b, 0x00000000, 0xff000000, 0x00000000, 0xf000000f, 0x00006000, 0x00000038, 0x0000007f },  // 17:18
+    { 0x0000001b, 0x3fc00000, 0x00000000, 0x00000000, 0xf000000f, 0x00006000, 0x00000038, 0x0000007f },  // 17:19
+    { 0x00000fdb, 0x00000000, 0x00000000, 0x00000000, 0xf000000f, 0x00006000, 0x00000038, 0x0000007f },  // 17:20
+    { 0x0000efdb, 0x00000000, 0x00000000, 0x00000000, 0xf000000f, 0x00006000, 0x00000038, 0x0000007f },  // 17:21
+    { 0x00070fdb, 0x00000000, 0x00000000, 0x00000000, 0xf000000f, 0x00006000, 0x00000038, 0x0000007f },  // 17:22
+    { 0x00000fdb, 0x001f0000, 0x00000000, 0x00000000, 0xf000000f, 0x00006000, 0x00000038, 0x0000007f },  // 17:23
+    { 0x00000fdb, 0x0000f000, 0x00000000, 0x00000000, 0xf000000f, 0x00006000, 0x00000038, 0x0000007f },  // 17:24
+    { 0x00000fdb, 0x0000000f, 0x00000000, 0x00000000, 0xf000000f, 0x00006000, 0x00000038, 0x0000007f },  // 17:25
+    { 0x00000fdb, 0x00000000, 0x00070000, 0x00000000, 0xf000000f, 0x00006000, 0x00000038, 0x0000007f },  // 17:26
+    { 0x00000fdb, 0x00000000, 0x00000000, 0x0000001f, 0xf000000f, 0x00006000, 0x00000038, 0x0000007f },  // 17:27
+    { 0x00000fdb, 0x00000000, 0x1f000000, 0x00000000, 0xf000000f, 0x00006000, 0x00000038, 0x0000007f },  // 17:28
+    { 0x00000fdb, 0x03c00000, 0x00000000, 0x00000000, 0xf000000f, 0x00006000, 0x00000038, 0x0000007f },  // 17:29
+    { 0x0000001b, 0x00000000, 0x00000000, 0x000f0000, 0xf000000f, 0x00006000, 0x00000038, 0x0000007f },  // 17:30
+    { 0x00000fdb, 0x03c00000, 0x00000000, 0xc0000000, 0x0000e000, 0x00006000, 0x00000038, 0x0000007f },  // 17:31
+    { 0x00000fdb, 0x00000000, 0x1f000000, 0xc0000000, 0x0000e000, 0x00006000, 0x00000038, 0x0000007f },  // 17:32
+    { 0x00000fdb, 0x00000000, 0x00000000, 0xc000001f, 0x0000e000, 0x00006000, 0x00000038, 0x0000007f },  // 17:33
+    { 0x00000fdb, 0x00000000, 0x00070000, 0xc0000000, 0x0000e000, 0x00006000, 0x00000038, 0x0000007f },  // 17:34
+    { 0x00000fdb, 0x0000000f, 0x00000000, 0xc0000000, 0x0000e000, 0x00006000, 0x00000038, 0x0000007f },  // 17:35
+    { 0x00000fdb, 0x0000f000, 0x00000000, 0xc0000000, 0x0000e000, 0x00006000, 0x00000038, 0x0000007f },  // 17:36
+    { 0x00000fdb, 0x001f0000, 0x00000000, 0xc0000000, 0x0000e000, 0x00006000, 0x00000038, 0x0000007f },  // 17:37
+    { 0x00070fdb, 0x00000000, 0x00000000, 0xc0000000, 0x0000e000, 0x00006000, 0x00000038, 0x0000007f },  // 17:38
+    { 0x0000efdb, 0x00000000, 0x00000000, 0xc0000000, 0x0000e000, 0x00006000, 0x00000038, 0x0000007f },  // 17:39
+    { 0x00000fdb, 0x00000000, 0x00000000, 0xc0000000, 0x0000e000, 0x00006000, 0x00000038, 0x0000007f },  // 17:40
+    { 0x0000001b, 0x3fc00000, 0x00000000, 0xc0000000, 0x0000e000, 0x00006000, 0x00000038, 0x0000007f },  // 17:41
+    { 0x0000001b, 0x00000000, 0xff000000, 0xc0000000, 0x0000e000, 0x00006000, 0x00000038, 0x0000007f },  // 17:42
+    { 0x0000001b, 0x00000000, 0x00000000, 0xc00001ff, 0x0000e000, 0x00006000, 0x00000038, 0x0000007f },  // 17:43
+    { 0x0000001b, 0x00000000, 0x007f0000, 0xc0000000, 0x0000e000, 0x00006000, 0x00000038, 0x0000007f },  // 17:44
+    { 0x0000001b, 0x00000000, 0x00000000, 0xdfc20000, 0x0000e000, 0x00006000, 0x00000038, 0x0000007f },  // 17:45
+    { 0x0000001b, 0x00000000, 0x000000ff, 0xc0000000, 0x0000e000, 0x00006000, 0x00000038, 0x0000007f },  // 17:46
+    { 0xff00001b, 0x00000000, 0x00000000, 0xc0000000, 0x0000e000, 0x00006000, 0x00000038, 0x0000007f },  // 17:47
+    { 0x0000001b, 0x00000000, 0x00000000, 0xc000fc00, 0x0000e000, 0x00006000, 0x00000038, 0x0000007f },  // 17:48
+    { 0x0000001b, 0x000007e0, 0x00000000, 0xc0000000, 0x0000e000, 0x00006000, 0x00000038, 0x0000007f },  // 17:49
+    { 0x0070001b, 0x00000000, 0x00000000, 0xc0000000, 0x0000e000, 0x00006000, 0x00000038, 0x0000007f },  // 17:50
+    { 0x0000001b, 0x03c00000, 0x00000000, 0xc0000000, 0x0000e000, 0x00006000, 0x00000038, 0x0000007f },  // 17:51
+    { 0x0000001b, 0x00000000, 0x1f000000, 0xc0000000, 0x0000e000, 0x00006000, 0x00000038, 0x0000007f },  // 17:52
+    { 0x0000001b, 0x00000000, 0x00000000, 0xc000001f, 0x0000e000, 0x00006000, 0x00000038, 0x0000007f },  // 17:53
+    { 0x0000001b, 0x00000000, 0x00070000, 0xc0000000, 0x0000e000, 0x00006000, 0x00000038, 0x0000007f },  // 17:54
+    { 0x0000001b, 0x0000000f, 0x00000000, 0xc0000000, 0x0000e000, 0x00006000, 0x00000038, 0x0000007f },  // 17:55
+    { 0x0000001b, 0x0000f000, 0x00000000, 0xc0000000, 0x0000e000, 0x00006000, 0x00000038, 0x0000007f },  // 17:56
+    { 0x0000001b, 0x001f0000, 0x00000000, 0xc0000000, 0x0000e000, 0x00006000, 0x00000038, 0x0000007f },  // 17:57
+    { 0x0007001b, 0x00000000, 0x00000000, 0xc0000000, 0x0000e000, 0x00006000, 0x00000038, 0x0000007f },  // 17:58
+    { 0x0000e01b, 0x00000000, 0x00000000, 0xc0000000, 0x0000e000, 0x00006000, 0x00000038, 0x0000007f },  // 17:59
+    { 0x0000001b, 0x00000000, 0x00070000, 0x00000000, 0x00000000, 0x00006000, 0x00000038, 0x0000007f },  // 18:00
+    { 0x0000e01b, 0x00000000, 0x00000000, 0x00000000, 0x0000e00f, 0x00006000, 0x00000038, 0x0000007f },  // 18:01
+    { 0x0007001b, 0x00000000, 0x00000000, 0x00000000, 0x0000e00f, 0x00006000, 0x00000038, 0x0000007f },  // 18:02
+    { 0x0000001b, 0x001f0000, 0x00000000, 0x00000000, 0x0000e00f, 0x00006000, 0x00000038, 0x0000007f },  // 18:03
+    { 0x0000001b, 0x0000f000, 0x00000000, 0x00000000, 0x0000e00f, 0x00006000, 0x00000038, 0x0000007f },  // 18:04
+    { 0x0000001b, 0x0000000f, 0x00000000, 0x00000000, 0x0000e00f, 0x00006000, 0x00000038, 0x0000007f },  // 18:05
+    { 0x0000001b, 0x00000000, 0x00070000, 0x00000000, 0x0000e00f, 0x00006000, 0x00000038, 0x0000007f },  // 18:06
+    { 0x0000001b, 0x00000000, 0x00000000, 0x0000001f, 0x0000e00f, 0x00006000, 0x00000038, 0x0000007f },  // 18:07
+    { 0x0000001b, 0x00000000, 0x1f000000, 0x00000000, 0x0000e00f, 0x00006000, 0x00000038, 0x0000007f },  // 18:08
+    { 0x0000001b, 0x03c00000, 0x00000000, 0x00000000, 0x0000e00f, 0x00006000, 0x00000038, 0x0000007f },  // 18:09
+    { 0x0070001b, 0x00000000, 0x00000000, 0x00000000, 0x0000e00f, 0x00006000, 0x00000038, 0x0000007f },  // 18:10
+    { 0x0000001b, 0x000007e0, 0x00000000, 0x00000000, 0x0000e00f, 0x00006000, 0x00000038, 0x0000007f },  // 18:11
+    { 0x0000001b, 0x00000000, 0x00000000, 0x0000fc00, 0x0000e00f, 0x00006000, 0x00000038, 0x0000007f },  // 18:12
+    { 0xff00001b, 0x00000000, 0x00000000, 0x00000000, 0x0000e00f, 0x00006000, 0x00000038, 0x0000007f },  // 18:13
+    { 0x0000001b, 0x00000000, 0x000000ff, 0x00000000, 0x0000e00f, 0x00006000, 0x00000038, 0x0000007f },  // 18:14
+    { 0x0000001b, 0x00000000, 0x00000000, 0x1fc20000, 0x0000e00f, 0x00006000, 0x00000038, 0x0000007f },  // 18:15
+    { 0x0000001b, 0x00000000, 0x007f0000, 0x00000000, 0x0000e00f, 0x00006000, 0x00000038, 0x0000007f },  // 18:16
+    { 0x0000001b, 0x00000000, 0x00000000, 0x000001ff, 0x0000e00f, 0x00006000, 0x00000038, 0x0000007f },  // 18:17
+    { 0x0000001b, 0x00000000, 0xff000000, 0x00000000, 0x0000e00f, 0x00006000, 0x00000038, 0x0000007f },  // 18:18
+    { 0x0000001b, 0x3fc00000, 0x00000000, 0x00000000, 0x0000e00f, 0x00006000, 0x00000038, 0x0000007f },  // 18:19
+    { 0x00000fdb, 0x00000000, 0x00000000, 0x00000000, 0x0000e00f, 0x00006000, 0x00000038, 0x0000007f },  // 18:20
+    { 0x0000efdb, 0x00000000, 0x00000000, 0x00000000, 0x0000e00f, 0x00006000, 0x00000038, 0x0000007f },  // 18:21
+    { 0x00070fdb, 0x00000000, 0x00000000, 0x00000000, 0x0000e00f, 0x00006000, 0x00000038, 0x0000007f },  // 18:22
+    { 0x00000fdb, 0x001f0000, 0x00000000, 0x00000000, 0x0000e00f, 0x00006000, 0x00000038, 0x0000007f },  // 18:23
+    { 0x00000fdb, 0x0000f000, 0x00000000, 0x00000000, 0x0000e00f, 0x00006000, 0x00000038, 0x0000007f },  // 18:24
+    { 0x00000fdb, 0x0000000f, 0x00000000, 0x00000000, 0x0000e00f, 0x00006000, 0x00000038, 0x0000007f },  // 18:25
+    { 0x00000fdb, 0x00000000, 0x00070000, 0x00000000, 0x0000e00f, 0x00006000, 0x00000038, 0x0000007f },  // 18:26
+    { 0x00000fdb, 0x00000000, 0x00000000, 0x0000001f, 0x0000e00f, 0x00006000, 0x00000038, 0x0000007f },  // 18:27
+    { 0x00000fdb, 0x00000000, 0x1f000000, 0x00000000, 0x0000e00f, 0x00006000, 0x00000038, 0x0000007f },  // 18:28
+    { 0x00000fdb, 0x03c00000, 0x00000000, 0x00000000, 0x0000e00f, 0x00006000, 0x00000038, 0x0000007f },  // 18:29
+    { 0x0000001b, 0x00000000, 0x00000000, 0x000f0000, 0x0000e00f, 0x00006000, 0x00000038, 0x0000007f },  // 18:30
+    { 0x00000fdb, 0x03c00000, 0x00000000, 0xc0000000, 0x00000000, 0x0000601f, 0x00000038, 0x0000007f },  // 18:31
+    { 0x00000fdb, 0x00000000, 0x1f000000, 0xc0000000, 0x00000000, 0x0000601f, 0x00000038, 0x0000007f },  // 18:32
+    { 0x00000fdb, 0x00000000, 0x00000000, 0xc000001f, 0x00000000, 0x0000601f, 0x00000038, 0x0000007f },  // 18:33
+    { 0x00000fdb, 0x00000000, 0x00070000, 0xc0000000, 0x00000000, 0x0000601f, 0x00000038, 0x0000007f },  // 18:34
+    { 0x00000fdb, 0x0000000f, 0x00000000, 0xc0000000, 0x00000000, 0x0000601f, 0x00000038, 0x0000007f },  // 18:35
+    { 0x00000fdb, 0x0000f000, 0x00000000, 0xc0000000, 0x00000000, 0x0000601f, 0x00000038, 0x0000007f },  // 18:36
+    { 0x00000fdb, 0x001f0000, 0x00000000, 0xc0000000, 0x00000000, 0x0000601f, 0x00000038, 0x0000007f },  // 18:37
+    { 0x00070fdb, 0x00000000, 0x00000000, 0xc0000000, 0x00000000, 0x0000601f, 0x00000038, 0x0000007f },  // 18:38
+    { 0x0000efdb, 0x00000000, 0x00000000, 0xc0000000, 0x00000000, 0x0000601f, 0x00000038, 0x0000007f },  // 18:39
+    { 0x00000fdb, 0x00000000, 0x00000000, 0xc0000000, 0x00000000, 0x0000601f, 0x00000038, 0x0000007f },  // 18:40
+    { 0x0000001b, 0x3fc00000, 0x00000000, 0xc0000000, 0x00000000, 0x0000601f, 0x00000038, 0x0000007f },  // 18:41
+    { 0x0000001b, 0x00000000, 0xff000000, 0xc0000000, 0x00000000, 0x0000601f, 0x00000038, 0x0000007f },  // 18:42
+    { 0x0000001b, 0x00000000, 0x00000000, 0xc00001ff, 0x00000000, 0x0000601f, 0x00000038, 0x0000007f },  // 18:43
+    { 0x0000001b, 0x00000000, 0x007f0000, 0xc0000000, 0x00000000, 0x0000601f, 0x00000038, 0x0000007f },  // 18:44
+    { 0x0000001b, 0x00000000, 0x00000000, 0xdfc20000, 0x00000000, 0x0000601f, 0x00000038, 0x0000007f },  // 18:45
+    { 0x0000001b, 0x00000000, 0x000000ff, 0xc0000000, 0x00000000, 0x0000601f, 0x00000038, 0x0000007f },  // 18:46
+    { 0xff00001b, 0x00000000, 0x00000000, 0xc0000000, 0x00000000, 0x0000601f, 0x00000038, 0x0000007f },  // 18:47
+    { 0x0000001b, 0x00000000, 0x00000000, 0xc000fc00, 0x00000000, 0x0000601f, 0x00000038, 0x0000007f },  // 18:48
+    { 0x0000001b, 0x000007e0, 0x00000000, 0xc0000000, 0x00000000, 0x0000601f, 0x00000038, 0x0000007f },  // 18:49
+    { 0x0070001b, 0x00000000, 0x00000000, 0xc0000000, 0x00000000, 0x0000601f, 0x00000038, 0x0000007f },  // 18:50
+    { 0x0000001b, 0x03c00000, 0x00000000, 0xc0000000, 0x00000000, 0x0000601f, 0x00000038, 0x0000007f },  // 18:51
+    { 0x0000001b, 0x00000000, 0x1f000000, 0xc0000000, 0x00000000, 0x0000601f, 0x00000038, 0x0000007f },  // 18:52
+    { 0x0000001b, 0x00000000, 0x00000000, 0xc000001f, 0x00000000, 0x0000601f, 0x00000038, 0x0000007f },  // 18:53
+    { 0x0000001b, 0x00000000, 0x00070000, 0xc0000000, 0x00000000, 0x0000601f, 0x00000038, 0x0000007f },  // 18:54
+    { 0x0000001b, 0x0000000f, 0x00000000, 0xc0000000, 0x00000000, 0x0000601f, 0x00000038, 0x0000007f },  // 18:55
+    { 0x0000001b, 0x0000f000, 0x00000000, 0xc0000000, 0x00000000, 0x0000601f, 0x00000038, 0x0000007f },  // 18:56
+    { 0x0000001b, 0x001f0000, 0x00000000, 0xc0000000, 0x00000000, 0x0000601f, 0x00000038, 0x0000007f },  // 18:57
+    { 0x0007001b, 0x00000000, 0x00000000, 0xc0000000, 0x00000000, 0x0000601f, 0x00000038, 0x0000007f },  // 18:58
+    { 0x0000e01b, 0x00000000, 0x00000000, 0xc0000000, 0x00000000, 0x0000601f, 0x00000038, 0x0000007f },  // 18:59
+    { 0x0000001b, 0x00000000, 0x00000000, 0x0000001f, 0x00000000, 0x00006000, 0x00000038, 0x0000007f },  // 19:00
+    { 0x0000e01b, 0x00000000, 0x00000000, 0x00000000, 0x0000000f, 0x0000601f, 0x00000038, 0x0000007f },  // 19:01
+    { 0x0007001b, 0x00000000, 0x00000000, 0x00000000, 0x0000000f, 0x0000601f, 0x00000038, 0x0000007f },  // 19:02
+    { 0x0000001b, 0x001f0000, 0x00000000, 0x00000000, 0x0000000f, 0x0000601f, 0x00000038, 0x0000007f },  // 19:03
+    { 0x0000001b, 0x0000f000, 0x00000000, 0x00000000, 0x0000000f, 0x0000601f, 0x00000038, 0x0000007f },  // 19:04
+    { 0x0000001b, 0x0000000f, 0x00000000, 0x00000000, 0x0000000f, 0x0000601f, 0x00000038, 0x0000007f },  // 19:05
+    { 0x0000001b, 0x00000000, 0x00070000, 0x00000000, 0x0000000f, 0x0000601f, 0x00000038, 0x0000007f },  // 19:06
+    { 0x0000001b, 0x00000000, 0x00000000, 0x0000001f, 0x0000000f, 0x0000601f, 0x00000038, 0x0000007f },  // 19:07
+    { 0x0000001b, 0x00000000, 0x1f000000, 0x00000000, 0x0000000f, 0x0000601f, 0x00000038, 0x0000007f },  // 19:08
+    { 0x0000001b, 0x03c00000, 0x00000000, 0x00000000, 0x0000000f, 0x0000601f, 0x00000038, 0x0000007f },  // 19:09
+    { 0x0070001b, 0x00000000, 0x00000000, 0x00000000, 0x0000000f, 0x0000601f, 0x00000038, 0x0000007f },  // 19:10
+    { 0x0000001b, 0x000007e0, 0x00000000, 0x00000000, 0x0000000f, 0x0000601f, 0x00000038, 0x0000007f },  // 19:11
+    { 0x0000001b, 0x00000000, 0x00000000, 0x0000fc00, 0x0000000f, 0x0000601f, 0x00000038, 0x0000007f },  // 19:12
+    { 0xff00001b, 0x00000000, 0x00000000, 0x00000000, 0x0000000f, 0x0000601f, 0x00000038, 0x0000007f },  // 19:13
+    { 0x0000001b, 0x00000000, 0x000000ff, 0x00000000, 0x0000000f, 0x0000601f, 0x00000038, 0x0000007f },  // 19:14
+    { 0x0000001b, 0x00000000, 0x00000000, 0x1fc20000, 0x0000000f, 0x0000601f, 0x00000038, 0x0000007f },  // 19:15
+    { 0x0000001b, 0x00000000, 0x007f0000, 0x00000000, 0x0000000f, 0x0000601f, 0x00000038, 0x0000007f },  // 19:16
+    { 0x0000001b, 0x00000000, 0x00000000, 0x000001ff, 0x0000000f, 0x0000601f, 0x00000038, 0x0000007f },  // 19:17
+    { 0x0000001b, 0x00000000, 0xff000000, 0x00000000, 0x0000000f, 0x0000601f, 0x00000038, 0x0000007f },  // 19:18
+    { 0x0000001b, 0x3fc00000, 0x00000000, 0x00000000, 0x0000000f, 0x0000601f, 0x00000038, 0x0000007f },  // 19:19
+    { 0x00000fdb, 0x00000000, 0x00000000, 0x00000000, 0x0000000f, 0x0000601f, 0x00000038, 0x0000007f },  // 19:20
+    { 0x0000efdb, 0x00000000, 0x00000000, 0x00000000, 0x0000000f, 0x0000601f, 0x00000038, 0x0000007f },  // 19:21
+    { 0x00070fdb, 0x00000000, 0x00000000, 0x00000000, 0x0000000f, 0x0000601f, 0x00000038, 0x0000007f },  // 19:22
+    { 0x00000fdb, 0x001f0000, 0x00000000, 0x00000000, 0x0000000f, 0x0000601f, 0x00000038, 0x0000007f },  // 19:23
+    { 0x00000fdb, 0x0000f000, 0x00000000, 0x00000000, 0x0000000f, 0x0000601f, 0x00000038, 0x0000007f },  // 19:24
+    { 0x00000fdb, 0x0000000f, 0x00000000, 0x00000000, 0x0000000f, 0x0000601f, 0x00000038, 0x0000007f },  // 19:25
+    { 0x00000fdb, 0x00000000, 0x00070000, 0x00000000, 0x0000000f, 0x0000601f, 0x00000038, 0x0000007f },  // 19:26
+    { 0x00000fdb, 0x00000000, 0x00000000, 0x0000001f, 0x0000000f, 0x0000601f, 0x00000038, 0x0000007f },  // 19:27
+    { 0x00000fdb, 0x00000000, 0x1f000000, 0x00000000, 0x0000000f, 0x0000601f, 0x00000038, 0x0000007f },  // 19:28
+    { 0x00000fdb, 0x03c00000, 0x00000000, 0x00000000, 0x0000000f, 0x0000601f, 0x00000038, 0x0000007f },  // 19:29
+    { 0x0000001b, 0x00000000, 0x00000000, 0x000f0000, 0x0000000f, 0x0000601f, 0x00000038, 0x0000007f },  // 19:30
+    { 0x00000fdb, 0x03c00000, 0x00000000, 0xc0000000, 0x00000000, 0x000067c0, 0x00000038, 0x0000007f },  // 19:31
+    { 0x00000fdb, 0x00000000, 0x1f000000, 0xc0000000, 0x00000000, 0x000067c0, 0x00000038, 0x0000007f },  // 19:32
+    { 0x00000fdb, 0x00000000, 0x00000000, 0xc000001f, 0x00000000, 0x000067c0, 0x00000038, 0x0000007f },  // 19:33
+    { 0x00000fdb, 0x00000000, 0x00070000, 0xc0000000, 0x00000000, 0x000067c0, 0x00000038, 0x0000007f },  // 19:34
+    { 0x00000fdb, 0x0000000f, 0x00000000, 0xc0000000, 0x00000000, 0x000067c0, 0x00000038, 0x0000007f },  // 19:35
+    { 0x00000fdb, 0x0000f000, 0x00000000, 0xc0000000, 0x00000000, 0x000067c0, 0x00000038, 0x0000007f },  // 19:36
+    { 0x00000fdb, 0x001f0000, 0x00000000, 0xc0000000, 0x00000000, 0x000067c0, 0x00000038, 0x0000007f },  // 19:37
+    { 0x00070fdb, 0x00000000, 0x00000000, 0xc0000000, 0x00000000, 0x000067c0, 0x00000038, 0x0000007f },  // 19:38
+    { 0x0000efdb, 0x00000000, 0x00000000, 0xc0000000, 0x00000000, 0x000067c0, 0x00000038, 0x0000007f },  // 19:39
+    { 0x00000fdb, 0x00000000, 0x00000000, 0xc0000000, 0x00000000, 0x000067c0, 0x00000038, 0x0000007f },  // 19:40
+    { 0x0000001b, 0x3fc00000, 0x00000000, 0xc0000000, 0x00000000, 0x000067c0, 0x00000038, 0x0000007f },  // 19:41
+    { 0x0000001b, 0x00000000, 0xff000000, 0xc0000000, 0x00000000, 0x000067c0, 0x00000038, 0x0000007f },  // 19:42
+    { 0x0000001b, 0x00000000, 0x00000000, 0xc00001ff, 0x00000000, 0x000067c0, 0x00000038, 0x0000007f },  // 19:43
+    { 0x0000001b, 0x00000000, 0x007f0000, 0xc0000000, 0x00000000, 0x000067c0, 0x00000038, 0x0000007f },  // 19:44
+    { 0x0000001b, 0x00000000, 0x00000000, 0xdfc20000, 0x00000000, 0x000067c0, 0x00000038, 0x0000007f },  // 19:45
+    { 0x0000001b, 0x00000000, 0x000000ff, 0xc0000000, 0x00000000, 0x000067c0, 0x00000038, 0x0000007f },  // 19:46
+    { 0xff00001b, 0x00000000, 0x00000000, 0xc0000000, 0x00000000, 0x000067c0, 0x00000038, 0x0000007f },  // 19:47
+    { 0x0000001b, 0x00000000, 0x00000000, 0xc000fc00, 0x00000000, 0x000067c0, 0x00000038, 0x0000007f },  // 19:48
+    { 0x0000001b, 0x000007e0, 0x00000000, 0xc0000000, 0x00000000, 0x000067c0, 0x00000038, 0x0000007f },  // 19:49
+    { 0x0070001b, 0x00000000, 0x00000000, 0xc0000000, 0x00000000, 0x000067c0, 0x00000038, 0x0000007f },  // 19:50
+    { 0x0000001b, 0x03c00000, 0x00000000, 0xc0000000, 0x00000000, 0x000067c0, 0x00000038, 0x0000007f },  // 19:51
+    { 0x0000001b, 0x00000000, 0x1f000000, 0xc0000000, 0x00000000, 0x000067c0, 0x00000038, 0x0000007f },  // 19:52
+    { 0x0000001b, 0x00000000, 0x00000000, 0xc000001f, 0x00000000, 0x000067c0, 0x00000038, 0x0000007f },  // 19:53
+    { 0x0000001b, 0x00000000, 0x00070000, 0xc0000000, 0x00000000, 0x000067c0, 0x00000038, 0x0000007f },  // 19:54
+    { 0x0000001b, 0x0000000f, 0x00000000, 0xc0000000, 0x00000000, 0x000067c0, 0x00000038, 0x0000007f },  // 19:55
+    { 0x0000001b, 0x0000f000, 0x00000000, 0xc0000000, 0x00000000, 0x000067c0, 0x00000038, 0x0000007f },  // 19:56
+    { 0x0000001b, 0x001f0000, 0x00000000, 0xc0000000, 0x00000000, 0x000067c0, 0x00000038, 0x0000007f },  // 19:57
+    { 0x0007001b, 0x00000000, 0x00000000, 0xc0000000, 0x00000000, 0x000067c0, 0x00000038, 0x0000007f },  // 19:58
+    { 0x0000e01b, 0x00000000, 0x00000000, 0xc0000000, 0x00000000, 0x000067c0, 0x00000038, 0x0000007f },  // 19:59
+    { 0x0000001b, 0x00000000, 0x1f000000, 0x00000000, 0x00000000, 0x00006000, 0x00000038, 0x0000007f },  // 20:00
+    { 0x0000e01b, 0x00000000, 0x00000000, 0x00000000, 0x0000000f, 0x000067c0, 0x00000038, 0x0000007f },  // 20:01
+    { 0x0007001b, 0x00000000, 0x00000000, 0x00000000, 0x0000000f, 0x000067c0, 0x00000038, 0x0000007f },  // 20:02
+    { 0x0000001b, 0x001f0000, 0x00000000, 0x00000000, 0x0000000f, 0x000067c0, 0x00000038, 0x0000007f },  // 20:03
+    { 0x0000001b, 0x0000f000, 0x00000000, 0x00000000, 0x0000000f, 0x000067c0, 0x00000038, 0x0000007f },  // 20:04
+    { 0x0000001b, 0x0000000f, 0x00000000, 0x00000000, 0x0000000f, 0x000067c0, 0x00000038, 0x0000007f },  // 20:05
+    { 0x0000001b, 0x00000000, 0x00070000, 0x00000000, 0x0000000f, 0x000067c0, 0x00000038, 0x0000007f },  // 20:06
+    { 0x0000001b, 0x00000000, 0x00000000, 0x0000001f, 0x0000000f, 0x000067c0, 0x00000038, 0x0000007f },  // 20:07
+    { 0x0000001b, 0x00000000, 0x1f000000, 0x00000000, 0x0000000f, 0x000067c0, 0x00000038, 0x0000007f },  // 20:08
+    { 0x0000001b, 0x03c00000, 0x00000000, 0x00000000, 0x0000000f, 0x000067c0, 0x00000038, 0x0000007f },  // 20:09
+    { 0x0070001b, 0x00000000, 0x00000000, 0x00000000, 0x0000000f, 0x000067c0, 0x00000038, 0x0000007f },  // 20:10
+    { 0x0000001b, 0x000007e0, 0x00000000, 0x00000000, 0x0000000f, 0x000067c0, 0x00000038, 0x0000007f },  // 20:11
+    { 0x0000001b, 0x00000000, 0x00000000, 0x0000fc00, 0x0000000f, 0x000067c0, 0x00000038, 0x0000007f },  // 20:12
+    { 0xff00001b, 0x00000000, 0x00000000, 0x00000000, 0x0000000f, 0x000067c0, 0x00000038, 0x0000007f },  // 20:13
+    { 0x0000001b, 0x00000000, 0x000000ff, 0x00000000, 0x0000000f, 0x000067c0, 0x00000038, 0x0000007f },  // 20:14
+    { 0x0000001b, 0x00000000, 0x00000000, 0x1fc20000, 0x0000000f, 0x000067c0, 0x00000038, 0x0000007f },  // 20:15
+    { 0x0000001b, 0x00000000, 0x007f0000, 0x00000000, 0x0000000f, 0x000067c0, 0x00000038, 0x0000007f },  // 20:16
+    { 0x0000001b, 0x00000000, 0x00000000, 0x000001ff, 0x0000000f, 0x000067c0, 0x00000038, 0x0000007f },  // 20:17
+    { 0x0000001b, 0x00000000, 0xff000000, 0x00000000, 0x0000000f, 0x000067c0, 0x00000038, 0x0000007f },  // 20:18
+    { 0x0000001b, 0x3fc00000, 0x00000000, 0x00000000, 0x0000000f, 0x000067c0, 0x00000038, 0x0000007f },  // 20:19
+    { 0x00000fdb, 0x00000000, 0x00000000, 0x00000000, 0x0000000f, 0x000067c0, 0x00000038, 0x0000007f },  // 20:20
+    { 0x0000efdb, 0x00000000, 0x00000000, 0x00000000, 0x0000000f, 0x000067c0, 0x00000038, 0x0000007f },  // 20:21
+    { 0x00070fdb, 0x00000000, 0x00000000, 0x00000000, 0x0000000f, 0x000067c0, 0x00000038, 0x0000007f },  // 20:22
+    { 0x00000fdb, 0x001f0000, 0x00000000, 0x00000000, 0x0000000f, 0x000067c0, 0x00000038, 0x0000007f },  // 20:23
+    { 0x00000fdb, 0x0000f000, 0x00000000, 0x00000000, 0x0000000f, 0x000067c0, 0x00000038, 0x0000007f },  // 20:24
+    { 0x00000fdb, 0x0000000f, 0x00000000, 0x00000000, 0x0000000f, 0x000067c0, 0x00000038, 0x0000007f },  // 20:25
+    { 0x00000fdb, 0x00000000, 0x00070000, 0x00000000, 0x0000000f, 0x000067c0, 0x00000038, 0x0000007f },  // 20:26
+    { 0x00000fdb, 0x00000000, 0x00000000, 0x0000001f, 0x0000000f, 0x000067c0, 0x00000038, 0x0000007f },  // 20:27
+    { 0x00000fdb, 0x00000000, 0x1f000000, 0x00000000, 0x0000000f, 0x000067c0, 0x00000038, 0x0000007f },  // 20:28
+    { 0x00000fdb, 0x03c00000, 0x00000000, 0x00000000, 0x0000000f, 0x000067c0, 0x00000038, 0x0000007f },  // 20:29
+    { 0x0000001b, 0x00000000, 0x00000000, 0x000f0000, 0x0000000f, 0x000067c0, 0x00000038, 0x0000007f },  // 20:30
+    { 0x00000fdb, 0x03c00000, 0x00000000, 0xc0000000, 0x00000000, 0x0000f000, 0xfb000000, 0x00000000 },  // 20:31
+    { 0x00000fdb, 0x00000000, 0x1f000000, 0xc0000000, 0x00000000, 0x0000f000, 0xfb000000, 0x00000000 },  // 20:32
+    { 0x00000fdb, 0x00000000, 0x00000000, 0xc000001f, 0x00000000, 0x0000f000, 0xfb000000, 0x00000000 },  // 20:33
+    { 0x00000fdb, 0x00000000, 0x00070000, 0xc0000000, 0x00000000, 0x0000f000, 0xfb000000, 0x00000000 },  // 20:34
+    { 0x00000fdb, 0x0000000f, 0x00000000, 0xc0000000, 0x00000000, 0x0000f000, 0xfb000000, 0x00000000 },  // 20:35
+    { 0x00000fdb, 0x0000f000, 0x00000000, 0xc0000000, 0x00000000, 0x0000f000, 0xfb000000, 0x00000000 },  // 20:36
+    { 0x00000fdb, 0x001f0000, 0x00000000, 0xc0000000, 0x00000000, 0x0000f000, 0xfb000000, 0x00000000 },  // 20:37
+    { 0x00070fdb, 0x00000000, 0x00000000, 0xc0000000, 0x00000000, 0x0000f000, 0xfb000000, 0x00000000 },  // 20:38
+    { 0x0000efdb, 0x00000000, 0x00000000, 0xc0000000, 0x00000000, 0x0000f000, 0xfb000000, 0x00000000 },  // 20:39
+    { 0x00000fdb, 0x00000000, 0x00000000, 0xc0000000, 0x00000000, 0x0000f000, 0xfb000000, 0x00000000 },  // 20:40
+    { 0x0000001b, 0x3fc00000, 0x00000000, 0xc0000000, 0x00000000, 0x0000f000, 0xfb000000, 0x00000000 },  // 20:41
+    { 0x0000001b, 0x00000000, 0xff000000, 0xc0000000, 0x00000000, 0x0000f000, 0xfb000000, 0x00000000 },  // 20:42
+    { 0x0000001b, 0x00000000, 0x00000000, 0xc00001ff, 0x00000000, 0x0000f000, 0xfb000000, 0x00000000 },  // 20:43
+    { 0x0000001b, 0x00000000, 0x007f0000, 0xc0000000, 0x00000000, 0x0000f000, 0xfb000000, 0x00000000 },  // 20:44
+    { 0x0000001b, 0x00000000, 0x00000000, 0xdfc20000, 0x00000000, 0x0000f000, 0xfb000000, 0x00000000 },  // 20:45
+    { 0x0000001b, 0x00000000, 0x000000ff, 0xc0000000, 0x00000000, 0x0000f000, 0xfb000000, 0x00000000 },  // 20:46
+    { 0xff00001b, 0x00000000, 0x00000000, 0xc0000000, 0x00000000, 0x0000f000, 0xfb000000, 0x00000000 },  // 20:47
+    { 0x0000001b, 0x00000000, 0x00000000, 0xc000fc00, 0x00000000, 0x0000f000, 0xfb000000, 0x00000000 },  // 20:48
+    { 0x0000001b, 0x000007e0, 0x00000000, 0xc0000000, 0x00000000, 0x0000f000, 0xfb000000, 0x00000000 },  // 20:49
+    { 0x0070001b, 0x00000000, 0x00000000, 0xc0000000, 0x00000000, 0x0000f000, 0xfb000000, 0x00000000 },  // 20:50
+    { 0x0000001b, 0x03c00000, 0x00000000, 0xc0000000, 0x00000000, 0x0000f000, 0xfb000000, 0x00000000 },  // 20:51
+    { 0x0000001b, 0x00000000, 0x1f000000, 0xc0000000, 0x00000000, 0x0000f000, 0xfb000000, 0x00000000 },  // 20:52
+    { 0x0000001b, 0x00000000, 0x00000000, 0xc000001f, 0x00000000, 0x0000f000, 0xfb000000, 0x00000000 },  // 20:53
+    { 0x0000001b, 0x00000000, 0x00070000, 0xc0000000, 0x00000000, 0x0000f000, 0xfb000000, 0x00000000 },  // 20:54
+    { 0x0000001b, 0x0000000f, 0x00000000, 0xc0000000, 0x00000000, 0x0000f000, 0xfb000000, 0x00000000 },  // 20:55
+    { 0x0000001b, 0x0000f000, 0x00000000, 0xc0000000, 0x00000000, 0x0000f000, 0xfb000000, 0x00000000 },  // 20:56
+    { 0x0000001b, 0x001f0000, 0x00000000, 0xc0000000, 0x00000000, 0x0000f000, 0xfb000000, 0x00000000 },  // 20:57
+    { 0x0007001b, 0x00000000, 0x00000000, 0xc0000000, 0x00000000, 0x0000f000, 0xfb000000, 0x00000000 },  // 20:58
+    { 0x0000e01b, 0x00000000, 0x00000000, 0xc0000000, 0x00000000, 0x0000f000, 0xfb000000, 0x00000000 },  // 20:59
+    { 0x0000001b, 0x03c00000, 0x00000000, 0x00000000, 0x00000600, 0x00000000, 0xf8000000, 0x00000000 },  // 21:00
+    { 0x0000e01b, 0x00000000, 0x00000000, 0x00000000, 0x0000000f, 0x0000f000, 0xfb000000, 0x00000000 },  // 21:01
+    { 0x0007001b, 0x00000000, 0x00000000, 0x00000000, 0x0000000f, 0x0000f000, 0xfb000000, 0x00000000 },  // 21:02
+    { 0x0000001b, 0x001f0000, 0x00000000, 0x00000000, 0x0000000f, 0x0000f000, 0xfb000000, 0x00000000 },  // 21:03
+    { 0x0000001b, 0x0000f000, 0x00000000, 0x00000000, 0x0000000f, 0x0000f000, 0xfb000000, 0x00000000 },  // 21:04
+    { 0x0000001b, 0x0000000f, 0x00000000, 0x00000000, 0x0000000f, 0x0000f000, 0xfb000000, 0x00000000 },  // 21:05
+    { 0x0000001b, 0x00000000, 0x00070000, 0x00000000, 0x0000000f, 0x0000f000, 0xfb000000, 0x00000000 },  // 21:06
+    { 0x0000001b, 0x00000000, 0x00000000, 0x0000001f, 0x0000000f, 0x0000f000, 0xfb000000, 0x00000000 },  // 21:07
+    { 0x0000001b, 0x00000000, 0x1f000000, 0x00000000, 0x0000000f, 0x0000f000, 0xfb000000, 0x00000000 },  // 21:08
+    { 0x0000001b, 0x03c00000, 0x00000000, 0x00000000, 0x0000000f, 0x0000f000, 0xfb000000, 0x00000000 },  // 21:09
+    { 0x0070001b, 0x00000000, 0x00000000, 0x00000000, 0x0000000f, 0x0000f000, 0xfb000000, 0x00000000 },  // 21:10
+    { 0x0000001b, 0x000007e0, 0x00000000, 0x00000000, 0x0000000f, 0x0000f000, 0xfb000000, 0x00000000 },  // 21:11
+    { 0x0000001b, 0x00000000, 0x00000000, 0x0000fc00, 0x0000000f, 0x0000f000, 0xfb000000, 0x00000000 },  // 21:12
+    { 0xff00001b, 0x00000000, 0x00000000, 0x00000000, 0x0000000f, 0x0000f000, 0xfb000000, 0x00000000 },  // 21:13
+    { 0x0000001b, 0x00000000, 0x000000ff, 0x00000000, 0x0000000f, 0x0000f000, 0xfb000000, 0x00000000 },  // 21:14
+    { 0x0000001b, 0x00000000, 0x00000000, 0x1fc20000, 0x0000000f, 0x0000f000, 0xfb000000, 0x00000000 },  // 21:15
+    { 0x0000001b, 0x00000000, 0x007f0000, 0x00000000, 0x0000000f, 0x0000f000, 0xfb000000, 0x00000000 },  // 21:16
+    { 0x0000001b, 0x00000000, 0x00000000, 0x000001ff, 0x0000000f, 0x0000f000, 0xfb000000, 0x00000000 },  // 21:17
+    { 0x0000001b, 0x00000000, 0xff000000, 0x00000000, 0x0000000f, 0x0000f000, 0xfb000000, 0x00000000 },  // 21:18
+    { 0x0000001b, 0x3fc00000, 0x00000000, 0x00000000, 0x0000000f, 0x0000f000, 0xfb000000, 0x00000000 },  // 21:19
+    { 0x00000fdb, 0x00000000, 0x00000000, 0x00000000, 0x0000000f, 0x0000f000, 0xfb000000, 0x00000000 },  // 21:20
+    { 0x0000efdb, 0x00000000, 0x00000000, 0x00000000, 0x0000000f, 0x0000f000, 0xfb000000, 0x00000000 },  // 21:21
+    { 0x00070fdb, 0x00000000, 0x00000000, 0x00000000, 0x0000000f, 0x0000f000, 0xfb000000, 0x00000000 },  // 21:22
+    { 0x00000fdb, 0x001f0000, 0x00000000, 0x00000000, 0x0000000f, 0x0000f000, 0xfb000000, 0x00000000 },  // 21:23
+    { 0x00000fdb, 0x0000f000, 0x00000000, 0x00000000, 0x0000000f, 0x0000f000, 0xfb000000, 0x00000000 },  // 21:24
+    { 0x00000fdb, 0x0000000f, 0x00000000, 0x00000000, 0x0000000f, 0x0000f000, 0xfb000000, 0x00000000 },  // 21:25
+    { 0x00000fdb, 0x00000000, 0x00070000, 0x00000000, 0x0000000f, 0x0000f000, 0xfb000000, 0x00000000 },  // 21:26
+    { 0x00000fdb, 0x00000000, 0x00000000, 0x0000001f, 0x0000000f, 0x0000f000, 0xfb000000, 0x00000000 },  // 21:27
+    { 0x00000fdb, 0x00000000, 0x1f000000, 0x00000000, 0x0000000f, 0x0000f000, 0xfb000000, 0x00000000 },  // 21:28
+    { 0x00000fdb, 0x03c00000, 0x00000000, 0x00000000, 0x0000000f, 0x0000f000, 0xfb000000, 0x00000000 },  // 21:29
+    { 0x0000001b, 0x00000000, 0x00000000, 0x000f0000, 0x0000000f, 0x0000f000, 0xfb000000, 0x00000000 },  // 21:30
+    { 0x00000fdb, 0x03c00000, 0x00000000, 0xc0000000, 0x00000000, 0x00001c00, 0xfb000000, 0x00000000 },  // 21:31
+    { 0x00000fdb, 0x00000000, 0x1f000000, 0xc0000000, 0x00000000, 0x00001c00, 0xfb000000, 0x00000000 },  // 21:32
+    { 0x00000fdb, 0x00000000, 0x00000000, 0xc000001f, 0x00000000, 0x00001c00, 0xfb000000, 0x00000000 },  // 21:33
+    { 0x00000fdb, 0x00000000, 0x00070000, 0xc0000000, 0x00000000, 0x00001c00, 0xfb000000, 0x00000000 },  // 21:34
+    { 0x00000fdb, 0x0000000f, 0x00000000, 0xc0000000, 0x00000000, 0x00001c00, 0xfb000000, 0x00000000 },  // 21:35
+    { 0x00000fdb, 0x0000f000, 0x00000000, 0xc0000000, 0x00000000, 0x00001c00, 0xfb000000, 0x00000000 },  // 21:36
+    { 0x00000fdb, 0x001f0000, 0x00000000, 0xc0000000, 0x00000000, 0x00001c00, 0xfb000000, 0x00000000 },  // 21:37
+    { 0x00070fdb, 0x00000000, 0x00000000, 0xc0000000, 0x00000000, 0x00001c00, 0xfb000000, 0x00000000 },  // 21:38
+    { 0x0000efdb, 0x00000000, 0x00000000, 0xc0000000, 0x00000000, 0x00001c00, 0xfb000000, 0x00000000 },  // 21:39
+    { 0x00000fdb, 0x00000000, 0x00000000, 0xc0000000, 0x00000000, 0x00001c00, 0xfb000000, 0x00000000 },  // 21:40
+    { 0x0000001b, 0x3fc00000, 0x00000000, 0xc0000000, 0x00000000, 0x00001c00, 0xfb000000, 0x00000000 },  // 21:41
+    { 0x0000001b, 0x00000000, 0xff000000, 0xc0000000, 0x00000000, 0x00001c00, 0xfb000000, 0x00000000 },  // 21:42
+    { 0x0000001b, 0x00000000, 0x00000000, 0xc00001ff, 0x00000000, 0x00001c00, 0xfb000000, 0x00000000 },  // 21:43
+    { 0x0000001b, 0x00000000, 0x007f0000, 0xc0000000, 0x00000000, 0x00001c00, 0xfb000000, 0x00000000 },  // 21:44
+    { 0x0000001b, 0x00000000, 0x00000000, 0xdfc20000, 0x00000000, 0x00001c00, 0xfb000000, 0x00000000 },  // 21:45
+    { 0x0000001b, 0x00000000, 0x000000ff, 0xc0000000, 0x00000000, 0x00001c00, 0xfb000000, 0x00000000 },  // 21:46
+    { 0xff00001b, 0x00000000, 0x00000000, 0xc0000000, 0x00000000, 0x00001c00, 0xfb000000, 0x00000000 },  // 21:47
+    { 0x0000001b, 0x00000000, 0x00000000, 0xc000fc00, 0x00000000, 0x00001c00, 0xfb000000, 0x00000000 },  // 21:48
+    { 0x0000001b, 0x000007e0, 0x00000000, 0xc0000000, 0x00000000, 0x00001c00, 0xfb000000, 0x00000000 },  // 21:49
+    { 0x0070001b, 0x00000000, 0x00000000, 0xc0000000, 0x00000000, 0x00001c00, 0xfb000000, 0x00000000 },  // 21:50
+    { 0x0000001b, 0x03c00000, 0x00000000, 0xc0000000, 0x00000000, 0x00001c00, 0xfb000000, 0x00000000 },  // 21:51
+    { 0x0000001b, 0x00000000, 0x1f000000, 0xc0000000, 0x00000000, 0x00001c00, 0xfb000000, 0x00000000 },  // 21:52
+    { 0x0000001b, 0x00000000, 0x00000000, 0xc000001f, 0x00000000, 0x00001c00, 0xfb000000, 0x00000000 },  // 21:53
+    { 0x0000001b, 0x00000000, 0x00070000, 0xc0000000, 0x00000000, 0x00001c00, 0xfb000000, 0x00000000 },  // 21:54
+    { 0x0000001b, 0x0000000f, 0x00000000, 0xc0000000, 0x00000000, 0x00001c00, 0xfb000000, 0x00000000 },  // 21:55
+    { 0x0000001b, 0x0000f000, 0x00000000, 0xc0000000, 0x00000000, 0x00001c00, 0xfb000000, 0x00000000 },  // 21:56
+    { 0x0000001b, 0x001f0000, 0x00000000, 0xc0000000, 0x00000000, 0x00001c00, 0xfb000000, 0x00000000 },  // 21:57
+    { 0x0007001b, 0x00000000, 0x00000000, 0xc0000000, 0x00000000, 0x00001c00, 0xfb000000, 0x00000000 },  // 21:58
+    { 0x0000e01b, 0x00000000, 0x00000000, 0xc0000000, 0x00000000, 0x00001c00, 0xfb000000, 0x00000000 },  // 21:59
+    { 0x0070001b, 0x00000000, 0x00000000, 0x00000000, 0x00000600, 0x00000000, 0xf8000000, 0x00000000 },  // 22:00
+    { 0x0000e01b, 0x00000000, 0x00000000, 0x00000000, 0x0000000f, 0x00001c00, 0xfb000000, 0x00000000 },  // 22:01
+    { 0x0007001b, 0x00000000, 0x00000000, 0x00000000, 0x0000000f, 0x00001c00, 0xfb000000, 0x00000000 },  // 22:02
+    { 0x0000001b, 0x001f0000, 0x00000000, 0x00000000, 0x0000000f, 0x00001c00, 0xfb000000, 0x00000000 },  // 22:03
+    { 0x0000001b, 0x0000f000, 0x00000000, 0x00000000, 0x0000000f, 0x00001c00, 0xfb000000, 0x00000000 },  // 22:04
+    { 0x0000001b, 0x0000000f, 0x00000000, 0x00000000, 0x0000000f, 0x00001c00, 0xfb000000, 0x00000000 },  // 22:05
+    { 0x0000001b, 0x00000000, 0x00070000, 0x00000000, 0x0000000f, 0x00001c00, 0xfb000000, 0x00000000 },  // 22:06
+    { 0x0000001b, 0x00000000, 0x00000000, 0x0000001f, 0x0000000f, 0x00001c00, 0xfb000000, 0x00000000 },  // 22:07
+    { 0x0000001b, 0x00000000, 0x1f000000, 0x00000000, 0x0000000f, 0x00001c00, 0xfb000000, 0x00000000 },  // 22:08
+    { 0x0000001b, 0x03c00000, 0x00000000, 0x00000000, 0x0000000f, 0x00001c00, 0xfb000000, 0x00000000 },  // 22:09
+    { 0x0070001b, 0x00000000, 0x00000000, 0x00000000, 0x0000000f, 0x00001c00, 0xfb000000, 0x00000000 },  // 22:10
+    { 0x0000001b, 0x000007e0, 0x00000000, 0x00000000, 0x0000000f, 0x00001c00, 0xfb000000, 0x00000000 },  // 22:11
+    { 0x0000001b, 0x00000000, 0x00000000, 0x0000fc00, 0x0000000f, 0x00001c00, 0xfb000000, 0x00000000 },  // 22:12
+    { 0xff00001b, 0x00000000, 0x00000000, 0x00000000, 0x0000000f, 0x00001c00, 0xfb000000, 0x00000000 },  // 22:13
+    { 0x0000001b, 0x00000000, 0x000000ff, 0x00000000, 0x0000000f, 0x00001c00, 0xfb000000, 0x00000000 },  // 22:14
+    { 0x0000001b, 0x00000000, 0x00000000, 0x1fc20000, 0x0000000f, 0x00001c00, 0xfb000000, 0x00000000 },  // 22:15
+    { 0x0000001b, 0x00000000, 0x007f0000, 0x00000000, 0x0000000f, 0x00001c00, 0xfb000000, 0x00000000 },  // 22:16
+    { 0x0000001b, 0x00000000, 0x00000000, 0x000001ff, 0x0000000f, 0x00001c00, 0xfb000000, 0x00000000 },  // 22:17
+    { 0x0000001b, 0x00000000, 0xff000000, 0x00000000, 0x0000000f, 0x00001c00, 0xfb000000, 0x00000000 },  // 22:18
+    { 0x0000001b, 0x3fc00000, 0x00000000, 0x00000000, 0x0000000f, 0x00001c00, 0xfb000000, 0x00000000 },  // 22:19
+    { 0x00000fdb, 0x00000000, 0x00000000, 0x00000000, 0x0000000f, 0x00001c00, 0xfb000000, 0x00000000 },  // 22:20
+    { 0x0000efdb, 0x00000000, 0x00000000, 0x00000000, 0x0000000f, 0x00001c00, 0xfb000000, 0x00000000 },  // 22:21
+    { 0x00070fdb, 0x00000000, 0x00000000, 0x00000000, 0x0000000f, 0x00001c00, 0xfb000000, 0x00000000 },  // 22:22
+    { 0x00000fdb, 0x001f0000, 0x00000000, 0x00000000, 0x0000000f, 0x00001c00, 0xfb000000, 0x00000000 },  // 22:23
+    { 0x00000fdb, 0x0000f000, 0x00000000, 0x00000000, 0x0000000f, 0x00001c00, 0xfb000000, 0x00000000 },  // 22:24
+    { 0x00000fdb, 0x0000000f, 0x00000000, 0x00000000, 0x0000000f, 0x00001c00, 0xfb000000, 0x00000000 },  // 22:25
+    { 0x00000fdb, 0x00000000, 0x00070000, 0x00000000, 0x0000000f, 0x00001c00, 0xfb000000, 0x00000000 },  // 22:26
+    { 0x00000fdb, 0x00000000, 0x00000000, 0x0000001f, 0x0000000f, 0x00001c00, 0xfb000000, 0x00000000 },  // 22:27
+    { 0x00000fdb, 0x00000000, 0x1f000000, 0x00000000, 0x0000000f, 0x00001c00, 0xfb000000, 0x00000000 },  // 22:28
+    { 0x00000fdb, 0x03c00000, 0x00000000, 0x00000000, 0x0000000f, 0x00001c00, 0xfb000000, 0x00000000 },  // 22:29
+    { 0x0000001b, 0x00000000, 0x00000000, 0x000f0000, 0x0000000f, 0x00001c00, 0xfb000000, 0x00000000 },  // 22:30
+    { 0x00000fdb, 0x03c00000, 0x00000000, 0xc0000000, 0x00000000, 0xfc000000, 0xfb000000, 0x00000000 },  // 22:31
+    { 0x00000fdb, 0x00000000, 0x1f000000, 0xc0000000, 0x00000000, 0xfc000000, 0xfb000000, 0x00000000 },  // 22:32
+    { 0x00000fdb, 0x00000000, 0x00000000, 0xc000001f, 0x00000000, 0xfc000000, 0xfb000000, 0x00000000 },  // 22:33
+    { 0x00000fdb, 0x00000000, 0x00070000, 0xc0000000, 0x00000000, 0xfc000000, 0xfb000000, 0x00000000 },  // 22:34
+    { 0x00000fdb, 0x0000000f, 0x00000000, 0xc0000000, 0x00000000, 0xfc000000, 0xfb000000, 0x00000000 },  // 22:35
+    { 0x00000fdb, 0x0000f000, 0x00000000, 0xc0000000, 0x00000000, 0xfc000000, 0xfb000000, 0x00000000 },  // 22:36
+    { 0x00000fdb, 0x001f0000, 0x00000000, 0xc0000000, 0x00000000, 0xfc000000, 0xfb000000, 0x00000000 },  // 22:37
+    { 0x00070fdb, 0x00000000, 0x00000000, 0xc0000000, 0x00000000, 0xfc000000, 0xfb000000, 0x00000000 },  // 22:38
+    { 0x0000efdb, 0x00000000, 0x00000000, 0xc0000000, 0x00000000, 0xfc000000, 0xfb000000, 0x00000000 },  // 22:39
+    { 0x00000fdb, 0x00000000, 0x00000000, 0xc0000000, 0x00000000, 0xfc000000, 0xfb000000, 0x00000000 },  // 22:40
+    { 0x0000001b, 0x3fc00000, 0x00000000, 0xc0000000, 0x00000000, 0xfc000000, 0xfb000000, 0x00000000 },  // 22:41
+    { 0x0000001b, 0x00000000, 0xff000000, 0xc0000000, 0x00000000, 0xfc000000, 0xfb000000, 0x00000000 },  // 22:42
+    { 0x0000001b, 0x00000000, 0x00000000, 0xc00001ff, 0x00000000, 0xfc000000, 0xfb000000, 0x00000000 },  // 22:43
+    { 0x0000001b, 0x00000000, 0x007f0000, 0xc0000000, 0x00000000, 0xfc000000, 0xfb000000, 0x00000000 },  // 22:44
+    { 0x0000001b, 0x00000000, 0x00000000, 0xdfc20000, 0x00000000, 0xfc000000, 0xfb000000, 0x00000000 },  // 22:45
+    { 0x0000001b, 0x00000000, 0x000000ff, 0xc0000000, 0x00000000, 0xfc000000, 0xfb000000, 0x00000000 },  // 22:46
+    { 0xff00001b, 0x00000000, 0x00000000, 0xc0000000, 0x00000000, 0xfc000000, 0xfb000000, 0x00000000 },  // 22:47
+    { 0x0000001b, 0x00000000, 0x00000000, 0xc000fc00, 0x00000000, 0xfc000000, 0xfb000000, 0x00000000 },  // 22:48
+    { 0x0000001b, 0x000007e0, 0x00000000, 0xc0000000, 0x00000000, 0xfc000000, 0xfb000000, 0x00000000 },  // 22:49
+    { 0x0070001b, 0x00000000, 0x00000000, 0xc0000000, 0x00000000, 0xfc000000, 0xfb000000, 0x00000000 },  // 22:50
+    { 0x0000001b, 0x03c00000, 0x00000000, 0xc0000000, 0x00000000, 0xfc000000, 0xfb000000, 0x00000000 },  // 22:51
+    { 0x0000001b, 0x00000000, 0x1f000000, 0xc0000000, 0x00000000, 0xfc000000, 0xfb000000, 0x00000000 },  // 22:52
+    { 0x0000001b, 0x00000000, 0x00000000, 0xc000001f, 0x00000000, 0xfc000000, 0xfb000000, 0x00000000 },  // 22:53
+    { 0x0000001b, 0x00000000, 0x00070000, 0xc0000000, 0x00000000, 0xfc000000, 0xfb000000, 0x00000000 },  // 22:54
+    { 0x0000001b, 0x0000000f, 0x00000000, 0xc0000000, 0x00000000, 0xfc000000, 0xfb000000, 0x00000000 },  // 22:55
+    { 0x0000001b, 0x0000f000, 0x00000000, 0xc0000000, 0x00000000, 0xfc000000, 0xfb000000, 0x00000000 },  // 22:56
+    { 0x0000001b, 0x001f0000, 0x00000000, 0xc0000000, 0x00000000, 0xfc000000, 0xfb000000, 0x00000000 },  // 22:57
+    { 0x0007001b, 0x00000000, 0x00000000, 0xc0000000, 0x00000000, 0xfc000000, 0xfb000000, 0x00000000 },  // 22:58
+    { 0x0000e01b, 0x00000000, 0x00000000, 0xc0000000, 0x00000000, 0xfc000000, 0xfb000000, 0x00000000 },  // 22:59
+    { 0x0000001b, 0x000007e0, 0x00000000, 0x00000000, 0x00000600, 0x00000000, 0xf8000000, 0x00000000 },  // 23:00
+    { 0x0000e01b, 0x00000000, 0x00000000, 0x00000000, 0x0000000f, 0xfc000000, 0xfb000000, 0x00000000 },  // 23:01
+    { 0x0007001b, 0x00000000, 0x00000000, 0x00000000, 0x0000000f, 0xfc000000, 0xfb000000, 0x00000000 },  // 23:02
+    { 0x0000001b, 0x001f0000, 0x00000000, 0x00000000, 0x0000000f, 0xfc000000, 0xfb000000, 0x00000000 },  // 23:03
+    { 0x0000001b, 0x0000f000, 0x00000000, 0x00000000, 0x0000000f, 0xfc000000, 0xfb000000, 0x00000000 },  // 23:04
+    { 0x0000001b, 0x0000000f, 0x00000000, 0x00000000, 0x0000000f, 0xfc000000, 0xfb000000, 0x00000000 },  // 23:05
+    { 0x0000001b, 0x00000000, 0x00070000, 0x00000000, 0x0000000f, 0xfc000000, 0xfb000000, 0x00000000 },  // 23:06
+    { 0x0000001b, 0x00000000, 0x00000000, 0x0000001f, 0x0000000f, 0xfc000000, 0xfb000000, 0x00000000 },  // 23:07
+    { 0x0000001b, 0x00000000, 0x1f000000, 0x00000000, 0x0000000f, 0xfc000000, 0xfb000000, 0x00000000 },  // 23:08
+    { 0x0000001b, 0x03c00000, 0x00000000, 0x00000000, 0x0000000f, 0xfc000000, 0xfb000000, 0x00000000 },  // 23:09
+    { 0x0070001b, 0x00000000, 0x00000000, 0x00000000, 0x0000000f, 0xfc000000, 0xfb000000, 0x00000000 },  // 23:10
+    { 0x0000001b, 0x000007e0, 0x00000000, 0x00000000, 0x0000000f, 0xfc000000, 0xfb000000, 0x00000000 },  // 23:11
+    { 0x0000001b, 0x00000000, 0x00000000, 0x0000fc00, 0x0000000f, 0xfc000000, 0xfb000000, 0x00000000 },  // 23:12
+    { 0xff00001b, 0x00000000, 0x00000000, 0x00000000, 0x0000000f, 0xfc000000, 0xfb000000, 0x00000000 },  // 23:13
+    { 0x0000001b, 0x00000000, 0x000000ff, 0x00000000, 0x0000000f, 0xfc000000, 0xfb000000, 0x00000000 },  // 23:14
+    { 0x0000001b, 0x00000000, 0x00000000, 0x1fc20000, 0x0000000f, 0xfc000000, 0xfb000000, 0x00000000 },  // 23:15
+    { 0x0000001b, 0x00000000, 0x007f0000, 0x00000000, 0x0000000f, 0xfc000000, 0xfb000000, 0x00000000 },  // 23:16
+    { 0x0000001b, 0x00000000, 0x00000000, 0x000001ff, 0x0000000f, 0xfc000000, 0xfb000000, 0x00000000 },  // 23:17
+    { 0x0000001b, 0x00000000, 0xff000000, 0x00000000, 0x0000000f, 0xfc000000, 0xfb000000, 0x00000000 },  // 23:18
+    { 0x0000001b, 0x3fc00000, 0x00000000, 0x00000000, 0x0000000f, 0xfc000000, 0xfb000000, 0x00000000 },  // 23:19
+    { 0x00000fdb, 0x00000000, 0x00000000, 0x00000000, 0x0000000f, 0xfc000000, 0xfb000000, 0x00000000 },  // 23:20
+    { 0x0000efdb, 0x00000000, 0x00000000, 0x00000000, 0x0000000f, 0xfc000000, 0xfb000000, 0x00000000 },  // 23:21
+    { 0x00070fdb, 0x00000000, 0x00000000, 0x00000000, 0x0000000f, 0xfc000000, 0xfb000000, 0x00000000 },  // 23:22
+    { 0x00000fdb, 0x001f0000, 0x00000000, 0x00000000, 0x0000000f, 0xfc000000, 0xfb000000, 0x00000000 },  // 23:23
+    { 0x00000fdb, 0x0000f000, 0x00000000, 0x00000000, 0x0000000f, 0xfc000000, 0xfb000000, 0x00000000 },  // 23:24
+    { 0x00000fdb, 0x0000000f, 0x00000000, 0x00000000, 0x0000000f, 0xfc000000, 0xfb000000, 0x00000000 },  // 23:25
+    { 0x00000fdb, 0x00000000, 0x00070000, 0x00000000, 0x0000000f, 0xfc000000, 0xfb000000, 0x00000000 },  // 23:26
+    { 0x00000fdb, 0x00000000, 0x00000000, 0x0000001f, 0x0000000f, 0xfc000000, 0xfb000000, 0x00000000 },  // 23:27
+    { 0x00000fdb, 0x00000000, 0x1f000000, 0x00000000, 0x0000000f, 0xfc000000, 0xfb000000, 0x00000000 },  // 23:28
+    { 0x00000fdb, 0x03c00000, 0x00000000, 0x00000000, 0x0000000f, 0xfc000000, 0xfb000000, 0x00000000 },  // 23:29
+    { 0x0000001b, 0x00000000, 0x00000000, 0x000f0000, 0x0000000f, 0xfc000000, 0xfb000000, 0x00000000 },  // 23:30
+    { 0x00000fdb, 0x03c00000, 0x00000000, 0xc0000000, 0x003f0000, 0x00000000, 0xfb000000, 0x00000000 },  // 23:31
+    { 0x00000fdb, 0x00000000, 0x1f000000, 0xc0000000, 0x003f0000, 0x00000000, 0xfb000000, 0x00000000 },  // 23:32
+    { 0x00000fdb, 0x00000000, 0x00000000, 0xc000001f, 0x003f0000, 0x00000000, 0xfb000000, 0x00000000 },  // 23:33
+    { 0x00000fdb, 0x00000000, 0x00070000, 0xc0000000, 0x003f0000, 0x00000000, 0xfb000000, 0x00000000 },  // 23:34
+    { 0x00000fdb, 0x0000000f, 0x00000000, 0xc0000000, 0x003f0000, 0x00000000, 0xfb000000, 0x00000000 },  // 23:35
+    { 0x00000fdb, 0x0000f000, 0x00000000, 0xc0000000, 0x003f0000, 0x00000000, 0xfb000000, 0x00000000 },  // 23:36
+    { 0x00000fdb, 0x001f0000, 0x00000000, 0xc0000000, 0x003f0000, 0x00000000, 0xfb000000, 0x00000000 },  // 23:37
+    { 0x00070fdb, 0x00000000, 0x00000000, 0xc0000000, 0x003f0000, 0x00000000, 0xfb000000, 0x00000000 },  // 23:38
+    { 0x0000efdb, 0x00000000, 0x00000000, 0xc0000000, 0x003f0000, 0x00000000, 0xfb000000, 0x00000000 },  // 23:39
+    { 0x00000fdb, 0x00000000, 0x00000000, 0xc0000000, 0x003f0000, 0x00000000, 0xfb000000, 0x00000000 },  // 23:40
+    { 0x0000001b, 0x3fc00000, 0x00000000, 0xc0000000, 0x003f0000, 0x00000000, 0xfb000000, 0x00000000 },  // 23:41
+    { 0x0000001b, 0x00000000, 0xff000000, 0xc0000000, 0x003f0000, 0x00000000, 0xfb000000, 0x00000000 },  // 23:42
+    { 0x0000001b, 0x00000000, 0x00000000, 0xc00001ff, 0x003f0000, 0x00000000, 0xfb000000, 0x00000000 },  // 23:43
+    { 0x0000001b, 0x00000000, 0x007f0000, 0xc0000000, 0x003f0000, 0x00000000, 0xfb000000, 0x00000000 },  // 23:44
+    { 0x0000001b, 0x00000000, 0x00000000, 0xdfc20000, 0x003f0000, 0x00000000, 0xfb000000, 0x00000000 },  // 23:45
+    { 0x0000001b, 0x00000000, 0x000000ff, 0xc0000000, 0x003f0000, 0x00000000, 0xfb000000, 0x00000000 },  // 23:46
+    { 0xff00001b, 0x00000000, 0x00000000, 0xc0000000, 0x003f0000, 0x00000000, 0xfb000000, 0x00000000 },  // 23:47
+    { 0x0000001b, 0x00000000, 0x00000000, 0xc000fc00, 0x003f0000, 0x00000000, 0xfb000000, 0x00000000 },  // 23:48
+    { 0x0000001b, 0x000007e0, 0x00000000, 0xc0000000, 0x003f0000, 0x00000000, 0xfb000000, 0x00000000 },  // 23:49
+    { 0x0070001b, 0x00000000, 0x00000000, 0xc0000000, 0x003f0000, 0x00000000, 0xfb000000, 0x00000000 },  // 23:50
+    { 0x0000001b, 0x03c00000, 0x00000000, 0xc0000000, 0x003f0000, 0x00000000, 0xfb000000, 0x00000000 },  // 23:51
+    { 0x0000001b, 0x00000000, 0x1f000000, 0xc0000000, 0x003f0000, 0x00000000, 0xfb000000, 0x00000000 },  // 23:52
+    { 0x0000001b, 0x00000000, 0x00000000, 0xc000001f, 0x003f0000, 0x00000000, 0xfb000000, 0x00000000 },  // 23:53
+    { 0x0000001b, 0x00000000, 0x00070000, 0xc0000000, 0x003f0000, 0x00000000, 0xfb000000, 0x00000000 },  // 23:54
+    { 0x0000001b, 0x0000000f, 0x00000000, 0xc0000000, 0x003f0000, 0x00000000, 0xfb000000, 0x00000000 },  // 23:55
+    { 0x0000001b, 0x0000f000, 0x00000000, 0xc0000000, 0x003f0000, 0x00000000, 0xfb000000, 0x00000000 },  // 23:56
+    { 0x0000001b, 0x001f0000, 0x00000000, 0xc0000000, 0x003f0000, 0x00000000, 0xfb000000, 0x00000000 },  // 23:57
+    { 0x0007001b, 0x00000000, 0x00000000, 0xc0000000, 0x003f0000, 0x00000000, 0xfb000000, 0x00000000 },  // 23:58
+    { 0x0000e01b, 0x00000000, 0x00000000, 0xc0000000, 0x003f0000, 0x00000000, 0xfb000000, 0x00000000 },  // 23:59
+};
@@ -0,0 +1,15 @@
+#pragma once
+
+#include <stdint.h>
+
+/*
+ * Phrase path of the word clock before the phrase compiler
+ * (main/wordclock/wordclock_phrases.h): every update built the sentence as
+ * a string and searched the letter grid for it word by word.
+ *
+ * Kept here unchanged as the reference the golden masks were generated
+ * from and as the baseline of bench_wordclock_phrases.
+ */
+
+// One byte per letter, 1 if lit
+void string_path_set_time(int hour, int minute, uint8_t bits[256]);
@@ -0,0 +1,131 @@
+#!/usr/bin/env python3
+"""Report where the firmware's static memory goes and check it against a budget.
+
+Sections of the linked ELF are summed per region (DRAM, IRAM, flash, PSRAM)
+and the largest symbols of each region are listed, so a change that moves a
+table from flash into RAM, or grows a buffer, shows up by name. With budgets
+given, the script exits with status 1 when a region is over its budget.
+
+Run through the build, which passes the toolchain objdump and the budgets
+from menuconfig ("Memory budget"):
+    cmake --build build --target memory_report
+
+Or by hand:
+    tools/memory_report.py --objdump xtensa-esp32s3-elf-objdump \\
+        --budget dram=90000 build/clock-fw.elf
+"""
+
+import argparse
+import re
+import subprocess
+import sys
+
+# Output section name prefixes of the ESP-IDF linker scripts, per region
+REGIONS = (
+    ("dram", (".dram0.data", ".dram0.bss", ".noinit", ".dram0.rodata")),
+    ("iram", (".iram0.text", ".iram0.vectors", ".iram0.data", ".iram0.bss", ".iram0.text_end")),
+    ("flash", (".flash.text", ".flash.rodata", ".flash.appdesc", ".flash.init_array", ".flash.tdata",
+               ".flash.tbss", ".flash.rodata_noload")),
+    ("psram", (".ext_ram.bss", ".ext_ram_noinit")),
+)
+
+# objdump -h: "  3 .dram0.data   00003a1c  3fc88000  3fc88000  000d1000  2**4"
+SECTION_RE = re.compile(r"^\s*\d+\s+(\S+)\s+([0-9a-fA-F]+)\s+[0-9a-fA-F]+")
+
+# objdump -t: "3fc8a0c4 l     O .dram0.bss	00000100 frame_buf"
+SYMBOL_RE = re.compile(r"^[0-9a-fA-F]+\s.{7}\s(\S+)\s+([0-9a-fA-F]+)\s+(.+)$")
+
+
+def region_of(section):
+    for region, prefixes in REGIONS:
+        if any(section == p or section.startswith(p + ".") for p in prefixes):
+            return region
+    return None
+
+
+def objdump(tool, flag, elf):
+    result = subprocess.run([tool, flag, elf], capture_output=True, text=True)
+    if result.returncode != 0:
+        sys.exit(f"{tool} {flag} failed: {result.stderr.strip()}")
+    return result.stdout.splitlines()
+
+
+def collect(tool, elf):
+    totals = {region: 0 for region, _ in REGIONS}
+    for line in objdump(tool, "-h", elf):
+        m = SECTION_RE.match(line)
+        if m and region_of(m.group(1)):
+            totals[region_of(m.group(1))] += int(m.group(2), 16)
+
+    symbols = {region: [] for region, _ in REGIONS}
+    for line in objdump(tool, "-t", elf):
+        m = SYMBOL_RE.match(line)
+        if not m:
+            continue
+        region = region_of(m.group(1))
+        size = int(m.group(2), 16)
+        if region and size > 0:
+            symbols[region].append((size, m.group(3).strip(), m.group(1)))
+
+    for entries in symbols.values():
+        entries.sort(key=lambda e: (-e[0], e[1]))
+    return totals, symbols
+
+
+def parse_budgets(values):
+    budgets = {}
+    for value in values:
+        region, _, limit = value.partition("=")
+        if region not in dict(REGIONS) or not limit.isdigit():
+            sys.exit(f"Bad budget '{value}', expected <dram|iram|flash|psram>=<bytes>")
+        # 0 means no limit, as in menuconfig
+        if int(limit) > 0:
+            budgets[region] = int(limit)
+    return budgets
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("elf", help="Linked firmware ELF")
+    parser.add_argument("--objdump", default="objdump", help="objdump of the target toolchain")
+    parser.add_argument("--variant", default="", help="Clock variant, for the report header")
+    parser.add_argument("--budget", action="append", default=[], metavar="REGION=BYTES",
+                        help="Fail when REGION uses more than BYTES; may be repeated")
+    parser.add_argument("--top", type=int, default=25, help="Symbols listed per region")
+    parser.add_argument("-o", "--output", help="Also write the report to this file")
+    args = parser.parse_args()
+
+    budgets = parse_budgets(args.budget)
+    totals, symbols = collect(args.objdump, args.elf)
+
+    lines = [f"Memory report{' for ' + args.variant if args.variant else ''}: {args.elf}", ""]
+    lines.append(f"{'region':<8}{'bytes':>10}{'budget':>10}")
+    over = []
+    for region, _ in REGIONS:
+        budget = budgets.get(region)
+        lines.append(f"{region:<8}{totals[region]:>10}{budget if budget else '-':>10}")
+        if budget and totals[region] > budget:
+            over.append(f"{region} uses {totals[region]} bytes, budget is {budget}")
+
+    for region, _ in REGIONS:
+        if not symbols[region] or args.top == 0:
+            continue
+        lines += ["", f"Largest {region} symbols:"]
+        for size, name, section in symbols[region][:args.top]:
+            lines.append(f"{size:>10}  {name}  ({section})")
+
+    report = "\n".join(lines) + "\n"
+    sys.stdout.write(report)
+    if args.output:
+        with open(args.output, "w") as f:
+            f.write(report)
+
+    if over:
+        for message in over:
+            print(f"error: {message}", file=sys.stderr)
+        return 1
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,188 @@
+#!/usr/bin/env python3
+"""Build a web UI bundle image for the webui flash partition.
+
+Packs a built clock-app directory (index.html, assets/...) into one image:
+every file gzip-compressed (files already ending in .gz are taken as is),
+optionally brotli-compressed as well, with a strong ETag per body and the
+same perfect hash path index the firmware uses for its built-in files.
+
+Usage:
+    tools/webui_bundle.py -o webui.bin --label v1.4.0 path/to/clock-app/dist
+    curl --data-binary @webui.bin http://<device>/api/webui
+or, for a device without a bundle yet:
+    parttool.py write_partition --partition-name webui --input webui.bin
+
+The image format is described in main/api/webui_bundle.h.
+"""
+
+import argparse
+import gzip
+import mimetypes
+import os
+import struct
+import sys
+import zlib
+
+sys.path.insert(0, os.path.join(os.path.dirname(os.path.abspath(__file__)), "..", "components", "clock-app"))
+import static_files_index  # noqa: E402
+
+MAGIC = 0x42495557  # "WUIB"
+VERSION = 1
+LABEL_LEN = 16
+ETAG_LEN = 20
+
+HEADER = struct.Struct("<IHHHHIII16sII")
+ENTRY = struct.Struct("<II" + "II20s" * 2)
+
+# The bundle can fill the whole webui partition
+PARTITION_TABLE = os.path.join(os.path.dirname(os.path.abspath(__file__)), "..", "partitions.csv")
+PARTITION_NAME = "webui"
+
+TYPES = {
+    ".js": "application/javascript",
+    ".mjs": "application/javascript",
+    ".json": "application/json",
+    ".svg": "image/svg+xml",
+    ".woff2": "font/woff2",
+    ".webmanifest": "application/manifest+json",
+}
+
+
+def partition_size(table, name):
+    """Size of a partition in an ESP-IDF partition table CSV."""
+    with open(table) as f:
+        for line in f:
+            fields = [field.strip() for field in line.split("#", 1)[0].split(",")]
+            if len(fields) >= 5 and fields[0] == name:
+                return int(fields[4], 0)
+    raise SystemExit("webui_bundle: no %s partition in %s" % (name, table))
+
+
+def align4(data):
+    return data + b"\0" * (-len(data) % 4)
+
+
+def collect(root, use_brotli):
+    """[(path, type, gzip_body, brotli_body or None)] sorted by path."""
+    if use_brotli:
+        try:
+            import brotli
+        except ImportError:
+            raise SystemExit("webui_bundle: --brotli needs the brotli module (pip install brotli)")
+
+    # A build with a compression plugin leaves app.js next to app.js.gz;
+    # both would serve /app.js, so the precompressed one wins
+    sources = {}
+    for directory, _, names in os.walk(root):
+        for name in names:
+            full = os.path.join(directory, name)
+            rel = os.path.relpath(full, root).replace(os.sep, "/")
+            path = rel[:-3] if rel.endswith(".gz") else rel
+            if path in sources:
+                gz, plain = (rel, sources[path]) if rel.endswith(".gz") else (sources[path], rel)
+                print("webui_bundle: /%s: using %s, not %s" % (path, gz, plain), file=sys.stderr)
+                rel = gz
+            sources[path] = rel
+
+    files = []
+    for rel in sources.values():
+        with open(os.path.join(root, rel), "rb") as f:
+            data = f.read()
+
+        if rel.endswith(".gz"):
+            rel = rel[:-3]
+            body = data
+            plain = gzip.decompress(data) if use_brotli else None
+        else:
+            body = gzip.compress(data, compresslevel=9, mtime=0)
+            plain = data
+
+        ext = os.path.splitext(rel)[1].lower()
+        mime = TYPES.get(ext) or mimetypes.guess_type(rel)[0] or "application/octet-stream"
+
+        encoded = None
+        if use_brotli:
+            candidate = brotli.compress(plain, quality=11)
+            if len(candidate) < len(body):
+                encoded = candidate
+
+        files.append(("/" + rel, mime, body, encoded))
+
+    files.sort(key=lambda f: f[0])
+    return files
+
+
+def build_image(files, label):
+    if not files:
+        raise SystemExit("webui_bundle: no files found")
+    if len(files) > 0x7FFF:
+        raise SystemExit("webui_bundle: too many files")
+
+    try:
+        displacements, slots = static_files_index.build([path for path, _, _, _ in files])
+    except ValueError as e:
+        raise SystemExit("webui_bundle: %s" % e)
+
+    # Layout: header, entries, index, strings, bodies
+    index_offset = HEADER.size + ENTRY.size * len(files)
+    strings_offset = index_offset + 2 * (len(displacements) + len(slots))
+
+    strings = b""
+    string_offsets = []
+    for path, mime, _, _ in files:
+        path_offset = strings_offset + len(strings)
+        strings += path.encode() + b"\0"
+        type_offset = strings_offset + len(strings)
+        strings += mime.encode() + b"\0"
+        string_offsets.append((path_offset, type_offset))
+    strings = align4(strings)
+
+    bodies = b""
+    entries = b""
+    bodies_offset = strings_offset + len(strings)
+    for (path, mime, gzip_body, brotli_body), (path_offset, type_offset) in zip(files, string_offsets):
+        fields = [path_offset, type_offset]
+        for body in (gzip_body, brotli_body):
+            if body is None:
+                fields += [0, 0, b""]
+                continue
+            fields += [bodies_offset + len(bodies), len(body), static_files_index.etag(body).encode()]
+            bodies = align4(bodies + body)
+        entries += ENTRY.pack(*fields)
+
+    index = struct.pack("<%dH" % len(displacements), *displacements) + struct.pack("<%dh" % len(slots), *slots)
+    body = entries + index + strings + bodies
+    assert HEADER.size + len(entries) + len(index) == strings_offset
+
+    label_bytes = label.encode()[:LABEL_LEN]
+    header = HEADER.pack(MAGIC, VERSION, len(files), len(displacements), len(slots), 0, len(body),
+        zlib.crc32(body), label_bytes, 0, 0)
+    header = header[:-4] + struct.pack("<I", zlib.crc32(header[:-4]))
+    return header + body
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("root", help="built web UI directory")
+    parser.add_argument("-o", "--output", required=True, help="bundle image to write")
+    parser.add_argument("--label", default="", help="version label shown by GET /api/webui (max 16 chars)")
+    parser.add_argument("--brotli", action="store_true", help="add brotli bodies where smaller than gzip")
+    parser.add_argument("--capacity", type=lambda v: int(v, 0),
+        help="bundle capacity on the device (default: size of the webui partition in partitions.csv)")
+    args = parser.parse_args()
+
+    capacity = args.capacity or partition_size(PARTITION_TABLE, PARTITION_NAME)
+    files = collect(args.root, args.brotli)
+    image = build_image(files, args.label)
+    if len(image) > capacity:
+        print("webui_bundle: image is %d bytes, the partition holds %d" % (len(image), capacity), file=sys.stderr)
+        return 1
+
+    with open(args.output, "wb") as f:
+        f.write(image)
+    print("webui_bundle: %d files, %d bytes (%d%% of the partition)" % (len(files), len(image), 100 * len(image) // capacity))
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,180 @@
+#!/usr/bin/env python3
+"""Build a word clock grid layout image for the grid flash partition.
+
+Each layout is described by a JSON file (see wordclock_grids/en_16x16.json):
+the letter grid, the phrase for every minute and hour, and how the LED chain
+is wired behind the letters. Phrases are resolved to packed letter masks here,
+exactly as the firmware's built-in compiler does, so the clock only ever does
+table lookups.
+
+Wiring keys: "rotation" (0/90/180/270, clockwise) and "mirror" describe how
+the LED panel sits behind the letters, "serpentine" that every other LED row
+runs right to left.
+
+Usage:
+    tools/wordclock_grid.py -o grid.bin tools/wordclock_grids/en_16x16.json
+    parttool.py write_partition --partition-name fs --input grid.bin
+
+The image format is described in main/wordclock/wordclock_grid.h.
+"""
+
+import argparse
+import json
+import struct
+import sys
+import zlib
+
+GRID_SIZE = 256
+MAGIC = 0x52474357  # "WCGR"
+VERSION = 1
+NAME_LEN = 24
+
+CONNECTOR_NONE = 0
+CONNECTOR_PAST = 1
+CONNECTOR_TO = 2
+CONNECTOR_COUNT = 3
+
+
+class LayoutError(Exception):
+    pass
+
+
+class Phrase:
+    """Lights words in order, each search starting after the previous match."""
+
+    def __init__(self, letters, cursor=0):
+        self.letters = letters
+        self.cursor = cursor
+        self.mask = 0
+
+    def add(self, text):
+        for word in text.split():
+            pos = self.letters.find(word, self.cursor)
+            if pos < 0:
+                raise LayoutError(f"'{word}' not found after position {self.cursor}")
+            for i in range(pos, pos + len(word)):
+                self.mask |= 1 << i
+            self.cursor = pos + len(word)
+        return self
+
+
+def pack_mask(mask):
+    return struct.pack("<8I", *((mask >> (32 * i)) & 0xFFFFFFFF for i in range(8)))
+
+
+def led_index_table(rows, cols, wiring):
+    """Map each letter (reading order) to its LED position on the chain."""
+    rotation = wiring.get("rotation", 0)
+    mirror = wiring.get("mirror", False)
+    serpentine = wiring.get("serpentine", False)
+    if rotation not in (0, 90, 180, 270):
+        raise LayoutError(f"rotation must be 0, 90, 180 or 270, not {rotation}")
+
+    prows, pcols = (cols, rows) if rotation in (90, 270) else (rows, cols)
+    table = []
+    for row in range(rows):
+        for col in range(cols):
+            r, c = row, (cols - 1 - col if mirror else col)
+            if rotation == 90:
+                r, c = c, rows - 1 - r
+            elif rotation == 180:
+                r, c = rows - 1 - r, cols - 1 - c
+            elif rotation == 270:
+                r, c = cols - 1 - c, r
+            if serpentine and r % 2 == 1:
+                c = pcols - 1 - c
+            table.append(r * pcols + c)
+
+    if sorted(table) != list(range(GRID_SIZE)):
+        raise LayoutError("wiring does not map every letter to a unique LED")
+    return table
+
+
+def compile_layout(layout):
+    rows, cols = layout["rows"], layout["cols"]
+    letters = "".join(layout["letters"])
+    if rows * cols != GRID_SIZE or len(letters) != GRID_SIZE:
+        raise LayoutError(f"grid must have {GRID_SIZE} letters")
+    if not letters.isascii():
+        raise LayoutError("letters must be ASCII")
+
+    phrases = layout["phrases"]
+    minutes = phrases["minutes"]
+    hours = phrases["hours"]
+    next_hour_from = phrases["next_hour_from"]
+    if len(minutes) != 60 or len(hours) != 12:
+        raise LayoutError("need 60 minute phrases and 12 hour words")
+
+    def connector_for(minute):
+        if minute == 0:
+            return CONNECTOR_NONE
+        return CONNECTOR_TO if minute >= next_hour_from else CONNECTOR_PAST
+
+    def period_for(hour):
+        words = None
+        for period in phrases["periods"]:
+            if hour >= period["from"]:
+                words = period["words"]
+        return words or ""
+
+    midnight = Phrase(letters).add(phrases["prefix"]).add(phrases["midnight"])
+
+    # The hour part may only depend on the connector
+    minute_masks, connectors = [], []
+    cursors = [None] * CONNECTOR_COUNT
+    for minute, text in enumerate(minutes):
+        phrase = Phrase(letters).add(phrases["prefix"]).add(text)
+        connector = connector_for(minute)
+        if cursors[connector] is None:
+            cursors[connector] = phrase.cursor
+        elif cursors[connector] != phrase.cursor:
+            raise LayoutError(f"minute {minute} ends at a different place than other minutes using its connector")
+        minute_masks.append(phrase.mask)
+        connectors.append(connector)
+
+    hour_masks = []
+    for connector in range(CONNECTOR_COUNT):
+        for hour in range(24):
+            cursor = cursors[connector] or 0
+            hour_masks.append(Phrase(letters, cursor).add(hours[hour % 12]).add(period_for(hour)).mask)
+
+    name = layout["name"].encode("ascii")
+    if len(name) > NAME_LEN:
+        raise LayoutError(f"name longer than {NAME_LEN} characters")
+
+    out = bytearray(name.ljust(NAME_LEN, b"\0"))
+    out += pack_mask(midnight.mask)
+    for mask in minute_masks + hour_masks:
+        out += pack_mask(mask)
+    out += bytes(connectors)
+    out += bytes(led_index_table(rows, cols, layout.get("wiring", {})))
+    out += letters.encode("ascii")
+    return bytes(out)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("layouts", nargs="+", help="layout JSON files")
+    parser.add_argument("-o", "--output", required=True, help="image file to write")
+    parser.add_argument("--active", type=int, default=0, help="index of the layout shown by default")
+    args = parser.parse_args()
+
+    if not 0 <= args.active < len(args.layouts):
+        parser.error("--active must index one of the given layouts")
+
+    body = b""
+    for path in args.layouts:
+        with open(path) as f:
+            try:
+                body += compile_layout(json.load(f))
+            except (LayoutError, KeyError) as e:
+                sys.exit(f"{path}: {e}")
+
+    header = struct.pack("<IHHHHI", MAGIC, VERSION, len(args.layouts), args.active, 0, zlib.crc32(body))
+    with open(args.output, "wb") as f:
+        f.write(header + body)
+    print(f"Wrote {len(args.layouts)} layout(s), {len(header) + len(body)} bytes to {args.output}")
+
+
+if __name__ == "__main__":
+    main()